@@ -10,6 +10,11 @@ public class EROEOREOREORTarget : TargetRules
 		Type = TargetType.Game;
 		DefaultBuildSettings = BuildSettingsVersion.V5;
 
+		// Combat components and attribute sets replicate push-based (net.IsPushModelEnabled in DefaultEngine.ini).
+		// Push model changes engine modules, so the target cannot share the installed engine's build environment.
+		bWithPushModel = true;
+		BuildEnvironment = TargetBuildEnvironment.Unique;
+
 		ExtraModuleNames.AddRange( new string[] { "EROEOREOREOR" } );
 	}
 }
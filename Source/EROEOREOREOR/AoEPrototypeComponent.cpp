@@ -1,5 +1,11 @@
 #include "AoEPrototypeComponent.h"
 #include "MyCharacter.h"
+#include "CombatLagCompensation.h"
+#include "CombatMathKernels.h"
+#include "CombatStats.h"
+#include "CombatLog.h"
+#include "CombatMemory.h"
+#include "CombatWorkScheduler.h"
 #include "Engine/Engine.h"
 #include "Engine/World.h"
 #include "DrawDebugHelpers.h"
@@ -7,6 +13,9 @@
 #include "Kismet/KismetMathLibrary.h"
 #include "Kismet/KismetSystemLibrary.h"
 
+static_assert(static_cast<int32>(ECombatGauge::AoETraveling) - static_cast<int32>(ECombatGauge::AoEInstant) == static_cast<int32>(EAoEBehavior::Traveling),
+    "AoE gauges must follow EAoEBehavior order");
+
 UAoEPrototypeComponent::UAoEPrototypeComponent()
 {
     PrimaryComponentTick.bCanEverTick = true;
@@ -25,13 +34,16 @@ void UAoEPrototypeComponent::BeginPlay()
     
     if (bDebugEnabled)
     {
-        UE_LOG(LogTemp, Log, TEXT("AoEPrototypeComponent initialized for %s"), 
+        UE_LOG(LogAoE, Verbose, TEXT("AoEPrototypeComponent initialized for %s"), 
                GetOwner() ? *GetOwner()->GetName() : TEXT("NULL"));
     }
 }
 
 void UAoEPrototypeComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
+    COMBAT_SCOPE(AoETick);
+    LLM_SCOPE_BYTAG(Combat_AoE);
+    
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
     
     if (ActiveAoEs.Num() > 0)
@@ -49,12 +61,14 @@ void UAoEPrototypeComponent::StartAoE(const FString& PrototypeName)
     }
     else
     {
-        UE_LOG(LogTemp, Warning, TEXT("AoE prototype '%s' not found!"), *PrototypeName);
+        UE_LOG(LogAoE, Warning, TEXT("AoE prototype '%s' not found!"), *PrototypeName);
     }
 }
 
 void UAoEPrototypeComponent::StartAoEWithData(const FAoEPrototypeData& AoEData)
 {
+    LLM_SCOPE_BYTAG(Combat_AoE);
+    
     FActiveAoE NewAoE;
     NewAoE.Name = AoEData.PrototypeName;
     NewAoE.Data = AoEData;
@@ -68,7 +82,7 @@ void UAoEPrototypeComponent::StartAoEWithData(const FAoEPrototypeData& AoEData)
     
     if (bDebugEnabled)
     {
-        UE_LOG(LogTemp, Log, TEXT("Started AoE: %s at location %s"), 
+        UE_LOG(LogAoE, Verbose, TEXT("Started AoE: %s at location %s"), 
                *AoEData.PrototypeName, *NewAoE.Location.ToString());
     }
 }
@@ -90,7 +104,7 @@ void UAoEPrototypeComponent::StartAoEAtLocation(const FString& PrototypeName, co
         
         if (bDebugEnabled)
         {
-            UE_LOG(LogTemp, Log, TEXT("Started AoE: %s at custom location %s"), 
+            UE_LOG(LogAoE, Verbose, TEXT("Started AoE: %s at custom location %s"), 
                    *PrototypeName, *Location.ToString());
         }
     }
@@ -113,7 +127,7 @@ void UAoEPrototypeComponent::StopAoE(const FString& PrototypeName)
             ActiveAoEs.RemoveAt(i);
             if (bDebugEnabled)
             {
-                UE_LOG(LogTemp, Log, TEXT("Stopped AoE: %s"), *PrototypeName);
+                UE_LOG(LogAoE, Verbose, TEXT("Stopped AoE: %s"), *PrototypeName);
             }
         }
     }
@@ -126,7 +140,7 @@ void UAoEPrototypeComponent::StopAllAoEs()
     
     if (bDebugEnabled && StoppedCount > 0)
     {
-        UE_LOG(LogTemp, Log, TEXT("Stopped %d active AoEs"), StoppedCount);
+        UE_LOG(LogAoE, Verbose, TEXT("Stopped %d active AoEs"), StoppedCount);
     }
 }
 
@@ -154,9 +168,11 @@ bool UAoEPrototypeComponent::IsAoEActive(const FString& PrototypeName) const
 
 void UAoEPrototypeComponent::LoadAoEData(UDataTable* DataTable)
 {
+    LLM_SCOPE_BYTAG(Combat_Data);
+    
     if (!DataTable)
     {
-        UE_LOG(LogTemp, Warning, TEXT("Cannot load null AoE data table"));
+        UE_LOG(LogAoE, Warning, TEXT("Cannot load null AoE data table"));
         return;
     }
     
@@ -175,7 +191,7 @@ void UAoEPrototypeComponent::LoadAoEData(UDataTable* DataTable)
     
     if (bDebugEnabled)
     {
-        UE_LOG(LogTemp, Log, TEXT("Loaded %d AoE prototypes"), LoadedAoEPrototypes.Num());
+        UE_LOG(LogAoE, Log, TEXT("Loaded %d AoE prototypes"), LoadedAoEPrototypes.Num());
     }
 }
 
@@ -212,7 +228,7 @@ void UAoEPrototypeComponent::ModifyAoEShapeData(const FString& PrototypeName, co
         
         if (bDebugEnabled)
         {
-            UE_LOG(LogTemp, Log, TEXT("Modified shape data for AoE: %s"), *PrototypeName);
+            UE_LOG(LogAoE, Log, TEXT("Modified shape data for AoE: %s"), *PrototypeName);
         }
     }
 }
@@ -234,7 +250,7 @@ void UAoEPrototypeComponent::ModifyAoEBehaviorData(const FString& PrototypeName,
         
         if (bDebugEnabled)
         {
-            UE_LOG(LogTemp, Log, TEXT("Modified behavior data for AoE: %s"), *PrototypeName);
+            UE_LOG(LogAoE, Log, TEXT("Modified behavior data for AoE: %s"), *PrototypeName);
         }
     }
 }
@@ -252,7 +268,7 @@ void UAoEPrototypeComponent::TestAoEPrototype(const FString& PrototypeName)
     }
     else
     {
-        UE_LOG(LogTemp, Warning, TEXT("AoE prototype '%s' not found for testing"), *PrototypeName);
+        UE_LOG(LogAoE, Warning, TEXT("AoE prototype '%s' not found for testing"), *PrototypeName);
     }
 }
 
@@ -268,7 +284,7 @@ void UAoEPrototypeComponent::PreviewAoEShape(const FString& PrototypeName)
         
         if (bDebugEnabled)
         {
-            UE_LOG(LogTemp, Log, TEXT("Previewing AoE shape: %s"), *PrototypeName);
+            UE_LOG(LogAoE, Log, TEXT("Previewing AoE shape: %s"), *PrototypeName);
         }
     }
 }
@@ -281,6 +297,7 @@ void UAoEPrototypeComponent::UpdateActiveAoEs(float DeltaTime)
     {
         if (AoE.bIsActive)
         {
+            COMBAT_GAUGE_ADD(static_cast<ECombatGauge>(static_cast<int32>(ECombatGauge::AoEInstant) + static_cast<int32>(AoE.Data.BehaviorData.Behavior)), 1);
             UpdateAoE(AoE, DeltaTime);
         }
     }
@@ -289,11 +306,12 @@ void UAoEPrototypeComponent::UpdateActiveAoEs(float DeltaTime)
 void UAoEPrototypeComponent::UpdateAoE(FActiveAoE& AoE, float DeltaTime)
 {
     AoE.ElapsedTime += DeltaTime;
+    AoE.HitTime = AoE.ElapsedTime;
     
     // Handle start delay
     if (AoE.ElapsedTime < AoE.Data.BehaviorData.StartDelay)
     {
-        if (bDebugEnabled && AoE.Data.bDebugVisualization)
+        if (ShouldDrawDebug(AoE))
         {
             // Draw delayed AoE preview
             DrawShapeDebug(AoE.Data.ShapeData, AoE.Location, 
@@ -338,7 +356,7 @@ void UAoEPrototypeComponent::UpdateAoE(FActiveAoE& AoE, float DeltaTime)
     }
     
     // Draw debug visualization
-    if (bDebugEnabled && AoE.Data.bDebugVisualization)
+    if (ShouldDrawDebug(AoE))
     {
         DrawAoEDebugVisualization(AoE);
     }
@@ -381,7 +399,7 @@ void UAoEPrototypeComponent::UpdateProjectileAoE(FActiveAoE& AoE, float DeltaTim
         }
         
         // Draw projectile
-        if (bDebugEnabled && AoE.Data.bDebugVisualization)
+        if (ShouldDrawDebug(AoE))
         {
             DrawDebugSphere(GetWorld(), AoE.ProjectileLocation, 20.0f, 8, 
                            AoE.Data.DebugColor.ToFColor(false), false, -1.0f);
@@ -400,12 +418,16 @@ void UAoEPrototypeComponent::UpdateExpandingAoE(FActiveAoE& AoE, float DeltaTime
 {
     // Calculate current radius based on expansion
     float CurrentRadius = CalculateCurrentRadius(AoE);
+    const bool bFullyExpanded = CurrentRadius >= AoE.Data.ShapeData.Radius;
     
-    // Check hits continuously as it expands
-    CheckAoEHits(AoE);
+    // Check hits continuously as it expands - the final radius is always tested, it covers every skipped one
+    if (bFullyExpanded || ShouldQueryThisFrame(AoE))
+    {
+        CheckAoEHits(AoE);
+    }
     
     // Complete when fully expanded
-    if (CurrentRadius >= AoE.Data.ShapeData.Radius)
+    if (bFullyExpanded)
     {
         AoE.bIsActive = false;
     }
@@ -424,25 +446,68 @@ void UAoEPrototypeComponent::UpdateTravelingAoE(FActiveAoE& AoE, float DeltaTime
     AoE.Location += TravelDirection * TravelDistance;
     
     // Check hits at current location
-    CheckAoEHits(AoE);
+    if (ShouldQueryThisFrame(AoE))
+    {
+        CheckAoEHits(AoE);
+    }
 }
 
 void UAoEPrototypeComponent::UpdatePersistentAoE(FActiveAoE& AoE, float DeltaTime)
 {
-    // Check hits based on hit interval
-    static float LastHitTime = 0.0f;
-    if (AoE.ElapsedTime - LastHitTime >= AoE.Data.DamageData.HitInterval)
+    if (AoE.NextTickTime < 0.0f)
+    {
+        AoE.NextTickTime = AoE.ElapsedTime;
+    }
+    
+    if (AoE.ElapsedTime < AoE.NextTickTime)
+        return;
+    
+    // FRAME BUDGET: Field ticks are the first work to wait when combat is over budget
+    UCombatWorkScheduler* Scheduler = UCombatWorkScheduler::Get(GetWorld());
+    if (Scheduler && UCombatWorkScheduler::IsBudgetEnabled())
+    {
+        const ECombatWorkPriority Priority = Scheduler->GetPriority(GetOwner(), AoE.Location, true);
+        if (!Scheduler->TryAdmit(Priority, AoE.DeferredFrames))
+            return;
+    }
+    
+    UCombatWorkScheduler::FScopedWork Work(Scheduler);
+    
+    const float Interval = AoE.Data.DamageData.HitInterval;
+    if (Interval <= 0.0f)
     {
+        // No interval - tick every frame
         CheckAoEHits(AoE);
-        LastHitTime = AoE.ElapsedTime;
+        AoE.NextTickTime = AoE.ElapsedTime;
+        return;
     }
+    
+    // Every tick owed since the last one, stamped at its grid time - a deferred tick lands late, against whoever is inside now
+    const int32 OwedTicks = FMath::FloorToInt((AoE.ElapsedTime - AoE.NextTickTime) / Interval) + 1;
+    AoE.HitTime = AoE.NextTickTime;
+    CheckAoEHits(AoE, OwedTicks, Interval);
+    AoE.NextTickTime += OwedTicks * Interval;
+    AoE.HitTime = AoE.ElapsedTime;
 }
 
-void UAoEPrototypeComponent::CheckAoEHits(FActiveAoE& AoE)
+void UAoEPrototypeComponent::CheckAoEHits(FActiveAoE& AoE, int32 TickCount, float TickInterval)
 {
+    COMBAT_SCOPE(CheckAoEHits);
+    
     if (!GetWorld())
         return;
     
+    // LAG COMPENSATION: Cast-relative AoEs from remote players test victims where the caster saw them
+    if (const UCombatLagCompensationSubsystem* LagCompensation = UCombatLagCompensationSubsystem::Get(GetWorld()))
+    {
+        const EAoEBehavior Behavior = AoE.Data.BehaviorData.Behavior;
+        if ((Behavior == EAoEBehavior::Instant || Behavior == EAoEBehavior::Expanding) && LagCompensation->ShouldRewindFor(GetOwner()))
+        {
+            CheckRewoundAoEHits(*LagCompensation, AoE);
+            return;
+        }
+    }
+    
     // Get all pawns in range
     TArray<FHitResult> HitResults;
     TArray<TEnumAsByte<EObjectTypeQuery>> ObjectTypes;
@@ -460,11 +525,15 @@ void UAoEPrototypeComponent::CheckAoEHits(FActiveAoE& AoE)
         ObjectTypes,
         false,
         ActorsToIgnore,
-        bDebugEnabled ? EDrawDebugTrace::ForOneFrame : EDrawDebugTrace::None,
+        bDebugEnabled && CombatLod == ECombatLod::Full ? EDrawDebugTrace::ForOneFrame : EDrawDebugTrace::None,
         HitResults,
         true
     );
     
+    COMBAT_COUNTER_ADD(Queries, 1);
+    COMBAT_COUNTER_ADD(Candidates, HitResults.Num());
+    COMBAT_COUNTER_ADD(Allocations, HitResults.Max() > 0 ? 1 : 0);
+    
     if (bHit)
     {
         for (const FHitResult& Hit : HitResults)
@@ -477,186 +546,134 @@ void UAoEPrototypeComponent::CheckAoEHits(FActiveAoE& AoE)
             FVector HitLocation;
             if (IsActorInAoE(AoE, HitActor, HitLocation))
             {
-                // Check hit count limits
-                int32* HitCount = AoE.ActorHitCounts.Find(HitActor);
-                int32 CurrentHitCount = HitCount ? *HitCount : 0;
-                
-                if (CurrentHitCount < AoE.Data.DamageData.MaxHitsPerActor || AoE.Data.DamageData.MaxHitsPerActor <= 0)
+                const float FirstHitTime = AoE.HitTime;
+                for (int32 Tick = 0; Tick < TickCount; ++Tick)
                 {
-                    // Check hit interval for multi-hit
-                    if (AoE.Data.DamageData.bAllowMultipleHits)
-                    {
-                        float* LastHitTime = AoE.LastHitTimes.Find(HitActor);
-                        float CurrentTime = GetWorld()->GetTimeSeconds();
-                        
-                        if (!LastHitTime || CurrentTime - *LastHitTime >= AoE.Data.DamageData.HitInterval)
-                        {
-                            // Apply damage
-                            float DamageAmount = CalculateDamageAtLocation(AoE, HitLocation);
-                            
-                            // Update hit tracking
-                            AoE.ActorHitCounts.Add(HitActor, CurrentHitCount + 1);
-                            AoE.LastHitTimes.Add(HitActor, CurrentTime);
-                            
-                            // Broadcast hit event
-                            OnAoEHit.Broadcast(HitActor, HitLocation, DamageAmount);
-                            
-                            if (bDebugEnabled)
-                            {
-                                UE_LOG(LogTemp, Log, TEXT("AoE '%s' hit %s for %.1f damage"), 
-                                       *AoE.Name, *HitActor->GetName(), DamageAmount);
-                            }
-                        }
-                    }
-                    else if (!AoE.HitActors.Contains(HitActor))
-                    {
-                        // Single hit per actor
-                        float DamageAmount = CalculateDamageAtLocation(AoE, HitLocation);
-                        
-                        AoE.HitActors.Add(HitActor);
-                        AoE.ActorHitCounts.Add(HitActor, 1);
-                        
-                        // Broadcast hit event
-                        OnAoEHit.Broadcast(HitActor, HitLocation, DamageAmount);
-                        
-                        if (bDebugEnabled)
-                        {
-                            UE_LOG(LogTemp, Log, TEXT("AoE '%s' hit %s for %.1f damage"), 
-                                   *AoE.Name, *HitActor->GetName(), DamageAmount);
-                        }
-                    }
+                    AoE.HitTime = FirstHitTime + Tick * TickInterval;
+                    ApplyAoEHit(AoE, HitActor, HitLocation);
                 }
+                AoE.HitTime = FirstHitTime;
             }
         }
     }
 }
 
-bool UAoEPrototypeComponent::IsActorInAoE(const FActiveAoE& AoE, AActor* Actor, FVector& OutHitLocation) const
+void UAoEPrototypeComponent::CheckRewoundAoEHits(const UCombatLagCompensationSubsystem& LagCompensation, FActiveAoE& AoE)
 {
-    if (!Actor)
-        return false;
+    const FAoEShapeData& Shape = AoE.Data.ShapeData;
+    const FVector Forward = GetOwner() ? GetOwner()->GetActorForwardVector() : FVector::ForwardVector;
+    const double RewindTime = GetWorld()->GetTimeSeconds() - LagCompensation.GetRewindSeconds(GetOwner());
     
-    FVector ActorLocation = Actor->GetActorLocation();
-    FVector Forward = GetOwner() ? GetOwner()->GetActorForwardVector() : FVector::ForwardVector;
+    // Broad phase must cover every shape the point test accepts
+    const float Reach = FMath::Max3(Shape.Radius, Shape.Dimensions.Size() * 0.5f, Shape.Length + Shape.Width * 0.5f);
     
-    OutHitLocation = ActorLocation;
+    RewoundVolumes.Reset();
+    LagCompensation.GatherVolumesAtTime(RewindTime, AoE.Location, Reach, GetOwner(), RewoundVolumes);
+    COMBAT_COUNTER_ADD(Candidates, RewoundVolumes.Num());
     
-    return IsPointInShape(AoE.Data.ShapeData, ActorLocation, AoE.Location, Forward);
+    // Same point test as IsActorInAoE, against the rewound location
+    for (const FLagCompensatedVolume& Volume : RewoundVolumes)
+    {
+        if (IsPointInShape(Shape, Volume.Center, AoE.Location, Forward))
+        {
+            ApplyAoEHit(AoE, Volume.Actor, Volume.Center);
+        }
+    }
 }
 
-bool UAoEPrototypeComponent::IsPointInShape(const FAoEShapeData& Shape, const FVector& Point, const FVector& Center, const FVector& Forward) const
+void UAoEPrototypeComponent::ApplyAoEHit(FActiveAoE& AoE, AActor* HitActor, const FVector& HitLocation)
 {
-    FVector LocalPoint = Point - Center;
-    float Distance2D = FVector2D(LocalPoint.X, LocalPoint.Y).Size();
+    COMBAT_SCOPE(ApplyAoEHit);
     
-    switch (Shape.Shape)
+    // Check hit count limits
+    int32* HitCount = AoE.ActorHitCounts.Find(HitActor);
+    int32 CurrentHitCount = HitCount ? *HitCount : 0;
+    
+    if (CurrentHitCount >= AoE.Data.DamageData.MaxHitsPerActor && AoE.Data.DamageData.MaxHitsPerActor > 0)
+        return;
+    
+    // Check hit interval for multi-hit
+    if (AoE.Data.DamageData.bAllowMultipleHits)
     {
-        case EAoEShape::Circle:
-        {
-            return Distance2D <= Shape.Radius;
-        }
-        
-        case EAoEShape::Ring:
-        {
-            return Distance2D >= Shape.InnerRadius && Distance2D <= Shape.Radius;
-        }
-        
-        case EAoEShape::Cone:
-        {
-            if (Distance2D > Shape.Radius)
-                return false;
-                
-            FVector ToPoint = LocalPoint.GetSafeNormal();
-            float Dot = FVector::DotProduct(Forward, ToPoint);
-            float AngleDegrees = FMath::RadiansToDegrees(FMath::Acos(Dot));
-            
-            return AngleDegrees <= Shape.Angle * 0.5f;
-        }
+        float* LastHitTime = AoE.LastHitTimes.Find(HitActor);
+        const float CurrentTime = AoE.HitTime;
         
-        case EAoEShape::Rectangle:
+        // Tolerance keeps grid-spaced catch-up ticks from failing the interval on float rounding
+        if (!LastHitTime || CurrentTime - *LastHitTime >= AoE.Data.DamageData.HitInterval - KINDA_SMALL_NUMBER)
         {
-            FVector Right = FVector::CrossProduct(Forward, FVector::UpVector);
+            // Apply damage
+            float DamageAmount = CalculateDamageAtLocation(AoE, HitLocation);
             
-            float ForwardDist = FVector::DotProduct(LocalPoint, Forward);
-            float RightDist = FVector::DotProduct(LocalPoint, Right);
+            // Update hit tracking
+            AoE.ActorHitCounts.Add(HitActor, CurrentHitCount + 1);
+            AoE.LastHitTimes.Add(HitActor, CurrentTime);
             
-            return FMath::Abs(ForwardDist) <= Shape.Dimensions.X * 0.5f &&
-                   FMath::Abs(RightDist) <= Shape.Dimensions.Y * 0.5f;
-        }
-        
-        case EAoEShape::Line:
-        {
-            FVector Right = FVector::CrossProduct(Forward, FVector::UpVector);
+            COMBAT_COUNTER_ADD(Hits, 1);
             
-            float ForwardDist = FVector::DotProduct(LocalPoint, Forward);
-            float RightDist = FVector::DotProduct(LocalPoint, Right);
+            // Broadcast hit event
+            OnAoEHit.Broadcast(HitActor, HitLocation, DamageAmount);
             
-            return ForwardDist >= 0 && ForwardDist <= Shape.Length &&
-                   FMath::Abs(RightDist) <= Shape.Width * 0.5f;
+            if (bDebugEnabled)
+            {
+                UE_LOG(LogAoE, VeryVerbose, TEXT("AoE '%s' hit %s for %.1f damage"), 
+                       *AoE.Name, *HitActor->GetName(), DamageAmount);
+            }
         }
+    }
+    else if (!AoE.HitActors.Contains(HitActor))
+    {
+        // Single hit per actor
+        float DamageAmount = CalculateDamageAtLocation(AoE, HitLocation);
         
-        case EAoEShape::Sector:
+        AoE.HitActors.Add(HitActor);
+        AoE.ActorHitCounts.Add(HitActor, 1);
+        
+        COMBAT_COUNTER_ADD(Hits, 1);
+        
+        // Broadcast hit event
+        OnAoEHit.Broadcast(HitActor, HitLocation, DamageAmount);
+        
+        if (bDebugEnabled)
         {
-            if (Distance2D < Shape.InnerRadius || Distance2D > Shape.Radius)
-                return false;
-                
-            FVector ToPoint = LocalPoint.GetSafeNormal();
-            float Dot = FVector::DotProduct(Forward, ToPoint);
-            float AngleDegrees = FMath::RadiansToDegrees(FMath::Acos(Dot));
-            
-            return AngleDegrees <= Shape.Angle * 0.5f;
+            UE_LOG(LogAoE, VeryVerbose, TEXT("AoE '%s' hit %s for %.1f damage"), 
+                   *AoE.Name, *HitActor->GetName(), DamageAmount);
         }
-        
-        default:
-            return Distance2D <= Shape.Radius;
     }
 }
 
-float UAoEPrototypeComponent::CalculateCurrentRadius(const FActiveAoE& AoE) const
+bool UAoEPrototypeComponent::IsActorInAoE(const FActiveAoE& AoE, AActor* Actor, FVector& OutHitLocation) const
 {
-    if (AoE.Data.BehaviorData.Behavior != EAoEBehavior::Expanding)
-    {
-        return AoE.Data.ShapeData.Radius;
-    }
+    if (!Actor)
+        return false;
     
-    float ElapsedSinceStart = AoE.ElapsedTime - AoE.Data.BehaviorData.StartDelay;
-    float ExpansionAlpha = 0.0f;
+    FVector ActorLocation = Actor->GetActorLocation();
+    FVector Forward = GetOwner() ? GetOwner()->GetActorForwardVector() : FVector::ForwardVector;
     
-    if (AoE.Data.BehaviorData.ExpansionCurve)
-    {
-        ExpansionAlpha = AoE.Data.BehaviorData.ExpansionCurve->GetFloatValue(ElapsedSinceStart / AoE.Data.BehaviorData.Duration);
-    }
-    else
-    {
-        ExpansionAlpha = ElapsedSinceStart * AoE.Data.BehaviorData.ExpansionSpeed / AoE.Data.ShapeData.Radius;
-    }
+    OutHitLocation = ActorLocation;
     
-    return FMath::Clamp(ExpansionAlpha, 0.0f, 1.0f) * AoE.Data.ShapeData.Radius;
+    return IsPointInShape(AoE.Data.ShapeData, ActorLocation, AoE.Location, Forward);
+}
+
+bool UAoEPrototypeComponent::IsPointInShape(const FAoEShapeData& Shape, const FVector& Point, const FVector& Center, const FVector& Forward) const
+{
+    return FCombatMathKernels::IsPointInShape(Shape, Point, Center, Forward);
+}
+
+float UAoEPrototypeComponent::CalculateCurrentRadius(const FActiveAoE& AoE) const
+{
+    return FCombatMathKernels::CurrentRadius(AoE.Data.ShapeData, AoE.Data.BehaviorData, AoE.ElapsedTime);
 }
 
 float UAoEPrototypeComponent::CalculateDamageAtLocation(const FActiveAoE& AoE, const FVector& Location) const
 {
-    float BaseDamage = AoE.Data.DamageData.Damage;
-    
-    if (!AoE.Data.DamageData.bUseDamageFalloff)
-    {
-        return BaseDamage;
-    }
-    
-    // Calculate distance falloff
-    float Distance = FVector::Dist(Location, AoE.Location);
-    float FalloffAlpha = 1.0f - FMath::Clamp(Distance / AoE.Data.ShapeData.Radius, 0.0f, 1.0f);
-    
-    if (AoE.Data.DamageData.DamageFalloffCurve)
-    {
-        FalloffAlpha = AoE.Data.DamageData.DamageFalloffCurve->GetFloatValue(FalloffAlpha);
-    }
-    
-    return BaseDamage * FalloffAlpha;
+    // Falloff spans the full shape radius, not the current expansion radius
+    return FCombatMathKernels::DamageAtLocation(AoE.Data.DamageData, AoE.Data.ShapeData.Radius, AoE.Location, Location);
 }
 
 void UAoEPrototypeComponent::DrawAoEDebugVisualization(const FActiveAoE& AoE)
 {
+    LLM_SCOPE_BYTAG(Combat_Debug);
+    
     if (!GetWorld())
         return;
     
@@ -812,6 +829,42 @@ FVector UAoEPrototypeComponent::GetAoEOriginLocation(EAoEOrigin Origin, const FV
     }
 }
 
+int32 UAoEPrototypeComponent::GetLodQueryStride(const FActiveAoE& AoE) const
+{
+    int32 Stride = UCombatSignificanceSubsystem::GetFrameStride(CombatLod);
+    if (Stride <= 1)
+    {
+        return 1;
+    }
+    
+    // One query hits a victim once - a multi-hit AoE keeps at least one query per hit interval
+    if (AoE.Data.DamageData.bAllowMultipleHits)
+    {
+        Stride = FMath::Min(Stride, FMath::Max(1, FMath::FloorToInt(AoE.Data.DamageData.HitInterval * CombatConstants::TARGET_FRAMERATE)));
+    }
+    
+    // A traveling AoE must not step further than its radius between queries or it would pass over victims
+    const float TravelSpeed = AoE.Data.BehaviorData.TravelSpeed;
+    if (AoE.Data.BehaviorData.Behavior == EAoEBehavior::Traveling && TravelSpeed > 0.0f)
+    {
+        Stride = FMath::Min(Stride, FMath::Max(1, FMath::FloorToInt(AoE.Data.ShapeData.Radius * CombatConstants::TARGET_FRAMERATE / TravelSpeed)));
+    }
+    
+    return Stride;
+}
+
+bool UAoEPrototypeComponent::ShouldQueryThisFrame(FActiveAoE& AoE) const
+{
+    // COMBAT LOD: Continuous AoEs of less significant fighters query every stride frames
+    if (++AoE.FramesSinceQuery < GetLodQueryStride(AoE))
+    {
+        return false;
+    }
+    
+    AoE.FramesSinceQuery = 0;
+    return true;
+}
+
 void UAoEPrototypeComponent::RemoveCompletedAoEs()
 {
     for (int32 i = ActiveAoEs.Num() - 1; i >= 0; --i)
@@ -820,9 +873,41 @@ void UAoEPrototypeComponent::RemoveCompletedAoEs()
         {
             if (bDebugEnabled)
             {
-                UE_LOG(LogTemp, Log, TEXT("Removing completed AoE: %s"), *ActiveAoEs[i].Name);
+                UE_LOG(LogAoE, Verbose, TEXT("Removing completed AoE: %s"), *ActiveAoEs[i].Name);
             }
             ActiveAoEs.RemoveAt(i);
         }
     }
 }
+
+// MEMORY ACCOUNTING
+
+static SIZE_T GetAoERowBytes(const FAoEPrototypeData& Row)
+{
+    return Row.PrototypeName.GetAllocatedSize() + Row.ShapeData.CustomShapePoints.GetAllocatedSize();
+}
+
+void UAoEPrototypeComponent::GetCombatMemoryUsage(FCombatMemoryUsage& OutUsage) const
+{
+    OutUsage.Add(ECombatMemoryCategory::Runtime, sizeof(*this) + RewoundVolumes.GetAllocatedSize());
+
+    SIZE_T ActiveBytes = ActiveAoEs.GetAllocatedSize();
+    for (const FActiveAoE& AoE : ActiveAoEs)
+    {
+        ActiveBytes += AoE.Name.GetAllocatedSize() + GetAoERowBytes(AoE.Data) + AoE.HitActors.GetAllocatedSize() +
+            AoE.ActorHitCounts.GetAllocatedSize() + AoE.LastHitTimes.GetAllocatedSize();
+    }
+    OutUsage.Add(ECombatMemoryCategory::AoE, ActiveBytes);
+
+    OutUsage.AddTable(AoEDataTable ? AoEDataTable->GetFName() : FName(TEXT("LoadedAoEPrototypes")),
+        CombatMemory::GetMapBytes(LoadedAoEPrototypes, [](const FString& Key, const FAoEPrototypeData& Row)
+        {
+            return Key.GetAllocatedSize() + GetAoERowBytes(Row);
+        }));
+}
+
+void UAoEPrototypeComponent::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+    Super::GetResourceSizeEx(CumulativeResourceSize);
+    AddHeapResourceSize(CumulativeResourceSize, sizeof(*this));
+}
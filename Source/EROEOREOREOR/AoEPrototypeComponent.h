@@ -5,6 +5,9 @@
 #include "Engine/DataTable.h"
 #include "Curves/CurveFloat.h"
 #include "GameplayTagContainer.h"
+#include "CombatLagCompensation.h"
+#include "CombatSignificance.h"
+#include "CombatMemory.h"
 #include "AoEPrototypeComponent.generated.h"
 
 UENUM(BlueprintType)
@@ -186,6 +189,11 @@ struct FAoEPrototypeData : public FTableRowBase
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AoE Prototype")
     FLinearColor DebugColor = FLinearColor::Red;
+
+#if WITH_EDITOR
+    // Query-cost warnings from the combat data linter (CombatDataLinter.cpp)
+    virtual EDataValidationResult IsDataValid(FDataValidationContext& Context) const override;
+#endif
 };
 
 USTRUCT()
@@ -200,16 +208,28 @@ struct FActiveAoE
     FVector ProjectileLocation = FVector::ZeroVector;
     TArray<AActor*> HitActors;
     TMap<AActor*, int32> ActorHitCounts;
-    TMap<AActor*, float> LastHitTimes;
+    TMap<AActor*, float> LastHitTimes;  // AoE-local HitTime of each actor's last hit
     bool bIsActive = false;
     bool bProjectileActive = false;
+    
+    // Time hits are stamped with, on the ElapsedTime clock - a persistent field catching up stamps each owed tick
+    float HitTime = 0.0f;
+    
+    // Persistent field ticks run on a fixed grid from the first one (-1 until then)
+    float NextTickTime = -1.0f;
+    
+    // Consecutive frames the due tick was deferred by the combat frame budget
+    int32 DeferredFrames = 0;
+    
+    // Frames since the last continuous (expanding/traveling) query - counts up to the combat LOD stride
+    int32 FramesSinceQuery = 0;
 };
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnAoEHit, AActor*, HitActor, FVector, HitLocation, float, DamageAmount);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAoEComplete, const FString&, AoEName);
 
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
-class EROEOREOREOR_API UAoEPrototypeComponent : public UActorComponent
+class EROEOREOREOR_API UAoEPrototypeComponent : public UActorComponent, public ICombatMemoryReporter
 {
     GENERATED_BODY()
 
@@ -221,6 +241,10 @@ protected:
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 public:
+    // Prototype rows keyed by name (Data, per table) plus live AoE instances with their hit maps (AoE)
+    virtual void GetCombatMemoryUsage(FCombatMemoryUsage& OutUsage) const override;
+    virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
+
     // Core AoE Control
     UFUNCTION(BlueprintCallable, Category = "AoE Prototype")
     void StartAoE(const FString& PrototypeName);
@@ -247,6 +271,11 @@ public:
     UFUNCTION(BlueprintPure, Category = "AoE Prototype")
     bool IsAoEActive(const FString& PrototypeName) const;
 
+    const TArray<FActiveAoE>& GetActiveAoEs() const { return ActiveAoEs; }
+
+    // Set by UCombatSignificanceSubsystem - lower tiers query continuous AoEs less often and skip debug drawing
+    void SetCombatLod(ECombatLod Lod) { CombatLod = Lod; }
+
     // Data Management
     UFUNCTION(BlueprintCallable, Category = "AoE Prototype")
     void LoadAoEData(UDataTable* DataTable);
@@ -308,7 +337,10 @@ private:
     void UpdateTravelingAoE(FActiveAoE& AoE, float DeltaTime);
     void UpdatePersistentAoE(FActiveAoE& AoE, float DeltaTime);
 
-    void CheckAoEHits(FActiveAoE& AoE);
+    // TickCount > 1 applies several persistent-field ticks, TickInterval apart, from one query
+    void CheckAoEHits(FActiveAoE& AoE, int32 TickCount = 1, float TickInterval = 0.0f);
+    void CheckRewoundAoEHits(const UCombatLagCompensationSubsystem& LagCompensation, FActiveAoE& AoE);
+    void ApplyAoEHit(FActiveAoE& AoE, AActor* HitActor, const FVector& HitLocation);
     bool IsActorInAoE(const FActiveAoE& AoE, AActor* Actor, FVector& OutHitLocation) const;
     bool IsPointInShape(const FAoEShapeData& Shape, const FVector& Point, const FVector& Center, const FVector& Forward) const;
     
@@ -320,4 +352,14 @@ private:
 
     FVector GetAoEOriginLocation(EAoEOrigin Origin, const FVector& CustomLocation = FVector::ZeroVector) const;
     void RemoveCompletedAoEs();
+
+    // Combat LOD
+    int32 GetLodQueryStride(const FActiveAoE& AoE) const;
+    bool ShouldQueryThisFrame(FActiveAoE& AoE) const;
+    bool ShouldDrawDebug(const FActiveAoE& AoE) const { return bDebugEnabled && AoE.Data.bDebugVisualization && CombatLod == ECombatLod::Full; }
+
+    ECombatLod CombatLod = ECombatLod::Full;
+
+    // Lag compensation scratch - reused every check to avoid per-frame allocations
+    TArray<FLagCompensatedVolume> RewoundVolumes;
 };
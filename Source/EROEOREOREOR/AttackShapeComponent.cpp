@@ -1,5 +1,9 @@
 #include "AttackShapeComponent.h"
 #include "GameplayEffect_Damage.h"
+#include "CombatStats.h"
+#include "CombatLog.h"
+#include "CombatMemory.h"
+#include "CombatWorkScheduler.h"
 #include "MyCharacter.h"
 #include "Engine/Engine.h"
 #include "GameFramework/Actor.h"
@@ -9,12 +13,41 @@
 #include "DrawDebugHelpers.h"
 #include "AbilitySystemComponent.h"
 #include "GameplayEffectTypes.h"
+#include "GameFramework/Pawn.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<bool> CVarHitClaimsEnable(
+	TEXT("Combat.HitClaims.Enable"),
+	true,
+	TEXT("Owning clients test their attack shapes and send hits to the server as batched claims; the server validates them instead of testing remote attackers itself. Must match on client and server."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarHitClaimsFrameSlack(
+	TEXT("Combat.HitClaims.FrameSlack"),
+	6,
+	TEXT("Frames a claim may lead or trail the server's copy of the attack beyond the lag compensation rewind."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarHitClaimsMaxFrameSpan(
+	TEXT("Combat.HitClaims.MaxFrameSpan"),
+	8,
+	TEXT("Most frames one claim batch may cover - a client that deferred longer has its older frames ignored."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarHitClaimsLocationSlack(
+	TEXT("Combat.HitClaims.LocationSlack"),
+	50.0f,
+	TEXT("Distance in cm a claimed victim location may sit outside the victim's rewound hurt volume."),
+	ECVF_Default);
 
 UAttackShapeComponent::UAttackShapeComponent()
 {
 	PrimaryComponentTick.bCanEverTick = true;
 	PrimaryComponentTick.bStartWithTickEnabled = false; // Enable only when needed
 	
+	// Hit claim RPCs only - no replicated properties
+	SetIsReplicatedByDefault(true);
+	
 	bShowDebugShapes = true;
 	bShowHitResults = true;
 	HitResultDisplayTime = 2.0f;
@@ -27,6 +60,9 @@ void UAttackShapeComponent::BeginPlay()
 
 void UAttackShapeComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
+	COMBAT_SCOPE(AttackShapeTick);
+	LLM_SCOPE_BYTAG(Combat_Runtime);
+	
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 	
 	if (bAttackActive)
@@ -52,6 +88,8 @@ void UAttackShapeComponent::TickComponent(float DeltaTime, ELevelTick TickType,
 
 void UAttackShapeComponent::StartAttack(const FAttackPrototypeData& AttackData)
 {
+	LLM_SCOPE_BYTAG(Combat_Runtime);
+	
 	// Stop any current attack
 	StopAttack();
 	
@@ -60,14 +98,28 @@ void UAttackShapeComponent::StartAttack(const FAttackPrototypeData& AttackData)
 	CurrentAttackData = AttackData;
 	AttackStartTime = GetWorld()->GetTimeSeconds();
 	CurrentFrame = 0;
+	LastProcessedFrame = 0;
+	DeferredFrames = 0;
 	AlreadyHitActors.Empty();
 	ActorHitCounts.Empty();
 	LastHitTimes.Empty();
+	LastClaimedFrame = 0;
+	AttackHitClaimSequence = NextHitClaimSequence;
+	
+	// A batched test hits a multi-hit victim once - the stride must not span a whole interval or hits would be lost
+	MaxLodFrameStride = MAX_int32;
+	for (const FAttackShapeData& ShapeData : AttackData.AttackShapes)
+	{
+		if (ShapeData.bAllowMultiHit)
+		{
+			MaxLodFrameStride = FMath::Min(MaxLodFrameStride, FMath::Max(1, FMath::FloorToInt(ShapeData.MultihitInterval * CombatConstants::TARGET_FRAMERATE)));
+		}
+	}
 	
 	// Enable ticking for attack processing
 	SetComponentTickEnabled(true);
 	
-	UE_LOG(LogTemp, Log, TEXT("AttackShapeComponent: Started attack '%s' with %d shapes"), 
+	UE_LOG(LogCombat, Verbose, TEXT("AttackShapeComponent: Started attack '%s' with %d shapes"), 
 		*AttackData.AttackName, AttackData.AttackShapes.Num());
 }
 
@@ -75,6 +127,13 @@ void UAttackShapeComponent::StopAttack()
 {
 	if (bAttackActive)
 	{
+		// Frames the budget deferred still get their hit tests - stopping early must not drop them
+		if (CurrentFrame > LastProcessedFrame && GetWorld())
+		{
+			UCombatWorkScheduler::FScopedWork Work(UCombatWorkScheduler::Get(GetWorld()));
+			ProcessActiveShapes();
+		}
+		
 		bAttackActive = false;
 		AlreadyHitActors.Empty();
 		ActorHitCounts.Empty();
@@ -83,7 +142,7 @@ void UAttackShapeComponent::StopAttack()
 		// Disable ticking when not needed for performance
 		SetComponentTickEnabled(false);
 		
-		UE_LOG(LogTemp, Log, TEXT("AttackShapeComponent: Stopped attack"));
+		UE_LOG(LogCombat, Verbose, TEXT("AttackShapeComponent: Stopped attack"));
 	}
 }
 
@@ -96,7 +155,7 @@ void UAttackShapeComponent::PreviewAttackShape(const FAttackShapeData& ShapeData
 	// Enable ticking for preview
 	SetComponentTickEnabled(true);
 	
-	UE_LOG(LogTemp, Log, TEXT("AttackShapeComponent: Previewing %s shape for %.1f seconds"), 
+	UE_LOG(LogCombat, Log, TEXT("AttackShapeComponent: Previewing %s shape for %.1f seconds"), 
 		*UEnum::GetValueAsString(ShapeData.ShapeType), PreviewTime);
 }
 
@@ -129,14 +188,14 @@ void UAttackShapeComponent::TestShapeAtLocation(const FAttackShapeData& ShapeDat
 	DrawShapeDebug(TestShape, ShapeColor, 3.0f);
 	
 	// Log results
-	UE_LOG(LogTemp, Log, TEXT("AttackShapeComponent: Shape test at %s - Hit %d actors"), 
+	UE_LOG(LogCombat, Log, TEXT("AttackShapeComponent: Shape test at %s - Hit %d actors"), 
 		*WorldLocation.ToString(), HitResults.Num());
 		
 	for (const FHitResult& Hit : HitResults)
 	{
 		if (Hit.GetActor())
 		{
-			UE_LOG(LogTemp, Log, TEXT("  - Hit: %s"), *Hit.GetActor()->GetName());
+			UE_LOG(LogCombat, Log, TEXT("  - Hit: %s"), *Hit.GetActor()->GetName());
 			
 			// Draw hit location
 			if (bShowHitResults)
@@ -159,47 +218,120 @@ void UAttackShapeComponent::UpdateAttack(float DeltaTime)
 	if (NewFrame != CurrentFrame)
 	{
 		CurrentFrame = NewFrame;
-		ProcessActiveShapes();
 	}
+	
+#if !UE_BUILD_SHIPPING
+	COMBAT_GAUGE_ADD(ECombatGauge::ActiveAttacks, 1);
+	for (const FAttackShapeData& ShapeData : CurrentAttackData.AttackShapes)
+	{
+		if (IsShapeActiveInFrames(ShapeData, CurrentFrame, CurrentFrame))
+			COMBAT_GAUGE_ADD(ECombatGauge::ActiveHitboxes, 1);
+	}
+#endif
+	
+	if (CurrentFrame <= LastProcessedFrame)
+		return;
+	
+	// COMBAT LOD: Less significant fighters test their owed frames together at the current pose - an approximation, see CombatSignificance.h
+	const int32 LodFrameStride = FMath::Min(UCombatSignificanceSubsystem::GetFrameStride(CombatLod), MaxLodFrameStride);
+	if (CurrentFrame - LastProcessedFrame < LodFrameStride)
+		return;
+	
+	// FRAME BUDGET: Low-priority attacks may wait - the owed frames are tested together once admitted
+	UCombatWorkScheduler* Scheduler = UCombatWorkScheduler::Get(GetWorld());
+	if (Scheduler && GetOwner() && UCombatWorkScheduler::IsBudgetEnabled())
+	{
+		const ECombatWorkPriority Priority = Scheduler->GetPriority(GetOwner(), GetOwner()->GetActorLocation());
+		if (!Scheduler->TryAdmit(Priority, DeferredFrames))
+			return;
+	}
+	
+	UCombatWorkScheduler::FScopedWork Work(Scheduler);
+	ProcessActiveShapes();
 }
 
 void UAttackShapeComponent::ProcessActiveShapes()
 {
+	COMBAT_SCOPE(ProcessActiveShapes);
+	
+	// Every frame since the last processed one - one frame normally, several after a deferral or a long frame
+	const int32 FirstFrame = LastProcessedFrame + 1;
+	LastProcessedFrame = CurrentFrame;
+	
 	if (CurrentAttackData.AttackShapes.Num() == 0)
 		return;
+	
+	// The owning client tests this attack - its hits arrive through ServerHitClaims
+	if (IsAwaitingHitClaims())
+		return;
+	
+	const bool bPredictingHits = IsPredictingHits();
+	if (bPredictingHits)
+	{
+		PendingHitClaims.AttackFrame = static_cast<uint16>(FMath::Clamp(CurrentFrame, 0, MAX_uint16));
+		PendingHitClaims.FrameSpan = static_cast<uint8>(FMath::Clamp(CurrentFrame - FirstFrame, 0, MAX_uint8));
+	}
 		
-	// Check each shape that should be active this frame
-	for (const FAttackShapeData& ShapeData : CurrentAttackData.AttackShapes)
+	// Check each shape whose active window overlaps the pending frames, once
+	for (int32 ShapeIndex = 0; ShapeIndex < CurrentAttackData.AttackShapes.Num(); ++ShapeIndex)
 	{
-		if (IsShapeActiveThisFrame(ShapeData))
+		const FAttackShapeData& ShapeData = CurrentAttackData.AttackShapes[ShapeIndex];
+		if (IsShapeActiveInFrames(ShapeData, FirstFrame, CurrentFrame))
 		{
 			// Draw debug visualization
-			if (bShowDebugShapes && ShapeData.bShowDebugShape)
+			if (bShowDebugShapes && ShapeData.bShowDebugShape && CombatLod == ECombatLod::Full)
 			{
 				DrawShapeDebug(ShapeData, ShapeData.DebugColor, -1.0f);
 			}
 			
 			// Perform collision detection
 			TArray<FHitResult> HitResults;
-			if (CheckShapeCollision(ShapeData, HitResults))
+			const bool bAnyHit = CheckShapeCollision(ShapeData, HitResults);
+			COMBAT_COUNTER_ADD(Allocations, HitResults.Max() > 0 ? 1 : 0);
+			
+			if (bAnyHit)
 			{
 				// Process hits
 				for (const FHitResult& Hit : HitResults)
 				{
 					if (Hit.GetActor() && CanHitActor(Hit.GetActor(), ShapeData))
 					{
-						HandleActorHit(Hit.GetActor(), Hit.Location, ShapeData);
+						if (bPredictingHits)
+						{
+							AddHitClaim(ShapeIndex, Hit.GetActor(), Hit.Location, ShapeData);
+						}
+						else
+						{
+							HandleActorHit(Hit.GetActor(), Hit.Location, ShapeData);
+						}
 					}
 				}
 			}
 		}
 	}
+	
+	// One batch per update, however many frames and shapes it covered
+	if (bPredictingHits)
+	{
+		FlushHitClaims();
+	}
 }
 
 bool UAttackShapeComponent::CheckShapeCollision(const FAttackShapeData& ShapeData, TArray<FHitResult>& OutHits)
 {
+	COMBAT_SCOPE(ShapeCollision);
+	
 	OutHits.Empty();
 	
+	// LAG COMPENSATION: Remote attackers hit what they saw, not the server's current positions
+	if (const UCombatLagCompensationSubsystem* LagCompensation = UCombatLagCompensationSubsystem::Get(GetWorld()))
+	{
+		if (LagCompensation->ShouldRewindFor(GetOwner()))
+		{
+			return CheckRewoundShapeCollision(*LagCompensation, ShapeData, OutHits);
+		}
+	}
+	
 	switch (ShapeData.ShapeType)
 	{
 		case EAttackShape::Sphere:
@@ -217,13 +349,15 @@ bool UAttackShapeComponent::CheckShapeCollision(const FAttackShapeData& ShapeDat
 		case EAttackShape::Arc:
 			return CheckArcCollision(ShapeData, OutHits);
 		default:
-			UE_LOG(LogTemp, Warning, TEXT("AttackShapeComponent: Unknown shape type"));
+			UE_LOG(LogCombat, Warning, TEXT("AttackShapeComponent: Unknown shape type"));
 			return false;
 	}
 }
 
 void UAttackShapeComponent::DrawShapeDebug(const FAttackShapeData& ShapeData, const FColor& Color, float Duration)
 {
+	LLM_SCOPE_BYTAG(Combat_Debug);
+	
 	if (!bShowDebugShapes || !GetWorld())
 		return;
 		
@@ -277,6 +411,9 @@ bool UAttackShapeComponent::CheckSphereCollision(const FAttackShapeData& ShapeDa
 		OverlapActors
 	);
 	
+	COMBAT_COUNTER_ADD(Queries, 1);
+	COMBAT_COUNTER_ADD(Candidates, OverlapActors.Num());
+	
 	// Convert AActor array to FHitResult array
 	for (AActor* Actor : OverlapActors)
 	{
@@ -317,6 +454,9 @@ bool UAttackShapeComponent::CheckCapsuleCollision(const FAttackShapeData& ShapeD
 		OverlapActors
 	);
 	
+	COMBAT_COUNTER_ADD(Queries, 1);
+	COMBAT_COUNTER_ADD(Candidates, OverlapActors.Num());
+	
 	// Convert AActor array to FHitResult array
 	for (AActor* Actor : OverlapActors)
 	{
@@ -357,6 +497,9 @@ bool UAttackShapeComponent::CheckBoxCollision(const FAttackShapeData& ShapeData,
 		OverlapActors
 	);
 	
+	COMBAT_COUNTER_ADD(Queries, 1);
+	COMBAT_COUNTER_ADD(Candidates, OverlapActors.Num());
+	
 	// Convert AActor array to FHitResult array
 	for (AActor* Actor : OverlapActors)
 	{
@@ -431,6 +574,9 @@ bool UAttackShapeComponent::CheckLineCollision(const FAttackShapeData& ShapeData
 		true
 	);
 	
+	COMBAT_COUNTER_ADD(Queries, 1);
+	COMBAT_COUNTER_ADD(Candidates, bHit ? 1 : 0);
+	
 	if (bHit)
 	{
 		OutHits.Add(HitResult);
@@ -496,6 +642,34 @@ bool UAttackShapeComponent::CheckArcCollision(const FAttackShapeData& ShapeData,
 	return OutHits.Num() > 0;
 }
 
+bool UAttackShapeComponent::CheckRewoundShapeCollision(const UCombatLagCompensationSubsystem& LagCompensation, const FAttackShapeData& ShapeData, TArray<FHitResult>& OutHits)
+{
+	const FVector WorldPos = GetWorldPositionFromShape(ShapeData);
+	const FRotator WorldRot = GetWorldRotationFromShape(ShapeData);
+	const double RewindTime = GetWorld()->GetTimeSeconds() - LagCompensation.GetRewindSeconds(GetOwner());
+	
+	RewoundVolumes.Reset();
+	RewoundHitIndices.Reset();
+	LagCompensation.GatherVolumesAtTime(RewindTime, WorldPos, UCombatLagCompensationSubsystem::GetAttackShapeReach(ShapeData), GetOwner(), RewoundVolumes);
+	UCombatLagCompensationSubsystem::TestAttackShapeBatch(ShapeData, WorldPos, WorldRot, RewoundVolumes, RewoundHitIndices);
+	COMBAT_COUNTER_ADD(Candidates, RewoundVolumes.Num());
+	
+	// Hit location is where the victim was on the attacker's screen
+	for (const int32 Index : RewoundHitIndices)
+	{
+		const FLagCompensatedVolume& Volume = RewoundVolumes[Index];
+		
+		FHitResult HitResult;
+		HitResult.HitObjectHandle = FActorInstanceHandle(Volume.Actor);
+		HitResult.Location = Volume.Center;
+		HitResult.ImpactPoint = Volume.Center;
+		HitResult.Component = Cast<UPrimitiveComponent>(Volume.Actor->GetRootComponent());
+		OutHits.Add(HitResult);
+	}
+	
+	return OutHits.Num() > 0;
+}
+
 // Shape-specific debug drawing implementations
 void UAttackShapeComponent::DrawSphere(const FAttackShapeData& ShapeData, const FColor& Color, float Duration)
 {
@@ -645,9 +819,19 @@ FRotator UAttackShapeComponent::GetWorldRotationFromShape(const FAttackShapeData
 	return OwnerRotation + ShapeData.LocalRotation;
 }
 
-bool UAttackShapeComponent::IsShapeActiveThisFrame(const FAttackShapeData& ShapeData) const
+FVector UAttackShapeComponent::GetWorldPositionFromShape(const FAttackShapeData& ShapeData, const FTransform& OwnerTransform)
 {
-	return CurrentFrame >= ShapeData.ActivationFrame && CurrentFrame <= ShapeData.DeactivationFrame;
+	return OwnerTransform.TransformPosition(ShapeData.LocalOffset);
+}
+
+FRotator UAttackShapeComponent::GetWorldRotationFromShape(const FAttackShapeData& ShapeData, const FTransform& OwnerTransform)
+{
+	return OwnerTransform.Rotator() + ShapeData.LocalRotation;
+}
+
+bool UAttackShapeComponent::IsShapeActiveInFrames(const FAttackShapeData& ShapeData, int32 FirstFrame, int32 LastFrame) const
+{
+	return LastFrame >= ShapeData.ActivationFrame && FirstFrame <= ShapeData.DeactivationFrame;
 }
 
 bool UAttackShapeComponent::CanHitActor(AActor* Actor, const FAttackShapeData& ShapeData) const
@@ -680,20 +864,14 @@ bool UAttackShapeComponent::CanHitActor(AActor* Actor, const FAttackShapeData& S
 
 void UAttackShapeComponent::HandleActorHit(AActor* HitActor, const FVector& HitLocation, const FAttackShapeData& ShapeData)
 {
+	COMBAT_SCOPE(HandleActorHit);
+	
 	if (!HitActor)
 		return;
 		
-	// Update hit tracking
-	if (!ShapeData.bAllowMultiHit)
-	{
-		AlreadyHitActors.AddUnique(HitActor);
-	}
-	else
-	{
-		int32& HitCount = ActorHitCounts.FindOrAdd(HitActor, 0);
-		HitCount++;
-		LastHitTimes.FindOrAdd(HitActor) = GetWorld()->GetTimeSeconds();
-	}
+	RecordHit(HitActor, ShapeData);
+	
+	COMBAT_COUNTER_ADD(Hits, 1);
 	
 	// Apply damage through GAS - integrate with MyCharacter's ability system
 	if (AMyCharacter* MyChar = Cast<AMyCharacter>(GetOwner()))
@@ -711,6 +889,8 @@ void UAttackShapeComponent::HandleActorHit(AActor* HitActor, const FVector& HitL
 				if (SpecHandle.IsValid())
 				{
 					ASC->ApplyGameplayEffectSpecToTarget(*SpecHandle.Data.Get(), ASC);
+					COMBAT_COUNTER_ADD(DamageSpecs, 1);
+					COMBAT_COUNTER_ADD(Allocations, 1);
 				}
 			}
 		}
@@ -720,20 +900,276 @@ void UAttackShapeComponent::HandleActorHit(AActor* HitActor, const FVector& HitL
 	OnAttackHit.Broadcast(HitActor, HitLocation);
 	
 	// Debug visualization
-	if (bShowHitResults)
+	if (bShowHitResults && CombatLod == ECombatLod::Full)
 	{
 		DrawDebugSphere(GetWorld(), HitLocation, 15.0f, 8, FColor::Orange, false, HitResultDisplayTime);
 		DrawDebugString(GetWorld(), HitLocation + FVector(0, 0, 50), FString::Printf(TEXT("HIT: %s"), *HitActor->GetName()), 
 			nullptr, FColor::White, HitResultDisplayTime);
 	}
 	
-	UE_LOG(LogTemp, Log, TEXT("AttackShapeComponent: Hit actor '%s' at %s"), 
+	UE_LOG(LogCombat, VeryVerbose, TEXT("AttackShapeComponent: Hit actor '%s' at %s"), 
 		*HitActor->GetName(), *HitLocation.ToString());
 }
 
+void UAttackShapeComponent::RecordHit(AActor* HitActor, const FAttackShapeData& ShapeData)
+{
+	// Update hit tracking
+	if (!ShapeData.bAllowMultiHit)
+	{
+		AlreadyHitActors.AddUnique(HitActor);
+	}
+	else
+	{
+		int32& HitCount = ActorHitCounts.FindOrAdd(HitActor, 0);
+		HitCount++;
+		LastHitTimes.FindOrAdd(HitActor) = GetWorld()->GetTimeSeconds();
+	}
+}
+
 UGameplayEffect* UAttackShapeComponent::CreateDamageEffect(const FAttackPrototypeData& AttackData)
 {
 	// For now, return the default damage effect class
 	// In a full implementation, you'd create different effects based on attack data
 	return UGameplayEffect_Damage::StaticClass()->GetDefaultObject<UGameplayEffect_Damage>();
 }
+
+// HIT CLAIMS
+
+bool UAttackShapeComponent::IsPredictingHits() const
+{
+	const AActor* Owner = GetOwner();
+	return Owner && Owner->GetLocalRole() == ROLE_AutonomousProxy && CVarHitClaimsEnable.GetValueOnGameThread();
+}
+
+bool UAttackShapeComponent::IsAwaitingHitClaims() const
+{
+	const APawn* Pawn = Cast<APawn>(GetOwner());
+	return Pawn && Pawn->HasAuthority() && Pawn->GetRemoteRole() == ROLE_AutonomousProxy && !Pawn->IsLocallyControlled() &&
+		CVarHitClaimsEnable.GetValueOnGameThread();
+}
+
+void UAttackShapeComponent::AddHitClaim(int32 ShapeIndex, AActor* HitActor, const FVector& HitLocation, const FAttackShapeData& ShapeData)
+{
+	LLM_SCOPE_BYTAG(Combat_Runtime);
+	
+	if (PendingHitClaims.Claims.Num() >= FCombatHitClaimBatch::MAX_CLAIMS)
+	{
+		FlushHitClaims();
+	}
+	
+	// Tracked like a real hit so the next frames do not claim it again
+	RecordHit(HitActor, ShapeData);
+	
+	FCombatHitClaim& Claim = PendingHitClaims.Claims.AddDefaulted_GetRef();
+	Claim.Victim = HitActor;
+	Claim.Location = HitLocation;
+	Claim.ShapeIndex = static_cast<uint8>(ShapeIndex);
+	
+	// Feedback is predicted, damage waits for the server
+	OnAttackHit.Broadcast(HitActor, HitLocation);
+	
+	if (bShowHitResults)
+	{
+		DrawDebugSphere(GetWorld(), HitLocation, 15.0f, 8, FColor::Yellow, false, HitResultDisplayTime);
+	}
+}
+
+void UAttackShapeComponent::FlushHitClaims()
+{
+	if (PendingHitClaims.Claims.Num() == 0)
+		return;
+	
+	PendingHitClaims.Sequence = NextHitClaimSequence++;
+	ServerHitClaims(PendingHitClaims);
+	
+	// Kept until the result names the rejected claims
+	SentHitClaims.Add(PendingHitClaims);
+	PendingHitClaims.Claims.Reset();
+}
+
+void UAttackShapeComponent::ServerHitClaims_Implementation(const FCombatHitClaimBatch& Batch)
+{
+	COMBAT_SCOPE(ProcessActiveShapes);
+	LLM_SCOPE_BYTAG(Combat_Runtime);
+	
+	FCombatHitClaimResult Result;
+	ValidateHitClaims(Batch, Result);
+	ClientHitClaimResult(Result);
+	
+	UE_LOG(LogCombat, VeryVerbose, TEXT("AttackShapeComponent: Hit claim batch %d (frame %d) - %d of %d confirmed"), 
+		Batch.Sequence, Batch.AttackFrame, FMath::CountBits(Result.ConfirmedMask), Batch.Claims.Num());
+}
+
+void UAttackShapeComponent::ValidateHitClaims(const FCombatHitClaimBatch& Batch, FCombatHitClaimResult& OutResult)
+{
+	OutResult.Sequence = Batch.Sequence;
+	OutResult.ConfirmedMask = 0;
+	
+	const UCombatLagCompensationSubsystem* LagCompensation = UCombatLagCompensationSubsystem::Get(GetWorld());
+	if (!bAttackActive || !LagCompensation || !GetOwner())
+		return;
+	
+	// The server's copy of the attack starts half a round trip late - claims may lead or trail it by the rewind, not more
+	const float RewindSeconds = LagCompensation->GetRewindSeconds(GetOwner());
+	const int32 MaxLag = FMath::CeilToInt(RewindSeconds * CombatConstants::TARGET_FRAMERATE) + CVarHitClaimsFrameSlack.GetValueOnGameThread();
+	const int32 LastFrame = Batch.AttackFrame;
+	if (FMath::Abs(LastFrame - CurrentFrame) > MaxLag)
+		return;
+	
+	// Covered frames stay inside the window, are not claimed twice, and span no more than a client can plausibly defer -
+	// an overflow batch of the same update repeats its last frame
+	const int32 MaxFrameSpan = FMath::Max(CVarHitClaimsMaxFrameSpan.GetValueOnGameThread(), 0);
+	const int32 FirstFrame = FMath::Max3(LastFrame - FMath::Min<int32>(Batch.FrameSpan, MaxFrameSpan),
+		FMath::Min(LastClaimedFrame + 1, LastFrame), CurrentFrame - MaxLag);
+	if (FirstFrame > LastFrame)
+		return;
+	
+	LastClaimedFrame = FMath::Max(LastClaimedFrame, LastFrame);
+	
+	const int32 NumClaims = FMath::Min(Batch.Claims.Num(), FCombatHitClaimBatch::MAX_CLAIMS);
+	const TArray<FAttackShapeData>& Shapes = CurrentAttackData.AttackShapes;
+	
+	// Shapes the batch claims hits for - they must be active in the frames it covered
+	uint64 ClaimedShapes = 0;
+	float Reach = 0.0f;
+	for (int32 ClaimIndex = 0; ClaimIndex < NumClaims; ++ClaimIndex)
+	{
+		const int32 ShapeIndex = Batch.Claims[ClaimIndex].ShapeIndex;
+		if (ShapeIndex < 64 && Shapes.IsValidIndex(ShapeIndex) && IsShapeActiveInFrames(Shapes[ShapeIndex], FirstFrame, LastFrame))
+		{
+			ClaimedShapes |= 1ull << ShapeIndex;
+			Reach = FMath::Max(Reach, static_cast<float>(Shapes[ShapeIndex].LocalOffset.Size()) + UCombatLagCompensationSubsystem::GetAttackShapeReach(Shapes[ShapeIndex]));
+		}
+	}
+	
+	if (ClaimedShapes == 0)
+		return;
+	
+	// Shapes are placed where the attacker stood at the claimed frame, not where it stands now
+	const FTransform AttackerTransform = GetAttackerTransformAtFrame(LastFrame);
+	
+	// One rewind gather for the whole batch, sized by its widest shape
+	RewoundVolumes.Reset();
+	LagCompensation->GatherVolumesAtTime(GetWorld()->GetTimeSeconds() - RewindSeconds, AttackerTransform.GetLocation(), Reach, GetOwner(), RewoundVolumes);
+	COMBAT_COUNTER_ADD(Candidates, RewoundVolumes.Num());
+	
+	const float LocationSlack = CVarHitClaimsLocationSlack.GetValueOnGameThread();
+	
+	// Each claimed shape is tested once against the gathered volumes, then its claims are looked up in the result
+	for (int32 ShapeIndex = 0; ShapeIndex < Shapes.Num() && ShapeIndex < 64; ++ShapeIndex)
+	{
+		if (!(ClaimedShapes & (1ull << ShapeIndex)))
+			continue;
+		
+		const FAttackShapeData& ShapeData = Shapes[ShapeIndex];
+		RewoundHitIndices.Reset();
+		UCombatLagCompensationSubsystem::TestAttackShapeBatch(ShapeData, GetWorldPositionFromShape(ShapeData, AttackerTransform), 
+			GetWorldRotationFromShape(ShapeData, AttackerTransform), RewoundVolumes, RewoundHitIndices);
+		
+		for (int32 ClaimIndex = 0; ClaimIndex < NumClaims; ++ClaimIndex)
+		{
+			const FCombatHitClaim& Claim = Batch.Claims[ClaimIndex];
+			if (Claim.ShapeIndex != ShapeIndex || !Claim.Victim || !CanHitActor(Claim.Victim, ShapeData))
+				continue;
+			
+			for (const int32 VolumeIndex : RewoundHitIndices)
+			{
+				const FLagCompensatedVolume& Volume = RewoundVolumes[VolumeIndex];
+				if (Volume.Actor != Claim.Victim)
+					continue;
+				
+				// The client must have seen the victim where the history says it was
+				const float Tolerance = FMath::Max(Volume.Radius, Volume.HalfHeight) + LocationSlack;
+				if (FVector::DistSquared(Claim.Location, Volume.Center) <= FMath::Square(Tolerance))
+				{
+					HandleActorHit(Claim.Victim, Volume.Center, ShapeData);
+					OutResult.ConfirmedMask |= 1u << ClaimIndex;
+				}
+				break;
+			}
+		}
+	}
+}
+
+FTransform UAttackShapeComponent::GetAttackerTransformAtFrame(int32 AttackFrame) const
+{
+	const AActor* Owner = GetOwner();
+	FTransform Transform = Owner->GetActorTransform();
+	
+	// The server's frame clock runs as late as its copy of the attack, so the frame maps onto its own history
+	const double Now = GetWorld()->GetTimeSeconds();
+	const double FrameTime = FMath::Min(static_cast<double>(AttackStartTime) + AttackFrame * CombatConstants::FRAME_DURATION, Now);
+	
+	FMovementHistorySample Sample;
+	const UVelocitySnapshotComponent* History = Owner->FindComponentByClass<UVelocitySnapshotComponent>();
+	if (History && FrameTime < Now && History->GetHistorySampleAtTime(FrameTime, Sample))
+	{
+		Transform.SetLocation(Sample.Location);
+		Transform.SetRotation(FRotator(0.0f, Sample.Yaw, 0.0f).Quaternion());
+	}
+	
+	return Transform;
+}
+
+void UAttackShapeComponent::ClientHitClaimResult_Implementation(FCombatHitClaimResult Result)
+{
+	// Results come back in send order - anything older than this one was answered already
+	while (SentHitClaims.Num() > 0 && SentHitClaims[0].Sequence != Result.Sequence)
+	{
+		SentHitClaims.RemoveAt(0, EAllowShrinking::No);
+	}
+	
+	if (SentHitClaims.Num() == 0)
+		return;
+	
+	// Batches of an earlier attack still report rejections, but the current attack's hit tracking is not theirs
+	const FCombatHitClaimBatch& Batch = SentHitClaims[0];
+	const bool bCurrentAttack = bAttackActive && static_cast<int8>(Batch.Sequence - AttackHitClaimSequence) >= 0;
+	
+	for (int32 ClaimIndex = 0; ClaimIndex < Batch.Claims.Num(); ++ClaimIndex)
+	{
+		if (!(Result.ConfirmedMask & (1u << ClaimIndex)))
+		{
+			AActor* Victim = Batch.Claims[ClaimIndex].Victim;
+			
+			// A rejected hit did not happen - the victim stays hittable for the rest of the attack
+			if (bCurrentAttack)
+			{
+				AlreadyHitActors.Remove(Victim);
+				if (int32* HitCount = ActorHitCounts.Find(Victim); HitCount && --(*HitCount) <= 0)
+				{
+					ActorHitCounts.Remove(Victim);
+					LastHitTimes.Remove(Victim);
+				}
+			}
+			
+			UE_LOG(LogCombat, Verbose, TEXT("AttackShapeComponent: Server rejected predicted hit on %s (batch %d)"), 
+				*GetNameSafe(Victim), Batch.Sequence);
+			OnAttackHitRejected.Broadcast(Victim);
+		}
+	}
+	
+	SentHitClaims.RemoveAt(0, EAllowShrinking::No);
+}
+
+// MEMORY ACCOUNTING
+
+void UAttackShapeComponent::GetCombatMemoryUsage(FCombatMemoryUsage& OutUsage) const
+{
+	// The current attack is a per-attack copy of its table row, so it counts as runtime state
+	const SIZE_T AttackBytes = CurrentAttackData.AttackName.GetAllocatedSize() + CurrentAttackData.AttackShapes.GetAllocatedSize() +
+		CurrentAttackData.PlaceholderAnimationName.GetAllocatedSize() + CurrentAttackData.PlaceholderSoundEffect.GetAllocatedSize() +
+		CurrentAttackData.PlaceholderParticleEffect.GetAllocatedSize();
+
+	const SIZE_T HitTrackingBytes = AlreadyHitActors.GetAllocatedSize() + ActorHitCounts.GetAllocatedSize() + LastHitTimes.GetAllocatedSize();
+
+	OutUsage.Add(ECombatMemoryCategory::Runtime, sizeof(*this) + AttackBytes + HitTrackingBytes +
+		RewoundVolumes.GetAllocatedSize() + RewoundHitIndices.GetAllocatedSize() + PendingHitClaims.Claims.GetAllocatedSize() +
+		SentHitClaims.GetAllocatedSize());
+}
+
+void UAttackShapeComponent::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+	Super::GetResourceSizeEx(CumulativeResourceSize);
+	AddHeapResourceSize(CumulativeResourceSize, sizeof(*this));
+}
@@ -3,15 +3,75 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "CombatSystemTypes.h"
+#include "CombatLagCompensation.h"
+#include "CombatSignificance.h"
 #include "Engine/World.h"
 #include "DrawDebugHelpers.h"
 #include "Kismet/KismetSystemLibrary.h"
+#include "CombatMemory.h"
 #include "AttackShapeComponent.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnAttackHit, AActor*, HitActor, FVector, HitLocation);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAttackHitRejected, AActor*, HitActor);
+
+// One hit an owning client predicted - the victim goes over the wire as its net GUID
+USTRUCT()
+struct FCombatHitClaim
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<AActor> Victim = nullptr;
+
+	// Victim location as the client saw it, whole centimeters
+	UPROPERTY()
+	FVector_NetQuantize Location = FVector::ZeroVector;
+
+	// Index into the attack's AttackShapes
+	UPROPERTY()
+	uint8 ShapeIndex = 0;
+};
+
+// Every hit a client predicted in one attack update - sent as one reliable RPC
+USTRUCT()
+struct FCombatHitClaimBatch
+{
+	GENERATED_BODY()
+
+	// ConfirmedMask is 32 bits wide - a fuller update sends a second batch
+	static constexpr int32 MAX_CLAIMS = 32;
+
+	// Echoed by the server's result
+	UPROPERTY()
+	uint8 Sequence = 0;
+
+	// Last attack frame tested and how many frames before it the same test covered (deferred frames)
+	UPROPERTY()
+	uint16 AttackFrame = 0;
+
+	UPROPERTY()
+	uint8 FrameSpan = 0;
+
+	UPROPERTY()
+	TArray<FCombatHitClaim> Claims;
+};
+
+// Server answer to one FCombatHitClaimBatch
+USTRUCT()
+struct FCombatHitClaimResult
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	uint8 Sequence = 0;
+
+	// Bit i set: Claims[i] was confirmed and applied, clear: rejected
+	UPROPERTY()
+	uint32 ConfirmedMask = 0;
+};
 
 UCLASS( ClassGroup=(Combat), meta=(BlueprintSpawnableComponent) )
-class EROEOREOREOR_API UAttackShapeComponent : public UActorComponent
+class EROEOREOREOR_API UAttackShapeComponent : public UActorComponent, public ICombatMemoryReporter
 {
 	GENERATED_BODY()
 
@@ -24,6 +84,11 @@ protected:
 public:	
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
+	// Per-attack copy of the shape row, hit tracking and rewind/claim scratch arrays - all Runtime, no tables
+	virtual void GetCombatMemoryUsage(FCombatMemoryUsage& OutUsage) const override;
+	virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
+
+
 	// Main interface
 	UFUNCTION(BlueprintCallable, Category = "Attack Shape")
 	void StartAttack(const FAttackPrototypeData& AttackData);
@@ -33,6 +98,12 @@ public:
 	
 	UFUNCTION(BlueprintPure, Category = "Attack Shape")
 	bool IsAttackActive() const { return bAttackActive; }
+	
+	const FAttackPrototypeData& GetCurrentAttackData() const { return CurrentAttackData; }
+	int32 GetCurrentFrame() const { return CurrentFrame; }
+	
+	// Set by UCombatSignificanceSubsystem - lower tiers test owed frames together and skip debug feedback
+	void SetCombatLod(ECombatLod Lod) { CombatLod = Lod; }
 
 	// Shape testing and visualization
 	UFUNCTION(BlueprintCallable, Category = "Attack Shape")
@@ -52,6 +123,10 @@ public:
 	UPROPERTY(BlueprintAssignable)
 	FOnAttackHit OnAttackHit;
 
+	// Owning client only - a predicted hit (already broadcast through OnAttackHit) the server did not confirm
+	UPROPERTY(BlueprintAssignable)
+	FOnAttackHitRejected OnAttackHitRejected;
+
 	// Configuration
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Debug")
 	bool bShowDebugShapes = true;
@@ -76,6 +151,19 @@ protected:
 	UPROPERTY(Transient)
 	int32 CurrentFrame = 0;
 	
+	// Last attack frame whose shapes were tested - frames after it are owed when the frame budget defers us
+	UPROPERTY(Transient)
+	int32 LastProcessedFrame = 0;
+	
+	// Consecutive frames the owed shape tests were deferred (UCombatWorkScheduler)
+	UPROPERTY(Transient)
+	int32 DeferredFrames = 0;
+	
+	ECombatLod CombatLod = ECombatLod::Full;
+	
+	// Largest LOD frame stride that keeps every multi-hit interval of the current attack - 1 when one is a frame or less
+	int32 MaxLodFrameStride = MAX_int32;
+	
 	UPROPERTY(Transient)
 	TArray<AActor*> AlreadyHitActors;
 	
@@ -96,6 +184,14 @@ protected:
 	UPROPERTY(Transient)
 	float PreviewEndTime = 0.0f;
 
+	// Owning client -> server: this update's predicted hits, validated in one pass against lag-compensated history
+	UFUNCTION(Server, Reliable)
+	void ServerHitClaims(const FCombatHitClaimBatch& Batch);
+
+	// Server -> owning client: confirmations and rejections for one batch
+	UFUNCTION(Client, Reliable)
+	void ClientHitClaimResult(FCombatHitClaimResult Result);
+
 private:
 	// Core functionality
 	void UpdateAttack(float DeltaTime);
@@ -112,6 +208,9 @@ private:
 	bool CheckRingCollision(const FAttackShapeData& ShapeData, TArray<FHitResult>& OutHits);
 	bool CheckArcCollision(const FAttackShapeData& ShapeData, TArray<FHitResult>& OutHits);
 	
+	// Server path for remote attackers - victims rewound to the attacker's view, no physics queries
+	bool CheckRewoundShapeCollision(const UCombatLagCompensationSubsystem& LagCompensation, const FAttackShapeData& ShapeData, TArray<FHitResult>& OutHits);
+	
 	// Shape-specific debug drawing
 	void DrawSphere(const FAttackShapeData& ShapeData, const FColor& Color, float Duration);
 	void DrawCapsule(const FAttackShapeData& ShapeData, const FColor& Color, float Duration);
@@ -124,9 +223,19 @@ private:
 	// Utility functions
 	FVector GetWorldPositionFromShape(const FAttackShapeData& ShapeData) const;
 	FRotator GetWorldRotationFromShape(const FAttackShapeData& ShapeData) const;
-	bool IsShapeActiveThisFrame(const FAttackShapeData& ShapeData) const;
+	static FVector GetWorldPositionFromShape(const FAttackShapeData& ShapeData, const FTransform& OwnerTransform);
+	static FRotator GetWorldRotationFromShape(const FAttackShapeData& ShapeData, const FTransform& OwnerTransform);
+	bool IsShapeActiveInFrames(const FAttackShapeData& ShapeData, int32 FirstFrame, int32 LastFrame) const;
 	bool CanHitActor(AActor* Actor, const FAttackShapeData& ShapeData) const;
 	void HandleActorHit(AActor* HitActor, const FVector& HitLocation, const FAttackShapeData& ShapeData);
+	void RecordHit(AActor* HitActor, const FAttackShapeData& ShapeData);
+	
+	// Hit claims (Combat.HitClaims.Enable) - the owning client tests, the server validates and applies
+	bool IsPredictingHits() const;
+	bool IsAwaitingHitClaims() const;
+	void AddHitClaim(int32 ShapeIndex, AActor* HitActor, const FVector& HitLocation, const FAttackShapeData& ShapeData);
+	void FlushHitClaims();
+	void ValidateHitClaims(const FCombatHitClaimBatch& Batch, FCombatHitClaimResult& OutResult);
 	
 	// GAS Integration
 	class UGameplayEffect* CreateDamageEffect(const FAttackPrototypeData& AttackData);
@@ -134,4 +243,22 @@ private:
 	// Performance optimization
 	float LastCollisionCheckTime = 0.0f;
 	static constexpr float CollisionCheckInterval = 1.0f / 60.0f; // 60 FPS
+	
+	// Lag compensation scratch - reused every check to avoid per-frame allocations
+	TArray<FLagCompensatedVolume> RewoundVolumes;
+	TArray<int32> RewoundHitIndices;
+	
+	// Claims of the current update, and sent batches waiting for their result (reliable, so answered in order)
+	FCombatHitClaimBatch PendingHitClaims;
+	TArray<FCombatHitClaimBatch> SentHitClaims;
+	uint8 NextHitClaimSequence = 0;
+	
+	// First batch sequence of the current attack - older results must not touch its hit tracking
+	uint8 AttackHitClaimSequence = 0;
+	
+	// Server: last attack frame a validated batch covered - a frame is only claimed once
+	int32 LastClaimedFrame = 0;
+	
+	// Server: attacker transform at an attack frame, from its movement history
+	FTransform GetAttackerTransformAtFrame(int32 AttackFrame) const;
 };
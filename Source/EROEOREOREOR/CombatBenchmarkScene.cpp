@@ -0,0 +1,230 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CombatBenchmarkScene.h"
+#include "CombatLog.h"
+#include "MyCharacter.h"
+#include "TargetDummy.h"
+#include "CombatStateMachineComponent.h"
+#include "CombatSystemTypes.h"
+#include "InputActionValue.h"
+#include "Engine/DataTable.h"
+#include "Engine/World.h"
+#include "GameFramework/GameModeBase.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/PlatformTime.h"
+
+#if !UE_BUILD_SHIPPING
+namespace CombatBenchmarkScene
+{
+	enum class EMovementInput : uint8
+	{
+		DashLeft,
+		Bounce,
+		DashRight,
+		Count
+	};
+
+	// Bots buffer every row of this table in order - light/heavy chains, the dash attack, heavy AoE rows
+	static const TCHAR* const BASIC_COMBAT_ACTIONS_PATH = TEXT("/Game/Data/Combat/DT_BasicCombatActions.DT_BasicCombatActions");
+
+	static UClass* ResolveFighterClass(const UWorld* World)
+	{
+		const APlayerController* PlayerController = World->GetFirstPlayerController();
+		if (const APawn* Pawn = PlayerController ? PlayerController->GetPawn() : nullptr)
+		{
+			if (Pawn->IsA<AMyCharacter>())
+			{
+				return Pawn->GetClass();
+			}
+		}
+
+		const AGameModeBase* GameMode = World->GetAuthGameMode();
+		UClass* DefaultPawnClass = GameMode ? GameMode->DefaultPawnClass.Get() : nullptr;
+		if (DefaultPawnClass && DefaultPawnClass->IsChildOf<AMyCharacter>())
+		{
+			return DefaultPawnClass;
+		}
+
+		return AMyCharacter::StaticClass();
+	}
+
+	static FVector GridLocation(const FVector& Origin, int32 Index, int32 Columns, float Offset)
+	{
+		const float X = (Index % Columns + Offset) * FCombatBenchmarkScene::GRID_SPACING;
+		const float Y = (Index / Columns + Offset) * FCombatBenchmarkScene::GRID_SPACING;
+		return Origin + FVector(X, Y, 0.0f);
+	}
+}
+
+bool FCombatBenchmarkScene::Spawn(UWorld* World, const FVector& Origin, int32 NumFighters, int32 NumDummies)
+{
+	using namespace CombatBenchmarkScene;
+
+	if (!World)
+	{
+		return false;
+	}
+
+	Destroy();
+
+	if (!BuildActionScript())
+	{
+		UE_LOG(LogCombat, Warning, TEXT("CombatBenchmarkScene: %s has no action rows - bots only dash and bounce"), BASIC_COMBAT_ACTIONS_PATH);
+	}
+
+	UClass* FighterClass = ResolveFighterClass(World);
+	const int32 Columns = FMath::Max(1, FMath::CeilToInt(FMath::Sqrt(static_cast<float>(FMath::Max(NumFighters, NumDummies)))));
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	Fighters.Reserve(NumFighters);
+	for (int32 Index = 0; Index < NumFighters; ++Index)
+	{
+		AMyCharacter* Fighter = World->SpawnActor<AMyCharacter>(FighterClass, GridLocation(Origin, Index, Columns, 0.0f), FRotator::ZeroRotator, SpawnParams);
+		if (!Fighter)
+		{
+			continue;
+		}
+
+		PrepareFighter(Fighter);
+		Fighters.Add(Fighter);
+	}
+
+	// Dummies sit between the fighters so attack shapes and AoEs find targets
+	Dummies.Reserve(NumDummies);
+	for (int32 Index = 0; Index < NumDummies; ++Index)
+	{
+		if (AActor* Dummy = World->SpawnActor<ATargetDummy>(ATargetDummy::StaticClass(), GridLocation(Origin, Index, Columns, 0.5f), FRotator::ZeroRotator, SpawnParams))
+		{
+			Dummies.Add(Dummy);
+		}
+	}
+
+	UE_LOG(LogCombat, Display, TEXT("CombatBenchmarkScene: Spawned %d/%d fighters (%s) and %d/%d dummies"),
+		Fighters.Num(), NumFighters, *GetNameSafe(FighterClass), Dummies.Num(), NumDummies);
+
+	return Fighters.Num() == NumFighters && Dummies.Num() == NumDummies;
+}
+
+bool FCombatBenchmarkScene::BuildActionScript()
+{
+	using namespace CombatBenchmarkScene;
+
+	ActionScript.Reset();
+
+	const UDataTable* BasicActions = LoadObject<UDataTable>(nullptr, BASIC_COMBAT_ACTIONS_PATH);
+	if (!BasicActions)
+	{
+		return false;
+	}
+
+	BasicActions->ForeachRow<FCombatActionData>(TEXT("CombatBenchmarkScene"), [this](const FName& RowName, const FCombatActionData& Row)
+	{
+		if (Row.ActionTag.IsValid())
+		{
+			ActionScript.Add(Row.ActionTag);
+		}
+	});
+
+	return ActionScript.Num() > 0;
+}
+
+void FCombatBenchmarkScene::PrepareFighter(AMyCharacter* Fighter)
+{
+	using namespace CombatBenchmarkScene;
+
+	// AI possession runs PossessedBy, which initializes GAS the same way a server-owned character does
+	if (!Fighter->GetController())
+	{
+		Fighter->SpawnDefaultController();
+	}
+
+	// A native fallback class has no blueprint-assigned action table
+	UCombatStateMachineComponent* StateMachine = Fighter->FindComponentByClass<UCombatStateMachineComponent>();
+	if (StateMachine && StateMachine->GetLoadedActionCount() == 0)
+	{
+		if (UDataTable* BasicActions = LoadObject<UDataTable>(nullptr, BASIC_COMBAT_ACTIONS_PATH))
+		{
+			StateMachine->LoadActionData(BasicActions);
+		}
+	}
+}
+
+void FCombatBenchmarkScene::Destroy()
+{
+	for (const TWeakObjectPtr<AMyCharacter>& Fighter : Fighters)
+	{
+		if (AMyCharacter* Character = Fighter.Get())
+		{
+			if (AController* Controller = Character->GetController())
+			{
+				Controller->Destroy();
+			}
+			Character->Destroy();
+		}
+	}
+
+	for (const TWeakObjectPtr<AActor>& Dummy : Dummies)
+	{
+		if (AActor* Actor = Dummy.Get())
+		{
+			Actor->Destroy();
+		}
+	}
+
+	Fighters.Reset();
+	Dummies.Reset();
+}
+
+void FCombatBenchmarkScene::DriveInputs(int64 Frame)
+{
+	using namespace CombatBenchmarkScene;
+
+	const FInputActionValue PressedValue(true);
+	const double InputTime = FPlatformTime::Seconds();
+
+	// One pass is every table row followed by a single movement press
+	const int32 PassLength = ActionScript.Num() + 1;
+
+	for (int32 Index = 0; Index < Fighters.Num(); ++Index)
+	{
+		// Stagger bots across the interval so activations spread evenly over frames
+		if ((Frame + Index) % INPUT_INTERVAL_FRAMES != 0)
+		{
+			continue;
+		}
+
+		AMyCharacter* Fighter = Fighters[Index].Get();
+		if (!Fighter)
+		{
+			continue;
+		}
+
+		const int64 Step = (Frame + Index) / INPUT_INTERVAL_FRAMES + Index;
+		const int32 Slot = static_cast<int32>(Step % PassLength);
+		if (ActionScript.IsValidIndex(Slot))
+		{
+			// Same path as an attack press - the state machine picks up the buffered tag on its next tick
+			if (UCombatStateMachineComponent* StateMachine = Fighter->FindComponentByClass<UCombatStateMachineComponent>())
+			{
+				StateMachine->BufferTimestampedInput(ActionScript[Slot], InputTime);
+			}
+			continue;
+		}
+
+		switch (static_cast<EMovementInput>((Step / PassLength) % static_cast<int32>(EMovementInput::Count)))
+		{
+			case EMovementInput::DashLeft:
+				Fighter->DashLeft(PressedValue);
+				break;
+			case EMovementInput::DashRight:
+				Fighter->DashRight(PressedValue);
+				break;
+			default:
+				Fighter->Bounce(PressedValue);
+				break;
+		}
+	}
+}
+#endif
@@ -0,0 +1,47 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+class AMyCharacter;
+class UWorld;
+
+#if !UE_BUILD_SHIPPING
+/**
+ * Scripted fighter scene for combat benchmarks
+ * Spawns AMyCharacter bots (AI-possessed, so GAS initializes as on a server) and target dummies in a grid,
+ * then walks every row of DT_BasicCombatActions on a fixed per-bot schedule, buffering each row's action tag,
+ * with one dash or bounce press through the Enhanced Input handlers after each pass over the table.
+ * Bots are staggered so each frame carries a similar share of activations.
+ */
+class EROEOREOREOR_API FCombatBenchmarkScene
+{
+public:
+	// Frames between two inputs of the same bot
+	static constexpr int32 INPUT_INTERVAL_FRAMES = 20;
+	static constexpr float GRID_SPACING = 300.0f;
+
+	// Bots use the local player's pawn class when it is an AMyCharacter, so blueprint-configured abilities come along
+	bool Spawn(UWorld* World, const FVector& Origin, int32 NumFighters, int32 NumDummies);
+	void Destroy();
+
+	// AI-possesses a spawned fighter and gives it the basic action table when its class has none
+	static void PrepareFighter(AMyCharacter* Fighter);
+
+	// Call once per frame with a monotonically increasing frame index
+	void DriveInputs(int64 Frame);
+
+	int32 GetNumFighters() const { return Fighters.Num(); }
+	int32 GetNumDummies() const { return Dummies.Num(); }
+
+private:
+	// Action tags of the basic action table in row order
+	bool BuildActionScript();
+
+	TArray<FGameplayTag> ActionScript;
+	TArray<TWeakObjectPtr<AMyCharacter>> Fighters;
+	TArray<TWeakObjectPtr<AActor>> Dummies;
+};
+#endif
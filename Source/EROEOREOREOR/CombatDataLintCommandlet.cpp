@@ -0,0 +1,51 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CombatDataLintCommandlet.h"
+#include "CombatDataLinter.h"
+#include "CombatLog.h"
+#include "Engine/DataTable.h"
+#include "Misc/DateTime.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+
+UCombatDataLintCommandlet::UCombatDataLintCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+	HelpDescription = TEXT("Score combat DataTable rows by estimated hit-query cost per second and write a JSON report");
+	HelpUsage = TEXT("-run=CombatDataLint [-Out=<path>] [-Strict]");
+}
+
+int32 UCombatDataLintCommandlet::Main(const FString& Params)
+{
+	FString Path;
+	if (!FParse::Value(*Params, TEXT("Out="), Path))
+	{
+		Path = FPaths::ProjectSavedDir() / TEXT("CombatLint") / FString::Printf(TEXT("CombatLint_%s.json"), *FDateTime::Now().ToString());
+	}
+	const bool bStrict = FParse::Param(*Params, TEXT("Strict"));
+
+	TArray<const UDataTable*> Tables;
+	FCombatDataLinter::FindCombatTables(Tables);
+	if (Tables.Num() == 0)
+	{
+		UE_LOG(LogCombat, Warning, TEXT("CombatDataLint: No attack prototype, combat action or AoE tables under /Game"));
+		return 0;
+	}
+
+	TArray<FCombatLintRow> Rows;
+	FCombatDataLinter::LintTables(Tables, Rows);
+	FCombatDataLinter::LogReport(Rows, true);
+
+	if (!FCombatDataLinter::WriteReport(Rows, Path))
+	{
+		UE_LOG(LogCombat, Error, TEXT("CombatDataLint: Failed to write %s"), *Path);
+		return 1;
+	}
+	UE_LOG(LogCombat, Display, TEXT("CombatDataLint: %d tables, %d rows - wrote %s"), Tables.Num(), Rows.Num(), *Path);
+
+	const bool bAnyFlagged = Rows.ContainsByPredicate([](const FCombatLintRow& Row) { return Row.IsFlagged(); });
+	return bStrict && bAnyFlagged ? 1 : 0;
+}
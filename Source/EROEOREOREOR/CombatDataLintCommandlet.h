@@ -0,0 +1,23 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "CombatDataLintCommandlet.generated.h"
+
+/**
+ * Headless combat data lint for CI - scores every combat DataTable row (FCombatDataLinter) and writes the JSON report
+ * Usage: UnrealEditor-Cmd <Project>.uproject -run=CombatDataLint [-Out=<path>] [-Strict]
+ * -Strict returns 1 when any row is over budget, an outlier or carries a rule flag.
+ */
+UCLASS()
+class EROEOREOREOR_API UCombatDataLintCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UCombatDataLintCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,507 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CombatDataLinter.h"
+#include "AoEPrototypeComponent.h"
+#include "CombatLog.h"
+#include "CombatMathKernels.h"
+#include "CombatPrototypeComponent.h"
+#include "CombatSystemTypes.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/DataTable.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Modules/ModuleManager.h"
+
+#if WITH_EDITOR
+#include "Misc/DataValidation.h"
+#endif
+
+// COMBAT DATA LINT - Which rows make hit detection expensive
+// Console: Combat.Lint [AllRows=0]
+// Commandlet: UnrealEditor-Cmd <Project>.uproject -run=CombatDataLint [-Out=<path>] [-Strict]
+// Reports go to Saved/CombatLint/CombatLint_<time>.json
+
+namespace CombatDataLinter
+{
+	static TAutoConsoleVariable<float> CVarMaxCostPerSecond(
+		TEXT("Combat.Lint.MaxCostPerSecond"),
+		2500.0f,
+		TEXT("Query cost per second (m^2 of broadphase per second) above which a combat data row is flagged"),
+		ECVF_Default);
+
+	static TAutoConsoleVariable<float> CVarOutlierFactor(
+		TEXT("Combat.Lint.OutlierFactor"),
+		4.0f,
+		TEXT("A row costing more than this times the median of its table kind is reported as an outlier"),
+		ECVF_Default);
+
+	static TAutoConsoleVariable<float> CVarLargeRadius(
+		TEXT("Combat.Lint.LargeRadius"),
+		1000.0f,
+		TEXT("Persistent AoE fields with a Radius above this are flagged"),
+		ECVF_Default);
+
+	static TAutoConsoleVariable<int32> CVarMaxExpansionFrames(
+		TEXT("Combat.Lint.MaxExpansionFrames"),
+		30,
+		TEXT("Expanding AoEs that query for more frames than this before reaching full radius are flagged"),
+		ECVF_Default);
+
+	static constexpr float CM2_PER_M2 = 10000.0f;
+	// Line traces have no footprint - they are charged as a strip this wide
+	static constexpr float LINE_TRACE_WIDTH = 100.0f;
+	// Fewer rows of a kind than this and the median means nothing
+	static constexpr int32 MIN_ROWS_FOR_OUTLIERS = 3;
+
+	static float CircleAreaM2(float Radius)
+	{
+		return PI * Radius * Radius / CM2_PER_M2;
+	}
+
+	// Footprint of the overlap the attack shape component issues for this shape (CheckShapeCollision)
+	static float AttackShapeAreaM2(const FAttackShapeData& Shape)
+	{
+		switch (Shape.ShapeType)
+		{
+			case EAttackShape::Capsule:
+				return CircleAreaM2(FMath::Max(Shape.PrimarySize, Shape.SecondarySize));
+			case EAttackShape::Box:
+				return CircleAreaM2(FVector(Shape.PrimarySize, Shape.SecondarySize, Shape.TertiarySize).Size());
+			case EAttackShape::Line:
+				return Shape.PrimarySize * LINE_TRACE_WIDTH / CM2_PER_M2;
+			case EAttackShape::Ring:
+				return CircleAreaM2(Shape.OuterRadius);
+			default:
+				// Sphere, and Cone/Arc, which gather with a PrimarySize sphere before filtering by angle
+				return CircleAreaM2(Shape.PrimarySize);
+		}
+	}
+
+	static const TCHAR* GetKindName(ECombatLintTable Kind)
+	{
+		switch (Kind)
+		{
+			case ECombatLintTable::AttackPrototypes: return TEXT("attack");
+			case ECombatLintTable::CombatActions: return TEXT("action");
+			default: return TEXT("aoe");
+		}
+	}
+
+	static FString Escape(const FString& Value)
+	{
+		return Value.ReplaceCharWithEscapedChar();
+	}
+}
+
+FCombatLintScore FCombatDataLinter::ScoreAttackPrototype(const FAttackPrototypeData& Attack)
+{
+	using namespace CombatDataLinter;
+
+	FCombatLintScore Score;
+	int32 FirstFrame = MAX_int32;
+	int32 LastFrame = MIN_int32;
+
+	for (int32 ShapeIndex = 0; ShapeIndex < Attack.AttackShapes.Num(); ++ShapeIndex)
+	{
+		const FAttackShapeData& Shape = Attack.AttackShapes[ShapeIndex];
+		const int32 ActiveFrames = Shape.DeactivationFrame - Shape.ActivationFrame + 1;
+		if (ActiveFrames <= 0)
+		{
+			Score.Flags.Add(FString::Printf(TEXT("Shape %d is never active (DeactivationFrame %d < ActivationFrame %d)"),
+				ShapeIndex, Shape.DeactivationFrame, Shape.ActivationFrame));
+			continue;
+		}
+
+		// One overlap per shape per frame
+		Score.QueriesPerActivation += ActiveFrames;
+		Score.QueryAreaM2 += ActiveFrames * AttackShapeAreaM2(Shape);
+		FirstFrame = FMath::Min(FirstFrame, Shape.ActivationFrame);
+		LastFrame = FMath::Max(LastFrame, Shape.DeactivationFrame);
+
+		const float Reach = Shape.ShapeType == EAttackShape::Cone ? Shape.ConeRange
+			: Shape.ShapeType == EAttackShape::Arc ? Shape.OuterRadius : 0.0f;
+		if (Reach > Shape.PrimarySize)
+		{
+			Score.Flags.Add(FString::Printf(TEXT("Shape %d gathers with a %.0f sphere (PrimarySize) but reaches %.0f - targets past %.0f are never tested"),
+				ShapeIndex, Shape.PrimarySize, Reach, Shape.PrimarySize));
+		}
+
+		for (int32 OtherIndex = ShapeIndex + 1; OtherIndex < Attack.AttackShapes.Num(); ++OtherIndex)
+		{
+			const FAttackShapeData& Other = Attack.AttackShapes[OtherIndex];
+			const int32 OverlapFirst = FMath::Max(Shape.ActivationFrame, Other.ActivationFrame);
+			const int32 OverlapLast = FMath::Min(Shape.DeactivationFrame, Other.DeactivationFrame);
+			if (OverlapFirst <= OverlapLast)
+			{
+				Score.Flags.Add(FString::Printf(TEXT("Shapes %d and %d are both queried on frames %d-%d"),
+					ShapeIndex, OtherIndex, OverlapFirst, OverlapLast));
+			}
+		}
+	}
+
+	if (Score.QueriesPerActivation > 0)
+	{
+		Score.ActiveSeconds = (LastFrame - FirstFrame + 1) * CombatConstants::FRAME_DURATION;
+	}
+	return Score;
+}
+
+FCombatLintScore FCombatDataLinter::ScoreAoEPrototype(const FAoEPrototypeData& AoE)
+{
+	using namespace CombatDataLinter;
+
+	const FAoEShapeData& Shape = AoE.ShapeData;
+	const FAoEBehaviorData& Behavior = AoE.BehaviorData;
+	const FAoEDamageData& Damage = AoE.DamageData;
+
+	// UpdateAoE runs from StartDelay until Lifetime; CheckAoEHits always gathers with the full Radius
+	const float Window = FMath::Max(0.0f, Behavior.Lifetime - Behavior.StartDelay);
+	const int32 WindowFrames = FMath::Max(1, FMath::CeilToInt(Window * CombatConstants::TARGET_FRAMERATE));
+
+	FCombatLintScore Score;
+	switch (Behavior.Behavior)
+	{
+		case EAoEBehavior::Instant:
+		case EAoEBehavior::Delayed:
+			Score.QueriesPerActivation = 1;
+			Score.ActiveSeconds = CombatConstants::FRAME_DURATION;
+			break;
+
+		case EAoEBehavior::Expanding:
+		{
+			for (int32 Frame = 1; Frame <= WindowFrames; ++Frame)
+			{
+				++Score.QueriesPerActivation;
+				const float ElapsedTime = Behavior.StartDelay + Frame * CombatConstants::FRAME_DURATION;
+				if (FCombatMathKernels::CurrentRadius(Shape, Behavior, ElapsedTime) >= Shape.Radius)
+				{
+					break;
+				}
+			}
+			Score.ActiveSeconds = Score.QueriesPerActivation * CombatConstants::FRAME_DURATION;
+
+			if (Score.QueriesPerActivation > CVarMaxExpansionFrames.GetValueOnAnyThread())
+			{
+				Score.Flags.Add(FString::Printf(TEXT("Expands over %d frames, each querying the full %.0f radius"),
+					Score.QueriesPerActivation, Shape.Radius));
+			}
+			break;
+		}
+
+		case EAoEBehavior::Projectile:
+		{
+			// Worst case flies the full range; after impact it keeps querying every frame until Lifetime
+			const float FlightSeconds = Behavior.ProjectileSpeed > 0.0f ? Behavior.ProjectileRange / Behavior.ProjectileSpeed : Window;
+			const float ImpactSeconds = FMath::Max(0.0f, Window - FlightSeconds);
+			Score.QueriesPerActivation = 1 + FMath::CeilToInt(ImpactSeconds * CombatConstants::TARGET_FRAMERATE);
+			Score.ActiveSeconds = FMath::Max(CombatConstants::FRAME_DURATION, ImpactSeconds);
+
+			if (ImpactSeconds > 0.0f)
+			{
+				Score.Flags.Add(FString::Printf(TEXT("Queries every frame for %.2fs after impact (Lifetime %.2f, flight %.2fs)"),
+					ImpactSeconds, Behavior.Lifetime, FlightSeconds));
+			}
+			break;
+		}
+
+		case EAoEBehavior::Persistent:
+			Score.QueriesPerActivation = Damage.HitInterval > 0.0f ? FMath::FloorToInt(Window / Damage.HitInterval) + 1 : WindowFrames;
+			Score.ActiveSeconds = FMath::Max(CombatConstants::FRAME_DURATION, Window);
+
+			if (Shape.Radius > CVarLargeRadius.GetValueOnAnyThread())
+			{
+				Score.Flags.Add(FString::Printf(TEXT("Persistent field with Radius %.0f for %.1fs"), Shape.Radius, Window));
+			}
+			break;
+
+		case EAoEBehavior::Traveling:
+			Score.QueriesPerActivation = WindowFrames;
+			Score.ActiveSeconds = FMath::Max(CombatConstants::FRAME_DURATION, Window);
+			break;
+	}
+
+	if (Damage.bAllowMultipleHits && Damage.HitInterval <= 0.0f && Score.QueriesPerActivation > 1)
+	{
+		Score.Flags.Add(FString::Printf(TEXT("HitInterval 0 with bAllowMultipleHits - every target in range takes a hit on each of %d queries"),
+			Score.QueriesPerActivation));
+	}
+
+	Score.QueryAreaM2 = Score.QueriesPerActivation * CircleAreaM2(Shape.Radius);
+	return Score;
+}
+
+FCombatLintScore FCombatDataLinter::ScoreCombatAction(const FCombatActionData& Action, const TMap<FString, const FAoEPrototypeData*>* AoEsByName)
+{
+	using namespace CombatDataLinter;
+
+	FCombatLintScore Score;
+
+	// The combat prototype sweeps HIT_RADIUS every Active frame; the action's frame data stands in for its timing
+	if (Action.bUseCombatPrototype && !Action.CombatPrototypeName.IsEmpty())
+	{
+		Score.QueriesPerActivation += Action.ActiveFrames;
+		Score.QueryAreaM2 += Action.ActiveFrames * CircleAreaM2(UCombatPrototypeComponent::HIT_RADIUS);
+	}
+
+	if (Action.bTriggerAoE && !Action.AoEPrototypeName.IsEmpty() && AoEsByName)
+	{
+		if (const FAoEPrototypeData* const* AoE = AoEsByName->Find(Action.AoEPrototypeName))
+		{
+			const FCombatLintScore AoEScore = ScoreAoEPrototype(**AoE);
+			Score.QueriesPerActivation += AoEScore.QueriesPerActivation;
+			Score.QueryAreaM2 += AoEScore.QueryAreaM2;
+		}
+		else
+		{
+			Score.Flags.Add(FString::Printf(TEXT("AoE '%s' is not in any AoE table - its cost is not counted"), *Action.AoEPrototypeName));
+		}
+	}
+
+	// Spammed back to back, an action repeats once per total duration
+	Score.ActiveSeconds = Action.GetTotalDurationSeconds();
+	return Score;
+}
+
+void FCombatDataLinter::FindCombatTables(TArray<const UDataTable*>& OutTables)
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	if (IsRunningCommandlet())
+	{
+		AssetRegistry.SearchAllAssets(true);
+	}
+
+	TArray<FAssetData> Assets;
+	AssetRegistry.GetAssetsByClass(UDataTable::StaticClass()->GetClassPathName(), Assets, true);
+
+	for (const FAssetData& Asset : Assets)
+	{
+		if (!Asset.PackageName.ToString().StartsWith(TEXT("/Game/")))
+		{
+			continue;
+		}
+
+		const UDataTable* Table = Cast<UDataTable>(Asset.GetAsset());
+		const UScriptStruct* RowStruct = Table ? Table->GetRowStruct() : nullptr;
+		if (RowStruct && (RowStruct->IsChildOf(FAttackPrototypeData::StaticStruct())
+			|| RowStruct->IsChildOf(FCombatActionData::StaticStruct())
+			|| RowStruct->IsChildOf(FAoEPrototypeData::StaticStruct())))
+		{
+			OutTables.Add(Table);
+		}
+	}
+}
+
+void FCombatDataLinter::LintTables(const TArray<const UDataTable*>& Tables, TArray<FCombatLintRow>& OutRows)
+{
+	using namespace CombatDataLinter;
+
+	// Actions name their AoE by PrototypeName, the same key UAoEPrototypeComponent loads rows under
+	TMap<FString, const FAoEPrototypeData*> AoEsByName;
+	for (const UDataTable* Table : Tables)
+	{
+		if (Table->GetRowStruct()->IsChildOf(FAoEPrototypeData::StaticStruct()))
+		{
+			Table->ForeachRow<FAoEPrototypeData>(TEXT("CombatDataLint"), [&AoEsByName](const FName& Key, const FAoEPrototypeData& Row)
+			{
+				AoEsByName.Add(Row.PrototypeName, &Row);
+			});
+		}
+	}
+
+	for (const UDataTable* Table : Tables)
+	{
+		const UScriptStruct* RowStruct = Table->GetRowStruct();
+		for (const TPair<FName, uint8*>& RowPair : Table->GetRowMap())
+		{
+			FCombatLintRow& Row = OutRows.AddDefaulted_GetRef();
+			Row.Table = Table->GetFName();
+			Row.Row = RowPair.Key;
+
+			if (RowStruct->IsChildOf(FAttackPrototypeData::StaticStruct()))
+			{
+				Row.Kind = ECombatLintTable::AttackPrototypes;
+				Row.Score = ScoreAttackPrototype(*reinterpret_cast<const FAttackPrototypeData*>(RowPair.Value));
+			}
+			else if (RowStruct->IsChildOf(FCombatActionData::StaticStruct()))
+			{
+				Row.Kind = ECombatLintTable::CombatActions;
+				Row.Score = ScoreCombatAction(*reinterpret_cast<const FCombatActionData*>(RowPair.Value), &AoEsByName);
+			}
+			else
+			{
+				Row.Kind = ECombatLintTable::AoEPrototypes;
+				Row.Score = ScoreAoEPrototype(*reinterpret_cast<const FAoEPrototypeData*>(RowPair.Value));
+			}
+		}
+	}
+
+	const float MaxCostPerSecond = CVarMaxCostPerSecond.GetValueOnAnyThread();
+	const float OutlierFactor = CVarOutlierFactor.GetValueOnAnyThread();
+	for (const ECombatLintTable Kind : { ECombatLintTable::AttackPrototypes, ECombatLintTable::CombatActions, ECombatLintTable::AoEPrototypes })
+	{
+		TArray<float> Costs;
+		for (const FCombatLintRow& Row : OutRows)
+		{
+			if (Row.Kind == Kind && Row.Score.GetCostPerSecond() > 0.0f)
+			{
+				Costs.Add(Row.Score.GetCostPerSecond());
+			}
+		}
+		Costs.Sort();
+		const float Median = Costs.Num() >= MIN_ROWS_FOR_OUTLIERS ? Costs[Costs.Num() / 2] : 0.0f;
+
+		for (FCombatLintRow& Row : OutRows)
+		{
+			if (Row.Kind == Kind)
+			{
+				Row.bOverBudget = Row.Score.GetCostPerSecond() > MaxCostPerSecond;
+				Row.bOutlier = Median > 0.0f && Row.Score.GetCostPerSecond() > Median * OutlierFactor;
+			}
+		}
+	}
+
+	OutRows.Sort([](const FCombatLintRow& A, const FCombatLintRow& B)
+	{
+		return A.Score.GetCostPerSecond() > B.Score.GetCostPerSecond();
+	});
+}
+
+void FCombatDataLinter::LogReport(const TArray<FCombatLintRow>& Rows, bool bAllRows)
+{
+	using namespace CombatDataLinter;
+
+	int32 NumFlagged = 0;
+	for (const FCombatLintRow& Row : Rows)
+	{
+		NumFlagged += Row.IsFlagged() ? 1 : 0;
+	}
+	UE_LOG(LogCombat, Display, TEXT("Combat.Lint: %d rows, %d flagged (budget %.0f m^2/s, outlier %.1fx median)"),
+		Rows.Num(), NumFlagged, CVarMaxCostPerSecond.GetValueOnAnyThread(), CVarOutlierFactor.GetValueOnAnyThread());
+
+	for (const FCombatLintRow& Row : Rows)
+	{
+		if (!bAllRows && !Row.IsFlagged())
+		{
+			continue;
+		}
+
+		const FString Line = FString::Printf(TEXT("  %-6s %-24s %-28s %9.1f m^2/s  %4d queries  %5.2fs%s%s"),
+			GetKindName(Row.Kind), *Row.Table.ToString(), *Row.Row.ToString(), Row.Score.GetCostPerSecond(),
+			Row.Score.QueriesPerActivation, Row.Score.ActiveSeconds,
+			Row.bOverBudget ? TEXT("  OVER BUDGET") : TEXT(""), Row.bOutlier ? TEXT("  OUTLIER") : TEXT(""));
+		if (Row.IsFlagged())
+		{
+			UE_LOG(LogCombat, Warning, TEXT("%s"), *Line);
+		}
+		else
+		{
+			UE_LOG(LogCombat, Display, TEXT("%s"), *Line);
+		}
+
+		for (const FString& Flag : Row.Score.Flags)
+		{
+			UE_LOG(LogCombat, Warning, TEXT("      - %s"), *Flag);
+		}
+	}
+}
+
+bool FCombatDataLinter::WriteReport(const TArray<FCombatLintRow>& Rows, const FString& Path)
+{
+	using namespace CombatDataLinter;
+
+	FString Json;
+	Json += TEXT("{\n");
+	Json += FString::Printf(TEXT("\t\"timestamp\": \"%s\",\n"), *FDateTime::UtcNow().ToIso8601());
+	Json += FString::Printf(TEXT("\t\"max_cost_per_second\": %.1f,\n"), CVarMaxCostPerSecond.GetValueOnAnyThread());
+	Json += FString::Printf(TEXT("\t\"outlier_factor\": %.2f,\n"), CVarOutlierFactor.GetValueOnAnyThread());
+	Json += TEXT("\t\"rows\": [");
+
+	for (int32 Index = 0; Index < Rows.Num(); ++Index)
+	{
+		const FCombatLintRow& Row = Rows[Index];
+
+		FString Flags;
+		for (int32 FlagIndex = 0; FlagIndex < Row.Score.Flags.Num(); ++FlagIndex)
+		{
+			Flags += FString::Printf(TEXT("%s\"%s\""), FlagIndex > 0 ? TEXT(", ") : TEXT(""), *Escape(Row.Score.Flags[FlagIndex]));
+		}
+
+		Json += FString::Printf(TEXT("%s\n\t\t{ \"kind\": \"%s\", \"table\": \"%s\", \"row\": \"%s\", \"cost_per_second\": %.2f, ")
+			TEXT("\"queries_per_activation\": %d, \"query_area_m2\": %.2f, \"active_seconds\": %.3f, ")
+			TEXT("\"over_budget\": %s, \"outlier\": %s, \"flags\": [%s] }"),
+			Index > 0 ? TEXT(",") : TEXT(""), GetKindName(Row.Kind), *Escape(Row.Table.ToString()), *Escape(Row.Row.ToString()),
+			Row.Score.GetCostPerSecond(), Row.Score.QueriesPerActivation, Row.Score.QueryAreaM2, Row.Score.ActiveSeconds,
+			Row.bOverBudget ? TEXT("true") : TEXT("false"), Row.bOutlier ? TEXT("true") : TEXT("false"), *Flags);
+	}
+
+	Json += TEXT("\n\t]\n}\n");
+	return FFileHelper::SaveStringToFile(Json, *Path);
+}
+
+#if WITH_EDITOR
+EDataValidationResult FCombatDataLinter::ValidateScore(const FCombatLintScore& Score, const FString& Label, FDataValidationContext& Context)
+{
+	using namespace CombatDataLinter;
+
+	// Cost is a warning, never invalid data - the row still works, it is just expensive
+	for (const FString& Flag : Score.Flags)
+	{
+		Context.AddWarning(FText::FromString(FString::Printf(TEXT("%s: %s"), *Label, *Flag)));
+	}
+
+	const float MaxCostPerSecond = CVarMaxCostPerSecond.GetValueOnAnyThread();
+	if (Score.GetCostPerSecond() > MaxCostPerSecond)
+	{
+		Context.AddWarning(FText::FromString(FString::Printf(TEXT("%s: Estimated query cost %.0f m^2/s is over the %.0f budget (Combat.Lint.MaxCostPerSecond)"),
+			*Label, Score.GetCostPerSecond(), MaxCostPerSecond)));
+	}
+	return EDataValidationResult::Valid;
+}
+
+EDataValidationResult FAttackPrototypeData::IsDataValid(FDataValidationContext& Context) const
+{
+	return FCombatDataLinter::ValidateScore(FCombatDataLinter::ScoreAttackPrototype(*this), AttackName, Context);
+}
+
+EDataValidationResult FCombatActionData::IsDataValid(FDataValidationContext& Context) const
+{
+	return FCombatDataLinter::ValidateScore(FCombatDataLinter::ScoreCombatAction(*this, nullptr), DisplayName, Context);
+}
+
+EDataValidationResult FAoEPrototypeData::IsDataValid(FDataValidationContext& Context) const
+{
+	return FCombatDataLinter::ValidateScore(FCombatDataLinter::ScoreAoEPrototype(*this), PrototypeName, Context);
+}
+#endif
+
+#if !UE_BUILD_SHIPPING
+namespace CombatDataLinter
+{
+	static void RunLint(const TArray<FString>& Args, UWorld* World)
+	{
+		const bool bAllRows = Args.IsValidIndex(0) && FCString::Atoi(*Args[0]) != 0;
+
+		TArray<const UDataTable*> Tables;
+		FCombatDataLinter::FindCombatTables(Tables);
+
+		TArray<FCombatLintRow> Rows;
+		FCombatDataLinter::LintTables(Tables, Rows);
+		FCombatDataLinter::LogReport(Rows, bAllRows);
+
+		const FString Path = FPaths::ProjectSavedDir() / TEXT("CombatLint") /
+			FString::Printf(TEXT("CombatLint_%s.json"), *FDateTime::Now().ToString());
+		if (FCombatDataLinter::WriteReport(Rows, Path))
+		{
+			UE_LOG(LogCombat, Display, TEXT("Combat.Lint: Wrote %s"), *Path);
+		}
+	}
+
+	static FAutoConsoleCommandWithWorldAndArgs LintCommand(
+		TEXT("Combat.Lint"),
+		TEXT("Score every attack prototype, combat action and AoE row by estimated query cost per second and log flagged rows. Args: [AllRows=0]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&RunLint));
+}
+#endif
@@ -0,0 +1,76 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UDataTable;
+class FDataValidationContext;
+struct FAttackPrototypeData;
+struct FAoEPrototypeData;
+struct FCombatActionData;
+enum class EDataValidationResult : uint8;
+
+enum class ECombatLintTable : uint8
+{
+	AttackPrototypes,
+	CombatActions,
+	AoEPrototypes
+};
+
+// Estimated hit-query load of one row - one activation, mirrored from how the components query at 60 fps
+struct EROEOREOREOR_API FCombatLintScore
+{
+	int32 QueriesPerActivation = 0;
+	// Sum over every query of its broadphase footprint, m^2
+	float QueryAreaM2 = 0.0f;
+	// Span the queries are spread over - attack shape window, AoE query window, or a whole action
+	float ActiveSeconds = 0.0f;
+	TArray<FString> Flags;
+
+	float GetCostPerSecond() const { return ActiveSeconds > 0.0f ? QueryAreaM2 / ActiveSeconds : 0.0f; }
+};
+
+struct EROEOREOREOR_API FCombatLintRow
+{
+	FName Table;
+	FName Row;
+	ECombatLintTable Kind = ECombatLintTable::AttackPrototypes;
+	FCombatLintScore Score;
+	bool bOverBudget = false;
+	// Costlier than Combat.Lint.OutlierFactor times the median of its table kind
+	bool bOutlier = false;
+
+	bool IsFlagged() const { return bOverBudget || bOutlier || Score.Flags.Num() > 0; }
+};
+
+/**
+ * Combat data performance linter - scores DT_AttackPrototypes, DT_BasicCombatActions and AoE table rows by
+ * estimated query cost per second: queries x broadphase footprint / active time (m^2 per second).
+ * The footprint is the area of the query the component actually issues, which is not always the shape's reach:
+ * cones and arcs gather with a PrimarySize sphere, AoEs with their full Radius even while expanding.
+ *
+ * Editor: the rows' IsDataValid reports rule flags and over-budget rows as Validate Data warnings.
+ * Report: Combat.Lint console command and the CombatDataLint commandlet add per-table outliers and write JSON.
+ */
+class EROEOREOREOR_API FCombatDataLinter
+{
+public:
+	static FCombatLintScore ScoreAttackPrototype(const FAttackPrototypeData& Attack);
+	static FCombatLintScore ScoreAoEPrototype(const FAoEPrototypeData& AoE);
+	// AoEsByName resolves the action's AoEPrototypeName; null leaves the AoE share out
+	static FCombatLintScore ScoreCombatAction(const FCombatActionData& Action, const TMap<FString, const FAoEPrototypeData*>* AoEsByName);
+
+	// Every /Game DataTable whose row struct is one of the three combat rows, loaded
+	static void FindCombatTables(TArray<const UDataTable*>& OutTables);
+
+	// Scores every row, then marks over-budget rows and per-kind outliers; sorted by cost, highest first
+	static void LintTables(const TArray<const UDataTable*>& Tables, TArray<FCombatLintRow>& OutRows);
+
+	static void LogReport(const TArray<FCombatLintRow>& Rows, bool bAllRows);
+	static bool WriteReport(const TArray<FCombatLintRow>& Rows, const FString& Path);
+
+#if WITH_EDITOR
+	static EDataValidationResult ValidateScore(const FCombatLintScore& Score, const FString& Label, FDataValidationContext& Context);
+#endif
+};
@@ -0,0 +1,311 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CombatHitchCapture.h"
+
+#if !UE_BUILD_SHIPPING
+#include "CombatLog.h"
+#include "CombatMemory.h"
+#include "CombatStateMachineComponent.h"
+#include "CombatPrototypeComponent.h"
+#include "AttackShapeComponent.h"
+#include "AoEPrototypeComponent.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectIterator.h"
+
+static TAutoConsoleVariable<bool> CVarCombatHitchEnable(
+	TEXT("Combat.Hitch.Enable"),
+	false,
+	TEXT("Keep the last 120 frames of combat timings and dump them with a combat census when a frame goes over Combat.Hitch.ThresholdMs."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarCombatHitchThresholdMs(
+	TEXT("Combat.Hitch.ThresholdMs"),
+	4.0f,
+	TEXT("Combat game-thread time in one frame that counts as a hitch, in milliseconds."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarCombatHitchCooldownSeconds(
+	TEXT("Combat.Hitch.CooldownSeconds"),
+	10.0f,
+	TEXT("Minimum time between two hitch dumps - a sustained overload writes one file, not one per frame."),
+	ECVF_Default);
+
+TArray<FCombatHitchCapture::FFrameSample> FCombatHitchCapture::History;
+int32 FCombatHitchCapture::NextSample = 0;
+double FCombatHitchCapture::PreviousScopeMs[static_cast<int32>(ECombatScope::Count)] = {};
+double FCombatHitchCapture::LastDumpSeconds = -DBL_MAX;
+bool FCombatHitchCapture::bCapturing = false;
+
+namespace CombatHitchCapture
+{
+	static FString Escape(const FString& Value)
+	{
+		return Value.ReplaceCharWithEscapedChar();
+	}
+
+	template<typename EnumType>
+	static FString EnumName(EnumType Value)
+	{
+		return StaticEnum<EnumType>()->GetNameStringByValue(static_cast<int64>(Value));
+	}
+
+	template<typename ComponentType>
+	static bool IsCensusComponent(const ComponentType* Component)
+	{
+		const UWorld* World = Component->GetWorld();
+		return World && World->IsGameWorld() && Component->GetOwner();
+	}
+
+	static void AppendCensus(FString& Json)
+	{
+		Json += TEXT("\t\"state_machines\": [");
+		bool bFirst = true;
+		for (TObjectIterator<UCombatStateMachineComponent> It; It; ++It)
+		{
+			const UCombatStateMachineComponent* StateMachine = *It;
+			if (!IsCensusComponent(StateMachine) || StateMachine->GetCurrentState() == ECombatState::Idle)
+			{
+				continue;
+			}
+
+			Json += FString::Printf(TEXT("%s\n\t\t{ \"owner\": \"%s\", \"state\": \"%s\", \"action\": \"%s\", \"frame\": %d, \"combo\": %d, \"buffered_inputs\": %d }"),
+				bFirst ? TEXT("") : TEXT(","),
+				*Escape(StateMachine->GetOwner()->GetName()),
+				*EnumName(StateMachine->GetCurrentState()),
+				*Escape(StateMachine->GetCurrentActionTag().ToString()),
+				StateMachine->GetCurrentFrame(),
+				StateMachine->GetComboCount(),
+				StateMachine->GetInputBufferSize());
+			bFirst = false;
+		}
+		Json += TEXT("\n\t],\n");
+
+		Json += TEXT("\t\"prototypes\": [");
+		bFirst = true;
+		for (TObjectIterator<UCombatPrototypeComponent> It; It; ++It)
+		{
+			const UCombatPrototypeComponent* Prototype = *It;
+			if (!IsCensusComponent(Prototype) || !Prototype->IsExecutingAction())
+			{
+				continue;
+			}
+
+			const FCombatPrototypeData& Data = Prototype->GetCurrentAttackData();
+			Json += FString::Printf(TEXT("%s\n\t\t{ \"owner\": \"%s\", \"prototype\": \"%s\", \"phase\": \"%s\", \"trajectory\": \"%s\" }"),
+				bFirst ? TEXT("") : TEXT(","),
+				*Escape(Prototype->GetOwner()->GetName()),
+				*Escape(Data.PrototypeName),
+				*EnumName(Prototype->GetCurrentPhase()),
+				*EnumName(Data.TrajectoryData.TrajectoryType));
+			bFirst = false;
+		}
+		Json += TEXT("\n\t],\n");
+
+		Json += TEXT("\t\"attacks\": [");
+		bFirst = true;
+		for (TObjectIterator<UAttackShapeComponent> It; It; ++It)
+		{
+			const UAttackShapeComponent* AttackShape = *It;
+			if (!IsCensusComponent(AttackShape) || !AttackShape->IsAttackActive())
+			{
+				continue;
+			}
+
+			const FAttackPrototypeData& Attack = AttackShape->GetCurrentAttackData();
+			FString Shapes;
+			for (const FAttackShapeData& Shape : Attack.AttackShapes)
+			{
+				Shapes += FString::Printf(TEXT("%s\"%s %d-%d%s\""), Shapes.IsEmpty() ? TEXT("") : TEXT(", "),
+					*EnumName(Shape.ShapeType), Shape.ActivationFrame, Shape.DeactivationFrame, Shape.bAllowMultiHit ? TEXT(" multi") : TEXT(""));
+			}
+
+			Json += FString::Printf(TEXT("%s\n\t\t{ \"owner\": \"%s\", \"attack\": \"%s\", \"frame\": %d, \"shapes\": [%s] }"),
+				bFirst ? TEXT("") : TEXT(","),
+				*Escape(AttackShape->GetOwner()->GetName()),
+				*Escape(Attack.AttackName),
+				AttackShape->GetCurrentFrame(),
+				*Shapes);
+			bFirst = false;
+		}
+		Json += TEXT("\n\t],\n");
+
+		Json += TEXT("\t\"aoes\": [");
+		bFirst = true;
+		for (TObjectIterator<UAoEPrototypeComponent> It; It; ++It)
+		{
+			const UAoEPrototypeComponent* AoEComponent = *It;
+			if (!IsCensusComponent(AoEComponent))
+			{
+				continue;
+			}
+
+			for (const FActiveAoE& AoE : AoEComponent->GetActiveAoEs())
+			{
+				if (!AoE.bIsActive)
+				{
+					continue;
+				}
+
+				Json += FString::Printf(TEXT("%s\n\t\t{ \"owner\": \"%s\", \"aoe\": \"%s\", \"behavior\": \"%s\", \"shape\": \"%s\", \"radius\": %.1f, \"hit_interval\": %.3f, \"elapsed\": %.3f, \"hit_actors\": %d, \"deferred_frames\": %d }"),
+					bFirst ? TEXT("") : TEXT(","),
+					*Escape(AoEComponent->GetOwner()->GetName()),
+					*Escape(AoE.Name),
+					*EnumName(AoE.Data.BehaviorData.Behavior),
+					*EnumName(AoE.Data.ShapeData.Shape),
+					AoE.Data.ShapeData.Radius,
+					AoE.Data.DamageData.HitInterval,
+					AoE.ElapsedTime,
+					AoE.ActorHitCounts.Num(),
+					AoE.DeferredFrames);
+				bFirst = false;
+			}
+		}
+		Json += TEXT("\n\t]\n");
+	}
+}
+
+void FCombatHitchCapture::BeginCapture()
+{
+	LLM_SCOPE_BYTAG(Combat_Debug);
+
+	History.SetNum(HISTORY_FRAMES);
+	NextSample = 0;
+	for (int32 Scope = 0; Scope < static_cast<int32>(ECombatScope::Count); ++Scope)
+	{
+		PreviousScopeMs[Scope] = FCombatScopeTimings::GetTotalMilliseconds(static_cast<ECombatScope>(Scope));
+	}
+	bCapturing = true;
+}
+
+void FCombatHitchCapture::EndCapture()
+{
+	FCombatScopeTimings::SetCapture(ECombatScopeCaptureClient::HitchCapture, false);
+	History.Empty();
+	bCapturing = false;
+}
+
+void FCombatHitchCapture::EndFrame()
+{
+	if (!CVarCombatHitchEnable.GetValueOnGameThread())
+	{
+		if (bCapturing)
+		{
+			EndCapture();
+		}
+		return;
+	}
+
+	if (!bCapturing)
+	{
+		// The first frame only sets the baseline - scope totals before it are not this frame's
+		BeginCapture();
+		FCombatScopeTimings::SetCapture(ECombatScopeCaptureClient::HitchCapture, true);
+		return;
+	}
+
+	FFrameSample& Sample = History[NextSample];
+	NextSample = (NextSample + 1) % HISTORY_FRAMES;
+
+	Sample.FrameNumber = GFrameCounter;
+	Sample.FrameMs = static_cast<float>(FApp::GetDeltaTime() * 1000.0);
+
+	for (int32 Scope = 0; Scope < static_cast<int32>(ECombatScope::Count); ++Scope)
+	{
+		const double TotalMs = FCombatScopeTimings::GetTotalMilliseconds(static_cast<ECombatScope>(Scope));
+		// A total below the previous one was reset by a benchmark - the whole total is this frame's
+		Sample.ScopeMs[Scope] = static_cast<float>(TotalMs >= PreviousScopeMs[Scope] ? TotalMs - PreviousScopeMs[Scope] : TotalMs);
+		PreviousScopeMs[Scope] = TotalMs;
+	}
+
+	for (int32 Counter = 0; Counter < static_cast<int32>(ECombatCounter::Count); ++Counter)
+	{
+		Sample.Counters[Counter] = FCombatFrameCounters::GetLastFrame(static_cast<ECombatCounter>(Counter));
+	}
+
+	Sample.CombatMs = 0.0f;
+	for (int32 Scope = 0; Scope < static_cast<int32>(ECombatScope::Count); ++Scope)
+	{
+		if (FCombatScopeTimings::IsRoot(static_cast<ECombatScope>(Scope)))
+		{
+			Sample.CombatMs += Sample.ScopeMs[Scope];
+		}
+	}
+
+	const float ThresholdMs = CVarCombatHitchThresholdMs.GetValueOnGameThread();
+	const double NowSeconds = FPlatformTime::Seconds();
+	if (Sample.CombatMs > ThresholdMs && NowSeconds - LastDumpSeconds >= CVarCombatHitchCooldownSeconds.GetValueOnGameThread())
+	{
+		LastDumpSeconds = NowSeconds;
+		Dump(Sample, ThresholdMs);
+	}
+}
+
+void FCombatHitchCapture::Dump(const FFrameSample& Hitch, float ThresholdMs)
+{
+	LLM_SCOPE_BYTAG(Combat_Debug);
+
+	FString Json;
+	Json += TEXT("{\n");
+	Json += FString::Printf(TEXT("\t\"timestamp\": \"%s\",\n"), *FDateTime::UtcNow().ToIso8601());
+	Json += FString::Printf(TEXT("\t\"hitch_frame\": %llu,\n"), Hitch.FrameNumber);
+	Json += FString::Printf(TEXT("\t\"combat_ms\": %.4f,\n"), Hitch.CombatMs);
+	Json += FString::Printf(TEXT("\t\"frame_ms\": %.4f,\n"), Hitch.FrameMs);
+	Json += FString::Printf(TEXT("\t\"threshold_ms\": %.4f,\n"), ThresholdMs);
+
+	// Oldest first, ending on the hitch frame - frames never sampled since capture began are skipped
+	Json += TEXT("\t\"frames\": [");
+	bool bFirst = true;
+	for (int32 Offset = 0; Offset < HISTORY_FRAMES; ++Offset)
+	{
+		const FFrameSample& Sample = History[(NextSample + Offset) % HISTORY_FRAMES];
+		if (Sample.FrameNumber == 0)
+		{
+			continue;
+		}
+
+		Json += FString::Printf(TEXT("%s\n\t\t{ \"frame\": %llu, \"frame_ms\": %.4f, \"combat_ms\": %.4f, \"scopes\": {"),
+			bFirst ? TEXT("") : TEXT(","), Sample.FrameNumber, Sample.FrameMs, Sample.CombatMs);
+		bFirst = false;
+
+		bool bFirstScope = true;
+		for (int32 Scope = 0; Scope < static_cast<int32>(ECombatScope::Count); ++Scope)
+		{
+			if (Sample.ScopeMs[Scope] > 0.0f)
+			{
+				Json += FString::Printf(TEXT("%s\"%s\": %.4f"), bFirstScope ? TEXT(" ") : TEXT(", "),
+					FCombatScopeTimings::GetName(static_cast<ECombatScope>(Scope)), Sample.ScopeMs[Scope]);
+				bFirstScope = false;
+			}
+		}
+
+		Json += TEXT(" }, \"counters\": {");
+		for (int32 Counter = 0; Counter < static_cast<int32>(ECombatCounter::Count); ++Counter)
+		{
+			Json += FString::Printf(TEXT("%s\"%s\": %u"), Counter == 0 ? TEXT(" ") : TEXT(", "),
+				FCombatFrameCounters::GetName(static_cast<ECombatCounter>(Counter)), Sample.Counters[Counter]);
+		}
+		Json += TEXT(" } }");
+	}
+	Json += TEXT("\n\t],\n");
+
+	// Census is taken at dump time, the end of the hitch frame
+	CombatHitchCapture::AppendCensus(Json);
+	Json += TEXT("}\n");
+
+	const FString Path = FPaths::ProjectSavedDir() / TEXT("CombatHitches") /
+		FString::Printf(TEXT("CombatHitch_%s.json"), *FDateTime::Now().ToString());
+	if (FFileHelper::SaveStringToFile(Json, *Path))
+	{
+		UE_LOG(LogCombat, Warning, TEXT("Combat hitch: %.2f ms of combat work in frame %llu (threshold %.2f ms), wrote %s"),
+			Hitch.CombatMs, Hitch.FrameNumber, ThresholdMs, *Path);
+	}
+	else
+	{
+		UE_LOG(LogCombat, Error, TEXT("Combat hitch: Failed to write %s"), *Path);
+	}
+}
+#endif
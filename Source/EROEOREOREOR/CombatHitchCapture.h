@@ -0,0 +1,47 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CombatStats.h"
+
+#if !UE_BUILD_SHIPPING
+/**
+ * Combat hitch capture - the last HISTORY_FRAMES frames of combat scope times and counters, kept in a ring
+ * When a frame's combat time passes Combat.Hitch.ThresholdMs the window is written to
+ * Saved/CombatHitches/CombatHitch_<time>.json together with a census of the live state machines, attacks
+ * and AoEs, so the prototype or AoE configuration behind the spike is on file.
+ *
+ * Off unless Combat.Hitch.Enable is set; while on, every COMBAT_SCOPE is timed (FCombatScopeTimings).
+ * Combat time is the sum of the root scopes - component ticks, movement phys and ability activation -
+ * so nested scopes are not counted twice.
+ */
+class EROEOREOREOR_API FCombatHitchCapture
+{
+public:
+	static constexpr int32 HISTORY_FRAMES = 120;
+
+	// Game thread, end of frame, after FCombatFrameCounters::Flush
+	static void EndFrame();
+
+private:
+	struct FFrameSample
+	{
+		uint64 FrameNumber = 0;
+		float FrameMs = 0.0f;
+		float CombatMs = 0.0f;
+		float ScopeMs[static_cast<int32>(ECombatScope::Count)] = {};
+		uint32 Counters[static_cast<int32>(ECombatCounter::Count)] = {};
+	};
+
+	static TArray<FFrameSample> History;
+	static int32 NextSample;
+	static double PreviousScopeMs[static_cast<int32>(ECombatScope::Count)];
+	static double LastDumpSeconds;
+	static bool bCapturing;
+
+	static void BeginCapture();
+	static void EndCapture();
+	static void Dump(const FFrameSample& Hitch, float ThresholdMs);
+};
+#endif
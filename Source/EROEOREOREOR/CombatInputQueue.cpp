@@ -0,0 +1,238 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CombatInputQueue.h"
+#include "CombatLog.h"
+#include "Framework/Application/SlateApplication.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+
+// INPUT CLOCK
+
+void FCombatInputClock::Anchor(int64 InFrame, double InPlatformTime)
+{
+    AnchorFrame = InFrame;
+    AnchorPlatformTime = InPlatformTime;
+}
+
+void FCombatInputClock::ToCombatFrame(double PlatformTime, int64& OutFrame, float& OutSubFrameOffset) const
+{
+    const double FramePosition = static_cast<double>(AnchorFrame) + (PlatformTime - AnchorPlatformTime) / FrameDuration;
+    const double WholeFrames = FMath::FloorToDouble(FramePosition);
+
+    OutFrame = static_cast<int64>(WholeFrames);
+    OutSubFrameOffset = static_cast<float>(FramePosition - WholeFrames);
+}
+
+// INPUT QUEUE
+
+bool FCombatInputQueue::Push(const FCombatInputEvent& Event)
+{
+    const uint32 CurrentTail = Tail.load(std::memory_order_relaxed);
+    if (CurrentTail - Head.load(std::memory_order_acquire) >= CAPACITY)
+    {
+        return false;
+    }
+
+    Events[CurrentTail & (CAPACITY - 1)] = Event;
+    Tail.store(CurrentTail + 1, std::memory_order_release);
+    return true;
+}
+
+const FCombatInputEvent* FCombatInputQueue::Peek() const
+{
+    const uint32 CurrentHead = Head.load(std::memory_order_relaxed);
+    if (CurrentHead == Tail.load(std::memory_order_acquire))
+    {
+        return nullptr;
+    }
+
+    return &Events[CurrentHead & (CAPACITY - 1)];
+}
+
+void FCombatInputQueue::Pop()
+{
+    const uint32 CurrentHead = Head.load(std::memory_order_relaxed);
+    if (CurrentHead != Tail.load(std::memory_order_acquire))
+    {
+        Head.store(CurrentHead + 1, std::memory_order_release);
+    }
+}
+
+void FCombatInputQueue::Clear()
+{
+    // Consumer side - drops everything published so far
+    Head.store(Tail.load(std::memory_order_acquire), std::memory_order_release);
+}
+
+int32 FCombatInputQueue::Num() const
+{
+    return static_cast<int32>(Tail.load(std::memory_order_acquire) - Head.load(std::memory_order_acquire));
+}
+
+// LATENCY HISTOGRAM
+
+void FCombatInputLatencyHistogram::Record(double LatencyMs)
+{
+    const double ClampedMs = FMath::Max(LatencyMs, 0.0);
+    const int32 Bucket = FMath::Min(static_cast<int32>(ClampedMs), MAX_MS);
+
+    ++Buckets[Bucket];
+    ++Count;
+    TotalMs += ClampedMs;
+    MaxMs = FMath::Max(MaxMs, ClampedMs);
+}
+
+void FCombatInputLatencyHistogram::Reset()
+{
+    FMemory::Memzero(Buckets);
+    Count = 0;
+    TotalMs = 0.0;
+    MaxMs = 0.0;
+}
+
+float FCombatInputLatencyHistogram::GetPercentileMs(float Percentile) const
+{
+    if (Count == 0)
+    {
+        return 0.0f;
+    }
+
+    const uint32 Target = FMath::Max(1u, static_cast<uint32>(FMath::CeilToDouble(FMath::Clamp(Percentile, 0.0f, 1.0f) * Count)));
+    uint32 Cumulative = 0;
+    for (int32 Bucket = 0; Bucket < MAX_MS; ++Bucket)
+    {
+        Cumulative += Buckets[Bucket];
+        if (Cumulative >= Target)
+        {
+            return static_cast<float>(Bucket + 1);
+        }
+    }
+
+    return static_cast<float>(MaxMs);
+}
+
+void FCombatInputLatencyHistogram::LogReport(const TCHAR* Name) const
+{
+    UE_LOG(LogCombat, Display, TEXT("%s input latency: %u samples, mean %.2f ms, p50 %.0f ms, p95 %.0f ms, p99 %.0f ms, max %.2f ms"),
+        Name, Count, GetMeanMs(), GetPercentileMs(0.5f), GetPercentileMs(0.95f), GetPercentileMs(0.99f), GetMaxMs());
+
+    for (int32 Bucket = 0; Bucket <= MAX_MS; ++Bucket)
+    {
+        if (Buckets[Bucket] > 0)
+        {
+            UE_LOG(LogCombat, Display, TEXT("  %s%3d ms: %u"), Bucket == MAX_MS ? TEXT(">=") : TEXT("  "), Bucket, Buckets[Bucket]);
+        }
+    }
+}
+
+FCombatInputLatencyHistogram& FCombatInputLatencyHistogram::GetAttackHistogram()
+{
+    static FCombatInputLatencyHistogram Histogram;
+    return Histogram;
+}
+
+FCombatInputLatencyHistogram& FCombatInputLatencyHistogram::GetMovementHistogram()
+{
+    static FCombatInputLatencyHistogram Histogram;
+    return Histogram;
+}
+
+// INPUT TIMESTAMPS
+
+namespace
+{
+    TSharedPtr<FCombatInputTimestamps> GInputTimestamps;
+    int32 GInputTimestampRefs = 0;
+}
+
+void FCombatInputTimestamps::AddRef()
+{
+    if (GInputTimestampRefs++ > 0 || !FSlateApplication::IsInitialized())
+    {
+        return;
+    }
+
+    GInputTimestamps = MakeShared<FCombatInputTimestamps>();
+    FSlateApplication::Get().RegisterInputPreProcessor(GInputTimestamps);
+}
+
+void FCombatInputTimestamps::Release()
+{
+    if (GInputTimestampRefs == 0 || --GInputTimestampRefs > 0)
+    {
+        return;
+    }
+
+    if (GInputTimestamps.IsValid() && FSlateApplication::IsInitialized())
+    {
+        FSlateApplication::Get().UnregisterInputPreProcessor(GInputTimestamps);
+    }
+    GInputTimestamps.Reset();
+}
+
+double FCombatInputTimestamps::ConsumePressTime(TConstArrayView<FKey> Keys)
+{
+    const double Now = FPlatformTime::Seconds();
+    if (!GInputTimestamps.IsValid())
+    {
+        return Now;
+    }
+
+    double PressTime = 0.0;
+    for (const FKey& Key : Keys)
+    {
+        double KeyPressTime = 0.0;
+        if (GInputTimestamps->PressTimes.RemoveAndCopyValue(Key, KeyPressTime))
+        {
+            PressTime = FMath::Max(PressTime, KeyPressTime);
+        }
+    }
+
+    return Now - PressTime <= MAX_PRESS_AGE ? PressTime : Now;
+}
+
+bool FCombatInputTimestamps::HandleKeyDownEvent(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent)
+{
+    if (!InKeyEvent.IsRepeat())
+    {
+        RecordPress(InKeyEvent.GetKey());
+    }
+
+    // Observe only - the event continues on to Enhanced Input
+    return false;
+}
+
+bool FCombatInputTimestamps::HandleMouseButtonDownEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent)
+{
+    RecordPress(MouseEvent.GetEffectingButton());
+    return false;
+}
+
+void FCombatInputTimestamps::RecordPress(const FKey& Key)
+{
+    PressTimes.Add(Key, FPlatformTime::Seconds());
+}
+
+// CONSOLE COMMANDS
+// Combat.Input.LatencyReport - histogram of poll-to-first-active-frame latency since the last reset
+// Combat.Input.LatencyReset
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommand CombatInputLatencyReportCommand(
+    TEXT("Combat.Input.LatencyReport"),
+    TEXT("Logs the combat input latency histograms (attack: poll to first Active frame, movement: poll to ability activation)."),
+    FConsoleCommandDelegate::CreateLambda([]()
+    {
+        FCombatInputLatencyHistogram::GetAttackHistogram().LogReport(TEXT("Attack"));
+        FCombatInputLatencyHistogram::GetMovementHistogram().LogReport(TEXT("Movement"));
+    }));
+
+static FAutoConsoleCommand CombatInputLatencyResetCommand(
+    TEXT("Combat.Input.LatencyReset"),
+    TEXT("Clears the combat input latency histograms."),
+    FConsoleCommandDelegate::CreateLambda([]()
+    {
+        FCombatInputLatencyHistogram::GetAttackHistogram().Reset();
+        FCombatInputLatencyHistogram::GetMovementHistogram().Reset();
+    }));
+#endif
@@ -0,0 +1,136 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "InputCoreTypes.h"
+#include "Framework/Application/IInputProcessor.h"
+#include <atomic>
+
+/**
+ * Combat input stamped with the platform time it was polled at
+ * The input landed SubFrameOffset (0..1) of the way through combat frame CombatFrame,
+ * so the first fixed step that may act on it is CombatFrame + 1.
+ */
+struct FCombatInputEvent
+{
+    FGameplayTag ActionTag;
+    double PlatformTime = 0.0;
+    int64 CombatFrame = 0;
+    float SubFrameOffset = 0.0f;
+
+    // Input time on the combat clock, in frames
+    double GetFrameTime() const { return static_cast<double>(CombatFrame) + SubFrameOffset; }
+};
+
+/**
+ * Maps platform time onto the fixed-step combat clock
+ * The consumer re-anchors after every tick with the platform time of the last fixed step it ran;
+ * any earlier anchor describes the same linear clock, so producers may read it at any point in the frame.
+ * Time dilation and pause break the linear relation - the anchor is refreshed each tick to bound the error.
+ */
+class EROEOREOREOR_API FCombatInputClock
+{
+public:
+    void SetFrameRate(float InFrameRate) { FrameDuration = 1.0 / FMath::Max(InFrameRate, 1.0f); }
+    void Anchor(int64 InFrame, double InPlatformTime);
+
+    // Combat frame and sub-frame offset containing PlatformTime
+    void ToCombatFrame(double PlatformTime, int64& OutFrame, float& OutSubFrameOffset) const;
+
+    double GetFrameDuration() const { return FrameDuration; }
+
+private:
+    double FrameDuration = 1.0 / 60.0;
+    double AnchorPlatformTime = 0.0;
+    int64 AnchorFrame = 0;
+};
+
+/**
+ * Fixed-capacity single-producer single-consumer ring - no locks, no allocations
+ * Producer is the input path, consumer is the combat fixed step. Push fails when full rather than overwriting.
+ */
+class EROEOREOREOR_API FCombatInputQueue
+{
+public:
+    static constexpr uint32 CAPACITY = 32;
+    static_assert((CAPACITY & (CAPACITY - 1)) == 0, "CAPACITY must be a power of two");
+
+    // Producer side
+    bool Push(const FCombatInputEvent& Event);
+
+    // Consumer side - Peek lets the fixed step leave inputs for future frames queued
+    const FCombatInputEvent* Peek() const;
+    void Pop();
+    void Clear();
+
+    int32 Num() const;
+
+private:
+    FCombatInputEvent Events[CAPACITY];
+    std::atomic<uint32> Head{0}; // Next slot to read - written by the consumer
+    std::atomic<uint32> Tail{0}; // Next slot to write - written by the producer
+};
+
+/**
+ * Fixed-bucket latency histogram - 1 ms buckets up to MAX_MS, everything above lands in the overflow bucket
+ */
+class EROEOREOREOR_API FCombatInputLatencyHistogram
+{
+public:
+    static constexpr int32 MAX_MS = 100;
+
+    void Record(double LatencyMs);
+    void Reset();
+
+    // Upper edge of the bucket containing the given percentile (0..1), in ms
+    float GetPercentileMs(float Percentile) const;
+
+    uint32 GetCount() const { return Count; }
+    double GetMeanMs() const { return Count > 0 ? TotalMs / Count : 0.0; }
+    double GetMaxMs() const { return MaxMs; }
+
+    void LogReport(const TCHAR* Name) const;
+
+    // Attack inputs: poll to first Active frame through the combat state machine
+    static FCombatInputLatencyHistogram& GetAttackHistogram();
+
+    // Dash/Bounce inputs: poll to ability activation (no startup frames)
+    static FCombatInputLatencyHistogram& GetMovementHistogram();
+
+private:
+    uint32 Buckets[MAX_MS + 1] = {};
+    uint32 Count = 0;
+    double TotalMs = 0.0;
+    double MaxMs = 0.0;
+};
+
+/**
+ * Slate input pre-processor recording the platform time of every key press as the OS messages are pumped -
+ * ahead of Enhanced Input, which only fires once the player controller ticks later in the frame.
+ * Registered while at least one local combat character is alive.
+ */
+class EROEOREOREOR_API FCombatInputTimestamps : public IInputProcessor
+{
+public:
+    static void AddRef();
+    static void Release();
+
+    // Most recent unconsumed press of any of Keys, consumed by the call. Falls back to now.
+    static double ConsumePressTime(TConstArrayView<FKey> Keys);
+
+    // IInputProcessor
+    virtual void Tick(const float DeltaTime, FSlateApplication& SlateApp, TSharedRef<ICursor> Cursor) override {}
+    virtual bool HandleKeyDownEvent(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent) override;
+    virtual bool HandleMouseButtonDownEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent) override;
+    virtual const TCHAR* GetDebugName() const override { return TEXT("CombatInputTimestamps"); }
+
+private:
+    // Presses older than this belong to a previous frame's input and are ignored
+    static constexpr double MAX_PRESS_AGE = 0.25;
+
+    void RecordPress(const FKey& Key);
+
+    TMap<FKey, double> PressTimes;
+};
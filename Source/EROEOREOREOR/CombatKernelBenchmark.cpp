@@ -0,0 +1,308 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CombatMathKernels.h"
+#include "CombatLog.h"
+#include "CombatPrototypeComponent.h"
+#include "AoEPrototypeComponent.h"
+#include "CombatMovementComponent.h"
+#include "GameplayAbility_Bounce.h"
+#include "MovementAbilityTuning.h"
+#include "VelocitySnapshotComponent.h"
+#include "Curves/CurveFloat.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "UObject/Package.h"
+#include "UObject/StrongObjectPtr.h"
+
+// KERNEL MICROBENCHMARK - ns/op and ops/sec for the FCombatMathKernels functions, no world required
+// Automation test EROEOREOREOR.Combat.Kernels.Throughput (perf filter, any context - no game or world needed):
+//   UnrealEditor-Cmd <Project>.uproject -nullrhi -unattended -ExecCmds="Automation RunTests EROEOREOREOR.Combat.Kernels; Quit"
+//   Optional: -CombatKernelIterations=<N> -CombatKernelSeed=<Seed>
+//
+// Each kernel runs over a table of randomized inputs generated from a fixed seed, so two builds with the same seed
+// feed the kernel identical data. Every kernel is timed RUNS times and the fastest run is reported - the minimum
+// is the least noisy estimate of the kernel itself. Results go to Saved/Benchmarks/Kernels_<time>.csv and the test
+// fails when a kernel is slower than its ceiling below.
+
+#if WITH_DEV_AUTOMATION_TESTS
+namespace CombatKernelBenchmark
+{
+	// Power of two so the input index is a mask; large enough that branches see realistic mixes
+	static constexpr int32 INPUT_COUNT = 4096;
+	static constexpr int32 INPUT_MASK = INPUT_COUNT - 1;
+	static constexpr int32 RUNS = 5;
+	static constexpr int32 DEFAULT_ITERATIONS = 1000000;
+	static constexpr int32 DEFAULT_SEED = 1337;
+
+	// Regression ceilings in ns/op - a few times the Development-build figures on a desktop CPU, so only real
+	// regressions (an extra curve lookup, a lost early-out, an allocation) trip them
+	static constexpr double MAX_NS_SIMPLE = 25.0;
+	static constexpr double MAX_NS_SHAPE = 50.0;
+	static constexpr double MAX_NS_CURVE = 100.0;
+
+	struct FKernelResult
+	{
+		const TCHAR* Name;
+		double NsPerOp;
+		double OpsPerSec;
+		double MaxNsPerOp;
+	};
+
+	// Results are folded into this so the optimizer cannot drop the kernel calls
+	static volatile float Sink = 0.0f;
+
+	template<typename KernelType>
+	static FKernelResult Measure(const TCHAR* Name, double MaxNsPerOp, int32 Iterations, KernelType&& Kernel)
+	{
+		double BestSeconds = TNumericLimits<double>::Max();
+		for (int32 Run = 0; Run < RUNS; ++Run)
+		{
+			float Accumulator = 0.0f;
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+			{
+				Accumulator += Kernel(Iteration & INPUT_MASK);
+			}
+			const double Seconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles);
+			Sink = Sink + Accumulator;
+			BestSeconds = FMath::Min(BestSeconds, Seconds);
+		}
+
+		const double NsPerOp = BestSeconds * 1.0e9 / Iterations;
+		return { Name, NsPerOp, NsPerOp > 0.0 ? 1.0e9 / NsPerOp : 0.0, MaxNsPerOp };
+	}
+
+	static float Fold(const FVector& Value)
+	{
+		return static_cast<float>(Value.X + Value.Y + Value.Z);
+	}
+
+	static FVector RandomVector(FRandomStream& Random, float Extent)
+	{
+		return FVector(Random.FRandRange(-Extent, Extent), Random.FRandRange(-Extent, Extent), Random.FRandRange(-Extent, Extent));
+	}
+
+	static FVector RandomForward(FRandomStream& Random)
+	{
+		const float Yaw = Random.FRandRange(0.0f, 2.0f * PI);
+		return FVector(FMath::Cos(Yaw), FMath::Sin(Yaw), 0.0f);
+	}
+
+	static TArray<FKernelResult> RunKernelBenchmark(int32 Iterations, int32 Seed)
+	{
+		FRandomStream Random(Seed);
+
+		// Shared fixtures - curves are transient so the curve-evaluation paths can be measured too
+		TStrongObjectPtr<UCurveFloat> EaseCurve(NewObject<UCurveFloat>(GetTransientPackage()));
+		EaseCurve->FloatCurve.AddKey(0.0f, 1.0f);
+		EaseCurve->FloatCurve.AddKey(0.5f, 0.6f);
+		EaseCurve->FloatCurve.AddKey(1.0f, 0.2f);
+
+		const FBounceTuningBlock& BounceTuning = UBounceTuningData::GetBuiltInPreset(EBounceTuningPreset::Default)->GetBlock();
+
+		// ATTACK TRAJECTORY INPUTS - one data row per trajectory type
+		static constexpr ETrajectoryType TrajectoryTypes[] =
+		{
+			ETrajectoryType::Linear, ETrajectoryType::Arc, ETrajectoryType::Homing, ETrajectoryType::Curve, ETrajectoryType::Teleport
+		};
+		TArray<FTrajectoryData> Trajectories;
+		for (const ETrajectoryType Type : TrajectoryTypes)
+		{
+			FTrajectoryData& Trajectory = Trajectories.AddDefaulted_GetRef();
+			Trajectory.TrajectoryType = Type;
+			Trajectory.TrajectorySpeedCurve = nullptr;
+			Trajectory.TrajectoryPathCurve = Type == ETrajectoryType::Curve ? EaseCurve.Get() : nullptr;
+			Trajectory.HomingStrength = 0.5f;
+		}
+
+		struct FTrajectoryInput
+		{
+			int32 TrajectoryIndex;
+			FVector Start;
+			FVector Target;
+			FVector Right;
+			float Alpha;
+		};
+		TArray<FTrajectoryInput> TrajectoryInputs;
+		TrajectoryInputs.Reserve(INPUT_COUNT);
+		for (int32 Index = 0; Index < INPUT_COUNT; ++Index)
+		{
+			const FVector Forward = RandomForward(Random);
+			TrajectoryInputs.Add({ Random.RandRange(0, Trajectories.Num() - 1), RandomVector(Random, 2000.0f), RandomVector(Random, 2000.0f),
+				FVector::CrossProduct(FVector::UpVector, Forward), Random.FRand() });
+		}
+
+		// AOE INPUTS - one shape per EAoEShape, half the behaviours expanding
+		static constexpr EAoEShape Shapes[] =
+		{
+			EAoEShape::Circle, EAoEShape::Ring, EAoEShape::Cone, EAoEShape::Rectangle, EAoEShape::Line, EAoEShape::Sector
+		};
+		TArray<FAoEShapeData> ShapeData;
+		for (const EAoEShape Shape : Shapes)
+		{
+			FAoEShapeData& Data = ShapeData.AddDefaulted_GetRef();
+			Data.Shape = Shape;
+			Data.InnerRadius = Shape == EAoEShape::Ring || Shape == EAoEShape::Sector ? 100.0f : 0.0f;
+		}
+
+		FAoEBehaviorData Behaviors[2];
+		Behaviors[0].Behavior = EAoEBehavior::Instant;
+		Behaviors[0].ExpansionCurve = nullptr;
+		Behaviors[1].Behavior = EAoEBehavior::Expanding;
+		Behaviors[1].ExpansionCurve = nullptr;
+
+		FAoEDamageData DamageData[2];
+		DamageData[0].DamageFalloffCurve = nullptr;
+		DamageData[1].DamageFalloffCurve = EaseCurve.Get();
+
+		struct FAoEInput
+		{
+			int32 ShapeIndex;
+			int32 Variant;
+			FVector Point;
+			FVector Center;
+			FVector Forward;
+			float ElapsedTime;
+		};
+		TArray<FAoEInput> AoEInputs;
+		AoEInputs.Reserve(INPUT_COUNT);
+		for (int32 Index = 0; Index < INPUT_COUNT; ++Index)
+		{
+			const FVector Center = RandomVector(Random, 2000.0f);
+			// Points land within 1.5x the default radius so hits and misses both occur
+			AoEInputs.Add({ Random.RandRange(0, ShapeData.Num() - 1), Random.RandRange(0, 1), Center + RandomVector(Random, 450.0f), Center,
+				RandomForward(Random), Random.FRandRange(0.0f, 2.0f) });
+		}
+
+		// BOUNCE INPUTS
+		static constexpr EVelocitySource Sources[] =
+		{
+			EVelocitySource::None, EVelocitySource::Dash, EVelocitySource::Jump, EVelocitySource::Fall, EVelocitySource::External
+		};
+		struct FBounceInput
+		{
+			FVelocitySnapshot Momentum;
+			FVector Velocity;
+			int32 AirBounceCount;
+		};
+		TArray<FBounceInput> BounceInputs;
+		BounceInputs.Reserve(INPUT_COUNT);
+		for (int32 Index = 0; Index < INPUT_COUNT; ++Index)
+		{
+			FBounceInput& Input = BounceInputs.AddDefaulted_GetRef();
+			Input.Momentum = FVelocitySnapshot(RandomVector(Random, 2000.0f), Sources[Random.RandRange(0, UE_ARRAY_COUNT(Sources) - 1)], FGameplayTag());
+			Input.Velocity = RandomVector(Random, 1500.0f);
+			Input.AirBounceCount = Random.RandRange(0, 3);
+		}
+
+		// DASH INPUTS
+		FCombatDashParams DashParams;
+		FCombatDashParams CurveDashParams;
+		CurveDashParams.SpeedCurve = EaseCurve.Get();
+
+		TArray<float> DashAlphas;
+		DashAlphas.Reserve(INPUT_COUNT);
+		for (int32 Index = 0; Index < INPUT_COUNT; ++Index)
+		{
+			DashAlphas.Add(Random.FRand());
+		}
+
+		TArray<FKernelResult> Results;
+
+		Results.Add(Measure(TEXT("TrajectoryPosition"), MAX_NS_SHAPE, Iterations, [&](int32 Index)
+		{
+			const FTrajectoryInput& Input = TrajectoryInputs[Index];
+			return Fold(FCombatMathKernels::TrajectoryPosition(Trajectories[Input.TrajectoryIndex], Input.Start, Input.Target, Input.Right, Input.Alpha));
+		}));
+
+		Results.Add(Measure(TEXT("IsPointInShape"), MAX_NS_SHAPE, Iterations, [&](int32 Index)
+		{
+			const FAoEInput& Input = AoEInputs[Index];
+			return FCombatMathKernels::IsPointInShape(ShapeData[Input.ShapeIndex], Input.Point, Input.Center, Input.Forward) ? 1.0f : 0.0f;
+		}));
+
+		Results.Add(Measure(TEXT("CurrentRadius"), MAX_NS_SIMPLE, Iterations, [&](int32 Index)
+		{
+			const FAoEInput& Input = AoEInputs[Index];
+			return FCombatMathKernels::CurrentRadius(ShapeData[Input.ShapeIndex], Behaviors[Input.Variant], Input.ElapsedTime);
+		}));
+
+		Results.Add(Measure(TEXT("DamageAtLocation"), MAX_NS_SIMPLE, Iterations, [&](int32 Index)
+		{
+			const FAoEInput& Input = AoEInputs[Index];
+			return FCombatMathKernels::DamageAtLocation(DamageData[0], ShapeData[Input.ShapeIndex].Radius, Input.Center, Input.Point);
+		}));
+
+		Results.Add(Measure(TEXT("DamageAtLocation (curve)"), MAX_NS_CURVE, Iterations, [&](int32 Index)
+		{
+			const FAoEInput& Input = AoEInputs[Index];
+			return FCombatMathKernels::DamageAtLocation(DamageData[1], ShapeData[Input.ShapeIndex].Radius, Input.Center, Input.Point);
+		}));
+
+		Results.Add(Measure(TEXT("EnhancedBounceVelocity"), MAX_NS_SHAPE, Iterations, [&](int32 Index)
+		{
+			const FBounceInput& Input = BounceInputs[Index];
+			return Fold(FCombatMathKernels::EnhancedBounceVelocity(BounceTuning, nullptr, Input.Momentum, Input.AirBounceCount));
+		}));
+
+		Results.Add(Measure(TEXT("DetermineTrajectoryType"), MAX_NS_SIMPLE, Iterations, [&](int32 Index)
+		{
+			return static_cast<float>(FCombatMathKernels::DetermineTrajectoryType(BounceTuning, BounceInputs[Index].Velocity, 50.0f));
+		}));
+
+		Results.Add(Measure(TEXT("DashSpeed"), MAX_NS_SIMPLE, Iterations, [&](int32 Index)
+		{
+			return FCombatMathKernels::DashSpeed(DashParams, DashAlphas[Index]);
+		}));
+
+		Results.Add(Measure(TEXT("DashSpeed (curve)"), MAX_NS_CURVE, Iterations, [&](int32 Index)
+		{
+			return FCombatMathKernels::DashSpeed(CurveDashParams, DashAlphas[Index]);
+		}));
+
+		FString Csv = TEXT("Kernel,NsPerOp,OpsPerSec,MaxNsPerOp,Iterations,Seed\n");
+		UE_LOG(LogCombat, Display, TEXT("Combat.Kernels.Throughput: %d iterations, best of %d runs, seed %d"), Iterations, RUNS, Seed);
+		for (const FKernelResult& Result : Results)
+		{
+			UE_LOG(LogCombat, Display, TEXT("  %-26s %8.2f ns/op %14.0f ops/sec (max %.0f)"), Result.Name, Result.NsPerOp, Result.OpsPerSec, Result.MaxNsPerOp);
+			Csv += FString::Printf(TEXT("%s,%.3f,%.0f,%.0f,%d,%d\n"), Result.Name, Result.NsPerOp, Result.OpsPerSec, Result.MaxNsPerOp, Iterations, Seed);
+		}
+
+		const FString Path = FPaths::ProjectSavedDir() / TEXT("Benchmarks") /
+			FString::Printf(TEXT("Kernels_%s.csv"), *FDateTime::Now().ToString());
+		if (FFileHelper::SaveStringToFile(Csv, *Path))
+		{
+			UE_LOG(LogCombat, Display, TEXT("Combat.Kernels.Throughput: Wrote %s"), *Path);
+		}
+
+		return Results;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCombatKernelThroughputTest, "EROEOREOREOR.Combat.Kernels.Throughput",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext
+	| EAutomationTestFlags::CommandletContext | EAutomationTestFlags::PerfFilter)
+
+bool FCombatKernelThroughputTest::RunTest(const FString& Parameters)
+{
+	using namespace CombatKernelBenchmark;
+
+	int32 Iterations = DEFAULT_ITERATIONS;
+	int32 Seed = DEFAULT_SEED;
+	FParse::Value(FCommandLine::Get(), TEXT("CombatKernelIterations="), Iterations);
+	FParse::Value(FCommandLine::Get(), TEXT("CombatKernelSeed="), Seed);
+
+	for (const FKernelResult& Result : RunKernelBenchmark(FMath::Max(INPUT_COUNT, Iterations), Seed))
+	{
+		TestTrue(FString::Printf(TEXT("%s %.2f ns/op <= %.0f"), Result.Name, Result.NsPerOp, Result.MaxNsPerOp),
+			Result.NsPerOp <= Result.MaxNsPerOp);
+	}
+	return true;
+}
+#endif
@@ -0,0 +1,366 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CombatLagCompensation.h"
+#include "VelocitySnapshotComponent.h"
+#include "CombatStats.h"
+#include "CombatMemory.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerState.h"
+#include "HAL/IConsoleManager.h"
+#include "DrawDebugHelpers.h"
+
+static TAutoConsoleVariable<bool> CVarLagCompEnable(
+	TEXT("Combat.LagComp.Enable"),
+	true,
+	TEXT("Rewind victim hurt volumes for attacks by remote players on the server."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarLagCompMaxRewindMs(
+	TEXT("Combat.LagComp.MaxRewindMs"),
+	300.0f,
+	TEXT("Upper bound on the rewind applied to a single attack, in milliseconds. Must stay below the movement history length (~1 s)."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarLagCompInterpDelayMs(
+	TEXT("Combat.LagComp.InterpDelayMs"),
+	0.0f,
+	TEXT("Extra rewind for client-side smoothing of simulated proxies, in milliseconds."),
+	ECVF_Default);
+
+#if !UE_BUILD_SHIPPING
+static TAutoConsoleVariable<bool> CVarLagCompDebug(
+	TEXT("Combat.LagComp.Debug"),
+	false,
+	TEXT("Draw rewound hurt volumes gathered for lag-compensated hit checks."),
+	ECVF_Cheat);
+#endif
+
+namespace
+{
+	// Half length of the capsule's inner segment
+	FORCEINLINE float AxisHalfLength(const FLagCompensatedVolume& Volume)
+	{
+		return FMath::Max(Volume.HalfHeight - Volume.Radius, 0.0f);
+	}
+
+	// Gap between two Z intervals, 0 when they overlap
+	FORCEINLINE float IntervalGap(float MinA, float MaxA, float MinB, float MaxB)
+	{
+		return FMath::Max3(MinA - MaxB, MinB - MaxA, 0.0f);
+	}
+
+	bool OverlapsSphere(const FLagCompensatedVolume& Volume, const FVector& Center, float Radius)
+	{
+		const float Half = AxisHalfLength(Volume);
+		const FVector OnAxis(Volume.Center.X, Volume.Center.Y, FMath::Clamp(Center.Z, Volume.Center.Z - Half, Volume.Center.Z + Half));
+		return FVector::DistSquared(Center, OnAxis) <= FMath::Square(Radius + Volume.Radius);
+	}
+
+	// Both capsules upright - XY distance plus the gap between their inner segments
+	bool OverlapsUprightCapsule(const FLagCompensatedVolume& Volume, const FVector& Center, float Radius, float HalfHeight)
+	{
+		const float HalfA = AxisHalfLength(Volume);
+		const float HalfB = FMath::Max(HalfHeight - Radius, 0.0f);
+		const float Gap = IntervalGap(Volume.Center.Z - HalfA, Volume.Center.Z + HalfA, Center.Z - HalfB, Center.Z + HalfB);
+		return FVector::DistSquared2D(Volume.Center, Center) + Gap * Gap <= FMath::Square(Radius + Volume.Radius);
+	}
+
+	bool OverlapsBox(const FLagCompensatedVolume& Volume, const FVector& Center, const FVector& Extent)
+	{
+		const float Half = AxisHalfLength(Volume);
+		const float DX = FMath::Max(FMath::Abs(Volume.Center.X - Center.X) - Extent.X, 0.0f);
+		const float DY = FMath::Max(FMath::Abs(Volume.Center.Y - Center.Y) - Extent.Y, 0.0f);
+		const float DZ = IntervalGap(Volume.Center.Z - Half, Volume.Center.Z + Half, Center.Z - Extent.Z, Center.Z + Extent.Z);
+		return DX * DX + DY * DY + DZ * DZ <= FMath::Square(Volume.Radius);
+	}
+
+	FORCEINLINE bool IsWithinCone(const FLagCompensatedVolume& Volume, const FVector& Origin, const FVector& Forward, float CosHalfAngle)
+	{
+		return FVector::DotProduct(Forward, (Volume.Center - Origin).GetSafeNormal()) >= CosHalfAngle;
+	}
+
+	FORCEINLINE bool IsWithinDistance(const FLagCompensatedVolume& Volume, const FVector& Origin, float MinDistance, float MaxDistance)
+	{
+		const float DistanceSquared = FVector::DistSquared(Volume.Center, Origin);
+		return DistanceSquared >= FMath::Square(MinDistance) && DistanceSquared <= FMath::Square(MaxDistance);
+	}
+}
+
+UCombatLagCompensationSubsystem* UCombatLagCompensationSubsystem::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UCombatLagCompensationSubsystem>() : nullptr;
+}
+
+bool UCombatLagCompensationSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UCombatLagCompensationSubsystem::Deinitialize()
+{
+	HurtVolumes.Empty();
+	Super::Deinitialize();
+}
+
+void UCombatLagCompensationSubsystem::GetCombatMemoryUsage(FCombatMemoryUsage& OutUsage) const
+{
+	OutUsage.Add(ECombatMemoryCategory::Runtime, sizeof(*this) + HurtVolumes.GetAllocatedSize());
+}
+
+void UCombatLagCompensationSubsystem::RegisterHurtVolume(AActor* Actor, const UVelocitySnapshotComponent* History, float Radius, float HalfHeight)
+{
+	LLM_SCOPE_BYTAG(Combat_Runtime);
+
+	if (!Actor)
+	{
+		return;
+	}
+
+	FRegisteredHurtVolume* Volume = HurtVolumes.FindByPredicate([Actor](const FRegisteredHurtVolume& Entry) { return Entry.Actor == Actor; });
+	if (!Volume)
+	{
+		Volume = &HurtVolumes.AddDefaulted_GetRef();
+		Volume->Actor = Actor;
+	}
+
+	Volume->History = History;
+	Volume->Radius = Radius;
+	Volume->HalfHeight = FMath::Max(HalfHeight, Radius);
+}
+
+void UCombatLagCompensationSubsystem::UnregisterHurtVolume(const AActor* Actor)
+{
+	// Stale entries are swept here so the query path stays read-only
+	HurtVolumes.RemoveAllSwap([Actor](const FRegisteredHurtVolume& Entry) { return Entry.Actor == Actor || !Entry.Actor.IsValid(); });
+}
+
+bool UCombatLagCompensationSubsystem::ShouldRewindFor(const AActor* Attacker) const
+{
+	const APawn* Pawn = Cast<APawn>(Attacker);
+	const UWorld* World = GetWorld();
+	if (!Pawn || !World || !CVarLagCompEnable.GetValueOnGameThread())
+	{
+		return false;
+	}
+
+	// Listen-server hosts and standalone players already see the server state
+	const ENetMode NetMode = World->GetNetMode();
+	if (NetMode == NM_Client || NetMode == NM_Standalone)
+	{
+		return false;
+	}
+
+	return Pawn->IsPlayerControlled() && !Pawn->IsLocallyControlled();
+}
+
+float UCombatLagCompensationSubsystem::GetRewindSeconds(const AActor* Attacker) const
+{
+	if (!ShouldRewindFor(Attacker))
+	{
+		return 0.0f;
+	}
+
+	const APlayerState* PlayerState = CastChecked<APawn>(Attacker)->GetPlayerState();
+	const float RoundTripMs = PlayerState ? PlayerState->GetPingInMilliseconds() : 0.0f;
+	const float RewindMs = FMath::Clamp(RoundTripMs + CVarLagCompInterpDelayMs.GetValueOnGameThread(),
+		0.0f, CVarLagCompMaxRewindMs.GetValueOnGameThread());
+
+	return RewindMs * 0.001f;
+}
+
+FVector UCombatLagCompensationSubsystem::ResolveLocationAtTime(const FRegisteredHurtVolume& Volume, const AActor& Actor, double Time) const
+{
+	const UVelocitySnapshotComponent* History = Volume.History.Get();
+	if (!History)
+	{
+		return Actor.GetActorLocation();
+	}
+
+	const FMovementHistoryBuffer& Buffer = History->GetMovementHistory();
+	FMovementHistorySample Sample;
+	if (Buffer.GetSampleAtTime(Time, Sample))
+	{
+		return Sample.Location;
+	}
+
+	// Older than the history (attacker ping above the buffer length) - clamp to the oldest recorded frame
+	if (!Buffer.IsEmpty() && Time < Buffer.GetFrameTime(Buffer.GetOldestFrame())
+		&& Buffer.GetSampleAtFrame(Buffer.GetOldestFrame(), Sample))
+	{
+		return Sample.Location;
+	}
+
+	// Newer than the last recorded frame - the actor has not moved since
+	return Actor.GetActorLocation();
+}
+
+void UCombatLagCompensationSubsystem::GatherVolumesAtTime(double Time, const FVector& Origin, float Reach, const AActor* IgnoreActor, TArray<FLagCompensatedVolume>& OutVolumes) const
+{
+	COMBAT_SCOPE(LagCompGather);
+	COMBAT_COUNTER_ADD(Queries, 1);
+
+	for (const FRegisteredHurtVolume& Volume : HurtVolumes)
+	{
+		AActor* Actor = Volume.Actor.Get();
+		if (!Actor || Actor == IgnoreActor)
+		{
+			continue;
+		}
+
+		const FVector Center = ResolveLocationAtTime(Volume, *Actor, Time);
+
+		// HalfHeight bounds the whole capsule
+		if (FVector::DistSquared(Center, Origin) > FMath::Square(Reach + Volume.HalfHeight))
+		{
+			continue;
+		}
+
+		FLagCompensatedVolume& Rewound = OutVolumes.AddDefaulted_GetRef();
+		Rewound.Actor = Actor;
+		Rewound.Center = Center;
+		Rewound.Radius = Volume.Radius;
+		Rewound.HalfHeight = Volume.HalfHeight;
+
+#if !UE_BUILD_SHIPPING
+		if (CVarLagCompDebug.GetValueOnGameThread())
+		{
+			DrawDebugCapsule(GetWorld(), Center, Volume.HalfHeight, Volume.Radius, FQuat::Identity, FColor::Cyan, false, 1.0f);
+			DrawDebugLine(GetWorld(), Center, Actor->GetActorLocation(), FColor::Cyan, false, 1.0f);
+		}
+#endif
+	}
+}
+
+float UCombatLagCompensationSubsystem::GetAttackShapeReach(const FAttackShapeData& ShapeData)
+{
+	switch (ShapeData.ShapeType)
+	{
+		case EAttackShape::Capsule:
+			return FMath::Max(ShapeData.PrimarySize, ShapeData.SecondarySize);
+		case EAttackShape::Box:
+			return FVector(ShapeData.PrimarySize, ShapeData.SecondarySize, ShapeData.TertiarySize).Size();
+		case EAttackShape::Ring:
+			return ShapeData.OuterRadius;
+		default:
+			// Sphere, cone, line and arc are all bounded by PrimarySize around the shape origin
+			return ShapeData.PrimarySize;
+	}
+}
+
+void UCombatLagCompensationSubsystem::TestAttackShapeBatch(const FAttackShapeData& ShapeData, const FVector& WorldPos, const FRotator& WorldRot,
+	TConstArrayView<FLagCompensatedVolume> Volumes, TArray<int32>& OutHitIndices)
+{
+	COMBAT_SCOPE(LagCompShapeBatch);
+
+	const FVector Forward = WorldRot.Vector();
+	const float CosHalfAngle = FMath::Cos(FMath::DegreesToRadians(ShapeData.ConeAngle * 0.5f));
+
+	switch (ShapeData.ShapeType)
+	{
+		case EAttackShape::Sphere:
+			for (int32 Index = 0; Index < Volumes.Num(); ++Index)
+			{
+				if (OverlapsSphere(Volumes[Index], WorldPos, ShapeData.PrimarySize))
+				{
+					OutHitIndices.Add(Index);
+				}
+			}
+			break;
+
+		case EAttackShape::Capsule:
+			for (int32 Index = 0; Index < Volumes.Num(); ++Index)
+			{
+				if (OverlapsUprightCapsule(Volumes[Index], WorldPos, ShapeData.PrimarySize, ShapeData.SecondarySize))
+				{
+					OutHitIndices.Add(Index);
+				}
+			}
+			break;
+
+		case EAttackShape::Box:
+		{
+			const FVector Extent(ShapeData.PrimarySize, ShapeData.SecondarySize, ShapeData.TertiarySize);
+			for (int32 Index = 0; Index < Volumes.Num(); ++Index)
+			{
+				if (OverlapsBox(Volumes[Index], WorldPos, Extent))
+				{
+					OutHitIndices.Add(Index);
+				}
+			}
+			break;
+		}
+
+		case EAttackShape::Cone:
+			for (int32 Index = 0; Index < Volumes.Num(); ++Index)
+			{
+				const FLagCompensatedVolume& Volume = Volumes[Index];
+				if (OverlapsSphere(Volume, WorldPos, ShapeData.PrimarySize) && IsWithinCone(Volume, WorldPos, Forward, CosHalfAngle))
+				{
+					OutHitIndices.Add(Index);
+				}
+			}
+			break;
+
+		case EAttackShape::Line:
+		{
+			// Single trace - only the first volume along the line is hit
+			const FVector EndPos = WorldPos + Forward * ShapeData.PrimarySize;
+			int32 NearestIndex = INDEX_NONE;
+			float NearestDistanceSquared = TNumericLimits<float>::Max();
+
+			for (int32 Index = 0; Index < Volumes.Num(); ++Index)
+			{
+				const FLagCompensatedVolume& Volume = Volumes[Index];
+				const FVector AxisOffset(0.0f, 0.0f, AxisHalfLength(Volume));
+
+				FVector OnLine;
+				FVector OnAxis;
+				FMath::SegmentDistToSegmentSafe(WorldPos, EndPos, Volume.Center - AxisOffset, Volume.Center + AxisOffset, OnLine, OnAxis);
+
+				if (FVector::DistSquared(OnLine, OnAxis) <= FMath::Square(Volume.Radius))
+				{
+					const float DistanceSquared = FVector::DistSquared(WorldPos, OnLine);
+					if (DistanceSquared < NearestDistanceSquared)
+					{
+						NearestDistanceSquared = DistanceSquared;
+						NearestIndex = Index;
+					}
+				}
+			}
+
+			if (NearestIndex != INDEX_NONE)
+			{
+				OutHitIndices.Add(NearestIndex);
+			}
+			break;
+		}
+
+		case EAttackShape::Ring:
+			for (int32 Index = 0; Index < Volumes.Num(); ++Index)
+			{
+				const FLagCompensatedVolume& Volume = Volumes[Index];
+				if (OverlapsSphere(Volume, WorldPos, ShapeData.OuterRadius)
+					&& FVector::DistSquared(Volume.Center, WorldPos) >= FMath::Square(ShapeData.InnerRadius))
+				{
+					OutHitIndices.Add(Index);
+				}
+			}
+			break;
+
+		case EAttackShape::Arc:
+			for (int32 Index = 0; Index < Volumes.Num(); ++Index)
+			{
+				const FLagCompensatedVolume& Volume = Volumes[Index];
+				if (OverlapsSphere(Volume, WorldPos, ShapeData.PrimarySize) && IsWithinCone(Volume, WorldPos, Forward, CosHalfAngle)
+					&& IsWithinDistance(Volume, WorldPos, ShapeData.InnerRadius, ShapeData.OuterRadius))
+				{
+					OutHitIndices.Add(Index);
+				}
+			}
+			break;
+
+		default:
+			break;
+	}
+}
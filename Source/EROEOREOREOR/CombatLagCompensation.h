@@ -0,0 +1,89 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CombatSystemTypes.h"
+#include "CombatMemory.h"
+#include "CombatLagCompensation.generated.h"
+
+class UVelocitySnapshotComponent;
+
+/**
+ * Hurt volume rewound to a past time - an upright capsule (Radius == HalfHeight is a sphere)
+ * Actor is only guaranteed valid for the query that produced the volume.
+ */
+struct FLagCompensatedVolume
+{
+	AActor* Actor = nullptr;
+	FVector Center = FVector::ZeroVector;
+	float Radius = 0.0f;
+	float HalfHeight = 0.0f;
+};
+
+/**
+ * Server-side lag compensation for attack shapes
+ * Hurt volumes register once (characters through UVelocitySnapshotComponent, static actors directly) and are
+ * rewound by reading the per-actor FMovementHistoryBuffer - real actors are never moved and the physics
+ * scene is never touched. Rewound volumes are tested against the attack shape analytically, in one batch.
+ *
+ * Rewind time for a remote attacker is its round trip time plus Combat.LagComp.InterpDelayMs, clamped to
+ * Combat.LagComp.MaxRewindMs: the client saw the victim one half trip late and the attack arrives one half trip later.
+ */
+UCLASS()
+class EROEOREOREOR_API UCombatLagCompensationSubsystem : public UWorldSubsystem, public ICombatMemoryReporter
+{
+	GENERATED_BODY()
+
+public:
+	static UCombatLagCompensationSubsystem* Get(const UWorld* World);
+
+	virtual void Deinitialize() override;
+
+	// Registry bytes - shared by every character in the world, reported once by Combat.MemReport
+	virtual void GetCombatMemoryUsage(FCombatMemoryUsage& OutUsage) const override;
+
+	// History may be null for actors that never move - they are tested at their current location
+	void RegisterHurtVolume(AActor* Actor, const UVelocitySnapshotComponent* History, float Radius, float HalfHeight);
+	void UnregisterHurtVolume(const AActor* Actor);
+
+	// True on the server for pawns driven by a remote player, while Combat.LagComp.Enable is set
+	bool ShouldRewindFor(const AActor* Attacker) const;
+
+	// Seconds to rewind victims for Attacker's hit checks - 0 when ShouldRewindFor is false
+	float GetRewindSeconds(const AActor* Attacker) const;
+
+	// Rewound hurt volumes within Reach of Origin at world time Time, skipping IgnoreActor. Appends to OutVolumes.
+	void GatherVolumesAtTime(double Time, const FVector& Origin, float Reach, const AActor* IgnoreActor, TArray<FLagCompensatedVolume>& OutVolumes) const;
+
+	/**
+	 * Tests every volume against an attack shape placed at WorldPos/WorldRot
+	 * Matches the UAttackShapeComponent overlap semantics: sphere, capsule and box are axis-aligned,
+	 * cone/ring/arc filter on the volume center, and a line keeps only its nearest hit.
+	 * Appends indices into Volumes to OutHitIndices.
+	 */
+	static void TestAttackShapeBatch(const FAttackShapeData& ShapeData, const FVector& WorldPos, const FRotator& WorldRot,
+		TConstArrayView<FLagCompensatedVolume> Volumes, TArray<int32>& OutHitIndices);
+
+	// Broad-phase radius of an attack shape around its world position
+	static float GetAttackShapeReach(const FAttackShapeData& ShapeData);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FRegisteredHurtVolume
+	{
+		TWeakObjectPtr<AActor> Actor;
+		TWeakObjectPtr<const UVelocitySnapshotComponent> History;
+		float Radius = 0.0f;
+		float HalfHeight = 0.0f;
+	};
+
+	// Dense array - a linear pass is cheaper than a spatial structure at combat-encounter actor counts
+	TArray<FRegisteredHurtVolume> HurtVolumes;
+
+	// History sample at Time - oldest sample when Time predates the history, current location when it has none
+	FVector ResolveLocationAtTime(const FRegisteredHurtVolume& Volume, const AActor& Actor, double Time) const;
+};
@@ -0,0 +1,301 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CombatBenchmarkScene.h"
+#include "CombatLog.h"
+#include "CombatSignificance.h"
+#include "CombatStats.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/Pawn.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMisc.h"
+#include "HAL/PlatformTime.h"
+
+// COMBAT LOD BENCHMARK - What combat LOD saves and what it costs in hits, on one scripted fighter scene
+// Usage: Combat.Bench.Lod [Fighters=200] [Frames=600] [DummyRatio=1.0] [QuitWhenDone=0]
+// Headless: <Project>.uproject <Map> -game -nullrhi -unattended -ExecCmds="Combat.Bench.Lod 200 600 1 1"
+//
+// Pass 1 runs with Combat.Lod.Enable 0, pass 2 with Combat.Lod.Enable 1, on the same fighters and input schedule.
+// A lower tier tests its owed frames together at the current pose, so the Hits and DamageSpecs deltas between the
+// passes are the hit error LOD introduces - the tolerance Combat.Lod.*Stride is tuned against. Frames is rounded
+// up to whole input cycles so both passes carry the same activations.
+
+#if !UE_BUILD_SHIPPING
+namespace CombatLodBenchmark
+{
+	static constexpr int32 WARMUP_FRAMES = 120;
+	// Frames for the significance manager to settle the tiers after Combat.Lod.Enable changes
+	static constexpr int32 SETTLE_FRAMES = FCombatBenchmarkScene::INPUT_INTERVAL_FRAMES;
+
+	static constexpr ECombatCounter REPORTED_COUNTERS[] = { ECombatCounter::Queries, ECombatCounter::Hits, ECombatCounter::DamageSpecs };
+
+	enum class EPhase : uint8
+	{
+		Warmup,
+		LodOff,
+		Settle,
+		LodOn,
+		Done
+	};
+
+	struct FPassResult
+	{
+		TArray<double> TickMs;
+		uint64 Counters[static_cast<int32>(ECombatCounter::Count)] = {};
+		uint64 LodFighters[static_cast<int32>(ECombatLod::Count)] = {};
+		int32 Frames = 0;
+	};
+
+	struct FBenchmarkRun
+	{
+		TWeakObjectPtr<UWorld> World;
+		FDelegateHandle TickStartHandle;
+		FDelegateHandle PreTickHandle;
+		FDelegateHandle PostTickHandle;
+
+		FCombatBenchmarkScene Scene;
+		int32 FramesPerPass = 600;
+		bool bQuitWhenDone = false;
+		bool bSavedLodEnable = true;
+
+		EPhase Phase = EPhase::Warmup;
+		int32 PhaseFrame = 0;
+		int64 Frame = 0;
+		double TickStartSeconds = 0.0;
+
+		FPassResult LodOff;
+		FPassResult LodOn;
+
+		// Counters are flushed at the end of the frame - the pass a measured frame belongs to collects them next frame
+		FPassResult* PendingPass = nullptr;
+	};
+
+	static FBenchmarkRun Run;
+
+	static void SetLodEnable(bool bEnable)
+	{
+		if (IConsoleVariable* LodEnable = IConsoleManager::Get().FindConsoleVariable(TEXT("Combat.Lod.Enable")))
+		{
+			LodEnable->Set(bEnable, ECVF_SetByConsole);
+		}
+	}
+
+	static double MeanMs(const TArray<double>& Samples)
+	{
+		double Sum = 0.0;
+		for (const double Ms : Samples)
+		{
+			Sum += Ms;
+		}
+		return Samples.Num() > 0 ? Sum / Samples.Num() : 0.0;
+	}
+
+	static double DeltaPercent(double Base, double Value)
+	{
+		return Base > 0.0 ? (Value - Base) / Base * 100.0 : 0.0;
+	}
+
+	static void Summarize(const TCHAR* Name, const FPassResult& Pass)
+	{
+		const double Frames = FMath::Max(1, Pass.Frames);
+		UE_LOG(LogCombat, Display, TEXT("Combat.Bench.Lod: %-7s actor tick mean %.3f ms, fighters per frame full %.1f reduced %.1f minimal %.1f"),
+			Name, MeanMs(Pass.TickMs), Pass.LodFighters[0] / Frames, Pass.LodFighters[1] / Frames, Pass.LodFighters[2] / Frames);
+	}
+
+	static void StopBenchmark()
+	{
+		FWorldDelegates::OnWorldTickStart.Remove(Run.TickStartHandle);
+		FWorldDelegates::OnWorldPreActorTick.Remove(Run.PreTickHandle);
+		FWorldDelegates::OnWorldPostActorTick.Remove(Run.PostTickHandle);
+		Run.TickStartHandle.Reset();
+		Run.PreTickHandle.Reset();
+		Run.PostTickHandle.Reset();
+		SetLodEnable(Run.bSavedLodEnable);
+		Run.Scene.Destroy();
+
+		if (Run.bQuitWhenDone)
+		{
+			FPlatformMisc::RequestExit(false);
+		}
+	}
+
+	static void Finish()
+	{
+		Summarize(TEXT("LOD off"), Run.LodOff);
+		Summarize(TEXT("LOD on"), Run.LodOn);
+
+		for (const ECombatCounter Counter : REPORTED_COUNTERS)
+		{
+			const uint64 Off = Run.LodOff.Counters[static_cast<int32>(Counter)];
+			const uint64 On = Run.LodOn.Counters[static_cast<int32>(Counter)];
+			UE_LOG(LogCombat, Display, TEXT("Combat.Bench.Lod: %-11s off %llu, on %llu (%+.2f%%)"),
+				FCombatFrameCounters::GetName(Counter), Off, On, DeltaPercent(Off, On));
+		}
+
+		const double OffMs = MeanMs(Run.LodOff.TickMs);
+		const double OnMs = MeanMs(Run.LodOn.TickMs);
+		UE_LOG(LogCombat, Display, TEXT("Combat.Bench.Lod: %d fighters, %d dummies, %d frames/pass - LOD delta %+.3f ms/frame (%+.1f%%)"),
+			Run.Scene.GetNumFighters(), Run.Scene.GetNumDummies(), Run.FramesPerPass, OnMs - OffMs, DeltaPercent(OffMs, OnMs));
+
+		StopBenchmark();
+	}
+
+	static void OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+	{
+		if (World != Run.World.Get() || TickType == LEVELTICK_TimeOnly)
+		{
+			return;
+		}
+
+		if (FPassResult* Pass = Run.PendingPass)
+		{
+			for (int32 Counter = 0; Counter < static_cast<int32>(ECombatCounter::Count); ++Counter)
+			{
+				Pass->Counters[Counter] += FCombatFrameCounters::GetLastFrame(static_cast<ECombatCounter>(Counter));
+			}
+			for (int32 Lod = 0; Lod < UE_ARRAY_COUNT(Pass->LodFighters); ++Lod)
+			{
+				Pass->LodFighters[Lod] += FCombatFrameGauges::GetLastFrame(static_cast<ECombatGauge>(static_cast<int32>(ECombatGauge::LodFull) + Lod));
+			}
+			++Pass->Frames;
+			Run.PendingPass = nullptr;
+		}
+
+		if (Run.Phase == EPhase::Done)
+		{
+			Finish();
+		}
+	}
+
+	static void OnWorldPreActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+	{
+		if (World != Run.World.Get())
+		{
+			return;
+		}
+
+		Run.Scene.DriveInputs(Run.Frame++);
+		Run.TickStartSeconds = FPlatformTime::Seconds();
+	}
+
+	static void OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+	{
+		if (World != Run.World.Get())
+		{
+			return;
+		}
+
+		const double TickMs = (FPlatformTime::Seconds() - Run.TickStartSeconds) * 1000.0;
+		++Run.PhaseFrame;
+
+		auto Measure = [TickMs](FPassResult& Pass)
+		{
+			Pass.TickMs.Add(TickMs);
+			Run.PendingPass = &Pass;
+		};
+
+		switch (Run.Phase)
+		{
+			case EPhase::Warmup:
+				if (Run.PhaseFrame >= WARMUP_FRAMES)
+				{
+					Run.Phase = EPhase::LodOff;
+					Run.PhaseFrame = 0;
+				}
+				break;
+
+			case EPhase::LodOff:
+				Measure(Run.LodOff);
+				if (Run.PhaseFrame >= Run.FramesPerPass)
+				{
+					SetLodEnable(true);
+					Run.Phase = EPhase::Settle;
+					Run.PhaseFrame = 0;
+				}
+				break;
+
+			case EPhase::Settle:
+				if (Run.PhaseFrame >= SETTLE_FRAMES)
+				{
+					Run.Phase = EPhase::LodOn;
+					Run.PhaseFrame = 0;
+				}
+				break;
+
+			case EPhase::LodOn:
+				Measure(Run.LodOn);
+				if (Run.PhaseFrame >= Run.FramesPerPass)
+				{
+					// Finished on the next tick start, once this frame's counters are flushed
+					Run.Phase = EPhase::Done;
+				}
+				break;
+
+			case EPhase::Done:
+				break;
+		}
+	}
+
+	static void RunLodBenchmark(const TArray<FString>& Args, UWorld* World)
+	{
+		if (!World)
+		{
+			return;
+		}
+
+		if (Run.PostTickHandle.IsValid())
+		{
+			UE_LOG(LogCombat, Warning, TEXT("Combat.Bench.Lod: Already running"));
+			return;
+		}
+
+		IConsoleVariable* LodEnable = IConsoleManager::Get().FindConsoleVariable(TEXT("Combat.Lod.Enable"));
+		if (!LodEnable)
+		{
+			UE_LOG(LogCombat, Warning, TEXT("Combat.Bench.Lod: Combat.Lod.Enable not found"));
+			return;
+		}
+
+		const int32 NumFighters = Args.IsValidIndex(0) ? FMath::Max(1, FCString::Atoi(*Args[0])) : 200;
+		const int32 Frames = Args.IsValidIndex(1) ? FMath::Max(1, FCString::Atoi(*Args[1])) : 600;
+		const float DummyRatio = Args.IsValidIndex(2) ? FMath::Max(0.0f, FCString::Atof(*Args[2])) : 1.0f;
+
+		Run.World = World;
+		Run.FramesPerPass = FMath::DivideAndRoundUp(Frames, FCombatBenchmarkScene::INPUT_INTERVAL_FRAMES) * FCombatBenchmarkScene::INPUT_INTERVAL_FRAMES;
+		Run.bQuitWhenDone = Args.IsValidIndex(3) && FCString::Atoi(*Args[3]) != 0;
+		Run.bSavedLodEnable = LodEnable->GetBool();
+		Run.Phase = EPhase::Warmup;
+		Run.PhaseFrame = 0;
+		Run.Frame = 0;
+		Run.LodOff = FPassResult();
+		Run.LodOn = FPassResult();
+		Run.LodOff.TickMs.Reserve(Run.FramesPerPass);
+		Run.LodOn.TickMs.Reserve(Run.FramesPerPass);
+		Run.PendingPass = nullptr;
+
+		const APlayerController* PlayerController = World->GetFirstPlayerController();
+		const APawn* PlayerPawn = PlayerController ? PlayerController->GetPawn() : nullptr;
+		const FVector Origin = PlayerPawn ? PlayerPawn->GetActorLocation() + FVector(FCombatBenchmarkScene::GRID_SPACING, 0.0f, 0.0f) : FVector::ZeroVector;
+
+		const int32 NumDummies = FMath::Max(0, FMath::RoundToInt(NumFighters * DummyRatio));
+		if (!Run.Scene.Spawn(World, Origin, NumFighters, NumDummies))
+		{
+			UE_LOG(LogCombat, Warning, TEXT("Combat.Bench.Lod: Only %d of %d fighters, %d of %d dummies spawned, measuring anyway"),
+				Run.Scene.GetNumFighters(), NumFighters, Run.Scene.GetNumDummies(), NumDummies);
+		}
+
+		SetLodEnable(false);
+		Run.TickStartHandle = FWorldDelegates::OnWorldTickStart.AddStatic(&OnWorldTickStart);
+		Run.PreTickHandle = FWorldDelegates::OnWorldPreActorTick.AddStatic(&OnWorldPreActorTick);
+		Run.PostTickHandle = FWorldDelegates::OnWorldPostActorTick.AddStatic(&OnWorldPostActorTick);
+
+		UE_LOG(LogCombat, Display, TEXT("Combat.Bench.Lod: %d fighters, %d dummies, %d warmup + 2 x %d frames"),
+			Run.Scene.GetNumFighters(), Run.Scene.GetNumDummies(), WARMUP_FRAMES, Run.FramesPerPass);
+	}
+
+	static FAutoConsoleCommandWithWorldAndArgs LodCommand(
+		TEXT("Combat.Bench.Lod"),
+		TEXT("Spawn scripted fighters and dummies and compare actor tick time, Hits and DamageSpecs with Combat.Lod.Enable 0 vs 1. Args: [Fighters=200] [Frames=600] [DummyRatio=1.0] [QuitWhenDone=0]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&RunLodBenchmark));
+}
+#endif
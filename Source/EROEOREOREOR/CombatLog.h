@@ -0,0 +1,46 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Logging/LogMacros.h"
+
+/**
+ * Combat module log categories
+ * Each category has a compile-time ceiling - UE_LOG calls above it are removed from the binary,
+ * so hot-path Verbose/VeryVerbose logs cost nothing unless a build opts in.
+ * Override per build through the target's GlobalDefinitions, e.g. BOUNCE_LOG_COMPILE_VERBOSITY=VeryVerbose
+ * to trace bounce validation, then raise the runtime level with `log LogBounce VeryVerbose`.
+ */
+
+#ifndef COMBAT_LOG_COMPILE_VERBOSITY
+	#if UE_BUILD_SHIPPING || UE_BUILD_TEST
+		#define COMBAT_LOG_COMPILE_VERBOSITY Warning
+	#else
+		#define COMBAT_LOG_COMPILE_VERBOSITY Log
+	#endif
+#endif
+
+#ifndef DASH_LOG_COMPILE_VERBOSITY
+	#define DASH_LOG_COMPILE_VERBOSITY COMBAT_LOG_COMPILE_VERBOSITY
+#endif
+
+#ifndef BOUNCE_LOG_COMPILE_VERBOSITY
+	#define BOUNCE_LOG_COMPILE_VERBOSITY COMBAT_LOG_COMPILE_VERBOSITY
+#endif
+
+#ifndef AOE_LOG_COMPILE_VERBOSITY
+	#define AOE_LOG_COMPILE_VERBOSITY COMBAT_LOG_COMPILE_VERBOSITY
+#endif
+
+// State machine, attack shapes, damage, character and shared combat infrastructure
+EROEOREOREOR_API DECLARE_LOG_CATEGORY_EXTERN(LogCombat, Log, COMBAT_LOG_COMPILE_VERBOSITY);
+
+// Dash ability
+EROEOREOREOR_API DECLARE_LOG_CATEGORY_EXTERN(LogDash, Log, DASH_LOG_COMPILE_VERBOSITY);
+
+// Bounce ability - activation validation, momentum transfer, trajectory enhancement
+EROEOREOREOR_API DECLARE_LOG_CATEGORY_EXTERN(LogBounce, Log, BOUNCE_LOG_COMPILE_VERBOSITY);
+
+// Area-of-effect prototypes
+EROEOREOREOR_API DECLARE_LOG_CATEGORY_EXTERN(LogAoE, Log, AOE_LOG_COMPILE_VERBOSITY);
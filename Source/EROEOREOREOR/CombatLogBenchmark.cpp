@@ -0,0 +1,257 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CombatBenchmarkScene.h"
+#include "CombatLog.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/Pawn.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMisc.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/OutputDevice.h"
+#include "Misc/OutputDeviceRedirector.h"
+
+// LOG COST BENCHMARK - Actor tick time of a scripted fighter scene with combat logging quiet vs fully enabled
+// Usage: Combat.Bench.LogCost [Fighters=50] [Frames=600] [QuitWhenDone=0]
+// Headless: <Project>.uproject <Map> -game -nullrhi -unattended -ExecCmds="Combat.Bench.LogCost 50 600 1"
+//
+// Pass 1 runs at the configured runtime verbosity. Pass 2 raises LogCombat/LogDash/LogBounce/LogAoE to VeryVerbose,
+// which only reaches calls the compile-time ceiling kept. With the default ceiling the delta is what hot-path
+// logging still costs. Run it again in the EROEOREOREORLogCost target, built with a ceiling of All, for the cost the
+// default ceiling strips - the difference between the two chatty deltas.
+
+#if !UE_BUILD_SHIPPING
+namespace CombatLogBenchmark
+{
+	static constexpr int32 WARMUP_FRAMES = 120;
+
+	enum class EPhase : uint8
+	{
+		Warmup,
+		Quiet,
+		Chatty
+	};
+
+	// Counts lines reaching the log so the report shows how much was actually emitted
+	class FLineCounter : public FOutputDevice
+	{
+	public:
+		virtual void Serialize(const TCHAR* V, ELogVerbosity::Type Verbosity, const FName& Category) override
+		{
+			++Lines;
+		}
+
+		virtual bool CanBeUsedOnAnyThread() const override { return true; }
+		virtual bool CanBeUsedOnMultipleThreads() const override { return true; }
+
+		std::atomic<int64> Lines{0};
+	};
+
+	struct FPassResult
+	{
+		TArray<double> TickMs;
+		int64 Lines = 0;
+	};
+
+	struct FBenchmarkRun
+	{
+		TWeakObjectPtr<UWorld> World;
+		FDelegateHandle PreTickHandle;
+		FDelegateHandle PostTickHandle;
+
+		FCombatBenchmarkScene Scene;
+		int32 FramesPerPass = 600;
+		bool bQuitWhenDone = false;
+
+		EPhase Phase = EPhase::Warmup;
+		int32 PhaseFrame = 0;
+		int64 Frame = 0;
+		double TickStartSeconds = 0.0;
+
+		FPassResult Quiet;
+		FPassResult Chatty;
+
+		ELogVerbosity::Type SavedVerbosity[4] = {};
+	};
+
+	static FBenchmarkRun Run;
+	static FLineCounter LineCounter;
+
+	static FLogCategoryBase* const Categories[] = { &LogCombat, &LogDash, &LogBounce, &LogAoE };
+
+	static void SetChatty(bool bChatty)
+	{
+		for (int32 Index = 0; Index < UE_ARRAY_COUNT(Categories); ++Index)
+		{
+			if (bChatty)
+			{
+				Run.SavedVerbosity[Index] = Categories[Index]->GetVerbosity();
+				Categories[Index]->SetVerbosity(ELogVerbosity::VeryVerbose);
+			}
+			else
+			{
+				Categories[Index]->SetVerbosity(Run.SavedVerbosity[Index]);
+			}
+		}
+	}
+
+	static void Summarize(const TCHAR* Name, FPassResult& Pass, double& OutMeanMs)
+	{
+		Pass.TickMs.Sort();
+
+		double Sum = 0.0;
+		for (const double Ms : Pass.TickMs)
+		{
+			Sum += Ms;
+		}
+
+		const int32 Num = Pass.TickMs.Num();
+		OutMeanMs = Num > 0 ? Sum / Num : 0.0;
+		const double P95Ms = Num > 0 ? Pass.TickMs[FMath::Min(Num - 1, FMath::FloorToInt(Num * 0.95))] : 0.0;
+
+		UE_LOG(LogCombat, Display, TEXT("Combat.Bench.LogCost: %-6s actor tick mean %.3f ms, p95 %.3f ms, %.1f log lines/frame"),
+			Name, OutMeanMs, P95Ms, Num > 0 ? static_cast<double>(Pass.Lines) / Num : 0.0);
+	}
+
+	static void StopBenchmark()
+	{
+		FWorldDelegates::OnWorldPreActorTick.Remove(Run.PreTickHandle);
+		FWorldDelegates::OnWorldPostActorTick.Remove(Run.PostTickHandle);
+		Run.PreTickHandle.Reset();
+		Run.PostTickHandle.Reset();
+		GLog->RemoveOutputDevice(&LineCounter);
+		Run.Scene.Destroy();
+
+		if (Run.bQuitWhenDone)
+		{
+			FPlatformMisc::RequestExit(false);
+		}
+	}
+
+	static void Finish()
+	{
+		SetChatty(false);
+
+		double QuietMs = 0.0;
+		double ChattyMs = 0.0;
+		Summarize(TEXT("Quiet"), Run.Quiet, QuietMs);
+		Summarize(TEXT("Chatty"), Run.Chatty, ChattyMs);
+
+		UE_LOG(LogCombat, Display, TEXT("Combat.Bench.LogCost: %d fighters, %d frames/pass, compile ceiling %s - logging delta %+.3f ms/frame (%+.1f%%)"),
+			Run.Scene.GetNumFighters(), Run.FramesPerPass, ELogVerbosity::ToString(LogCombat.CompileTimeVerbosity),
+			ChattyMs - QuietMs, QuietMs > 0.0 ? (ChattyMs - QuietMs) / QuietMs * 100.0 : 0.0);
+
+		if (LogCombat.CompileTimeVerbosity < ELogVerbosity::VeryVerbose)
+		{
+			UE_LOG(LogCombat, Display, TEXT("Combat.Bench.LogCost: Calls above the ceiling were not measured - build EROEOREOREORLogCost (ceiling All) for the stripped cost"));
+		}
+
+		StopBenchmark();
+	}
+
+	static void OnWorldPreActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+	{
+		if (World != Run.World.Get())
+		{
+			return;
+		}
+
+		// Inputs land before actors tick, like Enhanced Input does
+		Run.Scene.DriveInputs(Run.Frame++);
+		Run.TickStartSeconds = FPlatformTime::Seconds();
+		LineCounter.Lines = 0;
+	}
+
+	static void OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+	{
+		if (World != Run.World.Get())
+		{
+			return;
+		}
+
+		const double TickMs = (FPlatformTime::Seconds() - Run.TickStartSeconds) * 1000.0;
+		const int64 Lines = LineCounter.Lines;
+		++Run.PhaseFrame;
+
+		switch (Run.Phase)
+		{
+			case EPhase::Warmup:
+				if (Run.PhaseFrame >= WARMUP_FRAMES)
+				{
+					Run.Phase = EPhase::Quiet;
+					Run.PhaseFrame = 0;
+				}
+				break;
+
+			case EPhase::Quiet:
+				Run.Quiet.TickMs.Add(TickMs);
+				Run.Quiet.Lines += Lines;
+				if (Run.PhaseFrame >= Run.FramesPerPass)
+				{
+					SetChatty(true);
+					Run.Phase = EPhase::Chatty;
+					Run.PhaseFrame = 0;
+				}
+				break;
+
+			case EPhase::Chatty:
+				Run.Chatty.TickMs.Add(TickMs);
+				Run.Chatty.Lines += Lines;
+				if (Run.PhaseFrame >= Run.FramesPerPass)
+				{
+					Finish();
+				}
+				break;
+		}
+	}
+
+	static void RunLogCostBenchmark(const TArray<FString>& Args, UWorld* World)
+	{
+		if (!World)
+		{
+			return;
+		}
+
+		if (Run.PostTickHandle.IsValid())
+		{
+			UE_LOG(LogCombat, Warning, TEXT("Combat.Bench.LogCost: Already running"));
+			return;
+		}
+
+		const int32 NumFighters = Args.IsValidIndex(0) ? FMath::Max(1, FCString::Atoi(*Args[0])) : 50;
+
+		Run.World = World;
+		Run.FramesPerPass = Args.IsValidIndex(1) ? FMath::Max(1, FCString::Atoi(*Args[1])) : 600;
+		Run.bQuitWhenDone = Args.IsValidIndex(2) && FCString::Atoi(*Args[2]) != 0;
+		Run.Phase = EPhase::Warmup;
+		Run.PhaseFrame = 0;
+		Run.Frame = 0;
+		Run.Quiet = FPassResult();
+		Run.Chatty = FPassResult();
+		Run.Quiet.TickMs.Reserve(Run.FramesPerPass);
+		Run.Chatty.TickMs.Reserve(Run.FramesPerPass);
+
+		const APlayerController* PlayerController = World->GetFirstPlayerController();
+		const APawn* PlayerPawn = PlayerController ? PlayerController->GetPawn() : nullptr;
+		const FVector Origin = PlayerPawn ? PlayerPawn->GetActorLocation() + FVector(FCombatBenchmarkScene::GRID_SPACING, 0.0f, 0.0f) : FVector::ZeroVector;
+
+		if (!Run.Scene.Spawn(World, Origin, NumFighters, 0))
+		{
+			UE_LOG(LogCombat, Warning, TEXT("Combat.Bench.LogCost: Only %d of %d fighters spawned, measuring anyway"),
+				Run.Scene.GetNumFighters(), NumFighters);
+		}
+
+		GLog->AddOutputDevice(&LineCounter);
+		Run.PreTickHandle = FWorldDelegates::OnWorldPreActorTick.AddStatic(&OnWorldPreActorTick);
+		Run.PostTickHandle = FWorldDelegates::OnWorldPostActorTick.AddStatic(&OnWorldPostActorTick);
+
+		UE_LOG(LogCombat, Display, TEXT("Combat.Bench.LogCost: %d fighters, %d warmup + 2 x %d frames"),
+			Run.Scene.GetNumFighters(), WARMUP_FRAMES, Run.FramesPerPass);
+	}
+
+	static FAutoConsoleCommandWithWorldAndArgs LogCostCommand(
+		TEXT("Combat.Bench.LogCost"),
+		TEXT("Spawn scripted fighters and compare actor tick time with combat logging quiet vs VeryVerbose. Args: [Fighters=50] [Frames=600] [QuitWhenDone=0]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&RunLogCostBenchmark));
+}
+#endif
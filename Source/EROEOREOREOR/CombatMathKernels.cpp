@@ -0,0 +1,281 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CombatMathKernels.h"
+#include "CombatPrototypeComponent.h"
+#include "AoEPrototypeComponent.h"
+#include "CombatMovementComponent.h"
+#include "GameplayAbility_Bounce.h"
+#include "MovementAbilityTuning.h"
+#include "VelocitySnapshotComponent.h"
+#include "Curves/CurveFloat.h"
+
+// ATTACK TRAJECTORY
+
+FVector FCombatMathKernels::TrajectoryPosition(const FTrajectoryData& Trajectory, const FVector& StartLocation, const FVector& TargetLocation,
+	const FVector& RightVector, float Alpha)
+{
+	const FVector StartPos = StartLocation + Trajectory.StartOffset;
+	const FVector EndPos = TargetLocation + Trajectory.EndOffset;
+
+	switch (Trajectory.TrajectoryType)
+	{
+		case ETrajectoryType::Arc:
+		{
+			// Add arc height using sine wave
+			const float ArcHeight = Trajectory.ArcHeight * FMath::Sin(Alpha * PI);
+			return FMath::Lerp(StartPos, EndPos, Alpha) + FVector(0, 0, ArcHeight);
+		}
+
+		case ETrajectoryType::Homing:
+		{
+			// Apply homing strength
+			const float HomingStrength = FMath::Clamp(Trajectory.HomingStrength, 0.0f, 1.0f);
+			const FVector LinearPos = FMath::Lerp(StartPos, EndPos, Alpha);
+			const FVector DirectPos = StartPos + (EndPos - StartPos).GetSafeNormal() * (EndPos - StartPos).Size() * Alpha;
+			return FMath::Lerp(DirectPos, LinearPos, HomingStrength);
+		}
+
+		case ETrajectoryType::Curve:
+		{
+			FVector BasePos = FMath::Lerp(StartPos, EndPos, Alpha);
+			if (Trajectory.TrajectoryPathCurve)
+			{
+				// Apply curve modification to trajectory
+				BasePos += RightVector * Trajectory.TrajectoryPathCurve->GetFloatValue(Alpha) * 100.0f;
+			}
+			return BasePos;
+		}
+
+		case ETrajectoryType::Teleport:
+			// Offsets are not applied - the attack snaps between the raw locations
+			return Alpha >= 1.0f ? TargetLocation : StartLocation;
+
+		case ETrajectoryType::Linear:
+		default:
+			return FMath::Lerp(StartPos, EndPos, Alpha);
+	}
+}
+
+// AOE
+
+bool FCombatMathKernels::IsPointInShape(const FAoEShapeData& Shape, const FVector& Point, const FVector& Center, const FVector& Forward)
+{
+	const FVector LocalPoint = Point - Center;
+	const float Distance2D = FVector2D(LocalPoint.X, LocalPoint.Y).Size();
+
+	switch (Shape.Shape)
+	{
+		case EAoEShape::Circle:
+			return Distance2D <= Shape.Radius;
+
+		case EAoEShape::Ring:
+			return Distance2D >= Shape.InnerRadius && Distance2D <= Shape.Radius;
+
+		case EAoEShape::Cone:
+		case EAoEShape::Sector:
+		{
+			const float InnerRadius = Shape.Shape == EAoEShape::Sector ? Shape.InnerRadius : 0.0f;
+			if (Distance2D < InnerRadius || Distance2D > Shape.Radius)
+			{
+				return false;
+			}
+
+			const FVector ToPoint = LocalPoint.GetSafeNormal();
+			const float Dot = FVector::DotProduct(Forward, ToPoint);
+			const float AngleDegrees = FMath::RadiansToDegrees(FMath::Acos(Dot));
+
+			return AngleDegrees <= Shape.Angle * 0.5f;
+		}
+
+		case EAoEShape::Rectangle:
+		{
+			const FVector Right = FVector::CrossProduct(Forward, FVector::UpVector);
+			const float ForwardDist = FVector::DotProduct(LocalPoint, Forward);
+			const float RightDist = FVector::DotProduct(LocalPoint, Right);
+
+			return FMath::Abs(ForwardDist) <= Shape.Dimensions.X * 0.5f &&
+				FMath::Abs(RightDist) <= Shape.Dimensions.Y * 0.5f;
+		}
+
+		case EAoEShape::Line:
+		{
+			const FVector Right = FVector::CrossProduct(Forward, FVector::UpVector);
+			const float ForwardDist = FVector::DotProduct(LocalPoint, Forward);
+			const float RightDist = FVector::DotProduct(LocalPoint, Right);
+
+			return ForwardDist >= 0 && ForwardDist <= Shape.Length &&
+				FMath::Abs(RightDist) <= Shape.Width * 0.5f;
+		}
+
+		default:
+			return Distance2D <= Shape.Radius;
+	}
+}
+
+float FCombatMathKernels::CurrentRadius(const FAoEShapeData& Shape, const FAoEBehaviorData& Behavior, float ElapsedTime)
+{
+	if (Behavior.Behavior != EAoEBehavior::Expanding)
+	{
+		return Shape.Radius;
+	}
+
+	const float ElapsedSinceStart = ElapsedTime - Behavior.StartDelay;
+	float ExpansionAlpha = 0.0f;
+
+	if (Behavior.ExpansionCurve)
+	{
+		ExpansionAlpha = Behavior.ExpansionCurve->GetFloatValue(ElapsedSinceStart / Behavior.Duration);
+	}
+	else
+	{
+		ExpansionAlpha = ElapsedSinceStart * Behavior.ExpansionSpeed / Shape.Radius;
+	}
+
+	return FMath::Clamp(ExpansionAlpha, 0.0f, 1.0f) * Shape.Radius;
+}
+
+float FCombatMathKernels::DamageAtLocation(const FAoEDamageData& Damage, float Radius, const FVector& Center, const FVector& Location)
+{
+	if (!Damage.bUseDamageFalloff)
+	{
+		return Damage.Damage;
+	}
+
+	// Calculate distance falloff
+	const float Distance = FVector::Dist(Location, Center);
+	float FalloffAlpha = 1.0f - FMath::Clamp(Distance / Radius, 0.0f, 1.0f);
+
+	if (Damage.DamageFalloffCurve)
+	{
+		FalloffAlpha = Damage.DamageFalloffCurve->GetFloatValue(FalloffAlpha);
+	}
+
+	return Damage.Damage * FalloffAlpha;
+}
+
+// BOUNCE
+
+float FCombatMathKernels::EffectiveBounceVelocity(const FBounceTuningBlock& Tuning, int32 AirBounceCount)
+{
+	if (AirBounceCount == 0)
+	{
+		return Tuning.GetUpwardVelocity();
+	}
+
+	// Reduce velocity for air bounces
+	return Tuning.GetUpwardVelocity() * FMath::Pow(Tuning.GetAirBounceVelocityReduction(), static_cast<float>(AirBounceCount));
+}
+
+FVector FCombatMathKernels::BounceVelocity(const FBounceTuningBlock& Tuning, const UCurveFloat* VelocityCurve, int32 AirBounceCount)
+{
+	float CurveMultiplier = 1.0f;
+	if (VelocityCurve)
+	{
+		const float CurveInput = static_cast<float>(AirBounceCount) / FMath::Max(1.0f, static_cast<float>(Tuning.MaxAirBounces));
+		CurveMultiplier = VelocityCurve->GetFloatValue(CurveInput);
+	}
+
+	return FVector(0.0f, 0.0f, EffectiveBounceVelocity(Tuning, AirBounceCount) * CurveMultiplier);
+}
+
+float FCombatMathKernels::MomentumMultiplier(const FBounceTuningBlock& Tuning, EVelocitySource Source)
+{
+	// PERFORMANCE OPTIMIZATION: Direct enum switch (compiler optimizes to jump table)
+	switch (Source)
+	{
+		case EVelocitySource::Dash:
+			return Tuning.GetDashMomentumMultiplier();
+		case EVelocitySource::Jump:
+			return Tuning.GetJumpMomentumMultiplier();
+		case EVelocitySource::Fall:
+			return Tuning.GetFallMomentumMultiplier();
+		default:
+			return 1.0f;
+	}
+}
+
+FVector FCombatMathKernels::ApplyMomentumTransfer(const FBounceTuningBlock& Tuning, const FVector& BaseBounceVelocity, const FVelocitySnapshot& Momentum)
+{
+	const float Multiplier = MomentumMultiplier(Tuning, Momentum.Source);
+
+	FVector EnhancedVelocity = BaseBounceVelocity;
+
+	if (Tuning.bPreserveMomentumDirection)
+	{
+		const float TransferFactor = Multiplier * Tuning.GetMomentumTransferEfficiency();
+		EnhancedVelocity.X = Momentum.Velocity.X * TransferFactor;
+		EnhancedVelocity.Y = Momentum.Velocity.Y * TransferFactor;
+	}
+	else
+	{
+		// Apply momentum magnitude to existing direction
+		const float HorizontalSpeed = FVector2D(BaseBounceVelocity.X, BaseBounceVelocity.Y).Size();
+		const float EnhancedSpeed = HorizontalSpeed + (Momentum.Speed * Multiplier * Tuning.GetMomentumTransferEfficiency());
+
+		const FVector2D Direction = FVector2D(BaseBounceVelocity.X, BaseBounceVelocity.Y).GetSafeNormal();
+		EnhancedVelocity.X = Direction.X * EnhancedSpeed;
+		EnhancedVelocity.Y = Direction.Y * EnhancedSpeed;
+	}
+
+	// Enhance vertical velocity for dash momentum
+	if (Momentum.Source == EVelocitySource::Dash)
+	{
+		EnhancedVelocity.Z *= (1.0f + (Multiplier - 1.0f) * 0.5f);
+	}
+
+	return EnhancedVelocity;
+}
+
+FVector FCombatMathKernels::EnhancedBounceVelocity(const FBounceTuningBlock& Tuning, const UCurveFloat* VelocityCurve,
+	const FVelocitySnapshot& Momentum, int32 AirBounceCount)
+{
+	return ApplyMomentumTransfer(Tuning, BounceVelocity(Tuning, VelocityCurve, AirBounceCount), Momentum);
+}
+
+EBounceTrajectoryType FCombatMathKernels::DetermineTrajectoryType(const FBounceTuningBlock& Tuning, const FVector& Velocity, float MinVelocityThreshold)
+{
+	const float HorizontalSpeed = FVector2D(Velocity.X, Velocity.Y).Size();
+	const float VerticalSpeed = FMath::Abs(Velocity.Z);
+
+	// FALLING: Significant downward movement
+	if (Velocity.Z < -Tuning.GetFallingVelocityThreshold())
+	{
+		return EBounceTrajectoryType::RecoveryJump;
+	}
+
+	// UPWARD: Significant upward movement
+	if (Velocity.Z > Tuning.GetUpwardVelocityThreshold())
+	{
+		return EBounceTrajectoryType::UpwardBoost;
+	}
+
+	// DIAGONAL: Both horizontal and vertical movement
+	if (HorizontalSpeed > MinVelocityThreshold && VerticalSpeed > MinVelocityThreshold)
+	{
+		return EBounceTrajectoryType::DiagonalBoost;
+	}
+
+	// HORIZONTAL: Primarily horizontal movement
+	if (HorizontalSpeed > MinVelocityThreshold)
+	{
+		return EBounceTrajectoryType::HorizontalBoost;
+	}
+
+	return EBounceTrajectoryType::None;
+}
+
+// DASH
+
+float FCombatMathKernels::DashSpeed(const FCombatDashParams& Params, float Progress)
+{
+	const float ClampedAlpha = FMath::Clamp(Progress, 0.0f, 1.0f);
+
+	if (IsValid(Params.SpeedCurve))
+	{
+		return Params.Speed * Params.SpeedCurve->GetFloatValue(ClampedAlpha);
+	}
+
+	// Default quadratic ease-out - matches the ability's original timer-driven profile
+	const float EaseMultiplier = 1.0f - FMath::Square(1.0f - ClampedAlpha);
+	return Params.Speed * FMath::Lerp(1.0f, 0.2f, EaseMultiplier);
+}
@@ -0,0 +1,47 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UCurveFloat;
+struct FTrajectoryData;
+struct FAoEShapeData;
+struct FAoEBehaviorData;
+struct FAoEDamageData;
+struct FBounceTuningBlock;
+struct FVelocitySnapshot;
+struct FCombatDashParams;
+enum class EBounceTrajectoryType : uint8;
+enum class EVelocitySource : uint8;
+
+/**
+ * Pure combat math - the per-frame kernels behind attack trajectories, AoE hit tests and bounce launches
+ * Everything a kernel reads is passed in: no world, no actor, no component state. The components forward
+ * to these with their live data, and the Combat.Kernels.Throughput test times them in isolation (CombatKernelBenchmark.cpp),
+ * so a SIMD or LUT variant can be dropped in here and compared against the same inputs.
+ */
+class EROEOREOREOR_API FCombatMathKernels
+{
+public:
+	// ATTACK TRAJECTORY - TargetLocation is the live homing target; RightVector bends Curve paths
+	static FVector TrajectoryPosition(const FTrajectoryData& Trajectory, const FVector& StartLocation, const FVector& TargetLocation,
+		const FVector& RightVector, float Alpha);
+
+	// AOE
+	static bool IsPointInShape(const FAoEShapeData& Shape, const FVector& Point, const FVector& Center, const FVector& Forward);
+	static float CurrentRadius(const FAoEShapeData& Shape, const FAoEBehaviorData& Behavior, float ElapsedTime);
+	static float DamageAtLocation(const FAoEDamageData& Damage, float Radius, const FVector& Center, const FVector& Location);
+
+	// BOUNCE
+	static float EffectiveBounceVelocity(const FBounceTuningBlock& Tuning, int32 AirBounceCount);
+	static FVector BounceVelocity(const FBounceTuningBlock& Tuning, const UCurveFloat* VelocityCurve, int32 AirBounceCount);
+	static float MomentumMultiplier(const FBounceTuningBlock& Tuning, EVelocitySource Source);
+	static FVector ApplyMomentumTransfer(const FBounceTuningBlock& Tuning, const FVector& BaseBounceVelocity, const FVelocitySnapshot& Momentum);
+	static FVector EnhancedBounceVelocity(const FBounceTuningBlock& Tuning, const UCurveFloat* VelocityCurve,
+		const FVelocitySnapshot& Momentum, int32 AirBounceCount);
+	static EBounceTrajectoryType DetermineTrajectoryType(const FBounceTuningBlock& Tuning, const FVector& Velocity, float MinVelocityThreshold);
+
+	// DASH - speed at normalized dash time, same curve PhysDash integrates
+	static float DashSpeed(const FCombatDashParams& Params, float Progress);
+};
@@ -0,0 +1,173 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CombatMemory.h"
+#include "CombatLog.h"
+#include "CombatStateMachineComponent.h"
+#include "CombatPrototypeComponent.h"
+#include "AttackShapeComponent.h"
+#include "AoEPrototypeComponent.h"
+#include "VelocitySnapshotComponent.h"
+#include "CombatLagCompensation.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/UObjectIterator.h"
+
+LLM_DEFINE_TAG(Combat_Data, TEXT("Combat.Data"));
+LLM_DEFINE_TAG(Combat_Runtime, TEXT("Combat.Runtime"));
+LLM_DEFINE_TAG(Combat_AoE, TEXT("Combat.AoE"));
+LLM_DEFINE_TAG(Combat_Debug, TEXT("Combat.Debug"));
+
+SIZE_T FCombatMemoryUsage::GetTotal() const
+{
+	SIZE_T Total = 0;
+	for (const SIZE_T CategoryBytes : Bytes)
+	{
+		Total += CategoryBytes;
+	}
+	return Total;
+}
+
+void FCombatMemoryUsage::Append(const FCombatMemoryUsage& Other)
+{
+	for (int32 Index = 0; Index < static_cast<int32>(ECombatMemoryCategory::Count); ++Index)
+	{
+		Bytes[Index] += Other.Bytes[Index];
+	}
+	Tables.Append(Other.Tables);
+}
+
+void ICombatMemoryReporter::AddHeapResourceSize(FResourceSizeEx& CumulativeResourceSize, SIZE_T InlineBytes) const
+{
+	FCombatMemoryUsage Usage;
+	GetCombatMemoryUsage(Usage);
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(Usage.GetTotal() - InlineBytes);
+}
+
+#if !UE_BUILD_SHIPPING
+namespace CombatMemoryReport
+{
+	static TAutoConsoleVariable<int32> CVarCharacterBudgetKB(
+		TEXT("Combat.Memory.CharacterBudgetKB"),
+		0,
+		TEXT("Per-character combat memory budget checked by Combat.MemReport, in KB. 0 disables the check."),
+		ECVF_Default);
+
+	static double ToKB(SIZE_T InBytes)
+	{
+		return static_cast<double>(InBytes) / 1024.0;
+	}
+
+	static FString FormatCategories(const FCombatMemoryUsage& Usage)
+	{
+		return FString::Printf(TEXT("%.1f KB (data %.1f, runtime %.1f, aoe %.1f, debug %.1f)"),
+			ToKB(Usage.GetTotal()),
+			ToKB(Usage.Get(ECombatMemoryCategory::Data)),
+			ToKB(Usage.Get(ECombatMemoryCategory::Runtime)),
+			ToKB(Usage.Get(ECombatMemoryCategory::AoE)),
+			ToKB(Usage.Get(ECombatMemoryCategory::Debug)));
+	}
+
+	struct FOwnerReport
+	{
+		FCombatMemoryUsage Total;
+		TArray<TPair<FString, FCombatMemoryUsage>> Components;
+	};
+
+	template<typename ComponentType>
+	static void GatherComponents(const UWorld* World, TMap<const AActor*, FOwnerReport>& OutOwners)
+	{
+		for (TObjectIterator<ComponentType> It; It; ++It)
+		{
+			const ComponentType* Component = *It;
+			if (Component->GetWorld() != World || !Component->GetOwner())
+			{
+				continue;
+			}
+
+			FCombatMemoryUsage Usage;
+			Component->GetCombatMemoryUsage(Usage);
+
+			FOwnerReport& Report = OutOwners.FindOrAdd(Component->GetOwner());
+			Report.Total.Append(Usage);
+			Report.Components.Emplace(Component->GetClass()->GetName(), MoveTemp(Usage));
+		}
+	}
+
+	static void RunMemReport(const TArray<FString>& Args, UWorld* World)
+	{
+		if (!World)
+		{
+			return;
+		}
+
+		const bool bVerbose = Args.IsValidIndex(0) && FCString::Atoi(*Args[0]) != 0;
+		const int32 BudgetKB = CVarCharacterBudgetKB.GetValueOnGameThread();
+
+		TMap<const AActor*, FOwnerReport> Owners;
+		GatherComponents<UCombatStateMachineComponent>(World, Owners);
+		GatherComponents<UCombatPrototypeComponent>(World, Owners);
+		GatherComponents<UAttackShapeComponent>(World, Owners);
+		GatherComponents<UAoEPrototypeComponent>(World, Owners);
+		GatherComponents<UVelocitySnapshotComponent>(World, Owners);
+
+		// Largest characters first - those are the ones a budget breach points at
+		Owners.ValueSort([](const FOwnerReport& A, const FOwnerReport& B)
+		{
+			return A.Total.GetTotal() > B.Total.GetTotal();
+		});
+
+		FCombatMemoryUsage GrandTotal;
+		int32 OverBudget = 0;
+
+		UE_LOG(LogCombat, Display, TEXT("Combat.MemReport: %d characters, budget %d KB"), Owners.Num(), BudgetKB);
+
+		for (const TPair<const AActor*, FOwnerReport>& Owner : Owners)
+		{
+			const FOwnerReport& Report = Owner.Value;
+			GrandTotal.Append(Report.Total);
+
+			const bool bOverBudget = BudgetKB > 0 && Report.Total.GetTotal() > static_cast<SIZE_T>(BudgetKB) * 1024;
+			if (bOverBudget)
+			{
+				++OverBudget;
+				UE_LOG(LogCombat, Warning, TEXT("  %s: %s - over budget by %.1f KB"), *GetNameSafe(Owner.Key),
+					*FormatCategories(Report.Total), ToKB(Report.Total.GetTotal()) - BudgetKB);
+			}
+			else
+			{
+				UE_LOG(LogCombat, Display, TEXT("  %s: %s"), *GetNameSafe(Owner.Key), *FormatCategories(Report.Total));
+			}
+
+			if (!bVerbose && !bOverBudget)
+			{
+				continue;
+			}
+
+			for (const TPair<FString, FCombatMemoryUsage>& Component : Report.Components)
+			{
+				UE_LOG(LogCombat, Display, TEXT("    %s: %s"), *Component.Key, *FormatCategories(Component.Value));
+				for (const TPair<FName, SIZE_T>& Table : Component.Value.Tables)
+				{
+					UE_LOG(LogCombat, Display, TEXT("      table %s: %.1f KB"), *Table.Key.ToString(), ToKB(Table.Value));
+				}
+			}
+		}
+
+		// World-level state, shared by every character
+		if (const UCombatLagCompensationSubsystem* LagComp = UCombatLagCompensationSubsystem::Get(World))
+		{
+			FCombatMemoryUsage Usage;
+			LagComp->GetCombatMemoryUsage(Usage);
+			GrandTotal.Append(Usage);
+			UE_LOG(LogCombat, Display, TEXT("  LagCompensation: %s"), *FormatCategories(Usage));
+		}
+
+		UE_LOG(LogCombat, Display, TEXT("Combat.MemReport: total %s, %d over budget"), *FormatCategories(GrandTotal), OverBudget);
+	}
+
+	static FAutoConsoleCommandWithWorldAndArgs MemReportCommand(
+		TEXT("Combat.MemReport"),
+		TEXT("Print combat memory owned per character, per component and per loaded table. Args: [Verbose=0]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&RunMemReport));
+}
+#endif
@@ -0,0 +1,97 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "UObject/ResourceSize.h"
+
+/**
+ * Combat memory accounting
+ * LLM tags split combat heap allocations by what they hold (run with -llm, then `stat LLM` or Insights Memory).
+ * Combat.MemReport walks live combat components and prints the bytes each one owns, per loaded table
+ * and per character, against the Combat.Memory.CharacterBudgetKB budget.
+ */
+
+// Data-table rows copied into components at load
+LLM_DECLARE_TAG_API(Combat_Data, EROEOREOREOR_API);
+
+// Per-attack state, hit tracking, input buffers, hurt volumes and scratch arrays
+LLM_DECLARE_TAG_API(Combat_Runtime, EROEOREOREOR_API);
+
+// Active AoE instances and their hit maps
+LLM_DECLARE_TAG_API(Combat_AoE, EROEOREOREOR_API);
+
+// Debug drawing and debug strings
+LLM_DECLARE_TAG_API(Combat_Debug, EROEOREOREOR_API);
+
+enum class ECombatMemoryCategory : uint8
+{
+	Data,
+	Runtime,
+	AoE,
+	Debug,
+	Count
+};
+
+/**
+ * Bytes owned by one combat object - inline size plus heap allocations, split like the LLM tags
+ * Loaded tables are also listed by name so a budget breach can be traced to the table that caused it.
+ */
+struct EROEOREOREOR_API FCombatMemoryUsage
+{
+	SIZE_T Bytes[static_cast<int32>(ECombatMemoryCategory::Count)] = {};
+	TArray<TPair<FName, SIZE_T>, TInlineAllocator<4>> Tables;
+
+	void Add(ECombatMemoryCategory Category, SIZE_T InBytes)
+	{
+		Bytes[static_cast<int32>(Category)] += InBytes;
+	}
+
+	void AddTable(FName TableName, SIZE_T TableBytes)
+	{
+		Add(ECombatMemoryCategory::Data, TableBytes);
+		Tables.Emplace(TableName, TableBytes);
+	}
+
+	SIZE_T Get(ECombatMemoryCategory Category) const { return Bytes[static_cast<int32>(Category)]; }
+	SIZE_T GetTotal() const;
+
+	void Append(const FCombatMemoryUsage& Other);
+};
+
+/**
+ * Implemented by every object Combat.MemReport walks
+ * GetResourceSizeEx overrides forward to AddHeapResourceSize so `obj list` and `memreport` see the same heap bytes.
+ */
+class EROEOREOREOR_API ICombatMemoryReporter
+{
+public:
+	virtual ~ICombatMemoryReporter() = default;
+
+	virtual void GetCombatMemoryUsage(FCombatMemoryUsage& OutUsage) const = 0;
+
+protected:
+	// UObject::GetResourceSizeEx already counts the inline size - only the heap part of the usage is added
+	void AddHeapResourceSize(FResourceSizeEx& CumulativeResourceSize, SIZE_T InlineBytes) const;
+};
+
+// Heap bytes behind common row fields - containers report only their own allocation
+namespace CombatMemory
+{
+	inline SIZE_T GetStringBytes(const FString& String)
+	{
+		return String.GetAllocatedSize();
+	}
+
+	template<typename KeyType, typename ValueType, typename RowBytesType>
+	SIZE_T GetMapBytes(const TMap<KeyType, ValueType>& Map, RowBytesType&& RowBytes)
+	{
+		SIZE_T Bytes = Map.GetAllocatedSize();
+		for (const TPair<KeyType, ValueType>& Pair : Map)
+		{
+			Bytes += RowBytes(Pair.Key, Pair.Value);
+		}
+		return Bytes;
+	}
+}
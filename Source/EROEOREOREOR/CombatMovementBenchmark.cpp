@@ -0,0 +1,563 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CombatMovementComponent.h"
+#include "CombatTrajectoryPredictor.h"
+#include "CombatLog.h"
+#include "GameplayAbility_Dash.h"
+#include "GameplayAbility_Bounce.h"
+#include "MyCharacter.h"
+#include "AbilitySystemComponent.h"
+#include "InputActionValue.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Misc/App.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Tests/AutomationCommon.h"
+
+// MOVEMENT BENCHMARK - Input-to-velocity latency and trajectory error for Dash/Bounce
+// Automation test EROEOREOREOR.Combat.Movement.Latency (game):
+//   <Project>.uproject -game -nullrhi -unattended -ExecCmds="Automation RunTests EROEOREOREOR.Combat.Movement; Quit"
+//
+// Runs every scenario (dash left, dash right, bounce, dash->bounce combo) at 30, 60, 120 and 240 Hz
+// fixed time steps on the local AMyCharacter. Inputs go through the same handlers Enhanced Input calls.
+// Each trial records frames from input to the first velocity change and the error of the measured
+// path against FCombatTrajectoryPredictor. Per-trial rows go to Saved/Benchmarks/MovementLatency_<time>.csv;
+// the test fails when a scenario misses a trial or its latency, jitter or landing error exceeds the bounds below.
+
+#if WITH_DEV_AUTOMATION_TESTS
+namespace CombatMovementBenchmark
+{
+	enum class EScenario : uint8
+	{
+		DashLeft,
+		DashRight,
+		Bounce,
+		DashBounce,
+		Count
+	};
+
+	static const TCHAR* ScenarioNames[] = { TEXT("DashLeft"), TEXT("DashRight"), TEXT("Bounce"), TEXT("DashBounce") };
+	static_assert(UE_ARRAY_COUNT(ScenarioNames) == static_cast<int32>(EScenario::Count), "ScenarioNames out of sync with EScenario");
+
+	static constexpr float TickRates[] = { 30.0f, 60.0f, 120.0f, 240.0f };
+	static constexpr int32 NumTickRates = UE_ARRAY_COUNT(TickRates);
+
+	// Constants - Epic Games style
+	static constexpr float SETTLE_SECONDS = 0.5f;
+	static constexpr float SETTLE_TIMEOUT_SECONDS = 5.0f;
+	static constexpr float TRIAL_TIMEOUT_SECONDS = 5.0f;
+	static constexpr float COMBO_BOUNCE_DELAY = 0.2f;
+	static constexpr float VELOCITY_CHANGE_THRESHOLD = 1.0f;
+
+	// Regression bounds - the press lands after movement has ticked, so the next frame's move is the first that can react
+	static constexpr int32 REPETITIONS = 5;
+	static constexpr double MAX_MEAN_FRAMES_TO_VELOCITY_CHANGE = 2.0;
+	static constexpr double MAX_JITTER_FRAMES = 0.5;
+
+	// Landing error allowed on top of one simulation step of travel at LANDING_ERROR_SPEED
+	static constexpr double LANDING_ERROR_BASE_CM = 5.0;
+	static constexpr double LANDING_ERROR_SPEED = 1000.0;
+	static constexpr double RUN_TIMEOUT_SECONDS = 600.0;
+	static const TCHAR* const TEST_MAP = TEXT("/Game/ThirdPerson/Lvl_ThirdPerson");
+
+	struct FTrialResult
+	{
+		float TickHz = 0.0f;
+		EScenario Scenario = EScenario::DashLeft;
+		int32 Trial = 0;
+
+		// -1 when the input never changed velocity (activation rejected or timed out)
+		int32 FramesToVelocityChange = -1;
+
+		// Negative when the prediction or the measured path has no landing
+		float ApexErrorCm = -1.0f;
+		float LandingErrorCm = -1.0f;
+		float LandingTimeErrorMs = 0.0f;
+		bool bCompleted = false;
+	};
+
+	// Repetitions of one scenario at one tick rate
+	struct FScenarioSummary
+	{
+		float TickHz = 0.0f;
+		EScenario Scenario = EScenario::DashLeft;
+		int32 Count = 0;
+		int32 Failed = 0;
+		double MeanFrames = 0.0;
+		double JitterFrames = 0.0;
+		double MeanLandingErrorCm = 0.0;
+		int32 LandingCount = 0;
+	};
+
+	enum class EPhase : uint8
+	{
+		Settle,
+		Running
+	};
+
+	struct FBenchmarkRun
+	{
+		TWeakObjectPtr<AMyCharacter> Character;
+		TWeakObjectPtr<UWorld> World;
+		FDelegateHandle TickHandle;
+
+		int32 Repetitions = REPETITIONS;
+		bool bPreviousUseFixedTimeStep = false;
+		double PreviousFixedDeltaTime = 0.0;
+
+		int32 RateIndex = 0;
+		int32 ScenarioIndex = 0;
+		int32 Trial = 0;
+
+		EPhase Phase = EPhase::Settle;
+		int32 PhaseFrame = 0;
+		float PhaseTime = 0.0f;
+		bool bPlaced = false;
+
+		// Per-trial measurement
+		FVector HomeLocation = FVector::ZeroVector;
+		FVector VelocityBeforeInput = FVector::ZeroVector;
+		FCombatTrajectoryPrediction Prediction;
+		float ReferenceTime = 0.0f;
+		float MeasuredApexZ = 0.0f;
+		bool bSawDashMode = false;
+		bool bLeftGround = false;
+		bool bComboBounceSent = false;
+		FTrialResult Current;
+
+		FGameplayTagContainer SettleBlockingTags;
+		TArray<FTrialResult> Results;
+		TArray<FScenarioSummary> Summaries;
+	};
+
+	static FBenchmarkRun Run;
+
+	static EScenario GetScenario()
+	{
+		return static_cast<EScenario>(Run.ScenarioIndex);
+	}
+
+	static void ApplyTickRate()
+	{
+		FApp::SetUseFixedTimeStep(true);
+		FApp::SetFixedDeltaTime(1.0 / TickRates[Run.RateIndex]);
+	}
+
+	template <typename AbilityType>
+	static const AbilityType* FindAbilityInstance(const AMyCharacter* Character)
+	{
+		const UAbilitySystemComponent* ASC = Character->GetAbilitySystemComponent();
+		if (!ASC)
+		{
+			return nullptr;
+		}
+
+		for (const FGameplayAbilitySpec& Spec : ASC->GetActivatableAbilities())
+		{
+			if (Spec.Ability && Spec.Ability->IsA<AbilityType>())
+			{
+				return Cast<AbilityType>(Spec.GetPrimaryInstance());
+			}
+		}
+		return nullptr;
+	}
+
+	// Starts the reference path for the move about to be injected - apex and landing are measured from here
+	static void BeginReference(const FCombatTrajectoryPrediction& InPrediction)
+	{
+		Run.Prediction = InPrediction;
+		Run.ReferenceTime = Run.PhaseTime;
+		Run.MeasuredApexZ = Run.Character->GetActorLocation().Z;
+	}
+
+	static void InjectInput(AMyCharacter* Character)
+	{
+		const FInputActionValue PressedValue(true);
+		const float LandingZ = Run.HomeLocation.Z;
+
+		switch (GetScenario())
+		{
+			case EScenario::DashLeft:
+			case EScenario::DashBounce:
+				if (const UGameplayAbility_Dash* Dash = FindAbilityInstance<UGameplayAbility_Dash>(Character))
+				{
+					BeginReference(Dash->PredictDashFromCurrentState(EDashDirection::Left, LandingZ));
+				}
+				Character->DashLeft(PressedValue);
+				break;
+			case EScenario::DashRight:
+				if (const UGameplayAbility_Dash* Dash = FindAbilityInstance<UGameplayAbility_Dash>(Character))
+				{
+					BeginReference(Dash->PredictDashFromCurrentState(EDashDirection::Right, LandingZ));
+				}
+				Character->DashRight(PressedValue);
+				break;
+			case EScenario::Bounce:
+				if (const UGameplayAbility_Bounce* Bounce = FindAbilityInstance<UGameplayAbility_Bounce>(Character))
+				{
+					BeginReference(Bounce->PredictBounceFromCurrentState(LandingZ));
+				}
+				Character->Bounce(PressedValue);
+				break;
+			default:
+				break;
+		}
+	}
+
+	static void FinishTrial(const FVector& EndLocation, bool bCompleted)
+	{
+		FTrialResult& Result = Run.Current;
+		Result.bCompleted = bCompleted;
+
+		if (bCompleted)
+		{
+			Result.ApexErrorCm = FMath::Abs(Run.MeasuredApexZ - Run.Prediction.Apex.Z);
+			if (Run.Prediction.bLands)
+			{
+				Result.LandingErrorCm = FVector::Dist(EndLocation, Run.Prediction.LandingPoint);
+				Result.LandingTimeErrorMs = ((Run.PhaseTime - Run.ReferenceTime) - Run.Prediction.LandingTime) * 1000.0f;
+			}
+		}
+
+		Run.Results.Add(Result);
+		Run.Phase = EPhase::Settle;
+		Run.PhaseFrame = 0;
+		Run.PhaseTime = 0.0f;
+		Run.bPlaced = false;
+
+		if (++Run.Trial < Run.Repetitions)
+		{
+			return;
+		}
+
+		Run.Trial = 0;
+		if (++Run.ScenarioIndex < static_cast<int32>(EScenario::Count))
+		{
+			return;
+		}
+
+		Run.ScenarioIndex = 0;
+		if (++Run.RateIndex < NumTickRates)
+		{
+			ApplyTickRate();
+		}
+	}
+
+	static void WriteResults()
+	{
+		FString Csv = TEXT("TickHz,Scenario,Trial,Completed,FramesToVelocityChange,LatencyMs,ApexErrorCm,LandingErrorCm,LandingTimeErrorMs\n");
+		for (const FTrialResult& Result : Run.Results)
+		{
+			const float LatencyMs = Result.FramesToVelocityChange >= 0 ? Result.FramesToVelocityChange * 1000.0f / Result.TickHz : -1.0f;
+			Csv += FString::Printf(TEXT("%.0f,%s,%d,%d,%d,%.3f,%.3f,%.3f,%.3f\n"),
+				Result.TickHz, ScenarioNames[static_cast<int32>(Result.Scenario)], Result.Trial, Result.bCompleted ? 1 : 0,
+				Result.FramesToVelocityChange, LatencyMs, Result.ApexErrorCm, Result.LandingErrorCm, Result.LandingTimeErrorMs);
+		}
+
+		const FString Path = FPaths::ProjectSavedDir() / TEXT("Benchmarks") /
+			FString::Printf(TEXT("MovementLatency_%s.csv"), *FDateTime::Now().ToString());
+		if (FFileHelper::SaveStringToFile(Csv, *Path))
+		{
+			UE_LOG(LogCombat, Display, TEXT("Combat.Movement.Latency: Wrote %d trials to %s"), Run.Results.Num(), *Path);
+		}
+		else
+		{
+			UE_LOG(LogCombat, Error, TEXT("Combat.Movement.Latency: Failed to write %s"), *Path);
+		}
+
+		// Summary - jitter is the standard deviation of frames-to-velocity-change across repetitions
+		Run.Summaries.Reset();
+		for (const float TickHz : TickRates)
+		{
+			for (int32 ScenarioIdx = 0; ScenarioIdx < static_cast<int32>(EScenario::Count); ++ScenarioIdx)
+			{
+				FScenarioSummary& Summary = Run.Summaries.AddDefaulted_GetRef();
+				Summary.TickHz = TickHz;
+				Summary.Scenario = static_cast<EScenario>(ScenarioIdx);
+
+				double FrameSum = 0.0;
+				double FrameSquaredSum = 0.0;
+				double LandingErrorSum = 0.0;
+
+				for (const FTrialResult& Result : Run.Results)
+				{
+					if (Result.TickHz != TickHz || Result.Scenario != Summary.Scenario)
+					{
+						continue;
+					}
+					if (!Result.bCompleted || Result.FramesToVelocityChange < 0)
+					{
+						++Summary.Failed;
+						continue;
+					}
+
+					++Summary.Count;
+					FrameSum += Result.FramesToVelocityChange;
+					FrameSquaredSum += FMath::Square(static_cast<double>(Result.FramesToVelocityChange));
+					if (Result.LandingErrorCm >= 0.0f)
+					{
+						LandingErrorSum += Result.LandingErrorCm;
+						++Summary.LandingCount;
+					}
+				}
+
+				Summary.MeanFrames = Summary.Count > 0 ? FrameSum / Summary.Count : 0.0;
+				Summary.JitterFrames = Summary.Count > 0 ? FMath::Sqrt(FMath::Max(0.0, FrameSquaredSum / Summary.Count - FMath::Square(Summary.MeanFrames))) : 0.0;
+				Summary.MeanLandingErrorCm = Summary.LandingCount > 0 ? LandingErrorSum / Summary.LandingCount : 0.0;
+
+				UE_LOG(LogCombat, Display, TEXT("Combat.Movement.Latency: %3.0f Hz %-10s frames %.2f +/- %.2f (%.2f ms), landing error %.2f cm, failed %d"),
+					TickHz, ScenarioNames[ScenarioIdx], Summary.MeanFrames, Summary.JitterFrames, Summary.MeanFrames * 1000.0 / TickHz,
+					Summary.MeanLandingErrorCm, Summary.Failed);
+			}
+		}
+	}
+
+	static void StopBenchmark()
+	{
+		FWorldDelegates::OnWorldPostActorTick.Remove(Run.TickHandle);
+		Run.TickHandle.Reset();
+
+		FApp::SetUseFixedTimeStep(Run.bPreviousUseFixedTimeStep);
+		FApp::SetFixedDeltaTime(Run.PreviousFixedDeltaTime);
+	}
+
+	static void TickSettle(AMyCharacter* Character, UCombatMovementComponent* CombatMovement)
+	{
+		if (!Run.bPlaced)
+		{
+			// Every trial starts from the same grounded spot at rest
+			CombatMovement->StopCombatMovement();
+			Character->SetActorLocation(Run.HomeLocation, false, nullptr, ETeleportType::TeleportPhysics);
+			CombatMovement->Velocity = FVector::ZeroVector;
+			Run.bPlaced = true;
+		}
+
+		const UAbilitySystemComponent* ASC = Character->GetAbilitySystemComponent();
+		const bool bSettled = Run.PhaseTime >= SETTLE_SECONDS && CombatMovement->IsMovingOnGround()
+			&& !CombatMovement->IsInCombatMovementMode(ECombatMovementMode::Dash)
+			&& !CombatMovement->IsInCombatMovementMode(ECombatMovementMode::Bounce)
+			&& (!ASC || !ASC->HasAnyMatchingGameplayTags(Run.SettleBlockingTags));
+
+		if (!bSettled)
+		{
+			if (Run.PhaseTime > SETTLE_TIMEOUT_SECONDS)
+			{
+				UE_LOG(LogCombat, Warning, TEXT("Combat.Movement.Latency: Character never settled before %s trial %d"),
+					ScenarioNames[Run.ScenarioIndex], Run.Trial);
+				Run.Current = FTrialResult();
+				Run.Current.TickHz = TickRates[Run.RateIndex];
+				Run.Current.Scenario = GetScenario();
+				Run.Current.Trial = Run.Trial;
+				FinishTrial(Character->GetActorLocation(), false);
+			}
+			return;
+		}
+
+		Run.Current = FTrialResult();
+		Run.Current.TickHz = TickRates[Run.RateIndex];
+		Run.Current.Scenario = GetScenario();
+		Run.Current.Trial = Run.Trial;
+		Run.Prediction = FCombatTrajectoryPrediction();
+		Run.bSawDashMode = false;
+		Run.bLeftGround = false;
+		Run.bComboBounceSent = false;
+
+		Run.Phase = EPhase::Running;
+		Run.PhaseFrame = 0;
+		Run.PhaseTime = 0.0f;
+		Run.VelocityBeforeInput = CombatMovement->Velocity;
+		InjectInput(Character);
+	}
+
+	static void TickRunning(AMyCharacter* Character, UCombatMovementComponent* CombatMovement)
+	{
+		const FVector Location = Character->GetActorLocation();
+
+		if (Run.Current.FramesToVelocityChange < 0
+			&& !CombatMovement->Velocity.Equals(Run.VelocityBeforeInput, VELOCITY_CHANGE_THRESHOLD))
+		{
+			Run.Current.FramesToVelocityChange = Run.PhaseFrame;
+		}
+
+		Run.MeasuredApexZ = FMath::Max(Run.MeasuredApexZ, Location.Z);
+		Run.bSawDashMode |= CombatMovement->IsInCombatMovementMode(ECombatMovementMode::Dash);
+		Run.bLeftGround |= !CombatMovement->IsMovingOnGround();
+
+		const EScenario Scenario = GetScenario();
+		if (Scenario == EScenario::DashBounce && !Run.bComboBounceSent && Run.PhaseTime >= COMBO_BOUNCE_DELAY)
+		{
+			// Reference switches to the bounce launched from mid-dash state
+			if (const UGameplayAbility_Bounce* Bounce = FindAbilityInstance<UGameplayAbility_Bounce>(Character))
+			{
+				BeginReference(Bounce->PredictBounceFromCurrentState(Run.HomeLocation.Z));
+			}
+			Run.bLeftGround = false;
+			Run.bComboBounceSent = true;
+			Character->Bounce(FInputActionValue(true));
+			return;
+		}
+
+		const bool bIsDash = Scenario == EScenario::DashLeft || Scenario == EScenario::DashRight;
+		const bool bFinished = bIsDash
+			? Run.bSawDashMode && !CombatMovement->IsInCombatMovementMode(ECombatMovementMode::Dash)
+			: Run.bLeftGround && CombatMovement->IsMovingOnGround();
+
+		if (bFinished)
+		{
+			FinishTrial(Location, true);
+		}
+		else if (Run.PhaseTime > TRIAL_TIMEOUT_SECONDS)
+		{
+			FinishTrial(Location, false);
+		}
+	}
+
+	static void OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+	{
+		if (World != Run.World.Get())
+		{
+			return;
+		}
+
+		AMyCharacter* Character = Run.Character.Get();
+		UCombatMovementComponent* CombatMovement = Character ? Character->GetCombatMovementComponent() : nullptr;
+		if (!CombatMovement)
+		{
+			UE_LOG(LogCombat, Warning, TEXT("Combat.Movement.Latency: Character lost, aborting"));
+			StopBenchmark();
+			return;
+		}
+
+		++Run.PhaseFrame;
+		Run.PhaseTime += DeltaSeconds;
+
+		if (Run.Phase == EPhase::Settle)
+		{
+			TickSettle(Character, CombatMovement);
+		}
+		else
+		{
+			TickRunning(Character, CombatMovement);
+		}
+
+		if (Run.RateIndex >= NumTickRates)
+		{
+			WriteResults();
+			StopBenchmark();
+		}
+	}
+
+	static bool StartBenchmark(UWorld* World)
+	{
+		const APlayerController* PlayerController = World ? World->GetFirstPlayerController() : nullptr;
+		AMyCharacter* Character = PlayerController ? Cast<AMyCharacter>(PlayerController->GetPawn()) : nullptr;
+		if (!Character || !Character->GetCombatMovementComponent())
+		{
+			return false;
+		}
+
+		Run = FBenchmarkRun();
+		Run.Character = Character;
+		Run.World = World;
+		Run.HomeLocation = Character->GetActorLocation();
+		Run.bPreviousUseFixedTimeStep = FApp::UseFixedTimeStep();
+		Run.PreviousFixedDeltaTime = FApp::GetFixedDeltaTime();
+		Run.SettleBlockingTags.AddTag(FGameplayTag::RequestGameplayTag(FName("State.Dashing")));
+		Run.SettleBlockingTags.AddTag(FGameplayTag::RequestGameplayTag(FName("State.Bouncing")));
+		Run.SettleBlockingTags.AddTag(FGameplayTag::RequestGameplayTag(FName("Cooldown.Dash")));
+		Run.SettleBlockingTags.AddTag(FGameplayTag::RequestGameplayTag(FName("Cooldown.Bounce")));
+		Run.Results.Reserve(Run.Repetitions * static_cast<int32>(EScenario::Count) * NumTickRates);
+
+		ApplyTickRate();
+		Run.TickHandle = FWorldDelegates::OnWorldPostActorTick.AddStatic(&OnWorldPostActorTick);
+
+		UE_LOG(LogCombat, Display, TEXT("Combat.Movement.Latency: %d repetitions x %d scenarios x %d tick rates"),
+			Run.Repetitions, static_cast<int32>(EScenario::Count), NumTickRates);
+		return true;
+	}
+
+	static void CheckBounds(FAutomationTestBase& Test)
+	{
+		if (Run.Summaries.Num() != NumTickRates * static_cast<int32>(EScenario::Count))
+		{
+			Test.AddError(TEXT("Run aborted before every scenario finished"));
+			return;
+		}
+
+		for (const FScenarioSummary& Summary : Run.Summaries)
+		{
+			const FString Label = FString::Printf(TEXT("%.0f Hz %s"), Summary.TickHz, ScenarioNames[static_cast<int32>(Summary.Scenario)]);
+			const double MaxLandingErrorCm = LANDING_ERROR_BASE_CM + LANDING_ERROR_SPEED / Summary.TickHz;
+
+			Test.TestEqual(FString::Printf(TEXT("%s failed trials"), *Label), Summary.Failed, 0);
+			Test.TestTrue(FString::Printf(TEXT("%s frames to velocity change %.2f <= %.2f"), *Label, Summary.MeanFrames, MAX_MEAN_FRAMES_TO_VELOCITY_CHANGE),
+				Summary.MeanFrames <= MAX_MEAN_FRAMES_TO_VELOCITY_CHANGE);
+			Test.TestTrue(FString::Printf(TEXT("%s jitter %.2f <= %.2f frames"), *Label, Summary.JitterFrames, MAX_JITTER_FRAMES),
+				Summary.JitterFrames <= MAX_JITTER_FRAMES);
+			if (Summary.LandingCount > 0)
+			{
+				Test.TestTrue(FString::Printf(TEXT("%s landing error %.2f <= %.2f cm"), *Label, Summary.MeanLandingErrorCm, MaxLandingErrorCm),
+					Summary.MeanLandingErrorCm <= MaxLandingErrorCm);
+			}
+		}
+	}
+}
+
+// Starts the run once the player pawn is possessed and blocks the test until every tick rate has finished
+class FCombatRunMovementLatency : public IAutomationLatentCommand
+{
+public:
+	explicit FCombatRunMovementLatency(FAutomationTestBase* InTest)
+		: Test(InTest)
+	{
+	}
+
+	virtual bool Update() override
+	{
+		using namespace CombatMovementBenchmark;
+
+		if (!bStarted)
+		{
+			bStarted = StartBenchmark(AutomationCommon::GetAnyGameWorld());
+			if (!bStarted && GetCurrentRunTime() > SETTLE_TIMEOUT_SECONDS)
+			{
+				Test->AddError(TEXT("No local AMyCharacter with UCombatMovementComponent"));
+				return true;
+			}
+			return false;
+		}
+
+		if (Run.TickHandle.IsValid())
+		{
+			if (GetCurrentRunTime() < RUN_TIMEOUT_SECONDS)
+			{
+				return false;
+			}
+
+			Test->AddError(TEXT("Movement latency run timed out"));
+			StopBenchmark();
+			return true;
+		}
+
+		CheckBounds(*Test);
+		return true;
+	}
+
+private:
+	FAutomationTestBase* Test;
+	bool bStarted = false;
+};
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCombatMovementLatencyTest, "EROEOREOREOR.Combat.Movement.Latency",
+	EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FCombatMovementLatencyTest::RunTest(const FString& Parameters)
+{
+	AutomationOpenMap(CombatMovementBenchmark::TEST_MAP);
+	ADD_LATENT_AUTOMATION_COMMAND(FCombatRunMovementLatency(this));
+	return true;
+}
+#endif
@@ -0,0 +1,652 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CombatMovementComponent.h"
+#include "VelocitySnapshotComponent.h"
+#include "CombatMathKernels.h"
+#include "CombatStats.h"
+#include "CombatLog.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/Controller.h"
+#include "Components/CapsuleComponent.h"
+#include "Curves/CurveFloat.h"
+#include "Engine/World.h"
+
+float FCombatDashParams::EvaluateSpeed(float InAlpha) const
+{
+	return FCombatMathKernels::DashSpeed(*this, InAlpha);
+}
+
+void UCombatMovementComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// Cache once - PhysDash feeds the momentum-transfer snapshots every substep
+	if (const AActor* Owner = GetOwner())
+	{
+		VelocitySnapshotComponent = Owner->FindComponentByClass<UVelocitySnapshotComponent>();
+	}
+}
+
+// PUBLIC API
+
+bool UCombatMovementComponent::ShouldWaitForClientMove() const
+{
+	return CharacterOwner && CharacterOwner->HasAuthority() &&
+		CharacterOwner->GetRemoteRole() == ROLE_AutonomousProxy && !CharacterOwner->IsLocallyControlled();
+}
+
+void UCombatMovementComponent::StartDash(const FCombatDashParams& InParams)
+{
+	DashParams = InParams;
+	DashParams.Duration = FMath::Max(DashParams.Duration, KINDA_SMALL_NUMBER);
+
+	// Server for a remote client: parameters only, the flagged move decides when and which way
+	if (ShouldWaitForClientMove())
+	{
+		DashPairing.ParamsTime = GetWorld()->GetTimeSeconds();
+		return;
+	}
+
+	bWantsToDash = true;
+	bWantsToDashLeft = DashParams.DirectionSign < 0.0f;
+	bWantsToBounce = false;
+}
+
+void UCombatMovementComponent::StartBounce(const FCombatBounceParams& InParams)
+{
+	BounceParams = InParams;
+
+	if (ShouldWaitForClientMove())
+	{
+		BouncePairing.ParamsTime = GetWorld()->GetTimeSeconds();
+		return;
+	}
+
+	bWantsToBounce = true;
+	bWantsToDash = false;
+}
+
+bool UCombatMovementComponent::PairServerStart(bool& bInOutWantsToStart, FServerStartPairing& Pairing)
+{
+	const double Now = GetWorld()->GetTimeSeconds();
+	const bool bParamsReady = Pairing.ParamsTime >= 0.0 && Now - Pairing.ParamsTime <= START_PAIRING_SECONDS;
+
+	if (bInOutWantsToStart)
+	{
+		if (bParamsReady)
+		{
+			Pairing.ParamsTime = -1.0;
+			return true;
+		}
+
+		// The move beat its ability RPC - starting now would use the previous parameters
+		Pairing.MoveTime = Now;
+		Pairing.bMoveDashLeft = bWantsToDashLeft;
+		bInOutWantsToStart = false;
+		return false;
+	}
+
+	const bool bMoveWaiting = Pairing.MoveTime >= 0.0 && Now - Pairing.MoveTime <= START_PAIRING_SECONDS;
+	if (bMoveWaiting && bParamsReady)
+	{
+		Pairing.ParamsTime = -1.0;
+		Pairing.MoveTime = -1.0;
+		bInOutWantsToStart = true;
+		return true;
+	}
+
+	return false;
+}
+
+void UCombatMovementComponent::StopCombatMovement()
+{
+	bWantsToDash = false;
+	bWantsToBounce = false;
+
+	if (MovementMode == MOVE_Custom)
+	{
+		// Interrupted - no momentum retention, OnMovementModeChanged reports bWasInterrupted
+		SetMovementMode(MOVE_Falling);
+	}
+}
+
+bool UCombatMovementComponent::IsInCombatMovementMode(ECombatMovementMode InMode) const
+{
+	return MovementMode == MOVE_Custom && CustomMovementMode == static_cast<uint8>(InMode);
+}
+
+float UCombatMovementComponent::GetDashProgress() const
+{
+	if (!IsInCombatMovementMode(ECombatMovementMode::Dash))
+	{
+		return 0.0f;
+	}
+
+	return FMath::Clamp(DashElapsedTime / DashParams.Duration, 0.0f, 1.0f);
+}
+
+FVector UCombatMovementComponent::GetDashDirection() const
+{
+	return IsInCombatMovementMode(ECombatMovementMode::Dash) ? CalculateDashDirection() : FVector::ZeroVector;
+}
+
+float UCombatMovementComponent::GetDashSpeed() const
+{
+	return IsInCombatMovementMode(ECombatMovementMode::Dash) ? DashParams.EvaluateSpeed(GetDashProgress()) : 0.0f;
+}
+
+// UCharacterMovementComponent INTERFACE
+
+bool UCombatMovementComponent::IsMovingOnGround() const
+{
+	return Super::IsMovingOnGround() || (IsInCombatMovementMode(ECombatMovementMode::Dash) && bDashOnGround);
+}
+
+bool UCombatMovementComponent::IsFalling() const
+{
+	if (MovementMode == MOVE_Custom && UpdatedComponent)
+	{
+		return IsInCombatMovementMode(ECombatMovementMode::Bounce) ||
+			(IsInCombatMovementMode(ECombatMovementMode::Dash) && !bDashOnGround);
+	}
+
+	return Super::IsFalling();
+}
+
+float UCombatMovementComponent::GetMaxSpeed() const
+{
+	if (MovementMode == MOVE_Custom)
+	{
+		switch (static_cast<ECombatMovementMode>(CustomMovementMode))
+		{
+			case ECombatMovementMode::Dash:
+				return DashParams.Speed * DashParams.VelocityMultiplier *
+					FMath::Max(DashParams.XAxisMultiplier, DashParams.YAxisMultiplier);
+
+			case ECombatMovementMode::Bounce:
+				// Lateral air control uses falling limits
+				return MaxWalkSpeed;
+
+			default:
+				break;
+		}
+	}
+
+	return Super::GetMaxSpeed();
+}
+
+bool UCombatMovementComponent::DoJump(bool bReplayingMoves, float DeltaTime)
+{
+	// Grounded dashes keep the jump they had while the dash ran in MOVE_Walking
+	if (IsInCombatMovementMode(ECombatMovementMode::Dash) && bDashOnGround && CharacterOwner && CharacterOwner->CanJump())
+	{
+		// Stay in dash mode - PhysDash integrates gravity once we leave the floor
+		Velocity.Z = FMath::Max<FVector::FReal>(Velocity.Z, JumpZVelocity);
+		bDashOnGround = false;
+		CurrentFloor.Clear();
+		return true;
+	}
+
+	return Super::DoJump(bReplayingMoves, DeltaTime);
+}
+
+FVector UCombatMovementComponent::GetAirControl(float DeltaTime, float TickAirControl, const FVector& FallAcceleration)
+{
+	if (IsInCombatMovementMode(ECombatMovementMode::Bounce))
+	{
+		TickAirControl *= BounceAirControlScale;
+	}
+
+	return Super::GetAirControl(DeltaTime, TickAirControl, FallAcceleration);
+}
+
+void UCombatMovementComponent::UpdateCharacterStateBeforeMovement(float DeltaSeconds)
+{
+	// A server replaying a remote client's moves starts a mode only once the flagged move and its ability RPC have both arrived
+	if (ShouldWaitForClientMove())
+	{
+		const bool bDashFlagged = bWantsToDash;
+		if (PairServerStart(bWantsToDash, DashPairing) && !bDashFlagged)
+		{
+			// Released a held start - its direction came with the held move
+			bWantsToDashLeft = DashPairing.bMoveDashLeft;
+		}
+		PairServerStart(bWantsToBounce, BouncePairing);
+	}
+
+	// Starts are applied here so the first velocity evaluation happens inside this movement update.
+	// Runs identically for local prediction, server replay of the client's move and client replay after a correction.
+	if (bWantsToBounce)
+	{
+		ApplyPendingBounce();
+	}
+	else if (bWantsToDash)
+	{
+		ApplyPendingDash();
+	}
+
+	Super::UpdateCharacterStateBeforeMovement(DeltaSeconds);
+}
+
+void UCombatMovementComponent::UpdateFromCompressedFlags(uint8 Flags)
+{
+	Super::UpdateFromCompressedFlags(Flags);
+
+	bWantsToDash = (Flags & FSavedMove_Character::FLAG_Custom_0) != 0;
+	bWantsToDashLeft = (Flags & FSavedMove_Character::FLAG_Custom_1) != 0;
+	bWantsToBounce = (Flags & FSavedMove_Character::FLAG_Custom_2) != 0;
+}
+
+FNetworkPredictionData_Client* UCombatMovementComponent::GetPredictionData_Client() const
+{
+	if (ClientPredictionData == nullptr)
+	{
+		UCombatMovementComponent* MutableThis = const_cast<UCombatMovementComponent*>(this);
+		MutableThis->ClientPredictionData = new FNetworkPredictionData_Client_Combat(*this);
+	}
+
+	return ClientPredictionData;
+}
+
+void UCombatMovementComponent::ClientHandleMoveResponse(const FCharacterMoveResponseDataContainer& MoveResponse)
+{
+	if (!MoveResponse.IsGoodMove())
+	{
+		++NumClientCorrections;
+	}
+
+	Super::ClientHandleMoveResponse(MoveResponse);
+}
+
+void UCombatMovementComponent::ResetNetworkStats()
+{
+	NumClientCorrections = 0;
+	NumDashStarts = 0;
+	NumBounceStarts = 0;
+}
+
+void UCombatMovementComponent::PhysCustom(float deltaTime, int32 Iterations)
+{
+	switch (static_cast<ECombatMovementMode>(CustomMovementMode))
+	{
+		case ECombatMovementMode::Dash:
+			PhysDash(deltaTime, Iterations);
+			break;
+
+		case ECombatMovementMode::Bounce:
+			PhysBounce(deltaTime, Iterations);
+			break;
+
+		default:
+			Super::PhysCustom(deltaTime, Iterations);
+			break;
+	}
+}
+
+void UCombatMovementComponent::OnMovementModeChanged(EMovementMode PreviousMovementMode, uint8 PreviousCustomMode)
+{
+	Super::OnMovementModeChanged(PreviousMovementMode, PreviousCustomMode);
+
+	if (PreviousMovementMode != MOVE_Custom)
+	{
+		return;
+	}
+
+	const ECombatMovementMode EndedMode = static_cast<ECombatMovementMode>(PreviousCustomMode);
+	if (EndedMode == ECombatMovementMode::None || IsInCombatMovementMode(EndedMode))
+	{
+		return;
+	}
+
+	OnCombatMovementModeEnded.Broadcast(EndedMode, !bCompletingCombatMovement);
+}
+
+// MODE ENTRY
+
+void UCombatMovementComponent::ApplyPendingDash()
+{
+	bWantsToDash = false;
+	++NumDashStarts;
+
+	// Direction comes from the move, not from whichever ability activation reached the server first
+	DashParams.DirectionSign = bWantsToDashLeft ? -1.0f : 1.0f;
+	DashElapsedTime = 0.0f;
+	bDashOnGround = IsMovingOnGround();
+
+	if (!bDashOnGround)
+	{
+		CurrentFloor.Clear();
+	}
+
+	// Re-entering from an active dash restarts the profile without reporting an end
+	if (IsInCombatMovementMode(ECombatMovementMode::Dash))
+	{
+		return;
+	}
+
+	SetMovementMode(MOVE_Custom, static_cast<uint8>(ECombatMovementMode::Dash));
+}
+
+void UCombatMovementComponent::ApplyPendingBounce()
+{
+	bWantsToBounce = false;
+	++NumBounceStarts;
+
+	// Launch is a function of the move's own starting velocity and the captured launch inputs when the ability supplies a resolver
+	Velocity = BounceLaunchResolver.IsBound() ? BounceLaunchResolver.Execute(Velocity, BounceParams) : BounceParams.LaunchVelocity;
+	BounceAirControlScale = IsMovingOnGround() ? 1.0f : BounceParams.AirControlMultiplier;
+	BounceElapsedTime = 0.0f;
+
+	// No modified-physics window - behave exactly like a launch
+	if (BounceParams.Duration <= 0.0f)
+	{
+		SetMovementMode(MOVE_Falling);
+		return;
+	}
+
+	SetMovementMode(MOVE_Custom, static_cast<uint8>(ECombatMovementMode::Bounce));
+}
+
+void UCombatMovementComponent::FinishCombatMovement(float RemainingTime, int32 Iterations)
+{
+	if (IsInCombatMovementMode(ECombatMovementMode::Dash))
+	{
+		Velocity.X *= DashParams.MomentumRetention;
+		Velocity.Y *= DashParams.MomentumRetention;
+	}
+
+	bCompletingCombatMovement = true;
+
+	FindFloor(UpdatedComponent->GetComponentLocation(), CurrentFloor, false);
+	if (CurrentFloor.IsWalkableFloor() && Velocity.Z <= 0.0f)
+	{
+		Velocity.Z = 0.0f;
+		SetMovementMode(MOVE_Walking);
+	}
+	else
+	{
+		SetMovementMode(MOVE_Falling);
+	}
+
+	bCompletingCombatMovement = false;
+
+	StartNewPhysics(RemainingTime, Iterations);
+}
+
+// DASH MODE
+
+FVector UCombatMovementComponent::GetDashRightVector() const
+{
+	// Camera boom follows the control rotation, so control yaw is the camera's horizontal frame.
+	// Control rotation is part of every saved move, which keeps server replay in agreement.
+	FRotator YawRotation = FRotator::ZeroRotator;
+	if (CharacterOwner && CharacterOwner->Controller)
+	{
+		YawRotation.Yaw = CharacterOwner->GetControlRotation().Yaw;
+	}
+	else if (UpdatedComponent)
+	{
+		YawRotation.Yaw = UpdatedComponent->GetComponentRotation().Yaw;
+	}
+
+	return FRotationMatrix(YawRotation).GetUnitAxis(EAxis::Y);
+}
+
+FVector UCombatMovementComponent::CalculateDashDirection() const
+{
+	return GetDashRightVector() * FMath::Sign(DashParams.DirectionSign);
+}
+
+FVector UCombatMovementComponent::CalculateDashVelocity(float InAlpha) const
+{
+	FVector DashVelocity = CalculateDashDirection() * DashParams.EvaluateSpeed(InAlpha);
+	DashVelocity.X *= DashParams.XAxisMultiplier;
+	DashVelocity.Y *= DashParams.YAxisMultiplier;
+	return DashVelocity * DashParams.VelocityMultiplier;
+}
+
+void UCombatMovementComponent::PhysDash(float deltaTime, int32 Iterations)
+{
+	COMBAT_SCOPE(PhysDash);
+
+	if (deltaTime < MIN_TICK_TIME)
+	{
+		return;
+	}
+
+	float RemainingTime = deltaTime;
+	while (RemainingTime >= MIN_TICK_TIME && Iterations < MaxSimulationIterations && CharacterOwner)
+	{
+		const float Alpha = DashElapsedTime / DashParams.Duration;
+		if (Alpha >= 1.0f)
+		{
+			FinishCombatMovement(RemainingTime, Iterations);
+			return;
+		}
+
+		Iterations++;
+		const float TimeTick = FMath::Min(GetSimulationTimeStep(RemainingTime, Iterations), DashParams.Duration - DashElapsedTime);
+		RemainingTime -= TimeTick;
+		DashElapsedTime += TimeTick;
+
+		// Horizontal velocity is fully owned by the dash profile, vertical follows floor or gravity
+		const float PreviousZ = Velocity.Z;
+		Velocity = CalculateDashVelocity(Alpha);
+		if (bDashOnGround)
+		{
+			Velocity.Z = 0.0f;
+		}
+		else if (DashParams.bIgnoreGravity)
+		{
+			Velocity.Z = PreviousZ;
+		}
+		else
+		{
+			Velocity.Z = NewFallVelocity(FVector(0.0f, 0.0f, PreviousZ), FVector(0.0f, 0.0f, GetGravityZ()), TimeTick).Z;
+		}
+
+		const FVector Delta = Velocity * TimeTick;
+		FHitResult Hit(1.0f);
+		SafeMoveUpdatedComponent(Delta, UpdatedComponent->GetComponentQuat(), true, Hit);
+
+		if (Hit.Time < 1.0f)
+		{
+			// Step-up handling mirrors PhysFlying so low obstacles don't stop a grounded dash
+			const FVector GravDir(0.0f, 0.0f, -1.0f);
+			const float UpDown = GravDir | Velocity.GetSafeNormal();
+			bool bSteppedUp = false;
+
+			if (bDashOnGround && FMath::Abs(Hit.ImpactNormal.Z) < 0.2f && UpDown < 0.5f && UpDown > -0.2f && CanStepUp(Hit))
+			{
+				bSteppedUp = StepUp(GravDir, Delta * (1.0f - Hit.Time), Hit);
+			}
+
+			if (!bSteppedUp)
+			{
+				HandleImpact(Hit, TimeTick, Delta);
+				SlideAlongSurface(Delta, 1.0f - Hit.Time, Hit.Normal, Hit, true);
+			}
+		}
+
+		// Floor tracking - walking off a ledge makes the dash airborne, touching down makes it grounded
+		if (Velocity.Z <= 0.0f)
+		{
+			const bool bWasOnGround = bDashOnGround;
+			FindFloor(UpdatedComponent->GetComponentLocation(), CurrentFloor, false);
+
+			const bool bFloorInReach = bWasOnGround || CurrentFloor.FloorDist <= MAX_FLOOR_DIST;
+			bDashOnGround = CurrentFloor.IsWalkableFloor() && bFloorInReach;
+
+			if (bDashOnGround)
+			{
+				AdjustFloorHeight();
+				Velocity.Z = 0.0f;
+
+				if (!bWasOnGround && CharacterOwner->ShouldNotifyLanded(CurrentFloor.HitResult))
+				{
+					CharacterOwner->Landed(CurrentFloor.HitResult);
+				}
+			}
+		}
+	}
+
+	// Feed the dash-bounce combo while the dash is still strong - one history tag per frame, bounce reads it back
+	if (VelocitySnapshotComponent && DashElapsedTime < DashParams.Duration * SNAPSHOT_MAX_ALPHA && Velocity.Size2D() > SNAPSHOT_MIN_SPEED)
+	{
+		VelocitySnapshotComponent->MarkHistorySource(EVelocitySource::Dash);
+	}
+}
+
+// BOUNCE MODE
+
+void UCombatMovementComponent::PhysBounce(float deltaTime, int32 Iterations)
+{
+	COMBAT_SCOPE(PhysBounce);
+
+	if (deltaTime < MIN_TICK_TIME)
+	{
+		return;
+	}
+
+	float RemainingTime = deltaTime;
+	while (RemainingTime >= MIN_TICK_TIME && Iterations < MaxSimulationIterations && CharacterOwner)
+	{
+		if (BounceElapsedTime >= BounceParams.Duration)
+		{
+			FinishCombatMovement(RemainingTime, Iterations);
+			return;
+		}
+
+		Iterations++;
+		const float TimeTick = FMath::Min(GetSimulationTimeStep(RemainingTime, Iterations), BounceParams.Duration - BounceElapsedTime);
+		RemainingTime -= TimeTick;
+		BounceElapsedTime += TimeTick;
+
+		// Falling integration with the bounce window's gravity scale and air control (see GetAirControl)
+		const FVector OldVelocity = Velocity;
+		const FVector FallAcceleration = GetFallingLateralAcceleration(TimeTick);
+		{
+			TGuardValue<FVector> RestoreAcceleration(Acceleration, FallAcceleration);
+			Velocity.Z = 0.0f;
+			CalcVelocity(TimeTick, FallingLateralFriction, false, GetMaxBrakingDeceleration());
+			Velocity.Z = OldVelocity.Z;
+		}
+
+		const FVector BounceGravity(0.0f, 0.0f, GetGravityZ() * BounceParams.GravityScale);
+		Velocity = NewFallVelocity(Velocity, BounceGravity, TimeTick);
+
+		const FVector Delta = 0.5f * (OldVelocity + Velocity) * TimeTick;
+		FHitResult Hit(1.0f);
+		SafeMoveUpdatedComponent(Delta, UpdatedComponent->GetComponentQuat(), true, Hit);
+
+		if (Hit.bBlockingHit)
+		{
+			if (IsValidLandingSpot(UpdatedComponent->GetComponentLocation(), Hit))
+			{
+				// Hand off to falling so ProcessLanded runs the standard landing path and Landed notifies
+				RemainingTime += TimeTick * (1.0f - Hit.Time);
+				bCompletingCombatMovement = true;
+				SetMovementMode(MOVE_Falling);
+				bCompletingCombatMovement = false;
+				ProcessLanded(Hit, RemainingTime, Iterations);
+				return;
+			}
+
+			HandleImpact(Hit, TimeTick, Delta);
+			SlideAlongSurface(Delta, 1.0f - Hit.Time, Hit.Normal, Hit, true);
+		}
+	}
+}
+
+// NETWORK PREDICTION - Saved moves
+
+void FSavedMove_Combat::Clear()
+{
+	Super::Clear();
+
+	bSavedWantsToDash = false;
+	bSavedDashLeft = false;
+	bSavedWantsToBounce = false;
+	bSavedDashOnGround = false;
+	SavedDashElapsedTime = 0.0f;
+	SavedBounceElapsedTime = 0.0f;
+	SavedBounceParams = FCombatBounceParams();
+}
+
+uint8 FSavedMove_Combat::GetCompressedFlags() const
+{
+	uint8 Result = Super::GetCompressedFlags();
+
+	if (bSavedWantsToDash)
+	{
+		Result |= FLAG_Custom_0;
+	}
+
+	if (bSavedDashLeft)
+	{
+		Result |= FLAG_Custom_1;
+	}
+
+	if (bSavedWantsToBounce)
+	{
+		Result |= FLAG_Custom_2;
+	}
+
+	return Result;
+}
+
+bool FSavedMove_Combat::CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const
+{
+	const FSavedMove_Combat* NewCombatMove = static_cast<const FSavedMove_Combat*>(NewMove.Get());
+
+	// A start event must stay on its own move so the server starts the mode on the same frame
+	if (bSavedWantsToDash || bSavedWantsToBounce ||
+		NewCombatMove->bSavedWantsToDash || NewCombatMove->bSavedWantsToBounce)
+	{
+		return false;
+	}
+
+	return Super::CanCombineWith(NewMove, InCharacter, MaxDelta);
+}
+
+void FSavedMove_Combat::SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel, FNetworkPredictionData_Client_Character& ClientData)
+{
+	Super::SetMoveFor(C, InDeltaTime, NewAccel, ClientData);
+
+	if (const UCombatMovementComponent* CombatMovement = Cast<UCombatMovementComponent>(C->GetCharacterMovement()))
+	{
+		bSavedWantsToDash = CombatMovement->bWantsToDash;
+		bSavedDashLeft = CombatMovement->bWantsToDashLeft;
+		bSavedWantsToBounce = CombatMovement->bWantsToBounce;
+		bSavedDashOnGround = CombatMovement->bDashOnGround;
+		SavedDashElapsedTime = CombatMovement->DashElapsedTime;
+		SavedBounceElapsedTime = CombatMovement->BounceElapsedTime;
+		SavedBounceParams = CombatMovement->BounceParams;
+	}
+}
+
+void FSavedMove_Combat::PrepMoveFor(ACharacter* C)
+{
+	Super::PrepMoveFor(C);
+
+	if (UCombatMovementComponent* CombatMovement = Cast<UCombatMovementComponent>(C->GetCharacterMovement()))
+	{
+		CombatMovement->bWantsToDash = bSavedWantsToDash;
+		CombatMovement->bWantsToDashLeft = bSavedDashLeft;
+		CombatMovement->bWantsToBounce = bSavedWantsToBounce;
+		CombatMovement->bDashOnGround = bSavedDashOnGround;
+		CombatMovement->DashElapsedTime = SavedDashElapsedTime;
+		CombatMovement->BounceElapsedTime = SavedBounceElapsedTime;
+		CombatMovement->BounceParams = SavedBounceParams;
+	}
+}
+
+FNetworkPredictionData_Client_Combat::FNetworkPredictionData_Client_Combat(const UCharacterMovementComponent& ClientMovement)
+	: Super(ClientMovement)
+{
+}
+
+FSavedMovePtr FNetworkPredictionData_Client_Combat::AllocateNewMove()
+{
+	return FSavedMovePtr(new FSavedMove_Combat());
+}
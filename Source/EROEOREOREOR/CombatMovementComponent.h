@@ -0,0 +1,290 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameplayTagContainer.h"
+#include "VelocitySnapshotComponent.h"
+#include "CombatMovementComponent.generated.h"
+
+class UCurveFloat;
+
+/**
+ * Custom movement sub-modes used with MOVE_Custom
+ * Values are stored in CustomMovementMode and replicated with the movement mode
+ */
+UENUM(BlueprintType)
+enum class ECombatMovementMode : uint8
+{
+	None	UMETA(DisplayName = "None"),
+	Dash	UMETA(DisplayName = "Dash"),
+	Bounce	UMETA(DisplayName = "Bounce")
+};
+
+/**
+ * Dash parameters handed from UGameplayAbility_Dash to the movement component
+ * Evaluated once per movement substep inside PhysCustom
+ */
+USTRUCT(BlueprintType)
+struct FCombatDashParams
+{
+	GENERATED_BODY()
+
+	// +1 dashes toward camera right, -1 toward camera left
+	UPROPERTY(BlueprintReadWrite, Category = "Dash")
+	float DirectionSign = 1.0f;
+
+	UPROPERTY(BlueprintReadWrite, Category = "Dash")
+	float Speed = 1875.0f;
+
+	UPROPERTY(BlueprintReadWrite, Category = "Dash")
+	float Duration = 0.8f;
+
+	UPROPERTY(BlueprintReadWrite, Category = "Dash")
+	float XAxisMultiplier = 1.0f;
+
+	UPROPERTY(BlueprintReadWrite, Category = "Dash")
+	float YAxisMultiplier = 1.0f;
+
+	UPROPERTY(BlueprintReadWrite, Category = "Dash")
+	float VelocityMultiplier = 1.0f;
+
+	// Horizontal velocity kept when the dash runs to completion
+	UPROPERTY(BlueprintReadWrite, Category = "Dash")
+	float MomentumRetention = 0.3f;
+
+	UPROPERTY(BlueprintReadWrite, Category = "Dash")
+	bool bIgnoreGravity = false;
+
+	// Optional speed curve over normalized dash time - quadratic ease-out when unset
+	UPROPERTY(BlueprintReadWrite, Category = "Dash")
+	TObjectPtr<UCurveFloat> SpeedCurve = nullptr;
+
+	// Speed at normalized dash time, before axis and velocity multipliers
+	float EvaluateSpeed(float InAlpha) const;
+};
+
+/**
+ * Bounce parameters handed from UGameplayAbility_Bounce to the movement component
+ * The launch velocity is applied at the start of the next movement update
+ */
+USTRUCT(BlueprintType)
+struct FCombatBounceParams
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadWrite, Category = "Bounce")
+	FVector LaunchVelocity = FVector::ZeroVector;
+
+	// Length of the modified-physics window. 0 = plain launch into MOVE_Falling
+	UPROPERTY(BlueprintReadWrite, Category = "Bounce")
+	float Duration = 0.2f;
+
+	UPROPERTY(BlueprintReadWrite, Category = "Bounce")
+	float GravityScale = 1.0f;
+
+	// Applied only when the bounce starts airborne - decided inside the move so replay agrees
+	UPROPERTY(BlueprintReadWrite, Category = "Bounce")
+	float AirControlMultiplier = 1.0f;
+
+	// Launch inputs captured at activation - the resolver reads these, never the live attribute or snapshot,
+	// so a move replayed after a correction launches exactly as it did when first simulated
+	UPROPERTY(BlueprintReadWrite, Category = "Bounce")
+	int32 AirBounceCount = 0;
+
+	UPROPERTY(BlueprintReadWrite, Category = "Bounce")
+	bool bHasMomentum = false;
+
+	UPROPERTY(BlueprintReadWrite, Category = "Bounce")
+	FVelocitySnapshot Momentum;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnCombatMovementModeEnded, ECombatMovementMode, EndedMode, bool, bWasInterrupted);
+
+// Recomputes the bounce launch from the velocity at the start of the move that carries the bounce flag
+// and the launch inputs captured in the params
+DECLARE_DELEGATE_RetVal_TwoParams(FVector, FResolveBounceLaunchVelocity, const FVector& /*CurrentVelocity*/, const FCombatBounceParams& /*Params*/);
+
+/**
+ * Saved move carrying the Dash/Bounce start events as compressed flags
+ * FLAG_Custom_0 = dash start, FLAG_Custom_1 = dash left, FLAG_Custom_2 = bounce start
+ */
+class FSavedMove_Combat : public FSavedMove_Character
+{
+public:
+	typedef FSavedMove_Character Super;
+
+	virtual void Clear() override;
+	virtual uint8 GetCompressedFlags() const override;
+	virtual bool CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const override;
+	virtual void SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel, FNetworkPredictionData_Client_Character& ClientData) override;
+	virtual void PrepMoveFor(ACharacter* C) override;
+
+	// Start events
+	uint8 bSavedWantsToDash : 1;
+	uint8 bSavedDashLeft : 1;
+	uint8 bSavedWantsToBounce : 1;
+
+	// Mode progress at the start of the move - restored on replay after a correction
+	uint8 bSavedDashOnGround : 1;
+	float SavedDashElapsedTime = 0.0f;
+	float SavedBounceElapsedTime = 0.0f;
+
+	// Pending or active bounce, launch inputs included - a later activation must not change how this move replays
+	FCombatBounceParams SavedBounceParams;
+};
+
+class FNetworkPredictionData_Client_Combat : public FNetworkPredictionData_Client_Character
+{
+public:
+	typedef FNetworkPredictionData_Client_Character Super;
+
+	FNetworkPredictionData_Client_Combat(const UCharacterMovementComponent& ClientMovement);
+
+	virtual FSavedMovePtr AllocateNewMove() override;
+};
+
+/**
+ * Character movement with Dash and Bounce implemented as custom movement modes
+ * Velocity is evaluated once per movement substep inside PhysCustom, so there is no
+ * timer running outside the movement tick and no ordering hazard against CharacterMovement
+ *
+ * NETWORK PREDICTION: start events travel in the saved move's compressed flags. The server
+ * enters the mode when it replays the flagged move, never from the ability RPC, so client
+ * prediction and server simulation start on the same move with the same inputs.
+ * The parameters - and ability side effects such as the air bounce count - still come from the
+ * ability RPC, so a flagged move that arrives first waits for it and starts on a later move.
+ * Bounce launch inputs are captured into the params at activation and saved with every move,
+ * so a client replaying after a correction resolves the launch from what the move first saw.
+ */
+UCLASS()
+class EROEOREOREOR_API UCombatMovementComponent : public UCharacterMovementComponent
+{
+	GENERATED_BODY()
+
+public:
+	// Queue a dash - the mode is entered at the start of the next movement update.
+	// On a server simulating a remote client this only stores parameters; the client's move flag starts it.
+	void StartDash(const FCombatDashParams& InParams);
+
+	// Queue a bounce - replaces any active dash or bounce mode
+	void StartBounce(const FCombatBounceParams& InParams);
+
+	// Bound by the bounce ability so the launch is evaluated inside the move on both client and server
+	FResolveBounceLaunchVelocity BounceLaunchResolver;
+
+	// Leave the current combat mode without momentum retention
+	void StopCombatMovement();
+
+	UFUNCTION(BlueprintPure, Category = "Combat Movement")
+	bool IsInCombatMovementMode(ECombatMovementMode InMode) const;
+
+	UFUNCTION(BlueprintPure, Category = "Combat Movement")
+	float GetDashProgress() const;
+
+	UFUNCTION(BlueprintPure, Category = "Combat Movement")
+	FVector GetDashDirection() const;
+
+	UFUNCTION(BlueprintPure, Category = "Combat Movement")
+	float GetDashSpeed() const;
+
+	// Camera-right basis a dash started now would use - shared with trajectory prediction
+	FVector GetDashRightVector() const;
+
+	// Fired when Dash or Bounce mode is left, either naturally or by another mode change
+	UPROPERTY(BlueprintAssignable, Category = "Combat Movement")
+	FOnCombatMovementModeEnded OnCombatMovementModeEnded;
+
+	// NETWORK DIAGNOSTICS - read by the EROEOREOREOR.Combat.Net.Corrections automation test
+	void ResetNetworkStats();
+	int32 GetNumClientCorrections() const { return NumClientCorrections; }
+	int32 GetNumDashStarts() const { return NumDashStarts; }
+	int32 GetNumBounceStarts() const { return NumBounceStarts; }
+
+	// UCharacterMovementComponent interface
+	// Grounded dashes report as on-ground, bounces and airborne dashes as falling,
+	// so ability validation and engine slide/jump logic see the same states as before
+	virtual bool IsMovingOnGround() const override;
+	virtual bool IsFalling() const override;
+	virtual float GetMaxSpeed() const override;
+	virtual bool DoJump(bool bReplayingMoves, float DeltaTime) override;
+	virtual FVector GetAirControl(float DeltaTime, float TickAirControl, const FVector& FallAcceleration) override;
+	virtual FNetworkPredictionData_Client* GetPredictionData_Client() const override;
+	virtual void ClientHandleMoveResponse(const FCharacterMoveResponseDataContainer& MoveResponse) override;
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void UpdateCharacterStateBeforeMovement(float DeltaSeconds) override;
+	virtual void UpdateFromCompressedFlags(uint8 Flags) override;
+	virtual void PhysCustom(float deltaTime, int32 Iterations) override;
+	virtual void OnMovementModeChanged(EMovementMode PreviousMovementMode, uint8 PreviousCustomMode) override;
+
+private:
+	friend class FSavedMove_Combat;
+
+	// True on a server whose character is driven by a remote autonomous proxy
+	bool ShouldWaitForClientMove() const;
+
+	// Server pairing of a client's flagged start move with the ability RPC that delivers its parameters.
+	// Either side may arrive first; an unpaired side expires after START_PAIRING_SECONDS.
+	struct FServerStartPairing
+	{
+		double ParamsTime = -1.0;
+		double MoveTime = -1.0;
+		bool bMoveDashLeft = false;
+	};
+
+	// Holds a flagged start until its parameters have arrived and releases a held one when they do.
+	// Returns true when bInOutWantsToStart should start the mode in this move.
+	bool PairServerStart(bool& bInOutWantsToStart, FServerStartPairing& Pairing);
+
+	void PhysDash(float deltaTime, int32 Iterations);
+	void PhysBounce(float deltaTime, int32 Iterations);
+
+	// Apply queued starts inside the movement update
+	void ApplyPendingDash();
+	void ApplyPendingBounce();
+
+	// Natural end of a combat mode - picks walking or falling and continues simulating
+	void FinishCombatMovement(float RemainingTime, int32 Iterations);
+
+	FVector CalculateDashDirection() const;
+	FVector CalculateDashVelocity(float InAlpha) const;
+
+	// Active parameters
+	UPROPERTY(Transient)
+	FCombatDashParams DashParams;
+
+	UPROPERTY(Transient)
+	FCombatBounceParams BounceParams;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UVelocitySnapshotComponent> VelocitySnapshotComponent;
+
+	// Move inputs - mirrored by FSavedMove_Combat and the compressed flags
+	bool bWantsToDash = false;
+	bool bWantsToDashLeft = false;
+	bool bWantsToBounce = false;
+
+	// Server only - see PairServerStart
+	FServerStartPairing DashPairing;
+	FServerStartPairing BouncePairing;
+
+	// Runtime state
+	float DashElapsedTime = 0.0f;
+	float BounceElapsedTime = 0.0f;
+	float BounceAirControlScale = 1.0f;
+	bool bDashOnGround = false;
+	bool bCompletingCombatMovement = false;
+
+	// Diagnostics
+	int32 NumClientCorrections = 0;
+	int32 NumDashStarts = 0;
+	int32 NumBounceStarts = 0;
+
+	// Constants - Epic Games style
+	static constexpr float SNAPSHOT_MAX_ALPHA = 0.8f;
+	static constexpr float SNAPSHOT_MIN_SPEED = 500.0f;
+	static constexpr double START_PAIRING_SECONDS = 0.5;
+};
@@ -0,0 +1,215 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CombatMovementComponent.h"
+#include "CombatLog.h"
+#include "MyCharacter.h"
+#include "AbilitySystemComponent.h"
+#include "InputActionValue.h"
+#include "Engine/Engine.h"
+#include "Engine/NetDriver.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_EDITOR
+#include "Editor.h"
+#include "Settings/LevelEditorPlaySettings.h"
+#include "Tests/AutomationEditorCommon.h"
+#endif
+
+// NETWORK PREDICTION TEST - Dash/Bounce server corrections under injected latency
+// Automation test EROEOREOREOR.Combat.Net.Corrections (editor, -nullrhi is fine):
+//   UnrealEditor-Cmd <Project>.uproject -nullrhi -unattended -ExecCmds="Automation RunTests EROEOREOREOR.Combat.Net; Quit"
+//
+// Starts PIE as a dedicated server plus one client in one process, delays the client's outgoing packets by
+// ROUND_TRIP_MS, drives dash left / bounce / dash right / bounce on the client's character every ACTION_INTERVAL
+// seconds and fails when the client takes more than MAX_CORRECTIONS_PER_MINUTE movement corrections.
+
+#if WITH_EDITOR && WITH_DEV_AUTOMATION_TESTS
+namespace CombatNetCorrectionTest
+{
+	static const TCHAR* const TEST_MAP = TEXT("/Game/ThirdPerson/Lvl_ThirdPerson");
+
+	// Constants - Epic Games style
+	static constexpr int32 ROUND_TRIP_MS = 100;
+	static constexpr double MEASURE_SECONDS = 30.0;
+	static constexpr double ACTION_INTERVAL = 0.5;
+	static constexpr double CLIENT_TIMEOUT_SECONDS = 30.0;
+	static constexpr float MAX_CORRECTIONS_PER_MINUTE = 2.0f;
+
+	// Client-side character of the PIE session - the remote autonomous proxy the server corrects
+	static AMyCharacter* FindClientCharacter()
+	{
+		for (const FWorldContext& Context : GEngine->GetWorldContexts())
+		{
+			UWorld* World = Context.World();
+			if (Context.WorldType != EWorldType::PIE || !World || World->GetNetMode() != NM_Client)
+			{
+				continue;
+			}
+
+			const APlayerController* PlayerController = World->GetFirstPlayerController();
+			AMyCharacter* Character = PlayerController ? Cast<AMyCharacter>(PlayerController->GetPawn()) : nullptr;
+			const UAbilitySystemComponent* ASC = Character ? Character->GetAbilitySystemComponent() : nullptr;
+
+			// Abilities replicate after possession - presses before that would all be rejected
+			if (ASC && ASC->GetActivatableAbilities().Num() > 0 && Character->GetCombatMovementComponent())
+			{
+				return Character;
+			}
+		}
+		return nullptr;
+	}
+
+	static bool SetClientPacketLag(const AMyCharacter* Character, int32 LagMs)
+	{
+#if DO_ENABLE_NET_TEST
+		UNetDriver* NetDriver = Character ? Character->GetWorld()->GetNetDriver() : nullptr;
+		if (!NetDriver)
+		{
+			return false;
+		}
+
+		// Outgoing lag on the client only - the full round trip shows up as client->server delay
+		FPacketSimulationSettings Settings = NetDriver->PacketSimulationSettings;
+		Settings.PktLag = LagMs;
+		NetDriver->SetPacketSimulationSettings(Settings);
+		return true;
+#else
+		return false;
+#endif
+	}
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND(FCombatStartNetworkedPIE);
+bool FCombatStartNetworkedPIE::Update()
+{
+	ULevelEditorPlaySettings* PlaySettings = NewObject<ULevelEditorPlaySettings>();
+	PlaySettings->SetPlayNetMode(EPlayNetMode::PIE_Client);
+	PlaySettings->SetPlayNumberOfClients(1);
+	PlaySettings->SetRunUnderOneProcess(true);
+
+	FRequestPlaySessionParams Params;
+	Params.WorldType = EPlaySessionWorldType::PlayInEditor;
+	Params.EditorPlaySettings = PlaySettings;
+	GEditor->RequestPlaySession(Params);
+	return true;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND_ONE_PARAMETER(FCombatWaitForClientCharacter, FAutomationTestBase*, Test);
+bool FCombatWaitForClientCharacter::Update()
+{
+	using namespace CombatNetCorrectionTest;
+
+	if (FindClientCharacter())
+	{
+		return true;
+	}
+
+	if (GetCurrentRunTime() > CLIENT_TIMEOUT_SECONDS)
+	{
+		Test->AddError(TEXT("No client AMyCharacter with granted abilities - is the PIE pawn an AMyCharacter?"));
+		return true;
+	}
+	return false;
+}
+
+class FCombatMeasureCorrections : public IAutomationLatentCommand
+{
+public:
+	explicit FCombatMeasureCorrections(FAutomationTestBase* InTest)
+		: Test(InTest)
+	{
+	}
+
+	virtual bool Update() override;
+
+private:
+	FAutomationTestBase* Test;
+
+	// Next scripted press - INDEX_NONE until lag is injected and the stats are reset
+	int32 ActionIndex = INDEX_NONE;
+};
+
+bool FCombatMeasureCorrections::Update()
+{
+	using namespace CombatNetCorrectionTest;
+
+	// Nothing to measure when the previous command timed out
+	AMyCharacter* Character = FindClientCharacter();
+	UCombatMovementComponent* CombatMovement = Character ? Character->GetCombatMovementComponent() : nullptr;
+	if (!CombatMovement)
+	{
+		Test->AddError(TEXT("Client character lost during the correction measurement"));
+		return true;
+	}
+
+	// First update - GetCurrentRunTime starts counting here
+	if (ActionIndex == INDEX_NONE)
+	{
+		if (!SetClientPacketLag(Character, ROUND_TRIP_MS))
+		{
+			Test->AddError(TEXT("Packet simulation unavailable on the client net driver"));
+			return true;
+		}
+
+		CombatMovement->ResetNetworkStats();
+		ActionIndex = 0;
+	}
+
+	const double Elapsed = GetCurrentRunTime();
+	if (Elapsed < MEASURE_SECONDS)
+	{
+		// Dash left, bounce, dash right, bounce - covers dash, bounce and dash->bounce combos
+		if (Elapsed >= ActionIndex * ACTION_INTERVAL)
+		{
+			const FInputActionValue PressedValue(true);
+			switch (ActionIndex++ % 4)
+			{
+				case 0:		Character->DashLeft(PressedValue);	break;
+				case 2:		Character->DashRight(PressedValue);	break;
+				default:	Character->Bounce(PressedValue);	break;
+			}
+		}
+		return false;
+	}
+
+	SetClientPacketLag(Character, 0);
+
+	const int32 Corrections = CombatMovement->GetNumClientCorrections();
+	const float CorrectionsPerMinute = Corrections * static_cast<float>(60.0 / Elapsed);
+	UE_LOG(LogCombat, Display, TEXT("Combat.Net.Corrections: %d corrections in %.0fs at %dms RTT = %.2f/min (dash starts %d, bounce starts %d)"),
+		Corrections, Elapsed, ROUND_TRIP_MS, CorrectionsPerMinute, CombatMovement->GetNumDashStarts(), CombatMovement->GetNumBounceStarts());
+
+	Test->TestTrue(TEXT("Client started dashes and bounces"), CombatMovement->GetNumDashStarts() > 0 && CombatMovement->GetNumBounceStarts() > 0);
+	Test->TestTrue(FString::Printf(TEXT("Corrections per minute %.2f <= %.2f"), CorrectionsPerMinute, MAX_CORRECTIONS_PER_MINUTE),
+		CorrectionsPerMinute <= MAX_CORRECTIONS_PER_MINUTE);
+	return true;
+}
+
+DEFINE_LATENT_AUTOMATION_COMMAND(FCombatEndNetworkedPIE);
+bool FCombatEndNetworkedPIE::Update()
+{
+	GEditor->RequestEndPlayMap();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCombatNetCorrectionTest, "EROEOREOREOR.Combat.Net.Corrections",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FCombatNetCorrectionTest::RunTest(const FString& Parameters)
+{
+	if (!FAutomationEditorCommonUtils::LoadMap(CombatNetCorrectionTest::TEST_MAP))
+	{
+		AddError(FString::Printf(TEXT("Could not load %s"), CombatNetCorrectionTest::TEST_MAP));
+		return false;
+	}
+
+	ADD_LATENT_AUTOMATION_COMMAND(FCombatStartNetworkedPIE());
+	ADD_LATENT_AUTOMATION_COMMAND(FCombatWaitForClientCharacter(this));
+	ADD_LATENT_AUTOMATION_COMMAND(FCombatMeasureCorrections(this));
+	ADD_LATENT_AUTOMATION_COMMAND(FCombatEndNetworkedPIE());
+	return true;
+}
+#endif
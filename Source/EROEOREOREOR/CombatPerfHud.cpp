@@ -0,0 +1,250 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CombatPerfHud.h"
+
+#if !UE_BUILD_SHIPPING
+#include "CombatMemory.h"
+#include "CanvasItem.h"
+#include "Debug/DebugDrawService.h"
+#include "Engine/Canvas.h"
+#include "Engine/Engine.h"
+#include "Engine/Font.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+
+static TAutoConsoleVariable<int32> CVarCombatHudShow(
+	TEXT("Combat.Hud.Show"),
+	0,
+	TEXT("Draw the combat perf HUD: per-scope time, queries/specs/allocations per frame, live attacks and AoEs"),
+	ECVF_Default);
+
+float FCombatPerfHud::FrameMs[WINDOW_FRAMES] = {};
+float FCombatPerfHud::CombatMs[WINDOW_FRAMES] = {};
+float FCombatPerfHud::ScopeMs[WINDOW_FRAMES][NUM_SCOPES] = {};
+uint32 FCombatPerfHud::ScopeCalls[WINDOW_FRAMES][NUM_SCOPES] = {};
+uint32 FCombatPerfHud::Counters[WINDOW_FRAMES][NUM_COUNTERS] = {};
+uint32 FCombatPerfHud::Gauges[NUM_GAUGES] = {};
+double FCombatPerfHud::PreviousScopeMs[NUM_SCOPES] = {};
+uint32 FCombatPerfHud::PreviousScopeCalls[NUM_SCOPES] = {};
+int32 FCombatPerfHud::NextSample = 0;
+int32 FCombatPerfHud::NumSamples = 0;
+FDelegateHandle FCombatPerfHud::DrawHandle;
+
+namespace CombatPerfHud
+{
+	static constexpr float PANEL_X = 40.0f;
+	static constexpr float PANEL_Y = 120.0f;
+	static constexpr float PANEL_WIDTH = 430.0f;
+	static constexpr float COLUMN_X[] = { 0.0f, 190.0f, 270.0f, 350.0f };
+
+	static const FColor HeaderColor(120, 200, 255);
+	static const FColor ValueColor = FColor::White;
+	static const FColor IdleColor(110, 110, 110);
+
+	// Reused for every line - Reset keeps the allocation, so drawing does not touch the heap once warmed up
+	static FString Line;
+
+	struct FPanel
+	{
+		UCanvas* Canvas;
+		const UFont* Font;
+		float Y;
+		float LineHeight;
+
+		void Text(float Column, const FColor& Color, const TCHAR* Format, ...)
+		{
+			TCHAR Buffer[128];
+			va_list Args;
+			va_start(Args, Format);
+			FCString::GetVarArgs(Buffer, UE_ARRAY_COUNT(Buffer), Format, Args);
+			va_end(Args);
+
+			Line.Reset();
+			Line += Buffer;
+			Canvas->SetDrawColor(Color);
+			Canvas->DrawText(Font, Line, PANEL_X + Column, Y);
+		}
+
+		void NextLine(float Extra = 0.0f)
+		{
+			Y += LineHeight + Extra;
+		}
+	};
+}
+
+void FCombatPerfHud::Show()
+{
+	LLM_SCOPE_BYTAG(Combat_Debug);
+
+	for (int32 Scope = 0; Scope < NUM_SCOPES; ++Scope)
+	{
+		PreviousScopeMs[Scope] = FCombatScopeTimings::GetTotalMilliseconds(static_cast<ECombatScope>(Scope));
+		PreviousScopeCalls[Scope] = FCombatScopeTimings::GetTotalCalls(static_cast<ECombatScope>(Scope));
+	}
+	NextSample = 0;
+	NumSamples = 0;
+
+	FCombatScopeTimings::SetCapture(ECombatScopeCaptureClient::PerfHud, true);
+	DrawHandle = UDebugDrawService::Register(TEXT("Game"), FDebugDrawDelegate::CreateStatic(&FCombatPerfHud::Draw));
+}
+
+void FCombatPerfHud::Hide()
+{
+	UDebugDrawService::Unregister(DrawHandle);
+	DrawHandle.Reset();
+	FCombatScopeTimings::SetCapture(ECombatScopeCaptureClient::PerfHud, false);
+}
+
+void FCombatPerfHud::EndFrame()
+{
+	if (!CVarCombatHudShow.GetValueOnGameThread())
+	{
+		if (DrawHandle.IsValid())
+		{
+			Hide();
+		}
+		return;
+	}
+
+	if (!DrawHandle.IsValid())
+	{
+		// The first frame only sets the baseline - scope totals before it are not this frame's
+		Show();
+		return;
+	}
+
+	const int32 Sample = NextSample;
+	NextSample = (NextSample + 1) % WINDOW_FRAMES;
+	NumSamples = FMath::Min(NumSamples + 1, WINDOW_FRAMES);
+
+	FrameMs[Sample] = static_cast<float>(FApp::GetDeltaTime() * 1000.0);
+	CombatMs[Sample] = 0.0f;
+	for (int32 Scope = 0; Scope < NUM_SCOPES; ++Scope)
+	{
+		const double TotalMs = FCombatScopeTimings::GetTotalMilliseconds(static_cast<ECombatScope>(Scope));
+		const uint32 TotalCalls = FCombatScopeTimings::GetTotalCalls(static_cast<ECombatScope>(Scope));
+
+		// A total below the previous one was reset by a benchmark - the whole total is this frame's
+		ScopeMs[Sample][Scope] = static_cast<float>(TotalMs >= PreviousScopeMs[Scope] ? TotalMs - PreviousScopeMs[Scope] : TotalMs);
+		ScopeCalls[Sample][Scope] = TotalCalls >= PreviousScopeCalls[Scope] ? TotalCalls - PreviousScopeCalls[Scope] : TotalCalls;
+		PreviousScopeMs[Scope] = TotalMs;
+		PreviousScopeCalls[Scope] = TotalCalls;
+
+		if (FCombatScopeTimings::IsRoot(static_cast<ECombatScope>(Scope)))
+		{
+			CombatMs[Sample] += ScopeMs[Sample][Scope];
+		}
+	}
+
+	for (int32 Counter = 0; Counter < NUM_COUNTERS; ++Counter)
+	{
+		Counters[Sample][Counter] = FCombatFrameCounters::GetLastFrame(static_cast<ECombatCounter>(Counter));
+	}
+
+	for (int32 Gauge = 0; Gauge < NUM_GAUGES; ++Gauge)
+	{
+		Gauges[Gauge] = FCombatFrameGauges::GetLastFrame(static_cast<ECombatGauge>(Gauge));
+	}
+}
+
+void FCombatPerfHud::Draw(UCanvas* Canvas, APlayerController* PlayerController)
+{
+	using namespace CombatPerfHud;
+
+	if (!Canvas || !GEngine || NumSamples == 0)
+	{
+		return;
+	}
+
+	const UFont* Font = GEngine->GetSmallFont();
+	const float LineHeight = Font->GetMaxCharHeight() + 2.0f;
+	const float PanelHeight = LineHeight * (NUM_SCOPES + NUM_COUNTERS + NUM_GAUGES + 8);
+
+	FCanvasTileItem Background(FVector2D(PANEL_X - 8.0f, PANEL_Y - 6.0f), FVector2D(PANEL_WIDTH, PanelHeight), FLinearColor(0.0f, 0.0f, 0.0f, 0.6f));
+	Background.BlendMode = SE_BLEND_Translucent;
+	Canvas->DrawItem(Background);
+
+	FPanel Panel{ Canvas, Font, PANEL_Y, LineHeight };
+	const float InvSamples = 1.0f / NumSamples;
+
+	// Frame summary
+	float FrameAvg = 0.0f;
+	float CombatAvg = 0.0f;
+	float CombatPeak = 0.0f;
+	for (int32 Sample = 0; Sample < NumSamples; ++Sample)
+	{
+		FrameAvg += FrameMs[Sample] * InvSamples;
+		CombatAvg += CombatMs[Sample] * InvSamples;
+		CombatPeak = FMath::Max(CombatPeak, CombatMs[Sample]);
+	}
+	Panel.Text(COLUMN_X[0], HeaderColor, TEXT("Frame %.2f ms - combat"), FrameAvg);
+	Panel.Text(COLUMN_X[2], HeaderColor, TEXT("%.3f"), CombatAvg);
+	Panel.Text(COLUMN_X[3], HeaderColor, TEXT("%.3f"), CombatPeak);
+	Panel.NextLine(4.0f);
+
+	// Scopes
+	Panel.Text(COLUMN_X[0], HeaderColor, TEXT("Scope"));
+	Panel.Text(COLUMN_X[1], HeaderColor, TEXT("calls/f"));
+	Panel.Text(COLUMN_X[2], HeaderColor, TEXT("avg ms"));
+	Panel.Text(COLUMN_X[3], HeaderColor, TEXT("max ms"));
+	Panel.NextLine();
+	for (int32 Scope = 0; Scope < NUM_SCOPES; ++Scope)
+	{
+		float Avg = 0.0f;
+		float Peak = 0.0f;
+		uint32 Calls = 0;
+		for (int32 Sample = 0; Sample < NumSamples; ++Sample)
+		{
+			Avg += ScopeMs[Sample][Scope] * InvSamples;
+			Peak = FMath::Max(Peak, ScopeMs[Sample][Scope]);
+			Calls += ScopeCalls[Sample][Scope];
+		}
+
+		const FColor& Color = Calls > 0 ? ValueColor : IdleColor;
+		const bool bRoot = FCombatScopeTimings::IsRoot(static_cast<ECombatScope>(Scope));
+		Panel.Text(COLUMN_X[0], Color, bRoot ? TEXT("%s") : TEXT("  %s"), FCombatScopeTimings::GetName(static_cast<ECombatScope>(Scope)));
+		Panel.Text(COLUMN_X[1], Color, TEXT("%.1f"), Calls * InvSamples);
+		Panel.Text(COLUMN_X[2], Color, TEXT("%.3f"), Avg);
+		Panel.Text(COLUMN_X[3], Color, TEXT("%.3f"), Peak);
+		Panel.NextLine();
+	}
+	Panel.NextLine(4.0f);
+
+	// Work counters
+	Panel.Text(COLUMN_X[0], HeaderColor, TEXT("Work per frame"));
+	Panel.Text(COLUMN_X[1], HeaderColor, TEXT("last"));
+	Panel.Text(COLUMN_X[2], HeaderColor, TEXT("avg"));
+	Panel.Text(COLUMN_X[3], HeaderColor, TEXT("max"));
+	Panel.NextLine();
+	const int32 LastSample = (NextSample + WINDOW_FRAMES - 1) % WINDOW_FRAMES;
+	for (int32 Counter = 0; Counter < NUM_COUNTERS; ++Counter)
+	{
+		float Avg = 0.0f;
+		uint32 Peak = 0;
+		for (int32 Sample = 0; Sample < NumSamples; ++Sample)
+		{
+			Avg += Counters[Sample][Counter] * InvSamples;
+			Peak = FMath::Max(Peak, Counters[Sample][Counter]);
+		}
+
+		const FColor& Color = Peak > 0 ? ValueColor : IdleColor;
+		Panel.Text(COLUMN_X[0], Color, TEXT("%s"), FCombatFrameCounters::GetName(static_cast<ECombatCounter>(Counter)));
+		Panel.Text(COLUMN_X[1], Color, TEXT("%u"), Counters[LastSample][Counter]);
+		Panel.Text(COLUMN_X[2], Color, TEXT("%.1f"), Avg);
+		Panel.Text(COLUMN_X[3], Color, TEXT("%u"), Peak);
+		Panel.NextLine();
+	}
+	Panel.NextLine(4.0f);
+
+	// Gauges
+	Panel.Text(COLUMN_X[0], HeaderColor, TEXT("Live"));
+	Panel.NextLine();
+	for (int32 Gauge = 0; Gauge < NUM_GAUGES; ++Gauge)
+	{
+		const FColor& Color = Gauges[Gauge] > 0 ? ValueColor : IdleColor;
+		Panel.Text(COLUMN_X[0], Color, TEXT("%s"), FCombatFrameGauges::GetName(static_cast<ECombatGauge>(Gauge)));
+		Panel.Text(COLUMN_X[1], Color, TEXT("%u"), Gauges[Gauge]);
+		Panel.NextLine();
+	}
+}
+#endif
@@ -0,0 +1,50 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CombatStats.h"
+
+class UCanvas;
+class APlayerController;
+
+#if !UE_BUILD_SHIPPING
+/**
+ * Combat perf HUD - Combat.Hud.Show 1
+ * One aggregate canvas panel instead of per-actor debug strings: time per combat scope (average and peak over the
+ * last WINDOW_FRAMES frames), queries, specs and allocations per frame, and the live attack/hitbox/AoE gauges.
+ *
+ * Samples are copied at end of frame from FCombatScopeTimings, FCombatFrameCounters and FCombatFrameGauges into
+ * fixed arrays. Hidden, the canvas hook is unregistered and EndFrame returns after one CVar read.
+ */
+class EROEOREOREOR_API FCombatPerfHud
+{
+public:
+	static constexpr int32 WINDOW_FRAMES = 60;
+
+	// Game thread, end of frame, after the counters and gauges are flushed
+	static void EndFrame();
+
+private:
+	static constexpr int32 NUM_SCOPES = static_cast<int32>(ECombatScope::Count);
+	static constexpr int32 NUM_COUNTERS = static_cast<int32>(ECombatCounter::Count);
+	static constexpr int32 NUM_GAUGES = static_cast<int32>(ECombatGauge::Count);
+
+	static float FrameMs[WINDOW_FRAMES];
+	static float CombatMs[WINDOW_FRAMES];
+	static float ScopeMs[WINDOW_FRAMES][NUM_SCOPES];
+	static uint32 ScopeCalls[WINDOW_FRAMES][NUM_SCOPES];
+	static uint32 Counters[WINDOW_FRAMES][NUM_COUNTERS];
+	static uint32 Gauges[NUM_GAUGES];
+
+	static double PreviousScopeMs[NUM_SCOPES];
+	static uint32 PreviousScopeCalls[NUM_SCOPES];
+	static int32 NextSample;
+	static int32 NumSamples;
+	static FDelegateHandle DrawHandle;
+
+	static void Show();
+	static void Hide();
+	static void Draw(UCanvas* Canvas, APlayerController* PlayerController);
+};
+#endif
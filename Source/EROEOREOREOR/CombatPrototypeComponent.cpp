@@ -1,6 +1,9 @@
 #include "CombatPrototypeComponent.h"
 #include "CombatStateMachineComponent.h"
+#include "CombatMathKernels.h"
 #include "MyCharacter.h"
+#include "CombatLog.h"
+#include "CombatMemory.h"
 #include "Engine/Engine.h"
 #include "Engine/World.h"
 #include "DrawDebugHelpers.h"
@@ -37,13 +40,15 @@ void UCombatPrototypeComponent::BeginPlay()
     // Log initialization
     if (bDebugEnabled)
     {
-        UE_LOG(LogTemp, Log, TEXT("CombatPrototypeComponent initialized for %s"), 
+        UE_LOG(LogCombat, Verbose, TEXT("CombatPrototypeComponent initialized for %s"), 
                GetOwner() ? *GetOwner()->GetName() : TEXT("NULL"));
     }
 }
 
 void UCombatPrototypeComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
+    LLM_SCOPE_BYTAG(Combat_Runtime);
+    
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
     
     if (CurrentPhase != ECombatPhase::None)
@@ -68,12 +73,14 @@ void UCombatPrototypeComponent::StartAttack(const FString& PrototypeName)
     }
     else
     {
-        UE_LOG(LogTemp, Warning, TEXT("Combat prototype '%s' not found!"), *PrototypeName);
+        UE_LOG(LogCombat, Warning, TEXT("Combat prototype '%s' not found!"), *PrototypeName);
     }
 }
 
 void UCombatPrototypeComponent::StartAttackWithData(const FCombatPrototypeData& AttackData)
 {
+    LLM_SCOPE_BYTAG(Combat_Runtime);
+    
     // Cancel any current attack
     if (CurrentPhase != ECombatPhase::None)
     {
@@ -104,7 +111,7 @@ void UCombatPrototypeComponent::StartAttackWithData(const FCombatPrototypeData&
     
     if (bDebugEnabled)
     {
-        UE_LOG(LogTemp, Log, TEXT("Started attack: %s"), *CurrentAttackData.PrototypeName);
+        UE_LOG(LogCombat, Verbose, TEXT("Started attack: %s"), *CurrentAttackData.PrototypeName);
     }
 }
 
@@ -126,7 +133,7 @@ void UCombatPrototypeComponent::CancelAttack()
         
         if (bDebugEnabled)
         {
-            UE_LOG(LogTemp, Log, TEXT("Attack canceled: %s"), *CurrentAttackData.PrototypeName);
+            UE_LOG(LogCombat, Verbose, TEXT("Attack canceled: %s"), *CurrentAttackData.PrototypeName);
         }
         
         // End the attack after brief cancel phase
@@ -222,9 +229,11 @@ FVector UCombatPrototypeComponent::GetPredictedEndPosition() const
 
 void UCombatPrototypeComponent::LoadPrototypeData(UDataTable* DataTable)
 {
+    LLM_SCOPE_BYTAG(Combat_Data);
+    
     if (!DataTable)
     {
-        UE_LOG(LogTemp, Warning, TEXT("Cannot load null data table"));
+        UE_LOG(LogCombat, Warning, TEXT("Cannot load null data table"));
         return;
     }
     
@@ -243,7 +252,7 @@ void UCombatPrototypeComponent::LoadPrototypeData(UDataTable* DataTable)
     
     if (bDebugEnabled)
     {
-        UE_LOG(LogTemp, Log, TEXT("Loaded %d combat prototypes"), LoadedPrototypes.Num());
+        UE_LOG(LogCombat, Log, TEXT("Loaded %d combat prototypes"), LoadedPrototypes.Num());
     }
 }
 
@@ -270,7 +279,7 @@ void UCombatPrototypeComponent::ModifyCurrentTimingData(const FCombatTimingData&
     
     if (bDebugEnabled)
     {
-        UE_LOG(LogTemp, Log, TEXT("Modified timing data for current attack"));
+        UE_LOG(LogCombat, Log, TEXT("Modified timing data for current attack"));
     }
 }
 
@@ -280,7 +289,7 @@ void UCombatPrototypeComponent::ModifyCurrentTrajectoryData(const FTrajectoryDat
     
     if (bDebugEnabled)
     {
-        UE_LOG(LogTemp, Log, TEXT("Modified trajectory data for current attack"));
+        UE_LOG(LogCombat, Log, TEXT("Modified trajectory data for current attack"));
     }
 }
 
@@ -291,7 +300,7 @@ void UCombatPrototypeComponent::ModifyCurrentMovementData(const FMovementControl
     
     if (bDebugEnabled)
     {
-        UE_LOG(LogTemp, Log, TEXT("Modified movement data for current attack"));
+        UE_LOG(LogCombat, Log, TEXT("Modified movement data for current attack"));
     }
 }
 
@@ -311,12 +320,14 @@ void UCombatPrototypeComponent::TestCurrentPrototype()
     }
     else
     {
-        UE_LOG(LogTemp, Warning, TEXT("No prototypes loaded for testing"));
+        UE_LOG(LogCombat, Warning, TEXT("No prototypes loaded for testing"));
     }
 }
 
 void UCombatPrototypeComponent::PreviewTrajectory()
 {
+    LLM_SCOPE_BYTAG(Combat_Debug);
+    
     if (GetWorld() && GetOwner())
     {
         const FVector StartLocation = GetOwner()->GetActorLocation();
@@ -369,7 +380,7 @@ void UCombatPrototypeComponent::StartActionFromStateMachine(const FCombatActionD
         StartAttackWithData(TempPrototypeData);
     }
     
-    UE_LOG(LogTemp, Log, TEXT("Started action from state machine: %s"), *ActionData.DisplayName);
+    UE_LOG(LogCombat, Verbose, TEXT("Started action from state machine: %s"), *ActionData.DisplayName);
 }
 
 void UCombatPrototypeComponent::EndActionFromStateMachine(bool bWasCanceled)
@@ -384,7 +395,7 @@ void UCombatPrototypeComponent::EndActionFromStateMachine(bool bWasCanceled)
         SetPhase(ECombatPhase::None);
     }
     
-    UE_LOG(LogTemp, Log, TEXT("Ended action from state machine (Canceled: %s)"), bWasCanceled ? TEXT("Yes") : TEXT("No"));
+    UE_LOG(LogCombat, Verbose, TEXT("Ended action from state machine (Canceled: %s)"), bWasCanceled ? TEXT("Yes") : TEXT("No"));
 }
 
 // Private Methods
@@ -529,7 +540,6 @@ void UCombatPrototypeComponent::CheckForHits()
     
     // Simple sphere trace for hits
     const FVector StartLocation = OwnerCharacter->GetActorLocation();
-    const float HitRadius = 100.0f;
     
     TArray<FHitResult> HitResults;
     TArray<TEnumAsByte<EObjectTypeQuery>> ObjectTypes;
@@ -543,7 +553,7 @@ void UCombatPrototypeComponent::CheckForHits()
         GetWorld(),
         StartLocation,
         StartLocation,
-        HitRadius,
+        HIT_RADIUS,
         ObjectTypes,
         false,
         ActorsToIgnore,
@@ -567,7 +577,7 @@ void UCombatPrototypeComponent::CheckForHits()
                 
                 if (bDebugEnabled)
                 {
-                    UE_LOG(LogTemp, Log, TEXT("Attack hit: %s"), *Hit.GetActor()->GetName());
+                    UE_LOG(LogCombat, VeryVerbose, TEXT("Attack hit: %s"), *Hit.GetActor()->GetName());
                 }
             }
         }
@@ -576,6 +586,8 @@ void UCombatPrototypeComponent::CheckForHits()
 
 void UCombatPrototypeComponent::DrawDebugVisualization()
 {
+    LLM_SCOPE_BYTAG(Combat_Debug);
+    
     if (!GetWorld() || !OwnerCharacter.IsValid())
         return;
     
@@ -634,77 +646,36 @@ void UCombatPrototypeComponent::SetPhase(ECombatPhase NewPhase)
     
     if (bDebugEnabled)
     {
-        UE_LOG(LogTemp, Log, TEXT("Phase changed from %d to %d"), static_cast<int32>(OldPhase), static_cast<int32>(NewPhase));
+        UE_LOG(LogCombat, VeryVerbose, TEXT("Phase changed from %d to %d"), static_cast<int32>(OldPhase), static_cast<int32>(NewPhase));
     }
 }
 
 FVector UCombatPrototypeComponent::CalculateTrajectoryPosition(float Alpha) const
 {
-    switch (CurrentAttackData.TrajectoryData.TrajectoryType)
-    {
-        case ETrajectoryType::Linear:
-            return CalculateLinearTrajectory(Alpha);
-        case ETrajectoryType::Arc:
-            return CalculateArcTrajectory(Alpha);
-        case ETrajectoryType::Homing:
-            return CalculateHomingTrajectory(Alpha);
-        case ETrajectoryType::Curve:
-            return CalculateCurveTrajectory(Alpha);
-        case ETrajectoryType::Teleport:
-            return Alpha >= 1.0f ? AttackTargetLocation : AttackStartLocation;
-        default:
-            return CalculateLinearTrajectory(Alpha);
-    }
+    // Homing follows the live target; curve paths bend along the owner's right vector
+    const bool bHoming = CurrentAttackData.TrajectoryData.TrajectoryType == ETrajectoryType::Homing;
+    const FVector TargetLocation = bHoming && TargetActor.IsValid() ? TargetActor->GetActorLocation() : AttackTargetLocation;
+    const FVector RightVector = OwnerCharacter.IsValid() ? OwnerCharacter->GetActorRightVector() : FVector::RightVector;
+    
+    return FCombatMathKernels::TrajectoryPosition(CurrentAttackData.TrajectoryData, AttackStartLocation, TargetLocation, RightVector, Alpha);
 }
 
-FVector UCombatPrototypeComponent::CalculateLinearTrajectory(float Alpha) const
-{
-    const FVector StartPos = AttackStartLocation + CurrentAttackData.TrajectoryData.StartOffset;
-    const FVector EndPos = AttackTargetLocation + CurrentAttackData.TrajectoryData.EndOffset;
-    return FMath::Lerp(StartPos, EndPos, Alpha);
-}
+// MEMORY ACCOUNTING
 
-FVector UCombatPrototypeComponent::CalculateArcTrajectory(float Alpha) const
+void UCombatPrototypeComponent::GetCombatMemoryUsage(FCombatMemoryUsage& OutUsage) const
 {
-    const FVector StartPos = AttackStartLocation + CurrentAttackData.TrajectoryData.StartOffset;
-    const FVector EndPos = AttackTargetLocation + CurrentAttackData.TrajectoryData.EndOffset;
-    const FVector LinearPos = FMath::Lerp(StartPos, EndPos, Alpha);
-    
-    // Add arc height using sine wave
-    const float ArcHeight = CurrentAttackData.TrajectoryData.ArcHeight * FMath::Sin(Alpha * PI);
-    return LinearPos + FVector(0, 0, ArcHeight);
-}
+    OutUsage.Add(ECombatMemoryCategory::Runtime, sizeof(*this) + CurrentAttackData.PrototypeName.GetAllocatedSize() +
+        AlreadyHitActors.GetAllocatedSize());
 
-FVector UCombatPrototypeComponent::CalculateHomingTrajectory(float Alpha) const
-{
-    // Update target position if following an actor
-    FVector CurrentTarget = AttackTargetLocation;
-    if (TargetActor.IsValid())
-    {
-        CurrentTarget = TargetActor->GetActorLocation();
-    }
-    
-    const FVector StartPos = AttackStartLocation + CurrentAttackData.TrajectoryData.StartOffset;
-    const FVector EndPos = CurrentTarget + CurrentAttackData.TrajectoryData.EndOffset;
-    
-    // Apply homing strength
-    const float HomingStrength = FMath::Clamp(CurrentAttackData.TrajectoryData.HomingStrength, 0.0f, 1.0f);
-    const FVector LinearPos = FMath::Lerp(StartPos, EndPos, Alpha);
-    const FVector DirectPos = StartPos + (EndPos - StartPos).GetSafeNormal() * (EndPos - StartPos).Size() * Alpha;
-    
-    return FMath::Lerp(DirectPos, LinearPos, HomingStrength);
+    OutUsage.AddTable(PrototypeDataTable ? PrototypeDataTable->GetFName() : FName(TEXT("LoadedPrototypes")),
+        CombatMemory::GetMapBytes(LoadedPrototypes, [](const FString& Key, const FCombatPrototypeData& Row)
+        {
+            return Key.GetAllocatedSize() + Row.PrototypeName.GetAllocatedSize();
+        }));
 }
 
-FVector UCombatPrototypeComponent::CalculateCurveTrajectory(float Alpha) const
+void UCombatPrototypeComponent::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
 {
-    FVector BasePos = CalculateLinearTrajectory(Alpha);
-    
-    if (CurrentAttackData.TrajectoryData.TrajectoryPathCurve)
-    {
-        const float CurveValue = CurrentAttackData.TrajectoryData.TrajectoryPathCurve->GetFloatValue(Alpha);
-        // Apply curve modification to trajectory
-        BasePos += OwnerCharacter->GetActorRightVector() * CurveValue * 100.0f;
-    }
-    
-    return BasePos;
+    Super::GetResourceSizeEx(CumulativeResourceSize);
+    AddHeapResourceSize(CumulativeResourceSize, sizeof(*this));
 }
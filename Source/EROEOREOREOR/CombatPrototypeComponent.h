@@ -6,6 +6,7 @@
 #include "Curves/CurveFloat.h"
 #include "GameplayTagContainer.h"
 #include "CombatSystemTypes.h"
+#include "CombatMemory.h"
 #include "CombatPrototypeComponent.generated.h"
 
 class AMyCharacter;
@@ -153,18 +154,25 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnCombatPhaseChanged, ECombatPhase
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAttackConnected, AActor*, HitActor);
 
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
-class EROEOREOREOR_API UCombatPrototypeComponent : public UActorComponent
+class EROEOREOREOR_API UCombatPrototypeComponent : public UActorComponent, public ICombatMemoryReporter
 {
     GENERATED_BODY()
 
 public:
     UCombatPrototypeComponent();
 
+    // Radius of the Active-phase sphere sweep in CheckForHits - also what the data linter charges per active frame
+    static constexpr float HIT_RADIUS = 100.0f;
+
 protected:
     virtual void BeginPlay() override;
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 public:
+    // Loaded attack prototype rows (Data) plus the current attack and its already-hit set (Runtime)
+    virtual void GetCombatMemoryUsage(FCombatMemoryUsage& OutUsage) const override;
+    virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
+
     // Core Combat Control
     UFUNCTION(BlueprintCallable, Category = "Combat Prototype")
     void StartAttack(const FString& PrototypeName);
@@ -182,6 +190,8 @@ public:
     UFUNCTION(BlueprintPure, Category = "Combat Prototype")
     ECombatPhase GetCurrentPhase() const { return CurrentPhase; }
 
+    const FCombatPrototypeData& GetCurrentAttackData() const { return CurrentAttackData; }
+
     UFUNCTION(BlueprintPure, Category = "Combat Prototype")
     float GetPhaseProgress() const;
 
@@ -291,10 +301,6 @@ private:
     
     void SetPhase(ECombatPhase NewPhase);
     FVector CalculateTrajectoryPosition(float Alpha) const;
-    FVector CalculateLinearTrajectory(float Alpha) const;
-    FVector CalculateArcTrajectory(float Alpha) const;
-    FVector CalculateHomingTrajectory(float Alpha) const;
-    FVector CalculateCurveTrajectory(float Alpha) const;
 
     // Cache references
     UPROPERTY()
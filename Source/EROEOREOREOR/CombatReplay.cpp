@@ -0,0 +1,857 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CombatReplay.h"
+
+#if !UE_BUILD_SHIPPING
+#include "CombatBenchmarkScene.h"
+#include "CombatLog.h"
+#include "CombatStateMachineComponent.h"
+#include "CombatStats.h"
+#include "MyAttributeSet.h"
+#include "MyCharacter.h"
+#include "TargetDummy.h"
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "EngineUtils.h"
+#include "Engine/World.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/Controller.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMisc.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/App.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+// COMBAT REPLAY - Record a fight once, replay it frame for frame on every build
+// Record: Combat.Replay.Record [Name=Brawl] [Frames=1800] [Seed=1337]   (Combat.Replay.Stop ends it early)
+// Play:   Combat.Replay.Play [Name=Brawl] [QuitWhenDone=0]
+// Headless: <Project>.uproject <Map> -game -nullrhi -unattended -nosound -ExecCmds="Combat.Replay.Play Brawl 1"
+//
+// Recordings are written to Saved/CombatReplays/<Name>.combatreplay. Playback writes world tick percentiles,
+// per-scope combat time and the checksum comparison to Saved/Benchmarks/CombatReplay_<Name>_<time>.json.
+// Frame checksums are chained, so the first mismatching frame is where the simulation diverged.
+
+bool FCombatReplay::bRecording = false;
+
+namespace CombatReplay
+{
+	static constexpr uint32 FILE_MAGIC = 0x31505243; // "CRP1"
+	static constexpr int32 FILE_VERSION = 1;
+
+	struct FActorState
+	{
+		FString ClassPath;
+		FTransform Transform;
+		FRotator ControlRotation = FRotator::ZeroRotator;
+		float Health = 0.0f;
+		bool bFighter = false;
+
+		friend FArchive& operator<<(FArchive& Ar, FActorState& State)
+		{
+			return Ar << State.ClassPath << State.Transform << State.ControlRotation << State.Health << State.bFighter;
+		}
+	};
+
+	struct FInputRecord
+	{
+		int32 Frame = 0;
+		uint16 Actor = 0;
+		uint8 Action = 0;
+		// Poll time relative to the frame's FApp::GetCurrentTime(), so buffered-input windows line up on playback
+		float TimeOffset = 0.0f;
+
+		friend FArchive& operator<<(FArchive& Ar, FInputRecord& Input)
+		{
+			return Ar << Input.Frame << Input.Actor << Input.Action << Input.TimeOffset;
+		}
+	};
+
+	struct FPadState
+	{
+		FRotator3f ControlRotation = FRotator3f::ZeroRotator;
+		FVector2f MoveInput = FVector2f::ZeroVector;
+		FVector3f MovementVector = FVector3f::ZeroVector;
+		bool bJump = false;
+
+		bool operator==(const FPadState& Other) const
+		{
+			return ControlRotation == Other.ControlRotation && MoveInput == Other.MoveInput
+				&& MovementVector == Other.MovementVector && bJump == Other.bJump;
+		}
+		bool operator!=(const FPadState& Other) const { return !(*this == Other); }
+	};
+
+	struct FPadRecord
+	{
+		int32 Frame = 0;
+		uint16 Actor = 0;
+		FPadState State;
+
+		friend FArchive& operator<<(FArchive& Ar, FPadRecord& Pad)
+		{
+			return Ar << Pad.Frame << Pad.Actor << Pad.State.ControlRotation << Pad.State.MoveInput
+				<< Pad.State.MovementVector << Pad.State.bJump;
+		}
+	};
+
+	struct FRecording
+	{
+		FString MapName;
+		int32 Seed = 0;
+		TArray<FActorState> Actors;
+		TArray<float> FrameDeltas;
+		TArray<FInputRecord> Inputs;
+		TArray<FPadRecord> Pads;
+		TArray<uint32> FrameChecksums;
+
+		friend FArchive& operator<<(FArchive& Ar, FRecording& Recording)
+		{
+			return Ar << Recording.MapName << Recording.Seed << Recording.Actors << Recording.FrameDeltas
+				<< Recording.Inputs << Recording.Pads << Recording.FrameChecksums;
+		}
+	};
+
+	struct FRecordSession
+	{
+		TWeakObjectPtr<UWorld> World;
+		FDelegateHandle TickStartHandle;
+		FDelegateHandle PostTickHandle;
+
+		FString Name;
+		int32 MaxFrames = 0;
+		// INDEX_NONE until the first full frame after the command starts
+		int32 Frame = INDEX_NONE;
+
+		FRecording Recording;
+		TArray<TWeakObjectPtr<AActor>> Actors;
+		TArray<FPadState> LastPads;
+	};
+
+	struct FPlaySession
+	{
+		TWeakObjectPtr<UWorld> World;
+		FDelegateHandle TickStartHandle;
+		FDelegateHandle PreTickHandle;
+		FDelegateHandle PostTickHandle;
+
+		FString Name;
+		bool bQuitWhenDone = false;
+		int32 Frame = INDEX_NONE;
+		int32 NextInput = 0;
+		int32 NextPad = 0;
+		double TickStartSeconds = 0.0;
+
+		bool bPreviousUseFixedTimeStep = false;
+		double PreviousFixedDeltaTime = 0.0;
+
+		FRecording Recording;
+		TArray<TWeakObjectPtr<AActor>> Actors;
+		TArray<FPadState> Pads;
+		TArray<bool> HasPad;
+		// Pre-existing fighters and dummies, hidden and without collision for the length of the replay
+		TArray<TWeakObjectPtr<AActor>> Parked;
+
+		TArray<uint32> FrameChecksums;
+		int32 FirstDivergentFrame = INDEX_NONE;
+		TArray<double> WorldTickMs;
+	};
+
+	static FRecordSession Record;
+	static FPlaySession Play;
+
+	static FString GetRecordingPath(const FString& Name)
+	{
+		return FPaths::ProjectSavedDir() / TEXT("CombatReplays") / (Name + TEXT(".combatreplay"));
+	}
+
+	static bool SaveRecording(const FString& Path, FRecording& Recording)
+	{
+		TArray<uint8> Bytes;
+		FMemoryWriter Writer(Bytes);
+		uint32 Magic = FILE_MAGIC;
+		int32 Version = FILE_VERSION;
+		Writer << Magic << Version << Recording;
+		return FFileHelper::SaveArrayToFile(Bytes, *Path);
+	}
+
+	static bool LoadRecording(const FString& Path, FRecording& OutRecording)
+	{
+		TArray<uint8> Bytes;
+		if (!FFileHelper::LoadFileToArray(Bytes, *Path))
+		{
+			return false;
+		}
+
+		FMemoryReader Reader(Bytes);
+		uint32 Magic = 0;
+		int32 Version = 0;
+		Reader << Magic << Version;
+		if (Magic != FILE_MAGIC || Version != FILE_VERSION)
+		{
+			UE_LOG(LogCombat, Error, TEXT("Combat.Replay: %s is not a version %d combat replay"), *Path, FILE_VERSION);
+			return false;
+		}
+
+		Reader << OutRecording;
+		return !Reader.IsError() && OutRecording.FrameDeltas.Num() > 0;
+	}
+
+	static float GetHealth(const AActor* Actor)
+	{
+		const UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Actor);
+		return ASC ? ASC->GetNumericAttribute(UMyAttributeSet::GetHealthAttribute()) : 0.0f;
+	}
+
+	static void SetHealth(AActor* Actor, float Health)
+	{
+		if (UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Actor))
+		{
+			ASC->SetNumericAttributeBase(UMyAttributeSet::GetHealthAttribute(), Health);
+		}
+	}
+
+	static FPadState SamplePad(const AMyCharacter& Fighter)
+	{
+		FPadState Pad;
+		Pad.ControlRotation = FRotator3f(Fighter.GetControlRotation());
+		Pad.MoveInput = FVector2f(Fighter.GetCurrentMovementInput());
+		Pad.MovementVector = FVector3f(Fighter.GetLastMovementInputVector());
+		Pad.bJump = Fighter.bPressedJump;
+		return Pad;
+	}
+
+	static void ApplyPad(AMyCharacter& Fighter, const FPadState& Pad)
+	{
+		if (AController* Controller = Fighter.GetController())
+		{
+			Controller->SetControlRotation(FRotator(Pad.ControlRotation));
+		}
+		Fighter.SetCurrentMovementInput(FVector2D(Pad.MoveInput));
+		if (!Pad.MovementVector.IsZero())
+		{
+			Fighter.AddMovementInput(FVector(Pad.MovementVector));
+		}
+
+		ACharacter& Character = Fighter;
+		if (Pad.bJump && !Character.bPressedJump)
+		{
+			Character.Jump();
+		}
+		else if (!Pad.bJump && Character.bPressedJump)
+		{
+			Character.StopJumping();
+		}
+	}
+
+	// Combat outcome of one frame, chained onto the previous frame's hash
+	// Locations are rounded to whole units so the hash compares results, not the last bits of a float
+	static uint32 HashFrame(const TArray<TWeakObjectPtr<AActor>>& Actors, uint32 PreviousHash)
+	{
+		uint32 Hash = PreviousHash;
+		for (const TWeakObjectPtr<AActor>& WeakActor : Actors)
+		{
+			int32 Values[6] = { MIN_int32, 0, 0, 0, 0, 0 };
+			if (const AActor* Actor = WeakActor.Get())
+			{
+				const FVector Location = Actor->GetActorLocation();
+				Values[0] = FMath::RoundToInt(Location.X);
+				Values[1] = FMath::RoundToInt(Location.Y);
+				Values[2] = FMath::RoundToInt(Location.Z);
+				Values[3] = FMath::RoundToInt(GetHealth(Actor) * 100.0f);
+
+				if (const UCombatStateMachineComponent* StateMachine = Actor->FindComponentByClass<UCombatStateMachineComponent>())
+				{
+					Values[4] = static_cast<int32>(StateMachine->GetCurrentState());
+					Values[5] = static_cast<int32>(FCrc::StrCrc32(*StateMachine->GetCurrentActionTag().ToString()));
+				}
+			}
+			Hash = FCrc::MemCrc32(Values, sizeof(Values), Hash);
+		}
+
+		const uint32 Counters[] =
+		{
+			FCombatFrameCounters::GetLastFrame(ECombatCounter::Hits),
+			FCombatFrameCounters::GetLastFrame(ECombatCounter::DamageSpecs)
+		};
+		return FCrc::MemCrc32(Counters, sizeof(Counters), Hash);
+	}
+
+	// Nearest-rank percentile on a sorted array
+	static double Percentile(const TArray<double>& Sorted, double Fraction)
+	{
+		if (Sorted.Num() == 0)
+		{
+			return 0.0;
+		}
+		const int32 Rank = FMath::Clamp(FMath::CeilToInt(Fraction * Sorted.Num()) - 1, 0, Sorted.Num() - 1);
+		return Sorted[Rank];
+	}
+
+	static void AppendTimingJson(FString& Json, const TCHAR* Key, TArray<double>& Samples)
+	{
+		Samples.Sort();
+
+		double Sum = 0.0;
+		for (const double Ms : Samples)
+		{
+			Sum += Ms;
+		}
+
+		Json += FString::Printf(TEXT("\"%s\": { \"mean\": %.4f, \"p50\": %.4f, \"p95\": %.4f, \"p99\": %.4f, \"max\": %.4f }"),
+			Key, Samples.Num() > 0 ? Sum / Samples.Num() : 0.0,
+			Percentile(Samples, 0.50), Percentile(Samples, 0.95), Percentile(Samples, 0.99),
+			Samples.Num() > 0 ? Samples.Last() : 0.0);
+	}
+}
+
+// Owns the recording session; friend of FCombatReplay for the recording flag
+class FCombatReplayRecorder
+{
+public:
+	static void Start(UWorld* World, const FString& Name, int32 MaxFrames, int32 Seed);
+	static void Stop();
+	static void RecordInput(const AMyCharacter* Character, ECombatInputAction Action, double InputPollTime);
+
+private:
+	static void OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+	static void OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+};
+
+void FCombatReplay::RecordCombatInput(const AMyCharacter* Character, ECombatInputAction Action, double InputPollTime)
+{
+	FCombatReplayRecorder::RecordInput(Character, Action, InputPollTime);
+}
+
+void FCombatReplayRecorder::Start(UWorld* World, const FString& Name, int32 MaxFrames, int32 Seed)
+{
+	using namespace CombatReplay;
+
+	Record = FRecordSession();
+	Record.World = World;
+	Record.Name = Name;
+	Record.MaxFrames = MaxFrames;
+	Record.Recording.MapName = UWorld::RemovePIEPrefix(World->GetMapName());
+	Record.Recording.Seed = Seed;
+
+	auto CaptureActor = [](AActor* Actor, bool bFighter)
+	{
+		if (Record.Actors.Num() > MAX_uint16)
+		{
+			return;
+		}
+
+		FActorState& State = Record.Recording.Actors.AddDefaulted_GetRef();
+		State.ClassPath = Actor->GetClass()->GetPathName();
+		State.Transform = Actor->GetActorTransform();
+		State.Health = GetHealth(Actor);
+		State.bFighter = bFighter;
+		if (bFighter)
+		{
+			State.ControlRotation = CastChecked<AMyCharacter>(Actor)->GetControlRotation();
+		}
+		Record.Actors.Add(Actor);
+	};
+
+	for (TActorIterator<AMyCharacter> It(World); It; ++It)
+	{
+		CaptureActor(*It, true);
+	}
+	for (TActorIterator<ATargetDummy> It(World); It; ++It)
+	{
+		CaptureActor(*It, false);
+	}
+	Record.LastPads.SetNum(Record.Actors.Num());
+
+	UE_LOG(LogCombat, Display, TEXT("Combat.Replay.Record: Recording '%s' - %d actors, up to %d frames, seed %d"),
+		*Name, Record.Actors.Num(), MaxFrames, Seed);
+
+	Record.TickStartHandle = FWorldDelegates::OnWorldTickStart.AddStatic(&FCombatReplayRecorder::OnWorldTickStart);
+	Record.PostTickHandle = FWorldDelegates::OnWorldPostActorTick.AddStatic(&FCombatReplayRecorder::OnWorldPostActorTick);
+}
+
+void FCombatReplayRecorder::Stop()
+{
+	using namespace CombatReplay;
+
+	FWorldDelegates::OnWorldTickStart.Remove(Record.TickStartHandle);
+	FWorldDelegates::OnWorldPostActorTick.Remove(Record.PostTickHandle);
+	FCombatReplay::bRecording = false;
+
+	// A frame whose checksum was not taken yet is dropped
+	FRecording& Recording = Record.Recording;
+	Recording.FrameDeltas.SetNum(Recording.FrameChecksums.Num());
+	Recording.Inputs.RemoveAll([&Recording](const FInputRecord& Input) { return Input.Frame >= Recording.FrameChecksums.Num(); });
+
+	if (Recording.FrameChecksums.Num() == 0)
+	{
+		UE_LOG(LogCombat, Warning, TEXT("Combat.Replay.Record: '%s' stopped before its first frame, nothing written"), *Record.Name);
+	}
+	else
+	{
+		const FString Path = GetRecordingPath(Record.Name);
+		if (SaveRecording(Path, Recording))
+		{
+			UE_LOG(LogCombat, Display, TEXT("Combat.Replay.Record: Wrote %s - %d frames, %d inputs, %d pad changes, checksum %08x"),
+				*Path, Recording.FrameChecksums.Num(), Recording.Inputs.Num(), Recording.Pads.Num(), Recording.FrameChecksums.Last());
+		}
+		else
+		{
+			UE_LOG(LogCombat, Error, TEXT("Combat.Replay.Record: Failed to write %s"), *Path);
+		}
+	}
+
+	Record = FRecordSession();
+}
+
+void FCombatReplayRecorder::RecordInput(const AMyCharacter* Character, ECombatInputAction Action, double InputPollTime)
+{
+	using namespace CombatReplay;
+
+	// Fighters spawned after the recording started are not part of it
+	const int32 ActorIndex = Record.Actors.IndexOfByPredicate([Character](const TWeakObjectPtr<AActor>& Actor) { return Actor.Get() == Character; });
+	if (ActorIndex == INDEX_NONE || Record.Frame == INDEX_NONE)
+	{
+		return;
+	}
+
+	FInputRecord& Input = Record.Recording.Inputs.AddDefaulted_GetRef();
+	Input.Frame = Record.Frame;
+	Input.Actor = static_cast<uint16>(ActorIndex);
+	Input.Action = static_cast<uint8>(Action);
+	Input.TimeOffset = static_cast<float>(InputPollTime - FApp::GetCurrentTime());
+}
+
+void FCombatReplayRecorder::OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	using namespace CombatReplay;
+
+	if (World != Record.World.Get() || TickType == LEVELTICK_TimeOnly)
+	{
+		return;
+	}
+
+	if (Record.Frame == INDEX_NONE)
+	{
+		// Crit rolls and other FMath::Rand users start from the same state on playback
+		FMath::RandInit(Record.Recording.Seed);
+		FMath::SRandInit(Record.Recording.Seed);
+		FCombatReplay::bRecording = true;
+		Record.Frame = 0;
+	}
+
+	// Engine delta before time dilation - playback feeds it back as the fixed delta
+	Record.Recording.FrameDeltas.Add(static_cast<float>(FApp::GetDeltaTime()));
+}
+
+void FCombatReplayRecorder::OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	using namespace CombatReplay;
+
+	if (World != Record.World.Get() || Record.Frame == INDEX_NONE)
+	{
+		return;
+	}
+
+	FRecording& Recording = Record.Recording;
+	for (int32 ActorIndex = 0; ActorIndex < Record.Actors.Num(); ++ActorIndex)
+	{
+		const AMyCharacter* Fighter = Cast<AMyCharacter>(Record.Actors[ActorIndex].Get());
+		if (!Fighter)
+		{
+			continue;
+		}
+
+		const FPadState Pad = SamplePad(*Fighter);
+		if (Pad != Record.LastPads[ActorIndex])
+		{
+			FPadRecord& PadRecord = Recording.Pads.AddDefaulted_GetRef();
+			PadRecord.Frame = Record.Frame;
+			PadRecord.Actor = static_cast<uint16>(ActorIndex);
+			PadRecord.State = Pad;
+			Record.LastPads[ActorIndex] = Pad;
+		}
+	}
+
+	const uint32 PreviousHash = Recording.FrameChecksums.Num() > 0 ? Recording.FrameChecksums.Last() : static_cast<uint32>(Recording.Seed);
+	Recording.FrameChecksums.Add(HashFrame(Record.Actors, PreviousHash));
+
+	if (++Record.Frame >= Record.MaxFrames)
+	{
+		Stop();
+	}
+}
+
+namespace CombatReplay
+{
+	static FString BuildPlaybackJson()
+	{
+		const int32 NumFrames = Play.FrameChecksums.Num();
+		const uint32 RecordedChecksum = Play.Recording.FrameChecksums.IsValidIndex(NumFrames - 1) ? Play.Recording.FrameChecksums[NumFrames - 1] : 0;
+		const uint32 ReplayedChecksum = NumFrames > 0 ? Play.FrameChecksums.Last() : 0;
+
+		int32 NumFighters = 0;
+		for (const FActorState& State : Play.Recording.Actors)
+		{
+			NumFighters += State.bFighter ? 1 : 0;
+		}
+
+		FString Json;
+		Json += TEXT("{\n");
+		Json += FString::Printf(TEXT("\t\"replay\": \"%s\",\n"), *Play.Name);
+		Json += FString::Printf(TEXT("\t\"map\": \"%s\",\n"), *Play.Recording.MapName);
+		Json += FString::Printf(TEXT("\t\"build\": \"%s\",\n"), LexToString(FApp::GetBuildConfiguration()));
+		Json += FString::Printf(TEXT("\t\"build_version\": \"%s\",\n"), FApp::GetBuildVersion());
+		Json += FString::Printf(TEXT("\t\"platform\": \"%s\",\n"), ANSI_TO_TCHAR(FPlatformProperties::IniPlatformName()));
+		Json += FString::Printf(TEXT("\t\"timestamp\": \"%s\",\n"), *FDateTime::UtcNow().ToIso8601());
+		Json += FString::Printf(TEXT("\t\"frames\": %d,\n\t\"recorded_frames\": %d,\n"), NumFrames, Play.Recording.FrameDeltas.Num());
+		Json += FString::Printf(TEXT("\t\"fighters\": %d,\n\t\"dummies\": %d,\n\t\"inputs\": %d,\n"),
+			NumFighters, Play.Recording.Actors.Num() - NumFighters, Play.Recording.Inputs.Num());
+
+		Json += TEXT("\t");
+		AppendTimingJson(Json, TEXT("world_tick_ms"), Play.WorldTickMs);
+		Json += TEXT(",\n");
+
+		Json += TEXT("\t\"scopes\": {");
+		for (int32 Scope = 0; Scope < static_cast<int32>(ECombatScope::Count); ++Scope)
+		{
+			const double TotalMs = FCombatScopeTimings::GetTotalMilliseconds(static_cast<ECombatScope>(Scope));
+			Json += FString::Printf(TEXT("%s\n\t\t\"%s\": { \"total_ms\": %.4f, \"ms_per_frame\": %.5f, \"calls\": %u }"),
+				Scope > 0 ? TEXT(",") : TEXT(""), FCombatScopeTimings::GetName(static_cast<ECombatScope>(Scope)),
+				TotalMs, TotalMs / FMath::Max(1, NumFrames), FCombatScopeTimings::GetTotalCalls(static_cast<ECombatScope>(Scope)));
+		}
+		Json += TEXT("\n\t},\n");
+
+		Json += FString::Printf(TEXT("\t\"checksum_recorded\": \"%08x\",\n\t\"checksum_replayed\": \"%08x\",\n"), RecordedChecksum, ReplayedChecksum);
+		Json += FString::Printf(TEXT("\t\"checksum_match\": %s,\n"), Play.FirstDivergentFrame == INDEX_NONE ? TEXT("true") : TEXT("false"));
+		Json += FString::Printf(TEXT("\t\"first_divergent_frame\": %d\n"), Play.FirstDivergentFrame);
+		Json += TEXT("}\n");
+		return Json;
+	}
+
+	static void ParkActor(AActor* Actor)
+	{
+		Actor->SetActorHiddenInGame(true);
+		Actor->SetActorEnableCollision(false);
+		if (const ACharacter* Character = Cast<ACharacter>(Actor))
+		{
+			// No collision means no floor - hold it in place instead of letting it fall to KillZ
+			Character->GetCharacterMovement()->StopMovementImmediately();
+			Character->GetCharacterMovement()->DisableMovement();
+		}
+		Play.Parked.Add(Actor);
+	}
+
+	static void UnparkActors()
+	{
+		for (const TWeakObjectPtr<AActor>& WeakActor : Play.Parked)
+		{
+			if (AActor* Actor = WeakActor.Get())
+			{
+				Actor->SetActorHiddenInGame(false);
+				Actor->SetActorEnableCollision(true);
+				if (const ACharacter* Character = Cast<ACharacter>(Actor))
+				{
+					Character->GetCharacterMovement()->SetDefaultMovementMode();
+				}
+			}
+		}
+		Play.Parked.Reset();
+	}
+
+	static void FinishPlayback()
+	{
+		FWorldDelegates::OnWorldTickStart.Remove(Play.TickStartHandle);
+		FWorldDelegates::OnWorldPreActorTick.Remove(Play.PreTickHandle);
+		FWorldDelegates::OnWorldPostActorTick.Remove(Play.PostTickHandle);
+		FCombatScopeTimings::SetCapture(ECombatScopeCaptureClient::Replay, false);
+		FApp::SetUseFixedTimeStep(Play.bPreviousUseFixedTimeStep);
+		FApp::SetFixedDeltaTime(Play.PreviousFixedDeltaTime);
+
+		const FString Path = FPaths::ProjectSavedDir() / TEXT("Benchmarks") /
+			FString::Printf(TEXT("CombatReplay_%s_%s.json"), *Play.Name, *FDateTime::Now().ToString());
+		TArray<double> SortedTickMs = Play.WorldTickMs;
+		const FString Json = BuildPlaybackJson();
+		if (FFileHelper::SaveStringToFile(Json, *Path))
+		{
+			UE_LOG(LogCombat, Display, TEXT("Combat.Replay.Play: Wrote %s"), *Path);
+		}
+		else
+		{
+			UE_LOG(LogCombat, Error, TEXT("Combat.Replay.Play: Failed to write %s"), *Path);
+		}
+
+		SortedTickMs.Sort();
+		if (Play.FirstDivergentFrame == INDEX_NONE)
+		{
+			UE_LOG(LogCombat, Display, TEXT("Combat.Replay.Play: '%s' matched all %d frames - world tick p50 %.3f p95 %.3f p99 %.3f ms"),
+				*Play.Name, Play.FrameChecksums.Num(), Percentile(SortedTickMs, 0.50), Percentile(SortedTickMs, 0.95), Percentile(SortedTickMs, 0.99));
+		}
+		else
+		{
+			UE_LOG(LogCombat, Error, TEXT("Combat.Replay.Play: '%s' diverged from the recording at frame %d - timings are not comparable"),
+				*Play.Name, Play.FirstDivergentFrame);
+		}
+
+		for (const TWeakObjectPtr<AActor>& WeakActor : Play.Actors)
+		{
+			if (AActor* Actor = WeakActor.Get())
+			{
+				if (const APawn* Pawn = Cast<APawn>(Actor))
+				{
+					if (AController* Controller = Pawn->GetController())
+					{
+						Controller->Destroy();
+					}
+				}
+				Actor->Destroy();
+			}
+		}
+		UnparkActors();
+
+		const bool bQuitWhenDone = Play.bQuitWhenDone;
+		Play = FPlaySession();
+
+		if (bQuitWhenDone)
+		{
+			FPlatformMisc::RequestExit(false);
+		}
+	}
+
+	static void OnPlayTickStart(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+	{
+		if (World != Play.World.Get() || TickType == LEVELTICK_TimeOnly || Play.Frame != INDEX_NONE)
+		{
+			return;
+		}
+
+		// First replayed frame - same RNG state the recording started from
+		FMath::RandInit(Play.Recording.Seed);
+		FMath::SRandInit(Play.Recording.Seed);
+		FCombatScopeTimings::Reset();
+		FCombatScopeTimings::SetCapture(ECombatScopeCaptureClient::Replay, true);
+		Play.Frame = 0;
+	}
+
+	static void OnPlayPreActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+	{
+		if (World != Play.World.Get() || Play.Frame == INDEX_NONE)
+		{
+			return;
+		}
+
+		const FRecording& Recording = Play.Recording;
+		for (; Play.NextPad < Recording.Pads.Num() && Recording.Pads[Play.NextPad].Frame <= Play.Frame; ++Play.NextPad)
+		{
+			const FPadRecord& PadRecord = Recording.Pads[Play.NextPad];
+			if (Play.Pads.IsValidIndex(PadRecord.Actor))
+			{
+				Play.Pads[PadRecord.Actor] = PadRecord.State;
+				Play.HasPad[PadRecord.Actor] = true;
+			}
+		}
+
+		for (int32 ActorIndex = 0; ActorIndex < Play.Actors.Num(); ++ActorIndex)
+		{
+			AMyCharacter* Fighter = Cast<AMyCharacter>(Play.Actors[ActorIndex].Get());
+			if (Fighter && Play.HasPad[ActorIndex])
+			{
+				ApplyPad(*Fighter, Play.Pads[ActorIndex]);
+			}
+		}
+
+		for (; Play.NextInput < Recording.Inputs.Num() && Recording.Inputs[Play.NextInput].Frame <= Play.Frame; ++Play.NextInput)
+		{
+			const FInputRecord& Input = Recording.Inputs[Play.NextInput];
+			AMyCharacter* Fighter = Play.Actors.IsValidIndex(Input.Actor) ? Cast<AMyCharacter>(Play.Actors[Input.Actor].Get()) : nullptr;
+			if (Fighter && Input.Action < static_cast<uint8>(ECombatInputAction::Count))
+			{
+				Fighter->DispatchCombatInput(static_cast<ECombatInputAction>(Input.Action), FApp::GetCurrentTime() + Input.TimeOffset);
+			}
+		}
+
+		Play.TickStartSeconds = FPlatformTime::Seconds();
+	}
+
+	static void OnPlayPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+	{
+		if (World != Play.World.Get() || Play.Frame == INDEX_NONE)
+		{
+			return;
+		}
+
+		Play.WorldTickMs.Add((FPlatformTime::Seconds() - Play.TickStartSeconds) * 1000.0);
+
+		const uint32 PreviousHash = Play.FrameChecksums.Num() > 0 ? Play.FrameChecksums.Last() : static_cast<uint32>(Play.Recording.Seed);
+		const uint32 Hash = Play.FrameChecksums.Add_GetRef(HashFrame(Play.Actors, PreviousHash));
+		if (Play.FirstDivergentFrame == INDEX_NONE && Play.Recording.FrameChecksums[Play.Frame] != Hash)
+		{
+			Play.FirstDivergentFrame = Play.Frame;
+		}
+
+		if (++Play.Frame >= Play.Recording.FrameDeltas.Num())
+		{
+			FinishPlayback();
+			return;
+		}
+
+		FApp::SetFixedDeltaTime(Play.Recording.FrameDeltas[Play.Frame]);
+	}
+
+	static bool SpawnRecordedActors(UWorld* World)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		bool bAllSpawned = true;
+		for (const FActorState& State : Play.Recording.Actors)
+		{
+			UClass* Class = FSoftClassPath(State.ClassPath).TryLoadClass<AActor>();
+			if (!Class)
+			{
+				UE_LOG(LogCombat, Warning, TEXT("Combat.Replay.Play: Class %s not found, using the native class"), *State.ClassPath);
+				Class = State.bFighter ? AMyCharacter::StaticClass() : ATargetDummy::StaticClass();
+			}
+
+			AActor* Actor = World->SpawnActor<AActor>(Class, State.Transform, SpawnParams);
+			bAllSpawned &= Actor != nullptr;
+			Play.Actors.Add(Actor);
+			if (!Actor)
+			{
+				continue;
+			}
+
+			if (AMyCharacter* Fighter = Cast<AMyCharacter>(Actor))
+			{
+				FCombatBenchmarkScene::PrepareFighter(Fighter);
+				if (AController* Controller = Fighter->GetController())
+				{
+					Controller->SetControlRotation(State.ControlRotation);
+				}
+			}
+			SetHealth(Actor, State.Health);
+		}
+		return bAllSpawned;
+	}
+
+	static void StartPlayback(const TArray<FString>& Args, UWorld* World)
+	{
+		if (!World)
+		{
+			return;
+		}
+
+		if (Play.PostTickHandle.IsValid() || Record.PostTickHandle.IsValid())
+		{
+			UE_LOG(LogCombat, Warning, TEXT("Combat.Replay.Play: A replay is already recording or playing"));
+			return;
+		}
+
+		Play = FPlaySession();
+		Play.Name = Args.IsValidIndex(0) ? Args[0] : TEXT("Brawl");
+		Play.bQuitWhenDone = Args.IsValidIndex(1) && FCString::Atoi(*Args[1]) != 0;
+
+		const FString Path = GetRecordingPath(Play.Name);
+		if (!LoadRecording(Path, Play.Recording))
+		{
+			UE_LOG(LogCombat, Error, TEXT("Combat.Replay.Play: Could not load %s"), *Path);
+			if (Play.bQuitWhenDone)
+			{
+				FPlatformMisc::RequestExit(false);
+			}
+			Play = FPlaySession();
+			return;
+		}
+
+		const FString MapName = UWorld::RemovePIEPrefix(World->GetMapName());
+		if (MapName != Play.Recording.MapName)
+		{
+			UE_LOG(LogCombat, Warning, TEXT("Combat.Replay.Play: '%s' was recorded on %s, playing on %s - expect divergence"),
+				*Play.Name, *Play.Recording.MapName, *MapName);
+		}
+
+		// Live fighters and dummies would collide with and be hit by the replayed ones
+		TArray<AActor*> Existing;
+		for (TActorIterator<AMyCharacter> It(World); It; ++It)
+		{
+			Existing.Add(*It);
+		}
+		for (TActorIterator<ATargetDummy> It(World); It; ++It)
+		{
+			Existing.Add(*It);
+		}
+		for (AActor* Actor : Existing)
+		{
+			ParkActor(Actor);
+		}
+
+		Play.World = World;
+		if (!SpawnRecordedActors(World))
+		{
+			UE_LOG(LogCombat, Warning, TEXT("Combat.Replay.Play: Not every recorded actor spawned - expect divergence"));
+		}
+		Play.Pads.SetNum(Play.Actors.Num());
+		Play.HasPad.Init(false, Play.Actors.Num());
+
+		// Step the engine at the recorded deltas, independent of how fast this machine runs the frame
+		Play.bPreviousUseFixedTimeStep = FApp::UseFixedTimeStep();
+		Play.PreviousFixedDeltaTime = FApp::GetFixedDeltaTime();
+		FApp::SetUseFixedTimeStep(true);
+		FApp::SetFixedDeltaTime(Play.Recording.FrameDeltas[0]);
+
+		UE_LOG(LogCombat, Display, TEXT("Combat.Replay.Play: Playing '%s' - %d actors, %d frames, %d inputs"),
+			*Play.Name, Play.Actors.Num(), Play.Recording.FrameDeltas.Num(), Play.Recording.Inputs.Num());
+
+		Play.TickStartHandle = FWorldDelegates::OnWorldTickStart.AddStatic(&OnPlayTickStart);
+		Play.PreTickHandle = FWorldDelegates::OnWorldPreActorTick.AddStatic(&OnPlayPreActorTick);
+		Play.PostTickHandle = FWorldDelegates::OnWorldPostActorTick.AddStatic(&OnPlayPostActorTick);
+	}
+
+	static void StartRecording(const TArray<FString>& Args, UWorld* World)
+	{
+		if (!World)
+		{
+			return;
+		}
+
+		if (Play.PostTickHandle.IsValid() || Record.PostTickHandle.IsValid())
+		{
+			UE_LOG(LogCombat, Warning, TEXT("Combat.Replay.Record: A replay is already recording or playing"));
+			return;
+		}
+
+		const FString Name = Args.IsValidIndex(0) ? Args[0] : TEXT("Brawl");
+		const int32 MaxFrames = Args.IsValidIndex(1) ? FMath::Max(1, FCString::Atoi(*Args[1])) : 1800;
+		const int32 Seed = Args.IsValidIndex(2) ? FCString::Atoi(*Args[2]) : 1337;
+		FCombatReplayRecorder::Start(World, Name, MaxFrames, Seed);
+	}
+
+	static void StopRecording(const TArray<FString>& Args, UWorld* World)
+	{
+		if (!Record.PostTickHandle.IsValid())
+		{
+			UE_LOG(LogCombat, Warning, TEXT("Combat.Replay.Stop: Not recording"));
+			return;
+		}
+		FCombatReplayRecorder::Stop();
+	}
+
+	static FAutoConsoleCommandWithWorldAndArgs RecordCommand(
+		TEXT("Combat.Replay.Record"),
+		TEXT("Record combat inputs, pad state and frame deltas from the next frame on to Saved/CombatReplays. Args: [Name=Brawl] [Frames=1800] [Seed=1337]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&StartRecording));
+
+	static FAutoConsoleCommandWithWorldAndArgs StopCommand(
+		TEXT("Combat.Replay.Stop"),
+		TEXT("Stop the running combat replay recording and write it"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&StopRecording));
+
+	static FAutoConsoleCommandWithWorldAndArgs PlayCommand(
+		TEXT("Combat.Replay.Play"),
+		TEXT("Replay a recorded fight at its recorded frame deltas and write tick percentiles and checksum comparison to Saved/Benchmarks as JSON. Args: [Name=Brawl] [QuitWhenDone=0]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&StartPlayback));
+}
+#endif
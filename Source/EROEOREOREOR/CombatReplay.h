@@ -0,0 +1,41 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class AMyCharacter;
+enum class ECombatInputAction : uint8;
+
+#if !UE_BUILD_SHIPPING
+/**
+ * Deterministic combat replay - Combat.Replay.Record / Combat.Replay.Play
+ * A recording holds the initial combat state (every AMyCharacter and ATargetDummy: class, transform, health),
+ * every frame's delta time, the discrete combat inputs as they reached AMyCharacter::DispatchCombatInput and
+ * each fighter's pad state (control rotation, movement input, jump), stored only when it changes.
+ *
+ * Playback spawns the recorded actors, steps the engine at the recorded deltas with a fixed time step and
+ * re-drives the same inputs on the same frames, so the state machine, Dash/Bounce and hit detection run the
+ * same frame sequence. Both sides hash combat outcomes every frame; playback writes tick-time percentiles and
+ * whether its checksums match the recording (and the first frame that diverged) to Saved/Benchmarks.
+ */
+class EROEOREOREOR_API FCombatReplay
+{
+public:
+	// Called by AMyCharacter for every combat input - one branch while nothing is recording
+	static void NotifyCombatInput(const AMyCharacter* Character, ECombatInputAction Action, double InputPollTime)
+	{
+		if (bRecording)
+		{
+			RecordCombatInput(Character, Action, InputPollTime);
+		}
+	}
+
+private:
+	// Recording session lives in CombatReplay.cpp
+	friend class FCombatReplayRecorder;
+
+	static bool bRecording;
+	static void RecordCombatInput(const AMyCharacter* Character, ECombatInputAction Action, double InputPollTime);
+};
+#endif
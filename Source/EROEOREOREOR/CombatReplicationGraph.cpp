@@ -0,0 +1,205 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CombatReplicationGraph.h"
+#include "TargetDummy.h"
+#include "CombatLog.h"
+#include "Engine/LevelScriptActor.h"
+#include "Engine/NetDriver.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/Info.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerState.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectIterator.h"
+
+static TAutoConsoleVariable<bool> CVarRepGraphEnable(
+	TEXT("Combat.RepGraph.Enable"),
+	true,
+	TEXT("Use the combat replication graph for game net drivers created after this is set. 0 uses default per-connection relevancy."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarRepGraphCellSize(
+	TEXT("Combat.RepGraph.CellSize"),
+	5000.0f,
+	TEXT("Replication grid cell size in cm. Read when the graph is created."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarRepGraphSpatialBias(
+	TEXT("Combat.RepGraph.SpatialBias"),
+	50000.0f,
+	TEXT("Grid origin offset in cm, applied to X and Y - arenas are expected within this distance of the world origin. Read when the graph is created."),
+	ECVF_Default);
+
+void UCombatReplicationGraphNode_OwnerRelevant::GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params)
+{
+	ReplicationActorList.Reset();
+
+	for (const FNetViewer& Viewer : Params.Viewers)
+	{
+		ReplicationActorList.ConditionalAdd(Viewer.InViewer);
+		ReplicationActorList.ConditionalAdd(Viewer.ViewTarget);
+
+		if (const APlayerController* PlayerController = Cast<APlayerController>(Viewer.InViewer))
+		{
+			ReplicationActorList.ConditionalAdd(PlayerController->PlayerState);
+			ReplicationActorList.ConditionalAdd(PlayerController->GetPawn());
+		}
+	}
+
+	Params.OutGatheredReplicationLists.AddReplicationActorList(ReplicationActorList);
+}
+
+UReplicationDriver* UCombatReplicationGraph::CreateReplicationDriver(UNetDriver* ForNetDriver, const FURL& URL, UWorld* World)
+{
+	// Demo and beacon drivers keep the default path
+	if (!CVarRepGraphEnable.GetValueOnGameThread() || !World || !ForNetDriver || ForNetDriver->NetDriverName != NAME_GameNetDriver)
+	{
+		return nullptr;
+	}
+
+	UE_LOG(LogCombat, Log, TEXT("CombatReplicationGraph: Created for %s"), *World->GetName());
+	return NewObject<UCombatReplicationGraph>(GetTransientPackage());
+}
+
+void UCombatReplicationGraph::InitGlobalActorClassSettings()
+{
+	Super::InitGlobalActorClassSettings();
+
+	ClassRepNodePolicies.Set(AReplicationGraphDebugActor::StaticClass(), ECombatRepNodeMapping::NotRouted);
+	ClassRepNodePolicies.Set(ALevelScriptActor::StaticClass(), ECombatRepNodeMapping::NotRouted);
+	ClassRepNodePolicies.Set(APlayerController::StaticClass(), ECombatRepNodeMapping::NotRouted);
+	ClassRepNodePolicies.Set(AInfo::StaticClass(), ECombatRepNodeMapping::RelevantAllConnections);
+	ClassRepNodePolicies.Set(APlayerState::StaticClass(), ECombatRepNodeMapping::PlayerState);
+	ClassRepNodePolicies.Set(ACharacter::StaticClass(), ECombatRepNodeMapping::Spatialize_Dynamic);
+	ClassRepNodePolicies.Set(ATargetDummy::StaticClass(), ECombatRepNodeMapping::Spatialize_Dormancy);
+
+	// Native classes only - Blueprint subclasses resolve to their closest native parent's settings
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		UClass* Class = *It;
+		const AActor* CDO = Cast<AActor>(Class->GetDefaultObject(false));
+		if (!CDO || !CDO->GetIsReplicated() || !Class->IsNative() || Class->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated))
+		{
+			continue;
+		}
+
+		InitClassReplicationInfo(Class, GetMappingPolicy(Class));
+	}
+}
+
+void UCombatReplicationGraph::InitGlobalGraphNodes()
+{
+	GridNode = CreateNewNode<UReplicationGraphNode_GridSpatialization2D>();
+	GridNode->CellSize = CVarRepGraphCellSize.GetValueOnGameThread();
+	GridNode->SpatialBias = FVector2D(-CVarRepGraphSpatialBias.GetValueOnGameThread(), -CVarRepGraphSpatialBias.GetValueOnGameThread());
+	AddGlobalGraphNode(GridNode);
+
+	AlwaysRelevantNode = CreateNewNode<UReplicationGraphNode_ActorList>();
+	AddGlobalGraphNode(AlwaysRelevantNode);
+
+	// Gathered once and shared by every connection - each PlayerState is still sent at its own NetUpdateFrequency
+	PlayerStateNode = CreateNewNode<UReplicationGraphNode_ActorList>();
+	AddGlobalGraphNode(PlayerStateNode);
+}
+
+void UCombatReplicationGraph::InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection)
+{
+	Super::InitConnectionGraphNodes(RepGraphConnection);
+
+	UCombatReplicationGraphNode_OwnerRelevant* OwnerNode = CreateNewNode<UCombatReplicationGraphNode_OwnerRelevant>();
+	AddConnectionGraphNode(OwnerNode, RepGraphConnection);
+}
+
+void UCombatReplicationGraph::RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo)
+{
+	switch (GetMappingPolicy(ActorInfo.Class))
+	{
+	case ECombatRepNodeMapping::NotRouted:
+		break;
+	case ECombatRepNodeMapping::RelevantAllConnections:
+		AlwaysRelevantNode->NotifyAddNetworkActor(ActorInfo);
+		break;
+	case ECombatRepNodeMapping::PlayerState:
+		PlayerStateNode->NotifyAddNetworkActor(ActorInfo);
+		break;
+	case ECombatRepNodeMapping::Spatialize_Static:
+		GridNode->AddActor_Static(ActorInfo, GlobalInfo);
+		break;
+	case ECombatRepNodeMapping::Spatialize_Dynamic:
+		GridNode->AddActor_Dynamic(ActorInfo, GlobalInfo);
+		break;
+	case ECombatRepNodeMapping::Spatialize_Dormancy:
+		GridNode->AddActor_Dormancy(ActorInfo, GlobalInfo);
+		break;
+	}
+}
+
+void UCombatReplicationGraph::RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo)
+{
+	switch (GetMappingPolicy(ActorInfo.Class))
+	{
+	case ECombatRepNodeMapping::NotRouted:
+		break;
+	case ECombatRepNodeMapping::RelevantAllConnections:
+		AlwaysRelevantNode->NotifyRemoveNetworkActor(ActorInfo);
+		break;
+	case ECombatRepNodeMapping::PlayerState:
+		PlayerStateNode->NotifyRemoveNetworkActor(ActorInfo);
+		break;
+	case ECombatRepNodeMapping::Spatialize_Static:
+		GridNode->RemoveActor_Static(ActorInfo);
+		break;
+	case ECombatRepNodeMapping::Spatialize_Dynamic:
+		GridNode->RemoveActor_Dynamic(ActorInfo);
+		break;
+	case ECombatRepNodeMapping::Spatialize_Dormancy:
+		GridNode->RemoveActor_Dormancy(ActorInfo);
+		break;
+	}
+}
+
+ECombatRepNodeMapping UCombatReplicationGraph::GetMappingPolicy(UClass* Class)
+{
+	if (const ECombatRepNodeMapping* Mapping = ClassRepNodePolicies.Get(Class))
+	{
+		return *Mapping;
+	}
+
+	// Unlisted classes decide from their defaults - a new projectile or AoE actor lands in the dynamic grid
+	ECombatRepNodeMapping Mapping = ECombatRepNodeMapping::Spatialize_Dynamic;
+	if (const AActor* CDO = Class->GetDefaultObject<AActor>())
+	{
+		const USceneComponent* Root = CDO->GetRootComponent();
+		if (CDO->bAlwaysRelevant)
+		{
+			Mapping = ECombatRepNodeMapping::RelevantAllConnections;
+		}
+		else if (CDO->bOnlyRelevantToOwner)
+		{
+			Mapping = ECombatRepNodeMapping::NotRouted;
+		}
+		else if (Root && Root->Mobility == EComponentMobility::Static)
+		{
+			Mapping = ECombatRepNodeMapping::Spatialize_Static;
+		}
+	}
+
+	ClassRepNodePolicies.Set(Class, Mapping);
+	return Mapping;
+}
+
+void UCombatReplicationGraph::InitClassReplicationInfo(UClass* Class, ECombatRepNodeMapping Mapping)
+{
+	const AActor* CDO = Class->GetDefaultObject<AActor>();
+
+	FClassReplicationInfo ClassInfo;
+	if (Mapping == ECombatRepNodeMapping::Spatialize_Static || Mapping == ECombatRepNodeMapping::Spatialize_Dynamic || Mapping == ECombatRepNodeMapping::Spatialize_Dormancy)
+	{
+		ClassInfo.SetCullDistanceSquared(CDO->GetNetCullDistanceSquared());
+	}
+	ClassInfo.ReplicationPeriodFrame = GetReplicationPeriodFrameForFrequency(CDO->GetNetUpdateFrequency());
+
+	GlobalActorReplicationInfoMap.SetClassInfo(Class, ClassInfo);
+}
@@ -0,0 +1,85 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ReplicationGraph.h"
+#include "CombatReplicationGraph.generated.h"
+
+class UNetDriver;
+class UReplicationDriver;
+class UWorld;
+struct FURL;
+
+// How a replicated class is routed into the graph - resolved once per class, inherited by subclasses
+enum class ECombatRepNodeMapping : uint8
+{
+	NotRouted,				// Owner-only actors (PlayerController) - reached through the per-connection node
+	RelevantAllConnections,	// GameState and other always-relevant infos
+	PlayerState,			// Every connection, at the PlayerState's own update rate
+	Spatialize_Static,		// Grid, never moves
+	Spatialize_Dynamic,		// Grid, re-bucketed every frame - characters, projectiles, spawned AoE actors
+	Spatialize_Dormancy		// Grid, static while dormant and dynamic while awake - target dummies
+};
+
+/**
+ * Per-connection node - the viewer's PlayerController, its PlayerState, its pawn and view target
+ * The pawn carries the AbilitySystemComponent, so the owner's ability state replicates even when the
+ * pawn falls outside its own grid cells (spectating, detached cameras).
+ */
+UCLASS()
+class EROEOREOREOR_API UCombatReplicationGraphNode_OwnerRelevant : public UReplicationGraphNode
+{
+	GENERATED_BODY()
+
+public:
+	virtual void NotifyAddNetworkActor(const FNewReplicatedActorInfo& ActorInfo) override {}
+	virtual bool NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound = true) override { return false; }
+	virtual void NotifyResetAllNetworkActors() override {}
+
+	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override;
+
+private:
+	FActorRepListRefView ReplicationActorList;
+};
+
+/**
+ * Combat arena replication graph
+ * Replaces per-connection relevancy (every actor tested against every connection each net tick) with a 2D grid:
+ * a connection only considers the actors bucketed in the cells around its viewers. Characters and any future
+ * projectile/AoE actors are dynamic grid actors; ATargetDummy is dormant until its health changes, so idle
+ * dummies cost nothing per tick. PlayerStates and always-relevant infos are shared lists gathered once.
+ *
+ * Combat.RepGraph.Enable picks the graph when a game net driver is created - 0 falls back to the default
+ * relevancy path for A/B runs (stat Net, Net.RepGraph.PrintGraph).
+ */
+UCLASS(Transient)
+class EROEOREOREOR_API UCombatReplicationGraph : public UReplicationGraph
+{
+	GENERATED_BODY()
+
+public:
+	// Bound to UReplicationDriver::CreateReplicationDriverDelegate by the game module
+	static UReplicationDriver* CreateReplicationDriver(UNetDriver* ForNetDriver, const FURL& URL, UWorld* World);
+
+	virtual void InitGlobalActorClassSettings() override;
+	virtual void InitGlobalGraphNodes() override;
+	virtual void InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection) override;
+	virtual void RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo) override;
+	virtual void RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo) override;
+
+	UPROPERTY()
+	TObjectPtr<UReplicationGraphNode_GridSpatialization2D> GridNode;
+
+	UPROPERTY()
+	TObjectPtr<UReplicationGraphNode_ActorList> AlwaysRelevantNode;
+
+	UPROPERTY()
+	TObjectPtr<UReplicationGraphNode_ActorList> PlayerStateNode;
+
+private:
+	ECombatRepNodeMapping GetMappingPolicy(UClass* Class);
+	void InitClassReplicationInfo(UClass* Class, ECombatRepNodeMapping Mapping);
+
+	TClassMap<ECombatRepNodeMapping> ClassRepNodePolicies;
+};
@@ -0,0 +1,256 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CombatSignificance.h"
+#include "AoEPrototypeComponent.h"
+#include "AttackShapeComponent.h"
+#include "CombatLog.h"
+#include "CombatMemory.h"
+#include "CombatStateMachineComponent.h"
+#include "CombatStats.h"
+#include "SignificanceManager.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<bool> CVarCombatLodEnable(
+	TEXT("Combat.Lod.Enable"),
+	true,
+	TEXT("Assign combat LOD tiers through the significance manager. 0 keeps every fighter at Full."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarCombatLodAlwaysFullDistance(
+	TEXT("Combat.Lod.AlwaysFullDistance"),
+	600.0f,
+	TEXT("Fighters within this distance of a player view point are Full whether in view or not, in cm."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarCombatLodFullDistance(
+	TEXT("Combat.Lod.FullDistance"),
+	2500.0f,
+	TEXT("Fighters in view within this distance of a player view point are Full, in cm."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarCombatLodReducedDistance(
+	TEXT("Combat.Lod.ReducedDistance"),
+	6000.0f,
+	TEXT("Fighters in view within this distance of a player view point are Reduced, beyond it Minimal, in cm."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarCombatLodHysteresis(
+	TEXT("Combat.Lod.Hysteresis"),
+	0.1f,
+	TEXT("Fraction a fighter must move past a distance threshold before it drops to the lower tier."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarCombatLodViewCone(
+	TEXT("Combat.Lod.ViewConeDegrees"),
+	100.0f,
+	TEXT("Full angle of the cone around a view direction that counts as in view."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarCombatLodReducedStride(
+	TEXT("Combat.Lod.ReducedStride"),
+	2,
+	TEXT("Frames of hit work a Reduced fighter tests together."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarCombatLodMinimalStride(
+	TEXT("Combat.Lod.MinimalStride"),
+	4,
+	TEXT("Frames of hit work a Minimal fighter tests together."),
+	ECVF_Default);
+
+namespace CombatSignificance
+{
+	static const FName FighterTag(TEXT("CombatFighter"));
+
+	// Longest stride a CVar may ask for - the hit error grows with the frames a batched test covers
+	static constexpr int32 MAX_FRAME_STRIDE = 8;
+
+	// Significance is the tier itself, highest first - Full is Count - 1
+	static float ToSignificance(ECombatLod Lod)
+	{
+		return static_cast<float>(static_cast<int32>(ECombatLod::Count) - 1 - static_cast<int32>(Lod));
+	}
+
+	static ECombatLod ToLod(float Significance)
+	{
+		const int32 Top = static_cast<int32>(ECombatLod::Count) - 1;
+		return static_cast<ECombatLod>(Top - FMath::Clamp(FMath::FloorToInt(Significance), 0, Top));
+	}
+}
+
+UCombatSignificanceSubsystem* UCombatSignificanceSubsystem::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UCombatSignificanceSubsystem>() : nullptr;
+}
+
+bool UCombatSignificanceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UCombatSignificanceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UCombatSignificanceSubsystem, STATGROUP_Tickables);
+}
+
+int32 UCombatSignificanceSubsystem::GetFrameStride(ECombatLod Lod)
+{
+	switch (Lod)
+	{
+		case ECombatLod::Reduced:
+			return FMath::Clamp(CVarCombatLodReducedStride.GetValueOnGameThread(), 1, CombatSignificance::MAX_FRAME_STRIDE);
+		case ECombatLod::Minimal:
+			return FMath::Clamp(CVarCombatLodMinimalStride.GetValueOnGameThread(), 1, CombatSignificance::MAX_FRAME_STRIDE);
+		default:
+			return 1;
+	}
+}
+
+void UCombatSignificanceSubsystem::RegisterFighter(AActor* Fighter)
+{
+	LLM_SCOPE_BYTAG(Combat_Runtime);
+
+	USignificanceManager* SignificanceManager = USignificanceManager::Get(GetWorld());
+	if (!SignificanceManager || !Fighter)
+	{
+		return;
+	}
+
+	RefreshSettings();
+
+	auto Significance = [this](USignificanceManager::FManagedObjectInfo* ObjectInfo, const FTransform& Viewpoint)
+	{
+		return CalculateSignificance(*CastChecked<AActor>(ObjectInfo->GetObject()), CombatSignificance::ToLod(ObjectInfo->GetSignificance()), Viewpoint);
+	};
+
+	auto PostSignificance = [](USignificanceManager::FManagedObjectInfo* ObjectInfo, float OldSignificance, float NewSignificance, bool bFinal)
+	{
+		const ECombatLod Lod = CombatSignificance::ToLod(NewSignificance);
+		if (!bFinal && Lod != CombatSignificance::ToLod(OldSignificance))
+		{
+			ApplyLod(CastChecked<AActor>(ObjectInfo->GetObject()), Lod);
+		}
+	};
+
+	SignificanceManager->RegisterObject(Fighter, CombatSignificance::FighterTag, Significance,
+		USignificanceManager::EPostSignificanceType::Sequential, PostSignificance);
+
+	// Components start at Full - settle the tier the first evaluation gave, whatever it was compared against
+	ApplyLod(Fighter, CombatSignificance::ToLod(SignificanceManager->GetSignificance(Fighter)));
+}
+
+void UCombatSignificanceSubsystem::UnregisterFighter(AActor* Fighter)
+{
+	if (USignificanceManager* SignificanceManager = USignificanceManager::Get(GetWorld()))
+	{
+		SignificanceManager->UnregisterObject(Fighter);
+	}
+}
+
+void UCombatSignificanceSubsystem::Tick(float DeltaTime)
+{
+	COMBAT_SCOPE(SignificanceUpdate);
+	LLM_SCOPE_BYTAG(Combat_Runtime);
+
+	USignificanceManager* SignificanceManager = USignificanceManager::Get(GetWorld());
+	if (!SignificanceManager)
+	{
+		return;
+	}
+
+	RefreshSettings();
+
+	// Server-side controllers of remote players report their replicated view point, so remote players count on a server
+	Viewpoints.Reset();
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		if (const APlayerController* PlayerController = It->Get())
+		{
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			Viewpoints.Emplace(ViewRotation, ViewLocation);
+		}
+	}
+
+	SignificanceManager->Update(Viewpoints);
+
+#if !UE_BUILD_SHIPPING
+	for (const USignificanceManager::FManagedObjectInfo* ObjectInfo : SignificanceManager->GetManagedObjects(CombatSignificance::FighterTag))
+	{
+		const ECombatLod Lod = CombatSignificance::ToLod(ObjectInfo->GetSignificance());
+		COMBAT_GAUGE_ADD(static_cast<ECombatGauge>(static_cast<int32>(ECombatGauge::LodFull) + static_cast<int32>(Lod)), 1);
+	}
+#endif
+}
+
+void UCombatSignificanceSubsystem::RefreshSettings()
+{
+	Settings.bEnabled = CVarCombatLodEnable.GetValueOnGameThread();
+	Settings.AlwaysFullDistance = CVarCombatLodAlwaysFullDistance.GetValueOnGameThread();
+	Settings.FullDistance = CVarCombatLodFullDistance.GetValueOnGameThread();
+	Settings.ReducedDistance = CVarCombatLodReducedDistance.GetValueOnGameThread();
+	Settings.Hysteresis = FMath::Max(CVarCombatLodHysteresis.GetValueOnGameThread(), 0.0f);
+	Settings.CosHalfViewCone = FMath::Cos(FMath::DegreesToRadians(CVarCombatLodViewCone.GetValueOnGameThread() * 0.5f));
+}
+
+float UCombatSignificanceSubsystem::CalculateSignificance(const AActor& Fighter, ECombatLod CurrentLod, const FTransform& Viewpoint) const
+{
+	// Read-only - runs off the game thread
+	const APawn* Pawn = Cast<APawn>(&Fighter);
+	if (!Settings.bEnabled || (Pawn && Pawn->IsPlayerControlled()))
+	{
+		return CombatSignificance::ToSignificance(ECombatLod::Full);
+	}
+
+	const FVector ToFighter = Fighter.GetActorLocation() - Viewpoint.GetLocation();
+	const float DistanceSq = ToFighter.SizeSquared();
+
+	// A fighter keeps its tier until it is past the threshold by the hysteresis margin - no flapping on a boundary
+	auto IsWithin = [&](float Distance, ECombatLod Tier)
+	{
+		const float Threshold = CurrentLod <= Tier ? Distance * (1.0f + Settings.Hysteresis) : Distance;
+		return DistanceSq <= FMath::Square(Threshold);
+	};
+
+	if (IsWithin(Settings.AlwaysFullDistance, ECombatLod::Full))
+	{
+		return CombatSignificance::ToSignificance(ECombatLod::Full);
+	}
+
+	int32 Tier = IsWithin(Settings.FullDistance, ECombatLod::Full) ? 0 : IsWithin(Settings.ReducedDistance, ECombatLod::Reduced) ? 1 : 2;
+
+	// Off-screen fighters drop one tier
+	if (FVector::DotProduct(ToFighter.GetSafeNormal(), Viewpoint.GetRotation().GetForwardVector()) < Settings.CosHalfViewCone)
+	{
+		Tier = FMath::Min(Tier + 1, static_cast<int32>(ECombatLod::Count) - 1);
+	}
+
+	return CombatSignificance::ToSignificance(static_cast<ECombatLod>(Tier));
+}
+
+void UCombatSignificanceSubsystem::ApplyLod(AActor* Fighter, ECombatLod Lod)
+{
+	if (!Fighter)
+	{
+		return;
+	}
+
+	if (UCombatStateMachineComponent* StateMachine = Fighter->FindComponentByClass<UCombatStateMachineComponent>())
+	{
+		StateMachine->SetCombatLod(Lod);
+	}
+	if (UAttackShapeComponent* AttackShapes = Fighter->FindComponentByClass<UAttackShapeComponent>())
+	{
+		AttackShapes->SetCombatLod(Lod);
+	}
+	if (UAoEPrototypeComponent* AoEs = Fighter->FindComponentByClass<UAoEPrototypeComponent>())
+	{
+		AoEs->SetCombatLod(Lod);
+	}
+
+	UE_LOG(LogCombat, VeryVerbose, TEXT("CombatSignificance: %s -> LOD %d"), *Fighter->GetName(), static_cast<int32>(Lod));
+}
@@ -0,0 +1,71 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CombatSignificance.generated.h"
+
+// Combat work tier of one fighter, most significant first
+enum class ECombatLod : uint8
+{
+	Full,		// Player pawns, fighters near a player or close and in view - everything at full rate
+	Reduced,	// Mid-range, or close but off-screen - hit tests batched over Combat.Lod.ReducedStride frames, no debug feedback
+	Minimal,	// Far, or mid-range and off-screen - Combat.Lod.MinimalStride frames
+	Count
+};
+
+/**
+ * Combat LOD through the engine significance manager
+ * Fighters (AMyCharacter) register on BeginPlay. Once per frame the player view points - every player controller,
+ * so remote players count on a server - are handed to USignificanceManager::Update, and a fighter's significance
+ * is its tier: distance to the nearest view point, one tier lower outside the view cone, always Full for player
+ * pawns and within Combat.Lod.AlwaysFullDistance. A tier change is pushed to the fighter's combat components.
+ *
+ * Lower tiers run the same work less often: attack frames and AoE ticks are owed and tested together like budget
+ * deferrals (CombatWorkScheduler.h), and the state machine catches up its fixed steps. The batched test runs once at
+ * the current poses, so hits are approximate - a victim that only crossed a shape during the owed frames is missed,
+ * one that stepped in just before the test is hit up to stride - 1 frames early. Multi-hit shapes cap the stride at
+ * their interval. Combat.Bench.Lod measures the resulting Hits and DamageSpecs delta against Combat.Lod.Enable 0,
+ * which keeps every fighter Full - the strides are tuned against that tolerance. Movement history is recorded at
+ * every tier: NPC attacks and wide AoEs still reach distant fighters, and hit claim validation rewinds attackers.
+ */
+UCLASS()
+class EROEOREOREOR_API UCombatSignificanceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UCombatSignificanceSubsystem* Get(const UWorld* World);
+
+	void RegisterFighter(AActor* Fighter);
+	void UnregisterFighter(AActor* Fighter);
+
+	// Frames of hit work a tier tests together - 1 at Full
+	static int32 GetFrameStride(ECombatLod Lod);
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	// CVars sampled once per update - the significance manager evaluates fighters in parallel
+	struct FLodSettings
+	{
+		bool bEnabled = true;
+		float AlwaysFullDistance = 0.0f;
+		float FullDistance = 0.0f;
+		float ReducedDistance = 0.0f;
+		float Hysteresis = 0.0f;
+		float CosHalfViewCone = 0.0f;
+	};
+
+	FLodSettings Settings;
+	TArray<FTransform, TInlineAllocator<4>> Viewpoints;
+
+	void RefreshSettings();
+	float CalculateSignificance(const AActor& Fighter, ECombatLod CurrentLod, const FTransform& Viewpoint) const;
+	static void ApplyLod(AActor* Fighter, ECombatLod Lod);
+};
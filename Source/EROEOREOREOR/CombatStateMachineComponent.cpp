@@ -1,16 +1,49 @@
 #include "CombatStateMachineComponent.h"
 #include "CombatPrototypeComponent.h"
 #include "AoEPrototypeComponent.h"
+#include "CombatStats.h"
+#include "CombatLog.h"
+#include "CombatMemory.h"
 #include "MyCharacter.h"
 #include "Engine/Engine.h"
 #include "Engine/World.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerState.h"
+#include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
 #include "DrawDebugHelpers.h"
+#include "HAL/PlatformTime.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+CSV_DEFINE_CATEGORY(CombatNet, true);
+
+namespace CombatActionStream
+{
+    // State machines in networked worlds - the per-fighter stat divides the frame's record bytes by it
+    static int32 NumStreamingFighters = 0;
+    
+    // Payload only - RPC headers depend on the net driver and are the same for every record.
+    // csvprofile start, then read CombatNet/ActionRecordBytesPerFighter per frame.
+    static void CountRecordSent()
+    {
+#if CSV_PROFILER
+        constexpr float RecordBytes = FCombatActionRecord::NET_BITS / 8.0f;
+        CSV_CUSTOM_STAT(CombatNet, ActionRecords, 1, ECsvCustomStatOp::Accumulate);
+        CSV_CUSTOM_STAT(CombatNet, ActionRecordBytes, RecordBytes, ECsvCustomStatOp::Accumulate);
+        CSV_CUSTOM_STAT(CombatNet, ActionRecordBytesPerFighter, RecordBytes / FMath::Max(NumStreamingFighters, 1), ECsvCustomStatOp::Accumulate);
+#endif
+    }
+}
 
 UCombatStateMachineComponent::UCombatStateMachineComponent()
 {
     PrimaryComponentTick.bCanEverTick = true;
     PrimaryComponentTick.bStartWithTickEnabled = true;
     
+    // Action events only - see FCombatActionRecord
+    SetIsReplicatedByDefault(true);
+    
     // Initialize frame timing
     FrameDuration = 1.0f / TargetFrameRate;
     FrameTimer = 0.0f;
@@ -32,6 +65,18 @@ void UCombatStateMachineComponent::BeginPlay()
     // Cache component references
     FindComponentReferences();
     
+    if (GetNetMode() != NM_Standalone)
+    {
+        bStreamingActionRecords = true;
+        ++CombatActionStream::NumStreamingFighters;
+    }
+    
+    // Input clock starts at step 0 now - TargetFrameRate may have been edited after construction.
+    // Inputs are stamped with FPlatformTime::Seconds(), so the clock is anchored on the same timeline.
+    FrameDuration = 1.0f / TargetFrameRate;
+    InputClock.SetFrameRate(TargetFrameRate);
+    InputClock.Anchor(CombatStep, FPlatformTime::Seconds());
+    
     // Auto-load data tables
     if (bAutoLoadDefaultTables)
     {
@@ -46,17 +91,45 @@ void UCombatStateMachineComponent::BeginPlay()
         }
     }
     
-    UE_LOG(LogTemp, Log, TEXT("CombatStateMachineComponent initialized for %s"), 
+    UE_LOG(LogCombat, Verbose, TEXT("CombatStateMachineComponent initialized for %s"), 
            GetOwner() ? *GetOwner()->GetName() : TEXT("NULL"));
 }
 
+void UCombatStateMachineComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (bStreamingActionRecords)
+    {
+        bStreamingActionRecords = false;
+        --CombatActionStream::NumStreamingFighters;
+    }
+    
+    Super::EndPlay(EndPlayReason);
+}
+
+void UCombatStateMachineComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+    Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+    
+    // Push model - only PublishActionRecord dirties it
+    FDoRepLifetimeParams Params;
+    Params.bIsPushBased = true;
+    Params.Condition = COND_InitialOnly;
+    DOREPLIFETIME_WITH_PARAMS_FAST(UCombatStateMachineComponent, LastActionRecord, Params);
+}
+
 void UCombatStateMachineComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
+    COMBAT_SCOPE(StateMachineTick);
+    LLM_SCOPE_BYTAG(Combat_Runtime);
+    
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
     
     // Update frame-accurate timing
     UpdateFrameTimer(DeltaTime);
     
+    // Re-anchor the input clock on the last fixed step - FrameTimer is the time elapsed since it
+    InputClock.Anchor(CombatStep, FPlatformTime::Seconds() - FrameTimer);
+    
     // Update combo system
     UpdateComboSystem(DeltaTime);
     
@@ -64,12 +137,21 @@ void UCombatStateMachineComponent::TickComponent(float DeltaTime, ELevelTick Tic
     ProcessInputBuffer();
     
     // Debug visualization
-    if (bDebugVisualization)
+    if (bDebugVisualization && CombatLod == ECombatLod::Full)
     {
         DrawDebugInfo();
     }
 }
 
+void UCombatStateMachineComponent::SetCombatLod(ECombatLod Lod)
+{
+    CombatLod = Lod;
+    
+    // UpdateFrameTimer runs every fixed step the interval covered, so transitions land at most stride - 1 steps late
+    const int32 Stride = UCombatSignificanceSubsystem::GetFrameStride(Lod);
+    SetComponentTickInterval(Stride > 1 ? (Stride - 0.5f) * FrameDuration : 0.0f);
+}
+
 bool UCombatStateMachineComponent::TryStartAction(const FGameplayTag& ActionTag)
 {
     // Check if action is available
@@ -105,6 +187,7 @@ void UCombatStateMachineComponent::ForceEndAction(bool bWasCanceled)
     if (CurrentState != ECombatState::Idle)
     {
         EndCurrentAction(bWasCanceled);
+        SendActionRecord(FCombatActionRecord::END_ACTION, bWasCanceled ? FCombatActionRecord::FLAG_CANCELED : 0);
     }
 }
 
@@ -180,21 +263,31 @@ float UCombatStateMachineComponent::GetCurrentPhaseProgress() const
 
 void UCombatStateMachineComponent::BufferInput(const FGameplayTag& ActionTag)
 {
+    BufferTimestampedInput(ActionTag, FPlatformTime::Seconds());
+}
+
+void UCombatStateMachineComponent::BufferTimestampedInput(const FGameplayTag& ActionTag, double PlatformTime)
+{
+    LLM_SCOPE_BYTAG(Combat_Runtime);
+    
     if (!ActionTag.IsValid())
     {
         return;
     }
     
-    float CurrentTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
-    
-    // Add to buffer
-    InputBuffer.Add(ActionTag);
-    InputTimestamps.Add(CurrentTime);
+    FCombatInputEvent Event;
+    Event.ActionTag = ActionTag;
+    Event.PlatformTime = PlatformTime;
+    InputClock.ToCombatFrame(PlatformTime, Event.CombatFrame, Event.SubFrameOffset);
     
-    // Clean up old inputs
-    CleanupOldInputs();
+    if (!PendingInputs.Push(Event))
+    {
+        UE_LOG(LogCombat, Warning, TEXT("Combat input queue full - dropped %s"), *ActionTag.ToString());
+        return;
+    }
     
-    UE_LOG(LogTemp, VeryVerbose, TEXT("Buffered input: %s"), *ActionTag.ToString());
+    UE_LOG(LogCombat, VeryVerbose, TEXT("Queued input: %s (frame %lld + %.2f)"), 
+           *ActionTag.ToString(), Event.CombatFrame, Event.SubFrameOffset);
 }
 
 void UCombatStateMachineComponent::ClearInputBuffer()
@@ -222,13 +315,16 @@ void UCombatStateMachineComponent::ResetCombo()
 
 void UCombatStateMachineComponent::LoadActionData(UDataTable* ActionDataTable)
 {
+    LLM_SCOPE_BYTAG(Combat_Data);
+    
     if (!ActionDataTable)
     {
-        UE_LOG(LogTemp, Warning, TEXT("Cannot load null action data table"));
+        UE_LOG(LogCombat, Warning, TEXT("Cannot load null action data table"));
         return;
     }
     
     LoadedActions.Empty();
+    ActionIndexTags.Reset();
     
     TArray<FCombatActionData*> AllRows;
     ActionDataTable->GetAllRows<FCombatActionData>(TEXT("LoadActionData"), AllRows);
@@ -238,17 +334,26 @@ void UCombatStateMachineComponent::LoadActionData(UDataTable* ActionDataTable)
         if (Row && Row->ActionTag.IsValid())
         {
             LoadedActions.Add(Row->ActionTag, *Row);
+            ActionIndexTags.AddUnique(Row->ActionTag);
         }
     }
     
-    UE_LOG(LogTemp, Log, TEXT("Loaded %d combat actions"), LoadedActions.Num());
+    if (ActionIndexTags.Num() > FCombatActionRecord::END_ACTION)
+    {
+        UE_LOG(LogCombat, Warning, TEXT("%s has %d actions - only the first %d replicate"), 
+               *ActionDataTable->GetName(), ActionIndexTags.Num(), FCombatActionRecord::END_ACTION);
+    }
+    
+    UE_LOG(LogCombat, Log, TEXT("Loaded %d combat actions"), LoadedActions.Num());
 }
 
 void UCombatStateMachineComponent::LoadHiddenComboData(UDataTable* HiddenComboDataTable)
 {
+    LLM_SCOPE_BYTAG(Combat_Data);
+    
     if (!HiddenComboDataTable)
     {
-        UE_LOG(LogTemp, Warning, TEXT("Cannot load null hidden combo data table"));
+        UE_LOG(LogCombat, Warning, TEXT("Cannot load null hidden combo data table"));
         return;
     }
     
@@ -265,7 +370,7 @@ void UCombatStateMachineComponent::LoadHiddenComboData(UDataTable* HiddenComboDa
         }
     }
     
-    UE_LOG(LogTemp, Log, TEXT("Loaded %d hidden combos"), LoadedHiddenCombos.Num());
+    UE_LOG(LogCombat, Log, TEXT("Loaded %d hidden combos"), LoadedHiddenCombos.Num());
 }
 
 FCombatActionData UCombatStateMachineComponent::GetActionData(const FGameplayTag& ActionTag) const
@@ -372,7 +477,7 @@ TArray<FString> UCombatStateMachineComponent::GetAvailableHiddenCombos() const
 
 void UCombatStateMachineComponent::TestAction(const FGameplayTag& ActionTag)
 {
-    UE_LOG(LogTemp, Warning, TEXT("Testing action: %s"), *ActionTag.ToString());
+    UE_LOG(LogCombat, Warning, TEXT("Testing action: %s"), *ActionTag.ToString());
     TryStartAction(ActionTag);
 }
 
@@ -383,6 +488,8 @@ void UCombatStateMachineComponent::SetDebugVisualization(bool bEnabled)
 
 FString UCombatStateMachineComponent::GetDebugStateInfo() const
 {
+    LLM_SCOPE_BYTAG(Combat_Debug);
+    
     const FCombatActionData* ActionData = GetCurrentActionData();
     return FString::Printf(TEXT("State: %d, Frame: %d, Action: %s, ComboCount: %d"), 
                           static_cast<int32>(CurrentState), 
@@ -393,7 +500,7 @@ FString UCombatStateMachineComponent::GetDebugStateInfo() const
 
 void UCombatStateMachineComponent::PrintCurrentState()
 {
-    UE_LOG(LogTemp, Warning, TEXT("Combat State: %s"), *GetDebugStateInfo());
+    UE_LOG(LogCombat, Warning, TEXT("Combat State: %s"), *GetDebugStateInfo());
 }
 
 // Private Methods
@@ -408,6 +515,10 @@ void UCombatStateMachineComponent::UpdateFrameTimer(float DeltaTime)
     {
         FrameTimer -= FrameDuration;
         CurrentFrame++;
+        CombatStep++;
+        
+        // Catch-up steps take the inputs that landed by them, the last step of the tick takes every input polled so far
+        DrainPendingInputs(FrameTimer < FrameDuration ? MAX_int64 : CombatStep);
         ProcessFrame();
     }
 }
@@ -480,6 +591,17 @@ void UCombatStateMachineComponent::SetState(ECombatState NewState)
         CurrentFrame = 0;
     }
     
+    // Input latency ends on the first Active frame - actions that never get there are not sampled
+    if (NewState == ECombatState::Active && PendingLatencyInputTime >= 0.0)
+    {
+        FCombatInputLatencyHistogram::GetAttackHistogram().Record((GetCombatTime() - PendingLatencyInputTime) * 1000.0);
+        PendingLatencyInputTime = -1.0;
+    }
+    else if (NewState == ECombatState::Idle)
+    {
+        PendingLatencyInputTime = -1.0;
+    }
+    
     // Broadcast state change
     OnStateChanged.Broadcast(OldState, NewState, CurrentActionTag);
     
@@ -491,13 +613,13 @@ void UCombatStateMachineComponent::SetState(ECombatState NewState)
 
 void UCombatStateMachineComponent::ProcessInputBuffer()
 {
+    COMBAT_SCOPE(ProcessInputBuffer);
+    
     if (InputBuffer.Num() == 0)
     {
         return;
     }
     
-    float CurrentTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
-    
     // Try to execute the most recent valid input
     for (int32 i = InputBuffer.Num() - 1; i >= 0; --i)
     {
@@ -506,8 +628,11 @@ void UCombatStateMachineComponent::ProcessInputBuffer()
         if (CanStartAction(BufferedAction))
         {
             // Execute this action
+            const double InputTime = InputTimestamps[i];
             if (ExecuteAction(BufferedAction))
             {
+                PendingLatencyInputTime = InputTime;
+                
                 // Success - clear buffer
                 ClearInputBuffer();
                 return;
@@ -516,14 +641,26 @@ void UCombatStateMachineComponent::ProcessInputBuffer()
     }
 }
 
-void UCombatStateMachineComponent::CleanupOldInputs()
+void UCombatStateMachineComponent::DrainPendingInputs(int64 LastFrame)
 {
-    if (!GetWorld())
+    while (const FCombatInputEvent* Event = PendingInputs.Peek())
     {
-        return;
+        if (Event->CombatFrame > LastFrame)
+        {
+            break;
+        }
+        
+        InputBuffer.Add(Event->ActionTag);
+        InputTimestamps.Add(Event->GetFrameTime() * FrameDuration);
+        PendingInputs.Pop();
     }
     
-    float CurrentTime = GetWorld()->GetTimeSeconds();
+    CleanupOldInputs();
+}
+
+void UCombatStateMachineComponent::CleanupOldInputs()
+{
+    const double CurrentTime = GetCombatTime();
     
     // Remove inputs older than buffer window
     for (int32 i = InputBuffer.Num() - 1; i >= 0; --i)
@@ -541,7 +678,7 @@ bool UCombatStateMachineComponent::ExecuteAction(const FGameplayTag& ActionTag)
     const FCombatActionData* ActionData = LoadedActions.Find(ActionTag);
     if (!ActionData)
     {
-        UE_LOG(LogTemp, Warning, TEXT("Action data not found for tag: %s"), *ActionTag.ToString());
+        UE_LOG(LogCombat, Warning, TEXT("Action data not found for tag: %s"), *ActionTag.ToString());
         return false;
     }
     
@@ -577,7 +714,14 @@ void UCombatStateMachineComponent::StartAction(const FCombatActionData& ActionDa
     // Broadcast action started
     OnActionStarted.Broadcast(ActionData.ActionTag, ActionData);
     
-    UE_LOG(LogTemp, Log, TEXT("Started combat action: %s (Startup: %df, Active: %df, Recovery: %df)"), 
+    const int32 ActionIndex = ActionIndexTags.IndexOfByKey(ActionData.ActionTag);
+    if (ActionIndex >= 0 && ActionIndex < FCombatActionRecord::END_ACTION)
+    {
+        SendActionRecord(static_cast<uint8>(ActionIndex), PendingRecordFlags);
+    }
+    PendingRecordFlags = 0;
+    
+    UE_LOG(LogCombat, Verbose, TEXT("Started combat action: %s (Startup: %df, Active: %df, Recovery: %df)"), 
            *ActionData.DisplayName, ActionData.StartupFrames, ActionData.ActiveFrames, ActionData.RecoveryFrames);
 }
 
@@ -602,7 +746,7 @@ void UCombatStateMachineComponent::EndCurrentAction(bool bWasCanceled)
     // Broadcast action ended
     OnActionEnded.Broadcast(EndingActionTag, bWasCanceled);
     
-    UE_LOG(LogTemp, Log, TEXT("Ended combat action: %s (Canceled: %s)"), 
+    UE_LOG(LogCombat, Verbose, TEXT("Ended combat action: %s (Canceled: %s)"), 
            *EndingActionTag.ToString(), bWasCanceled ? TEXT("Yes") : TEXT("No"));
 }
 
@@ -624,11 +768,18 @@ bool UCombatStateMachineComponent::ProcessCancel(const FGameplayTag& NewActionTa
         HandlePerfectCancel(NewActionTag);
     }
     
-    // End current action as canceled
+    // End current action as canceled - the new action's record carries the cancel
+    PendingRecordFlags = FCombatActionRecord::FLAG_CANCELED | (bIsPerfectCancel ? FCombatActionRecord::FLAG_PERFECT_CANCEL : 0);
     EndCurrentAction(true);
     
     // Start new action
-    return ExecuteAction(NewActionTag);
+    if (!ExecuteAction(NewActionTag))
+    {
+        SendActionRecord(FCombatActionRecord::END_ACTION, PendingRecordFlags);
+        PendingRecordFlags = 0;
+        return false;
+    }
+    return true;
 }
 
 bool UCombatStateMachineComponent::IsPerfectCancel(const FCombatActionData& FromAction, const FCombatActionData& ToAction) const
@@ -646,7 +797,7 @@ void UCombatStateMachineComponent::HandlePerfectCancel(const FGameplayTag& Cance
     // Broadcast perfect cancel event
     OnPerfectCancel.Broadcast(CanceledInto);
     
-    UE_LOG(LogTemp, Log, TEXT("Perfect Cancel executed into: %s"), *CanceledInto.ToString());
+    UE_LOG(LogCombat, Verbose, TEXT("Perfect Cancel executed into: %s"), *CanceledInto.ToString());
 }
 
 void UCombatStateMachineComponent::UpdateComboSystem(float DeltaTime)
@@ -659,6 +810,8 @@ void UCombatStateMachineComponent::UpdateComboSystem(float DeltaTime)
 
 void UCombatStateMachineComponent::AddToCombo(const FGameplayTag& ActionTag)
 {
+    LLM_SCOPE_BYTAG(Combat_Runtime);
+    
     // Reset combo timer
     TimeSinceLastAction = 0.0f;
     
@@ -679,7 +832,7 @@ void UCombatStateMachineComponent::CheckComboReset()
 {
     if (TimeSinceLastAction >= ComboResetTime && CurrentComboChain.Num() > 0)
     {
-        UE_LOG(LogTemp, Log, TEXT("Combo reset - final count: %d"), GetComboCount());
+        UE_LOG(LogCombat, Verbose, TEXT("Combo reset - final count: %d"), GetComboCount());
         ResetCombo();
     }
 }
@@ -707,7 +860,7 @@ bool UCombatStateMachineComponent::MatchesHiddenComboSequence(const TArray<FGame
 
 void UCombatStateMachineComponent::ExecuteHiddenCombo(const FHiddenComboData& ComboData)
 {
-    UE_LOG(LogTemp, Log, TEXT("Hidden combo executed: %s"), *ComboData.ComboName);
+    UE_LOG(LogCombat, Verbose, TEXT("Hidden combo executed: %s"), *ComboData.ComboName);
     
     // Trigger special effects
     if (ComboData.SpecialEffectTag.IsValid())
@@ -731,6 +884,13 @@ void UCombatStateMachineComponent::FindComponentReferences()
 
 void UCombatStateMachineComponent::NotifyComponentsActionStarted(const FCombatActionData& ActionData)
 {
+    // Simulated proxies follow the record stream for presentation only - hit and AoE logic runs
+    // where the action was decided, and its results replicate from the server
+    if (GetOwnerRole() == ROLE_SimulatedProxy)
+    {
+        return;
+    }
+    
     // Integrate with existing CombatPrototypeComponent
     if (CombatPrototype && ActionData.bUseCombatPrototype)
     {
@@ -746,6 +906,12 @@ void UCombatStateMachineComponent::NotifyComponentsActionStarted(const FCombatAc
 
 void UCombatStateMachineComponent::NotifyComponentsActionEnded(const FGameplayTag& ActionTag, bool bWasCanceled)
 {
+    // Nothing was started on a simulated proxy
+    if (GetOwnerRole() == ROLE_SimulatedProxy)
+    {
+        return;
+    }
+    
     // Stop any ongoing combat prototype actions
     if (CombatPrototype)
     {
@@ -822,6 +988,8 @@ bool UCombatStateMachineComponent::ArePrerequisitesMet(const FCombatActionData&
 
 void UCombatStateMachineComponent::DrawDebugInfo()
 {
+    LLM_SCOPE_BYTAG(Combat_Debug);
+    
     if (!GetWorld() || !GetOwner())
     {
         return;
@@ -860,14 +1028,14 @@ void UCombatStateMachineComponent::DrawDebugInfo()
 
 void UCombatStateMachineComponent::LogStateTransition(ECombatState FromState, ECombatState ToState, const FGameplayTag& ActionTag)
 {
-    UE_LOG(LogTemp, Log, TEXT("Combat State: %d -> %d, Action: %s, Frame: %d"), 
+    UE_LOG(LogCombat, VeryVerbose, TEXT("Combat State: %d -> %d, Action: %s, Frame: %d"), 
            static_cast<int32>(FromState), static_cast<int32>(ToState), 
            *ActionTag.ToString(), CurrentFrame);
 }
 
 void UCombatStateMachineComponent::LogFrameInfo() const
 {
-    UE_LOG(LogTemp, VeryVerbose, TEXT("Frame: %d, State: %d, Progress: %.2f"), 
+    UE_LOG(LogCombat, VeryVerbose, TEXT("Frame: %d, State: %d, Progress: %.2f"), 
            CurrentFrame, static_cast<int32>(CurrentState), GetFrameProgress());
 }
 
@@ -882,13 +1050,297 @@ int32 UCombatStateMachineComponent::GetLoadedActionCount() const
     return LoadedActions.Num();
 }
 
-bool UCombatStateMachineComponent::CheckInputTiming(float InputTime) const
+bool UCombatStateMachineComponent::CheckInputTiming(double InputTime) const
+{
+    return (GetCombatTime() - InputTime) <= BufferWindowSeconds;
+}
+
+// REPLICATED ACTION STREAM
+
+bool FCombatActionRecord::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    Ar.SerializeBits(&ActionIndex, 8);
+    Ar.SerializeBits(&StartFrame, 16);
+    Ar.SerializeBits(&Flags, FLAG_BITS);
+    
+    if (Ar.IsLoading())
+    {
+        Flags &= (1 << FLAG_BITS) - 1;
+    }
+    
+    bOutSuccess = true;
+    return true;
+}
+
+uint16 UCombatStateMachineComponent::GetNetCombatFrame() const
+{
+    // Server world time is the one clock every machine agrees on - CombatStep starts at each component's BeginPlay
+    const UWorld* World = GetWorld();
+    const AGameStateBase* GameState = World ? World->GetGameState() : nullptr;
+    const double ServerSeconds = GameState ? GameState->GetServerWorldTimeSeconds() : (World ? World->GetTimeSeconds() : 0.0);
+    return static_cast<uint16>(static_cast<int64>(ServerSeconds * TargetFrameRate) & 0xFFFF);
+}
+
+void UCombatStateMachineComponent::SendActionRecord(uint8 ActionIndex, uint8 Flags)
+{
+    const AActor* Owner = GetOwner();
+    if (bApplyingActionRecord || !Owner || GetNetMode() == NM_Standalone)
+    {
+        return;
+    }
+    
+    FCombatActionRecord Record;
+    Record.ActionIndex = ActionIndex;
+    Record.StartFrame = GetNetCombatFrame();
+    Record.Flags = Flags;
+    
+    // Simulated proxies only follow the stream
+    if (Owner->HasAuthority())
+    {
+        PublishActionRecord(Record);
+    }
+    else if (Owner->GetLocalRole() == ROLE_AutonomousProxy)
+    {
+        ServerActionRecord(Record);
+        CombatActionStream::CountRecordSent();
+    }
+}
+
+void UCombatStateMachineComponent::PublishActionRecord(const FCombatActionRecord& Record)
 {
-    if (!GetWorld())
+    LastActionRecord = Record;
+    MARK_PROPERTY_DIRTY_FROM_NAME(UCombatStateMachineComponent, LastActionRecord, this);
+    MulticastActionRecord(Record);
+    CombatActionStream::CountRecordSent();
+}
+
+void UCombatStateMachineComponent::ServerActionRecord_Implementation(FCombatActionRecord Record)
+{
+    // The client's frame only says how long the record was in flight - never longer than the connection allows
+    const int32 Age = FMath::Clamp(GetRecordAge(Record), 0, GetMaxClientRecordAge());
+    
+    uint8 Flags = 0;
+    if (!ValidateActionRecord(Record, Age, Flags))
+    {
+        UE_LOG(LogCombat, Log, TEXT("%s: rejected action record %d (state %s, frame %d) - correcting the owner"), 
+               *GetNameSafe(GetOwner()), Record.ActionIndex, *UEnum::GetValueAsString(CurrentState), CurrentFrame);
+        ClientCorrectActionRecord(GetAuthoritativeActionRecord());
+        CombatActionStream::CountRecordSent();
+        return;
+    }
+    
+    TGuardValue<bool> ApplyingGuard(bApplyingActionRecord, true);
+    
+    FCombatActionRecord Accepted;
+    Accepted.ActionIndex = Record.ActionIndex;
+    Accepted.StartFrame = static_cast<uint16>(GetNetCombatFrame() - Age);
+    Accepted.Flags = Flags;
+    
+    if (Record.ActionIndex == FCombatActionRecord::END_ACTION)
+    {
+        EndCurrentAction((Flags & FCombatActionRecord::FLAG_CANCELED) != 0);
+    }
+    else
+    {
+        // Same order as ProcessCancel, with the flags the server worked out itself
+        const FCombatActionData& ActionData = LoadedActions.FindChecked(ActionIndexTags[Record.ActionIndex]);
+        if (Flags & FCombatActionRecord::FLAG_PERFECT_CANCEL)
+        {
+            HandlePerfectCancel(ActionData.ActionTag);
+        }
+        if (CurrentState != ECombatState::Idle)
+        {
+            EndCurrentAction(true);
+        }
+        StartAction(ActionData);
+        CatchUpActionRecord(ActionData, Age);
+    }
+    
+    PublishActionRecord(Accepted);
+}
+
+bool UCombatStateMachineComponent::ValidateActionRecord(const FCombatActionRecord& Record, int32 Age, uint8& OutFlags)
+{
+    OutFlags = 0;
+    
+    // The client decided Age frames ago - its cancel window may have closed on the server since
+    auto IsInWindowNowOrThen = [this, Age](TFunctionRef<bool()> Check)
+    {
+        if (Check())
+        {
+            return true;
+        }
+        TGuardValue<int32> RewoundFrame(CurrentFrame, FMath::Max(CurrentFrame - Age, 0));
+        return Check();
+    };
+    
+    if (Record.ActionIndex == FCombatActionRecord::END_ACTION)
+    {
+        // A bare end is a cancel whose follow-up failed its prerequisites - only valid where a cancel is
+        if (CurrentState == ECombatState::Idle)
+        {
+            return true;
+        }
+        OutFlags = Record.Flags & FCombatActionRecord::FLAG_CANCELED;
+        return IsInWindowNowOrThen([this]() { return IsInCancelWindow(); });
+    }
+    
+    if (!ActionIndexTags.IsValidIndex(Record.ActionIndex))
+    {
+        return false;
+    }
+    
+    const FGameplayTag& ActionTag = ActionIndexTags[Record.ActionIndex];
+    const FCombatActionData* ActionData = LoadedActions.Find(ActionTag);
+    if (!ActionData || !ArePrerequisitesMet(*ActionData))
     {
         return false;
     }
     
-    float CurrentTime = GetWorld()->GetTimeSeconds();
-    return (CurrentTime - InputTime) <= BufferWindowSeconds;
+    if (CurrentState == ECombatState::Idle)
+    {
+        return IsActionValid(ActionTag);
+    }
+    
+    // A cancel - same checks as TryCancel, and the perfect cancel is judged on the server's frames
+    const FCombatActionData* CurrentAction = GetCurrentActionData();
+    bool bPerfectCancel = false;
+    const bool bValid = CurrentAction && IsInWindowNowOrThen([this, &ActionTag, CurrentAction, ActionData, &bPerfectCancel]()
+    {
+        bPerfectCancel = IsPerfectCancel(*CurrentAction, *ActionData);
+        return IsInCancelWindow() && CanCancelCurrentAction(ActionTag);
+    });
+    
+    OutFlags = FCombatActionRecord::FLAG_CANCELED | (bPerfectCancel ? FCombatActionRecord::FLAG_PERFECT_CANCEL : 0);
+    return bValid;
+}
+
+FCombatActionRecord UCombatStateMachineComponent::GetAuthoritativeActionRecord() const
+{
+    // Every action the server starts is published, so the last record describes the current one
+    if (CurrentState != ECombatState::Idle)
+    {
+        return LastActionRecord;
+    }
+    
+    FCombatActionRecord Record;
+    Record.ActionIndex = FCombatActionRecord::END_ACTION;
+    Record.StartFrame = GetNetCombatFrame();
+    return Record;
+}
+
+int32 UCombatStateMachineComponent::GetRecordAge(const FCombatActionRecord& Record) const
+{
+    // The 16-bit frame wraps - negative ages are clock skew
+    return static_cast<int16>(static_cast<uint16>(GetNetCombatFrame() - Record.StartFrame));
+}
+
+int32 UCombatStateMachineComponent::GetMaxClientRecordAge() const
+{
+    const APawn* Pawn = Cast<APawn>(GetOwner());
+    const APlayerState* PlayerState = Pawn ? Pawn->GetPlayerState() : nullptr;
+    const float RoundTripMs = PlayerState ? PlayerState->GetPingInMilliseconds() : 0.0f;
+    return FMath::CeilToInt(RoundTripMs * 0.001f * TargetFrameRate) + FCombatActionRecord::AGE_SLACK_FRAMES;
+}
+
+void UCombatStateMachineComponent::ClientCorrectActionRecord_Implementation(FCombatActionRecord Record)
+{
+    UE_LOG(LogCombat, Verbose, TEXT("%s: server corrected action to record %d"), *GetNameSafe(GetOwner()), Record.ActionIndex);
+    ApplyActionRecord(Record);
+}
+
+void UCombatStateMachineComponent::MulticastActionRecord_Implementation(FCombatActionRecord Record)
+{
+    // The server and the owning client ran this action themselves
+    if (GetOwnerRole() == ROLE_SimulatedProxy)
+    {
+        ApplyActionRecord(Record);
+    }
+}
+
+void UCombatStateMachineComponent::OnRep_LastActionRecord()
+{
+    if (GetOwnerRole() == ROLE_SimulatedProxy)
+    {
+        ApplyActionRecord(LastActionRecord);
+    }
+}
+
+void UCombatStateMachineComponent::ApplyActionRecord(const FCombatActionRecord& Record)
+{
+    TGuardValue<bool> ApplyingGuard(bApplyingActionRecord, true);
+    
+    const bool bWasCanceled = (Record.Flags & FCombatActionRecord::FLAG_CANCELED) != 0;
+    if (Record.ActionIndex == FCombatActionRecord::END_ACTION)
+    {
+        ForceEndAction(bWasCanceled);
+        return;
+    }
+    
+    const FCombatActionData* ActionData = ActionIndexTags.IsValidIndex(Record.ActionIndex) ? LoadedActions.Find(ActionIndexTags[Record.ActionIndex]) : nullptr;
+    if (!ActionData)
+    {
+        UE_LOG(LogCombat, Warning, TEXT("%s: action record index %d is not in the loaded action table"), 
+               *GetNameSafe(GetOwner()), Record.ActionIndex);
+        return;
+    }
+    
+    // Same order as ProcessCancel on the sender
+    if (Record.Flags & FCombatActionRecord::FLAG_PERFECT_CANCEL)
+    {
+        HandlePerfectCancel(ActionData->ActionTag);
+    }
+    if (CurrentState != ECombatState::Idle)
+    {
+        EndCurrentAction(bWasCanceled);
+    }
+    StartAction(*ActionData);
+    
+    // Records applied here come from the server (proxies, corrections) - their frame is trusted as-is
+    CatchUpActionRecord(*ActionData, GetRecordAge(Record));
+}
+
+void UCombatStateMachineComponent::CatchUpActionRecord(const FCombatActionData& ActionData, int32 Age)
+{
+    // Catch up on the frames the record spent in flight
+    if (Age > 0)
+    {
+        CurrentFrame = FMath::Min(Age, ActionData.StartupFrames + ActionData.ActiveFrames + ActionData.RecoveryFrames);
+        for (int32 Phase = 0; Phase < 3 && CurrentState != ECombatState::Idle; ++Phase)
+        {
+            CheckForStateTransition();
+        }
+    }
+}
+
+// MEMORY ACCOUNTING
+
+static SIZE_T GetActionRowBytes(const FCombatActionData& Row)
+{
+    return Row.DisplayName.GetAllocatedSize() + Row.CanCancelInto.GetAllocatedSize() +
+        Row.CombatPrototypeName.GetAllocatedSize() + Row.AoEPrototypeName.GetAllocatedSize();
+}
+
+void UCombatStateMachineComponent::GetCombatMemoryUsage(FCombatMemoryUsage& OutUsage) const
+{
+    OutUsage.Add(ECombatMemoryCategory::Runtime, sizeof(*this) + InputBuffer.GetAllocatedSize() +
+        InputTimestamps.GetAllocatedSize() + CurrentComboChain.GetAllocatedSize() + ActionIndexTags.GetAllocatedSize());
+
+    OutUsage.AddTable(DefaultActionDataTable ? DefaultActionDataTable->GetFName() : FName(TEXT("LoadedActions")),
+        CombatMemory::GetMapBytes(LoadedActions, [](const FGameplayTag&, const FCombatActionData& Row)
+        {
+            return GetActionRowBytes(Row);
+        }));
+
+    OutUsage.AddTable(DefaultHiddenComboDataTable ? DefaultHiddenComboDataTable->GetFName() : FName(TEXT("LoadedHiddenCombos")),
+        CombatMemory::GetMapBytes(LoadedHiddenCombos, [](const FString& Key, const FHiddenComboData& Row)
+        {
+            return Key.GetAllocatedSize() + Row.RequiredSequence.GetAllocatedSize() + Row.ComboName.GetAllocatedSize();
+        }));
+}
+
+void UCombatStateMachineComponent::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+    Super::GetResourceSizeEx(CumulativeResourceSize);
+    AddHeapResourceSize(CumulativeResourceSize, sizeof(*this));
 }
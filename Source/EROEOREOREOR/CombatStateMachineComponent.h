@@ -5,6 +5,9 @@
 #include "Engine/DataTable.h"
 #include "GameplayTagContainer.h"
 #include "CombatSystemTypes.h"
+#include "CombatInputQueue.h"
+#include "CombatSignificance.h"
+#include "CombatMemory.h"
 #include "CombatStateMachineComponent.generated.h"
 
 // Forward declarations
@@ -19,8 +22,53 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPerfectCancel, const FGameplayTag
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnComboUpdated, int32, ComboCount, const TArray<FGameplayTag>&, ComboChain);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnHiddenComboExecuted, const FString&, ComboName);
 
+/**
+ * One replicated combat action event - 26 bits on the wire
+ * Everything else (phase, frame, combo chain, hidden combos) is rebuilt from the shared action table.
+ */
+USTRUCT()
+struct EROEOREOREOR_API FCombatActionRecord
+{
+    GENERATED_BODY()
+
+    // ActionIndex of a record that only ends the current action
+    static constexpr uint8 END_ACTION = 0xFF;
+
+    // Frames beyond the owner's round trip a client record may claim it is old - clock skew and frame quantization
+    static constexpr int32 AGE_SLACK_FRAMES = 4;
+
+    enum EFlags : uint8
+    {
+        FLAG_CANCELED = 1 << 0,         // The previous action ended as canceled
+        FLAG_PERFECT_CANCEL = 1 << 1,   // ...inside the perfect cancel window
+        FLAG_BITS = 2
+    };
+
+    // Bits NetSerialize writes per record - the payload the CombatNet CSV stats count
+    static constexpr int32 NET_BITS = 8 + 16 + FLAG_BITS;
+
+    // Dense index into the loaded action table (row order), END_ACTION for a bare end
+    uint8 ActionIndex = END_ACTION;
+
+    // Low 16 bits of the net combat frame the event happened on - server world time in combat frames
+    uint16 StartFrame = 0;
+
+    uint8 Flags = 0;
+
+    bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FCombatActionRecord> : public TStructOpsTypeTraitsBase2<FCombatActionRecord>
+{
+    enum
+    {
+        WithNetSerializer = true
+    };
+};
+
 UCLASS(ClassGroup=(Combat), meta=(BlueprintSpawnableComponent), BlueprintType, Blueprintable)
-class EROEOREOREOR_API UCombatStateMachineComponent : public UActorComponent
+class EROEOREOREOR_API UCombatStateMachineComponent : public UActorComponent, public ICombatMemoryReporter
 {
     GENERATED_BODY()
 
@@ -29,9 +77,19 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 public:
+    virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+    // Loaded action and hidden-combo rows (Data, per table) plus the input buffer and combo chain (Runtime)
+    virtual void GetCombatMemoryUsage(FCombatMemoryUsage& OutUsage) const override;
+    virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
+
+    // Set by UCombatSignificanceSubsystem - lower tiers tick every stride frames and catch up the fixed steps
+    void SetCombatLod(ECombatLod Lod);
+
     // Core State Management
     UFUNCTION(BlueprintCallable, Category = "Combat State Machine")
     bool TryStartAction(const FGameplayTag& ActionTag);
@@ -71,6 +129,9 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Input Buffer")
     void BufferInput(const FGameplayTag& ActionTag);
     
+    // PlatformTime is FPlatformTime::Seconds() when the input was polled - queued for the next fixed step
+    void BufferTimestampedInput(const FGameplayTag& ActionTag, double PlatformTime);
+    
     UFUNCTION(BlueprintPure, Category = "Input Buffer")
     bool HasBufferedInput() const { return InputBuffer.Num() > 0; }
     
@@ -205,8 +266,9 @@ protected:
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Input Buffer", meta = (AllowPrivateAccess = "true"))
     TArray<FGameplayTag> InputBuffer;
     
+    // Combat-clock seconds (fixed steps * FrameDuration) including the sub-frame offset
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Input Buffer", meta = (AllowPrivateAccess = "true"))
-    TArray<float> InputTimestamps;
+    TArray<double> InputTimestamps;
 
     // Combo tracking
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Combo System", meta = (AllowPrivateAccess = "true"))
@@ -249,6 +311,25 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Debug", meta = (AllowPrivateAccess = "true"))
     bool bDebugVisualization = false;
 
+    // Latest action event - sent once when a connection opens the channel, later events go through the RPC stream
+    UPROPERTY(ReplicatedUsing = OnRep_LastActionRecord)
+    FCombatActionRecord LastActionRecord;
+
+    UFUNCTION()
+    void OnRep_LastActionRecord();
+
+    // Owning client -> server: an action the client started locally, validated like a local input
+    UFUNCTION(Server, Reliable)
+    void ServerActionRecord(FCombatActionRecord Record);
+
+    // Server -> owning client: a record was rejected, this is the server's current action to snap back to
+    UFUNCTION(Client, Reliable)
+    void ClientCorrectActionRecord(FCombatActionRecord Record);
+
+    // Server -> simulated proxies, in order
+    UFUNCTION(NetMulticast, Reliable)
+    void MulticastActionRecord(FCombatActionRecord Record);
+
 private:
     // Internal state management
     void UpdateFrameTimer(float DeltaTime);
@@ -257,9 +338,11 @@ private:
     void SetState(ECombatState NewState);
     
     // Input processing
+    // Moves queued inputs up to and including LastFrame into the buffer
+    void DrainPendingInputs(int64 LastFrame);
     void ProcessInputBuffer();
     void CleanupOldInputs();
-    bool CheckInputTiming(float InputTime) const;
+    bool CheckInputTiming(double InputTime) const;
     
     // Action execution
     bool ExecuteAction(const FGameplayTag& ActionTag);
@@ -295,8 +378,44 @@ private:
     bool IsActionValid(const FGameplayTag& ActionTag) const;
     bool ArePrerequisitesMet(const FCombatActionData& ActionData) const;
     
+    // Replicated action stream
+    void SendActionRecord(uint8 ActionIndex, uint8 Flags);
+    void PublishActionRecord(const FCombatActionRecord& Record);
+    void ApplyActionRecord(const FCombatActionRecord& Record);
+    void CatchUpActionRecord(const FCombatActionData& ActionData, int32 Age);
+    bool ValidateActionRecord(const FCombatActionRecord& Record, int32 Age, uint8& OutFlags);
+    FCombatActionRecord GetAuthoritativeActionRecord() const;
+    int32 GetRecordAge(const FCombatActionRecord& Record) const;
+    int32 GetMaxClientRecordAge() const;
+    uint16 GetNetCombatFrame() const;
+    
     // Debug helpers
     void DrawDebugInfo();
     void LogStateTransition(ECombatState FromState, ECombatState ToState, const FGameplayTag& ActionTag);
     void LogFrameInfo() const;
+    
+    // Fixed steps run since BeginPlay - never reset, unlike CurrentFrame
+    int64 CombatStep = 0;
+    double GetCombatTime() const { return static_cast<double>(CombatStep) * FrameDuration; }
+    
+    // Timestamped inputs waiting for the fixed step that follows them
+    FCombatInputQueue PendingInputs;
+    FCombatInputClock InputClock;
+    
+    // Combat time of the input that started the current action, until its first Active frame
+    double PendingLatencyInputTime = -1.0;
+    
+    // Action tags in table row order - FCombatActionRecord::ActionIndex, identical on every machine
+    TArray<FGameplayTag> ActionIndexTags;
+    
+    // Flags for the record the next StartAction sends - set by ProcessCancel
+    uint8 PendingRecordFlags = 0;
+    
+    // Set while a received record drives the state machine, so it is not sent again
+    bool bApplyingActionRecord = false;
+    
+    // Counted in the CombatNet per-fighter stat while this component can send records
+    bool bStreamingActionRecords = false;
+    
+    ECombatLod CombatLod = ECombatLod::Full;
 };
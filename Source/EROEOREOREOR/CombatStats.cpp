@@ -0,0 +1,209 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CombatStats.h"
+#include "ProfilingDebugging/CountersTrace.h"
+
+DEFINE_STAT(STAT_Combat_StateMachineTick);
+DEFINE_STAT(STAT_Combat_ProcessInputBuffer);
+DEFINE_STAT(STAT_Combat_AttackShapeTick);
+DEFINE_STAT(STAT_Combat_ProcessActiveShapes);
+DEFINE_STAT(STAT_Combat_ShapeCollision);
+DEFINE_STAT(STAT_Combat_HandleActorHit);
+DEFINE_STAT(STAT_Combat_AoETick);
+DEFINE_STAT(STAT_Combat_CheckAoEHits);
+DEFINE_STAT(STAT_Combat_ApplyAoEHit);
+DEFINE_STAT(STAT_Combat_LagCompGather);
+DEFINE_STAT(STAT_Combat_LagCompShapeBatch);
+DEFINE_STAT(STAT_Combat_DamageExecution);
+DEFINE_STAT(STAT_Combat_ApplyDamage);
+DEFINE_STAT(STAT_Combat_PhysDash);
+DEFINE_STAT(STAT_Combat_PhysBounce);
+DEFINE_STAT(STAT_Combat_MovementHistory);
+DEFINE_STAT(STAT_Combat_DashActivate);
+DEFINE_STAT(STAT_Combat_BounceValidation);
+DEFINE_STAT(STAT_Combat_BounceActivate);
+DEFINE_STAT(STAT_Combat_SignificanceUpdate);
+
+DEFINE_STAT(STAT_Combat_Queries);
+DEFINE_STAT(STAT_Combat_Candidates);
+DEFINE_STAT(STAT_Combat_Hits);
+DEFINE_STAT(STAT_Combat_DamageSpecs);
+DEFINE_STAT(STAT_Combat_Allocations);
+DEFINE_STAT(STAT_Combat_Deferred);
+DEFINE_STAT(STAT_Combat_CaughtUp);
+
+UE_TRACE_CHANNEL_DEFINE(CombatChannel);
+
+UE_TRACE_EVENT_BEGIN(Combat, FrameCounters)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, Queries)
+	UE_TRACE_EVENT_FIELD(uint32, Candidates)
+	UE_TRACE_EVENT_FIELD(uint32, Hits)
+	UE_TRACE_EVENT_FIELD(uint32, DamageSpecs)
+	UE_TRACE_EVENT_FIELD(uint32, Allocations)
+	UE_TRACE_EVENT_FIELD(uint32, Deferred)
+	UE_TRACE_EVENT_FIELD(uint32, CaughtUp)
+UE_TRACE_EVENT_END()
+
+// Counter tracks shown in the Insights Counters panel
+TRACE_DECLARE_INT_COUNTER(CombatQueries, TEXT("Combat/QueriesIssued"));
+TRACE_DECLARE_INT_COUNTER(CombatCandidates, TEXT("Combat/CandidatesTested"));
+TRACE_DECLARE_INT_COUNTER(CombatHits, TEXT("Combat/Hits"));
+TRACE_DECLARE_INT_COUNTER(CombatDamageSpecs, TEXT("Combat/DamageSpecsApplied"));
+TRACE_DECLARE_INT_COUNTER(CombatAllocations, TEXT("Combat/Allocations"));
+TRACE_DECLARE_INT_COUNTER(CombatDeferred, TEXT("Combat/WorkDeferred"));
+TRACE_DECLARE_INT_COUNTER(CombatCaughtUp, TEXT("Combat/WorkCaughtUp"));
+
+uint32 FCombatFrameCounters::Current[static_cast<int32>(ECombatCounter::Count)] = {};
+uint32 FCombatFrameCounters::Last[static_cast<int32>(ECombatCounter::Count)] = {};
+
+namespace CombatFrameCounters
+{
+	static const TCHAR* const Names[] = { TEXT("Queries"), TEXT("Candidates"), TEXT("Hits"), TEXT("DamageSpecs"), TEXT("Allocations"), TEXT("Deferred"), TEXT("CaughtUp") };
+	static_assert(UE_ARRAY_COUNT(Names) == static_cast<int32>(ECombatCounter::Count), "ECombatCounter and its names are out of sync");
+}
+
+const TCHAR* FCombatFrameCounters::GetName(ECombatCounter Counter)
+{
+	return CombatFrameCounters::Names[static_cast<int32>(Counter)];
+}
+
+void FCombatFrameCounters::Flush()
+{
+	FMemory::Memcpy(Last, Current, sizeof(Current));
+	FMemory::Memzero(Current, sizeof(Current));
+
+	if (!UE_TRACE_CHANNELEXPR_IS_ENABLED(CombatChannel))
+	{
+		return;
+	}
+
+	const uint32 Queries = GetLastFrame(ECombatCounter::Queries);
+	const uint32 Candidates = GetLastFrame(ECombatCounter::Candidates);
+	const uint32 Hits = GetLastFrame(ECombatCounter::Hits);
+	const uint32 DamageSpecs = GetLastFrame(ECombatCounter::DamageSpecs);
+	const uint32 Allocations = GetLastFrame(ECombatCounter::Allocations);
+	const uint32 Deferred = GetLastFrame(ECombatCounter::Deferred);
+	const uint32 CaughtUp = GetLastFrame(ECombatCounter::CaughtUp);
+
+	UE_TRACE_LOG(Combat, FrameCounters, CombatChannel)
+		<< FrameCounters.Cycle(FPlatformTime::Cycles64())
+		<< FrameCounters.Queries(Queries)
+		<< FrameCounters.Candidates(Candidates)
+		<< FrameCounters.Hits(Hits)
+		<< FrameCounters.DamageSpecs(DamageSpecs)
+		<< FrameCounters.Allocations(Allocations)
+		<< FrameCounters.Deferred(Deferred)
+		<< FrameCounters.CaughtUp(CaughtUp);
+
+	TRACE_COUNTER_SET(CombatQueries, Queries);
+	TRACE_COUNTER_SET(CombatCandidates, Candidates);
+	TRACE_COUNTER_SET(CombatHits, Hits);
+	TRACE_COUNTER_SET(CombatDamageSpecs, DamageSpecs);
+	TRACE_COUNTER_SET(CombatAllocations, Allocations);
+	TRACE_COUNTER_SET(CombatDeferred, Deferred);
+	TRACE_COUNTER_SET(CombatCaughtUp, CaughtUp);
+}
+
+#if !UE_BUILD_SHIPPING
+uint8 FCombatScopeTimings::CaptureClients = 0;
+uint64 FCombatScopeTimings::Cycles[static_cast<int32>(ECombatScope::Count)] = {};
+uint32 FCombatScopeTimings::Calls[static_cast<int32>(ECombatScope::Count)] = {};
+
+namespace CombatScopeTimings
+{
+	static const TCHAR* const Names[] =
+	{
+		TEXT("StateMachineTick"),
+		TEXT("ProcessInputBuffer"),
+		TEXT("AttackShapeTick"),
+		TEXT("ProcessActiveShapes"),
+		TEXT("ShapeCollision"),
+		TEXT("HandleActorHit"),
+		TEXT("AoETick"),
+		TEXT("CheckAoEHits"),
+		TEXT("ApplyAoEHit"),
+		TEXT("LagCompGather"),
+		TEXT("LagCompShapeBatch"),
+		TEXT("DamageExecution"),
+		TEXT("ApplyDamage"),
+		TEXT("PhysDash"),
+		TEXT("PhysBounce"),
+		TEXT("MovementHistory"),
+		TEXT("DashActivate"),
+		TEXT("BounceValidation"),
+		TEXT("BounceActivate"),
+		TEXT("SignificanceUpdate")
+	};
+	static_assert(UE_ARRAY_COUNT(Names) == static_cast<int32>(ECombatScope::Count), "ECombatScope and its names are out of sync");
+}
+
+void FCombatScopeTimings::Reset()
+{
+	FMemory::Memzero(Cycles, sizeof(Cycles));
+	FMemory::Memzero(Calls, sizeof(Calls));
+}
+
+double FCombatScopeTimings::GetTotalMilliseconds(ECombatScope Scope)
+{
+	return FPlatformTime::ToMilliseconds64(Cycles[static_cast<int32>(Scope)]);
+}
+
+const TCHAR* FCombatScopeTimings::GetName(ECombatScope Scope)
+{
+	return CombatScopeTimings::Names[static_cast<int32>(Scope)];
+}
+
+bool FCombatScopeTimings::IsRoot(ECombatScope Scope)
+{
+	switch (Scope)
+	{
+		case ECombatScope::StateMachineTick:
+		case ECombatScope::AttackShapeTick:
+		case ECombatScope::AoETick:
+		case ECombatScope::MovementHistory:
+		case ECombatScope::PhysDash:
+		case ECombatScope::PhysBounce:
+		case ECombatScope::DashActivate:
+		case ECombatScope::BounceValidation:
+		case ECombatScope::BounceActivate:
+		case ECombatScope::SignificanceUpdate:
+			return true;
+		default:
+			return false;
+	}
+}
+
+uint32 FCombatFrameGauges::Current[static_cast<int32>(ECombatGauge::Count)] = {};
+uint32 FCombatFrameGauges::Last[static_cast<int32>(ECombatGauge::Count)] = {};
+
+namespace CombatFrameGauges
+{
+	static const TCHAR* const Names[] =
+	{
+		TEXT("Attacks"),
+		TEXT("Hitboxes"),
+		TEXT("AoE Instant"),
+		TEXT("AoE Expanding"),
+		TEXT("AoE Projectile"),
+		TEXT("AoE Delayed"),
+		TEXT("AoE Persistent"),
+		TEXT("AoE Traveling"),
+		TEXT("Fighters Full"),
+		TEXT("Fighters Reduced"),
+		TEXT("Fighters Minimal")
+	};
+	static_assert(UE_ARRAY_COUNT(Names) == static_cast<int32>(ECombatGauge::Count), "ECombatGauge and its names are out of sync");
+}
+
+void FCombatFrameGauges::Flush()
+{
+	FMemory::Memcpy(Last, Current, sizeof(Current));
+	FMemory::Memzero(Current, sizeof(Current));
+}
+
+const TCHAR* FCombatFrameGauges::GetName(ECombatGauge Gauge)
+{
+	return CombatFrameGauges::Names[static_cast<int32>(Gauge)];
+}
+#endif
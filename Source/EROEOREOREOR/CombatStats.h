@@ -0,0 +1,231 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+/**
+ * Combat profiling - `stat Combat` in game, Combat channel in Unreal Insights (-trace=cpu,counters,combat)
+ * Every hot function opens a COMBAT_SCOPE; per-frame work counters go through COMBAT_COUNTER_ADD
+ * and are flushed once per frame to the stat system and the trace.
+ */
+
+DECLARE_STATS_GROUP(TEXT("Combat"), STATGROUP_Combat, STATCAT_Advanced);
+
+// Hot path cycle stats
+DECLARE_CYCLE_STAT_EXTERN(TEXT("StateMachine Tick"), STAT_Combat_StateMachineTick, STATGROUP_Combat, EROEOREOREOR_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("StateMachine InputBuffer"), STAT_Combat_ProcessInputBuffer, STATGROUP_Combat, EROEOREOREOR_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AttackShape Tick"), STAT_Combat_AttackShapeTick, STATGROUP_Combat, EROEOREOREOR_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AttackShape ProcessActiveShapes"), STAT_Combat_ProcessActiveShapes, STATGROUP_Combat, EROEOREOREOR_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AttackShape Collision"), STAT_Combat_ShapeCollision, STATGROUP_Combat, EROEOREOREOR_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AttackShape HandleHit"), STAT_Combat_HandleActorHit, STATGROUP_Combat, EROEOREOREOR_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AoE Tick"), STAT_Combat_AoETick, STATGROUP_Combat, EROEOREOREOR_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AoE CheckHits"), STAT_Combat_CheckAoEHits, STATGROUP_Combat, EROEOREOREOR_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AoE ApplyHit"), STAT_Combat_ApplyAoEHit, STATGROUP_Combat, EROEOREOREOR_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("LagComp Gather"), STAT_Combat_LagCompGather, STATGROUP_Combat, EROEOREOREOR_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("LagComp ShapeBatch"), STAT_Combat_LagCompShapeBatch, STATGROUP_Combat, EROEOREOREOR_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Damage Execution"), STAT_Combat_DamageExecution, STATGROUP_Combat, EROEOREOREOR_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Damage Apply"), STAT_Combat_ApplyDamage, STATGROUP_Combat, EROEOREOREOR_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Movement PhysDash"), STAT_Combat_PhysDash, STATGROUP_Combat, EROEOREOREOR_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Movement PhysBounce"), STAT_Combat_PhysBounce, STATGROUP_Combat, EROEOREOREOR_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Movement History"), STAT_Combat_MovementHistory, STATGROUP_Combat, EROEOREOREOR_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Dash Activate"), STAT_Combat_DashActivate, STATGROUP_Combat, EROEOREOREOR_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Bounce Validation"), STAT_Combat_BounceValidation, STATGROUP_Combat, EROEOREOREOR_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Bounce Activate"), STAT_Combat_BounceActivate, STATGROUP_Combat, EROEOREOREOR_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Significance Update"), STAT_Combat_SignificanceUpdate, STATGROUP_Combat, EROEOREOREOR_API);
+
+// Per-frame work counters - reset by the stat system every frame
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Queries Issued"), STAT_Combat_Queries, STATGROUP_Combat, EROEOREOREOR_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Candidates Tested"), STAT_Combat_Candidates, STATGROUP_Combat, EROEOREOREOR_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Hits"), STAT_Combat_Hits, STATGROUP_Combat, EROEOREOREOR_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Damage Specs Applied"), STAT_Combat_DamageSpecs, STATGROUP_Combat, EROEOREOREOR_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Allocations"), STAT_Combat_Allocations, STATGROUP_Combat, EROEOREOREOR_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Work Deferred"), STAT_Combat_Deferred, STATGROUP_Combat, EROEOREOREOR_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Work Caught Up"), STAT_Combat_CaughtUp, STATGROUP_Combat, EROEOREOREOR_API);
+
+UE_TRACE_CHANNEL_EXTERN(CombatChannel, EROEOREOREOR_API);
+
+enum class ECombatCounter : uint8
+{
+	Queries,		// World/physics queries and lag compensation gathers
+	Candidates,		// Actors or rewound volumes run through a narrow-phase test
+	Hits,			// Hits that passed filtering and were applied
+	DamageSpecs,	// Gameplay effect specs applied to a target
+	Allocations,	// Heap blocks requested by combat code (hit arrays that grew, effect specs)
+	Deferred,		// Hit work pushed to a later frame by the combat frame budget
+	CaughtUp,		// Previously deferred hit work that ran this frame
+	Count
+};
+
+/**
+ * Per-frame combat counters for the trace
+ * Game thread only. Flush runs at end of frame: it emits the Combat.FrameCounters event and
+ * the Insights counter tracks, keeps the totals readable via GetLastFrame and resets for the next frame.
+ */
+class EROEOREOREOR_API FCombatFrameCounters
+{
+public:
+	static void Add(ECombatCounter Counter, uint32 Amount)
+	{
+		Current[static_cast<int32>(Counter)] += Amount;
+	}
+
+	static void Flush();
+
+	// Totals of the last flushed frame
+	static uint32 GetLastFrame(ECombatCounter Counter) { return Last[static_cast<int32>(Counter)]; }
+	static const TCHAR* GetName(ECombatCounter Counter);
+
+private:
+	static uint32 Current[static_cast<int32>(ECombatCounter::Count)];
+	static uint32 Last[static_cast<int32>(ECombatCounter::Count)];
+};
+
+// One entry per hot path cycle stat, same names without the STAT_Combat_ prefix
+enum class ECombatScope : uint8
+{
+	StateMachineTick,
+	ProcessInputBuffer,
+	AttackShapeTick,
+	ProcessActiveShapes,
+	ShapeCollision,
+	HandleActorHit,
+	AoETick,
+	CheckAoEHits,
+	ApplyAoEHit,
+	LagCompGather,
+	LagCompShapeBatch,
+	DamageExecution,
+	ApplyDamage,
+	PhysDash,
+	PhysBounce,
+	MovementHistory,
+	DashActivate,
+	BounceValidation,
+	BounceActivate,
+	SignificanceUpdate,
+	Count
+};
+
+// Live combat work - what is in flight this frame rather than what it did
+enum class ECombatGauge : uint8
+{
+	ActiveAttacks,	// Attack shape components mid-attack
+	ActiveHitboxes,	// Attack shapes whose window covers the current frame
+	// One per EAoEBehavior, same order
+	AoEInstant,
+	AoEExpanding,
+	AoEProjectile,
+	AoEDelayed,
+	AoEPersistent,
+	AoETraveling,
+	// Registered fighters per ECombatLod, same order
+	LodFull,
+	LodReduced,
+	LodMinimal,
+	Count
+};
+
+#if !UE_BUILD_SHIPPING
+// Tools that read FCombatScopeTimings - each holds its own capture bit
+enum class ECombatScopeCaptureClient : uint8
+{
+	PerfHud			= 1 << 0,
+	HitchCapture	= 1 << 1,
+	StressBenchmark	= 1 << 2,
+	Replay			= 1 << 3
+};
+
+/**
+ * Inclusive time per COMBAT_SCOPE for headless benchmarks, which cannot read the stat system directly
+ * Game thread only. Off by default - a disabled scope costs one branch. Capture runs while any client wants it,
+ * so a benchmark stopping does not blind the perf HUD or the hitch capture.
+ */
+class EROEOREOREOR_API FCombatScopeTimings
+{
+public:
+	static void SetCapture(ECombatScopeCaptureClient Client, bool bEnable)
+	{
+		CaptureClients = static_cast<uint8>(bEnable ? CaptureClients | static_cast<uint8>(Client) : CaptureClients & ~static_cast<uint8>(Client));
+	}
+	static void Reset();
+
+	static double GetTotalMilliseconds(ECombatScope Scope);
+	static uint32 GetTotalCalls(ECombatScope Scope) { return Calls[static_cast<int32>(Scope)]; }
+	static const TCHAR* GetName(ECombatScope Scope);
+
+	// Outermost scopes - every other scope runs inside one, so summing the roots counts each cycle once
+	static bool IsRoot(ECombatScope Scope);
+
+	struct FScope
+	{
+		explicit FScope(ECombatScope InScope)
+			: Scope(InScope)
+			, StartCycles(CaptureClients != 0 ? FPlatformTime::Cycles64() : 0)
+		{
+		}
+
+		~FScope()
+		{
+			if (StartCycles != 0)
+			{
+				Cycles[static_cast<int32>(Scope)] += FPlatformTime::Cycles64() - StartCycles;
+				++Calls[static_cast<int32>(Scope)];
+			}
+		}
+
+		ECombatScope Scope;
+		uint64 StartCycles;
+	};
+
+private:
+	static uint8 CaptureClients;
+	static uint64 Cycles[static_cast<int32>(ECombatScope::Count)];
+	static uint32 Calls[static_cast<int32>(ECombatScope::Count)];
+};
+
+#define COMBAT_SCOPE_TIMING(Name) FCombatScopeTimings::FScope ANONYMOUS_VARIABLE(CombatScopeTiming_)(ECombatScope::Name)
+
+/**
+ * Per-frame gauges for the perf HUD (Combat.Hud)
+ * Components add what they have in flight as they tick; flushed with the counters at end of frame,
+ * so nothing has to be decremented when an attack or AoE ends or its owner is destroyed.
+ */
+class EROEOREOREOR_API FCombatFrameGauges
+{
+public:
+	static void Add(ECombatGauge Gauge, uint32 Amount)
+	{
+		Current[static_cast<int32>(Gauge)] += Amount;
+	}
+
+	static void Flush();
+
+	static uint32 GetLastFrame(ECombatGauge Gauge) { return Last[static_cast<int32>(Gauge)]; }
+	static const TCHAR* GetName(ECombatGauge Gauge);
+
+private:
+	static uint32 Current[static_cast<int32>(ECombatGauge::Count)];
+	static uint32 Last[static_cast<int32>(ECombatGauge::Count)];
+};
+
+#define COMBAT_GAUGE_ADD(Gauge, Amount) FCombatFrameGauges::Add(Gauge, static_cast<uint32>(Amount))
+#else
+#define COMBAT_SCOPE_TIMING(Name)
+#define COMBAT_GAUGE_ADD(Gauge, Amount)
+#endif
+
+// Cycle stat + Insights scope on the Combat channel, e.g. COMBAT_SCOPE(PhysDash) -> STAT_Combat_PhysDash
+#define COMBAT_SCOPE(Name) \
+	SCOPE_CYCLE_COUNTER(STAT_Combat_##Name); \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Combat_##Name, CombatChannel); \
+	COMBAT_SCOPE_TIMING(Name)
+
+#define COMBAT_COUNTER_ADD(Counter, Amount) \
+	do { \
+		INC_DWORD_STAT_BY(STAT_Combat_##Counter, Amount); \
+		FCombatFrameCounters::Add(ECombatCounter::Counter, static_cast<uint32>(Amount)); \
+	} while (0)
@@ -0,0 +1,458 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CombatBenchmarkScene.h"
+#include "CombatLog.h"
+#include "CombatStats.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/Pawn.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/App.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Tests/AutomationCommon.h"
+
+// COMBAT STRESS BENCHMARK - Scaling curves for N scripted fighters and M target dummies
+// Automation test EROEOREOREOR.Combat.Stress.Sweep (game, stress filter):
+//   <Project>.uproject -game -nullrhi -unattended -nosound -ExecCmds="Automation RunTests EROEOREOREOR.Combat.Stress; Quit"
+//   Optional: -CombatStressMaxFighters=<N> -CombatStressMaxDummies=<M> -CombatStressFrames=<Frames>
+//
+// Sweeps every pair of fighter count N and dummy count M from the lists below, independently, up to 1000 each.
+// Each step spawns a fresh FCombatBenchmarkScene (bots walk DT_BasicCombatActions), settles, then records world tick
+// and frame time percentiles, per-scope combat time, per-frame work counters and peak memory.
+// Results go to Saved/Benchmarks/CombatStress_<time>.json, one object per step; the test fails when a step
+// could not spawn its N fighters and M dummies or did not record its frames.
+
+#if WITH_DEV_AUTOMATION_TESTS
+namespace CombatStressBenchmark
+{
+	static constexpr int32 FIGHTER_COUNTS[] = { 1, 10, 50, 100, 250, 500, 1000 };
+	static constexpr int32 DUMMY_COUNTS[] = { 0, 1, 10, 50, 100, 250, 500, 1000 };
+	static constexpr int32 SETTLE_FRAMES = 60;
+	// Frames after teardown so destroyed actors are collected before the next step spawns
+	static constexpr int32 COOLDOWN_FRAMES = 2;
+	static constexpr int32 DEFAULT_FRAMES_PER_STEP = 300;
+	static constexpr double START_TIMEOUT_SECONDS = 10.0;
+	static constexpr double RUN_TIMEOUT_SECONDS = 4.0 * 3600.0;
+	static const TCHAR* const TEST_MAP = TEXT("/Game/ThirdPerson/Lvl_ThirdPerson");
+
+	enum class EPhase : uint8
+	{
+		Settle,
+		Measure,
+		Cooldown
+	};
+
+	struct FStepResult
+	{
+		FIntPoint Requested = FIntPoint::ZeroValue;
+		int32 Fighters = 0;
+		int32 Dummies = 0;
+		TArray<double> WorldTickMs;
+		TArray<double> FrameMs;
+		double ScopeMs[static_cast<int32>(ECombatScope::Count)] = {};
+		uint32 ScopeCalls[static_cast<int32>(ECombatScope::Count)] = {};
+		uint64 Counters[static_cast<int32>(ECombatCounter::Count)] = {};
+		uint64 PeakUsedPhysical = 0;
+		uint64 PeakUsedVirtual = 0;
+	};
+
+	struct FBenchmarkRun
+	{
+		TWeakObjectPtr<UWorld> World;
+		FDelegateHandle TickStartHandle;
+		FDelegateHandle PostTickHandle;
+
+		FCombatBenchmarkScene Scene;
+		FVector Origin = FVector::ZeroVector;
+		// X = fighters, Y = dummies
+		TArray<FIntPoint> Grid;
+		int32 StepIndex = 0;
+		int32 FramesPerStep = DEFAULT_FRAMES_PER_STEP;
+
+		EPhase Phase = EPhase::Settle;
+		int32 PhaseFrame = 0;
+		int64 Frame = 0;
+		double TickStartSeconds = 0.0;
+
+		// A measured frame's counters and frame time are final at the next tick start - the step's last frame included
+		bool bPendingFrame = false;
+
+		TArray<FStepResult> Steps;
+	};
+
+	static FBenchmarkRun Run;
+
+	// Nearest-rank percentile on a sorted array
+	static double Percentile(const TArray<double>& Sorted, double Fraction)
+	{
+		if (Sorted.Num() == 0)
+		{
+			return 0.0;
+		}
+		const int32 Rank = FMath::Clamp(FMath::CeilToInt(Fraction * Sorted.Num()) - 1, 0, Sorted.Num() - 1);
+		return Sorted[Rank];
+	}
+
+	static void AppendTimingJson(FString& Json, const TCHAR* Key, TArray<double>& Samples)
+	{
+		Samples.Sort();
+
+		double Sum = 0.0;
+		for (const double Ms : Samples)
+		{
+			Sum += Ms;
+		}
+
+		Json += FString::Printf(TEXT("\"%s\": { \"mean\": %.4f, \"p50\": %.4f, \"p95\": %.4f, \"p99\": %.4f, \"max\": %.4f }"),
+			Key, Samples.Num() > 0 ? Sum / Samples.Num() : 0.0,
+			Percentile(Samples, 0.50), Percentile(Samples, 0.95), Percentile(Samples, 0.99),
+			Samples.Num() > 0 ? Samples.Last() : 0.0);
+	}
+
+	static FString BuildJson()
+	{
+		FString Json;
+		Json += TEXT("{\n");
+		Json += FString::Printf(TEXT("\t\"build\": \"%s\",\n"), LexToString(FApp::GetBuildConfiguration()));
+		Json += FString::Printf(TEXT("\t\"build_version\": \"%s\",\n"), FApp::GetBuildVersion());
+		Json += FString::Printf(TEXT("\t\"platform\": \"%s\",\n"), ANSI_TO_TCHAR(FPlatformProperties::IniPlatformName()));
+		Json += FString::Printf(TEXT("\t\"timestamp\": \"%s\",\n"), *FDateTime::UtcNow().ToIso8601());
+		Json += FString::Printf(TEXT("\t\"frames_per_step\": %d,\n"), Run.FramesPerStep);
+		Json += FString::Printf(TEXT("\t\"max_fighters\": %d,\n\t\"max_dummies\": %d,\n"),
+			Run.Grid.Num() > 0 ? Run.Grid.Last().X : 0, Run.Grid.Num() > 0 ? Run.Grid.Last().Y : 0);
+		Json += TEXT("\t\"steps\": [\n");
+
+		for (int32 StepIndex = 0; StepIndex < Run.Steps.Num(); ++StepIndex)
+		{
+			FStepResult& Step = Run.Steps[StepIndex];
+			const int32 NumFrames = FMath::Max(1, Step.WorldTickMs.Num());
+
+			Json += TEXT("\t\t{\n");
+			Json += FString::Printf(TEXT("\t\t\t\"fighters\": %d,\n\t\t\t\"dummies\": %d,\n\t\t\t\"frames\": %d,\n"),
+				Step.Fighters, Step.Dummies, Step.WorldTickMs.Num());
+
+			Json += TEXT("\t\t\t");
+			AppendTimingJson(Json, TEXT("world_tick_ms"), Step.WorldTickMs);
+			Json += TEXT(",\n\t\t\t");
+			AppendTimingJson(Json, TEXT("game_thread_frame_ms"), Step.FrameMs);
+			Json += TEXT(",\n");
+
+			Json += TEXT("\t\t\t\"scopes\": {");
+			for (int32 Scope = 0; Scope < static_cast<int32>(ECombatScope::Count); ++Scope)
+			{
+				Json += FString::Printf(TEXT("%s\n\t\t\t\t\"%s\": { \"total_ms\": %.4f, \"ms_per_frame\": %.5f, \"calls\": %u }"),
+					Scope > 0 ? TEXT(",") : TEXT(""), FCombatScopeTimings::GetName(static_cast<ECombatScope>(Scope)),
+					Step.ScopeMs[Scope], Step.ScopeMs[Scope] / NumFrames, Step.ScopeCalls[Scope]);
+			}
+			Json += TEXT("\n\t\t\t},\n");
+
+			Json += TEXT("\t\t\t\"counters\": {");
+			for (int32 Counter = 0; Counter < static_cast<int32>(ECombatCounter::Count); ++Counter)
+			{
+				Json += FString::Printf(TEXT("%s\n\t\t\t\t\"%s\": { \"total\": %llu, \"per_frame\": %.2f }"),
+					Counter > 0 ? TEXT(",") : TEXT(""), FCombatFrameCounters::GetName(static_cast<ECombatCounter>(Counter)),
+					Step.Counters[Counter], static_cast<double>(Step.Counters[Counter]) / NumFrames);
+			}
+			Json += TEXT("\n\t\t\t},\n");
+
+			Json += FString::Printf(TEXT("\t\t\t\"peak_used_physical_mb\": %.2f,\n\t\t\t\"peak_used_virtual_mb\": %.2f\n"),
+				Step.PeakUsedPhysical / (1024.0 * 1024.0), Step.PeakUsedVirtual / (1024.0 * 1024.0));
+			Json += StepIndex + 1 < Run.Steps.Num() ? TEXT("\t\t},\n") : TEXT("\t\t}\n");
+		}
+
+		Json += TEXT("\t]\n}\n");
+		return Json;
+	}
+
+	static void StopBenchmark()
+	{
+		FWorldDelegates::OnWorldTickStart.Remove(Run.TickStartHandle);
+		FWorldDelegates::OnWorldPostActorTick.Remove(Run.PostTickHandle);
+		Run.TickStartHandle.Reset();
+		Run.PostTickHandle.Reset();
+		FCombatScopeTimings::SetCapture(ECombatScopeCaptureClient::StressBenchmark, false);
+		Run.Scene.Destroy();
+	}
+
+	static void Finish()
+	{
+		const FString Path = FPaths::ProjectSavedDir() / TEXT("Benchmarks") /
+			FString::Printf(TEXT("CombatStress_%s.json"), *FDateTime::Now().ToString());
+		if (FFileHelper::SaveStringToFile(BuildJson(), *Path))
+		{
+			UE_LOG(LogCombat, Display, TEXT("Combat.Stress.Sweep: Wrote %s"), *Path);
+		}
+		else
+		{
+			UE_LOG(LogCombat, Error, TEXT("Combat.Stress.Sweep: Failed to write %s"), *Path);
+		}
+
+		StopBenchmark();
+	}
+
+	static void BeginStep()
+	{
+		const int32 NumFighters = Run.Grid[Run.StepIndex].X;
+		const int32 NumDummies = Run.Grid[Run.StepIndex].Y;
+
+		if (!Run.Scene.Spawn(Run.World.Get(), Run.Origin, NumFighters, NumDummies))
+		{
+			UE_LOG(LogCombat, Warning, TEXT("Combat.Stress.Sweep: Step %d spawned %d/%d fighters, %d/%d dummies"),
+				Run.StepIndex, Run.Scene.GetNumFighters(), NumFighters, Run.Scene.GetNumDummies(), NumDummies);
+		}
+
+		FStepResult& Step = Run.Steps.AddDefaulted_GetRef();
+		Step.Requested = Run.Grid[Run.StepIndex];
+		Step.Fighters = Run.Scene.GetNumFighters();
+		Step.Dummies = Run.Scene.GetNumDummies();
+		Step.WorldTickMs.Reserve(Run.FramesPerStep);
+		Step.FrameMs.Reserve(Run.FramesPerStep);
+
+		Run.Phase = EPhase::Settle;
+		Run.PhaseFrame = 0;
+	}
+
+	static void EndStep()
+	{
+		FCombatScopeTimings::SetCapture(ECombatScopeCaptureClient::StressBenchmark, false);
+
+		FStepResult& Step = Run.Steps.Last();
+		for (int32 Scope = 0; Scope < static_cast<int32>(ECombatScope::Count); ++Scope)
+		{
+			Step.ScopeMs[Scope] = FCombatScopeTimings::GetTotalMilliseconds(static_cast<ECombatScope>(Scope));
+			Step.ScopeCalls[Scope] = FCombatScopeTimings::GetTotalCalls(static_cast<ECombatScope>(Scope));
+		}
+
+		TArray<double> Sorted = Step.WorldTickMs;
+		Sorted.Sort();
+		UE_LOG(LogCombat, Display, TEXT("Combat.Stress.Sweep: %4d fighters %4d dummies - world tick p50 %.3f p95 %.3f p99 %.3f ms, peak %.1f MB"),
+			Step.Fighters, Step.Dummies, Percentile(Sorted, 0.50), Percentile(Sorted, 0.95), Percentile(Sorted, 0.99),
+			Step.PeakUsedPhysical / (1024.0 * 1024.0));
+
+		Run.Scene.Destroy();
+		if (GEngine)
+		{
+			GEngine->ForceGarbageCollection(true);
+		}
+
+		Run.Phase = EPhase::Cooldown;
+		Run.PhaseFrame = 0;
+	}
+
+	static void OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+	{
+		if (World != Run.World.Get() || TickType == LEVELTICK_TimeOnly)
+		{
+			return;
+		}
+
+		if (Run.bPendingFrame)
+		{
+			// Last frame's game-thread work: wall delta minus time spent waiting for frame pacing.
+			// Steps.Last() is still its step - the next one is only added after the cooldown.
+			Run.bPendingFrame = false;
+			FStepResult& Step = Run.Steps.Last();
+			Step.FrameMs.Add(FMath::Max(0.0, FApp::GetDeltaTime() - FApp::GetIdleTime()) * 1000.0);
+
+			for (int32 Counter = 0; Counter < static_cast<int32>(ECombatCounter::Count); ++Counter)
+			{
+				Step.Counters[Counter] += FCombatFrameCounters::GetLastFrame(static_cast<ECombatCounter>(Counter));
+			}
+		}
+
+		Run.Scene.DriveInputs(Run.Frame++);
+		Run.TickStartSeconds = FPlatformTime::Seconds();
+	}
+
+	static void OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+	{
+		if (World != Run.World.Get())
+		{
+			return;
+		}
+
+		const double TickMs = (FPlatformTime::Seconds() - Run.TickStartSeconds) * 1000.0;
+		++Run.PhaseFrame;
+
+		switch (Run.Phase)
+		{
+			case EPhase::Settle:
+				if (Run.PhaseFrame >= SETTLE_FRAMES)
+				{
+					FCombatScopeTimings::Reset();
+					FCombatScopeTimings::SetCapture(ECombatScopeCaptureClient::StressBenchmark, true);
+					Run.Phase = EPhase::Measure;
+					Run.PhaseFrame = 0;
+				}
+				break;
+
+			case EPhase::Measure:
+			{
+				FStepResult& Step = Run.Steps.Last();
+				Step.WorldTickMs.Add(TickMs);
+				Run.bPendingFrame = true;
+
+				const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+				Step.PeakUsedPhysical = FMath::Max<uint64>(Step.PeakUsedPhysical, MemoryStats.UsedPhysical);
+				Step.PeakUsedVirtual = FMath::Max<uint64>(Step.PeakUsedVirtual, MemoryStats.UsedVirtual);
+
+				if (Run.PhaseFrame >= Run.FramesPerStep)
+				{
+					EndStep();
+				}
+				break;
+			}
+
+			case EPhase::Cooldown:
+				if (Run.PhaseFrame >= COOLDOWN_FRAMES)
+				{
+					if (++Run.StepIndex < Run.Grid.Num())
+					{
+						BeginStep();
+					}
+					else
+					{
+						Finish();
+					}
+				}
+				break;
+		}
+	}
+
+	// Full N x M grid, clamped to the largest counts the command line allows
+	static void BuildGrid(int32 MaxFighters, int32 MaxDummies)
+	{
+		Run.Grid.Reset();
+		for (const int32 Fighters : FIGHTER_COUNTS)
+		{
+			if (Fighters > MaxFighters)
+			{
+				continue;
+			}
+
+			for (const int32 Dummies : DUMMY_COUNTS)
+			{
+				if (Dummies <= MaxDummies)
+				{
+					Run.Grid.Add(FIntPoint(Fighters, Dummies));
+				}
+			}
+		}
+	}
+
+	static bool StartBenchmark(UWorld* World)
+	{
+		if (!World || Run.PostTickHandle.IsValid())
+		{
+			return false;
+		}
+
+		int32 MaxFighters = FIGHTER_COUNTS[UE_ARRAY_COUNT(FIGHTER_COUNTS) - 1];
+		int32 MaxDummies = DUMMY_COUNTS[UE_ARRAY_COUNT(DUMMY_COUNTS) - 1];
+		int32 FramesPerStep = DEFAULT_FRAMES_PER_STEP;
+		FParse::Value(FCommandLine::Get(), TEXT("CombatStressMaxFighters="), MaxFighters);
+		FParse::Value(FCommandLine::Get(), TEXT("CombatStressMaxDummies="), MaxDummies);
+		FParse::Value(FCommandLine::Get(), TEXT("CombatStressFrames="), FramesPerStep);
+
+		BuildGrid(MaxFighters, MaxDummies);
+		if (Run.Grid.Num() == 0)
+		{
+			UE_LOG(LogCombat, Error, TEXT("Combat.Stress.Sweep: No grid steps within %d fighters, %d dummies"), MaxFighters, MaxDummies);
+			return false;
+		}
+
+		Run.World = World;
+		Run.FramesPerStep = FMath::Max(1, FramesPerStep);
+		Run.StepIndex = 0;
+		Run.Frame = 0;
+		Run.bPendingFrame = false;
+		Run.Steps.Reset();
+
+		const APlayerController* PlayerController = World->GetFirstPlayerController();
+		const APawn* PlayerPawn = PlayerController ? PlayerController->GetPawn() : nullptr;
+		Run.Origin = PlayerPawn ? PlayerPawn->GetActorLocation() + FVector(FCombatBenchmarkScene::GRID_SPACING, 0.0f, 0.0f) : FVector::ZeroVector;
+
+		UE_LOG(LogCombat, Display, TEXT("Combat.Stress.Sweep: %d steps up to %d fighters x %d dummies, %d frames each"),
+			Run.Grid.Num(), Run.Grid.Last().X, Run.Grid.Last().Y, Run.FramesPerStep);
+
+		BeginStep();
+		Run.TickStartHandle = FWorldDelegates::OnWorldTickStart.AddStatic(&OnWorldTickStart);
+		Run.PostTickHandle = FWorldDelegates::OnWorldPostActorTick.AddStatic(&OnWorldPostActorTick);
+		return true;
+	}
+
+	static void CheckSteps(FAutomationTestBase& Test)
+	{
+		Test.TestEqual(TEXT("Completed grid steps"), Run.Steps.Num(), Run.Grid.Num());
+
+		for (const FStepResult& Step : Run.Steps)
+		{
+			const FString What = FString::Printf(TEXT("%d fighters x %d dummies"), Step.Requested.X, Step.Requested.Y);
+			Test.TestEqual(*FString::Printf(TEXT("%s: spawned fighters"), *What), Step.Fighters, Step.Requested.X);
+			Test.TestEqual(*FString::Printf(TEXT("%s: spawned dummies"), *What), Step.Dummies, Step.Requested.Y);
+			Test.TestEqual(*FString::Printf(TEXT("%s: measured frames"), *What), Step.WorldTickMs.Num(), Run.FramesPerStep);
+		}
+	}
+}
+
+class FCombatRunStressSweep : public IAutomationLatentCommand
+{
+public:
+	explicit FCombatRunStressSweep(FAutomationTestBase* InTest)
+		: Test(InTest)
+	{
+	}
+
+	virtual bool Update() override
+	{
+		using namespace CombatStressBenchmark;
+
+		if (!bStarted)
+		{
+			bStarted = StartBenchmark(AutomationCommon::GetAnyGameWorld());
+			if (!bStarted && GetCurrentRunTime() > START_TIMEOUT_SECONDS)
+			{
+				Test->AddError(TEXT("No game world to run the stress sweep in"));
+				return true;
+			}
+			return false;
+		}
+
+		if (Run.PostTickHandle.IsValid())
+		{
+			if (GetCurrentRunTime() < RUN_TIMEOUT_SECONDS)
+			{
+				return false;
+			}
+
+			Test->AddError(TEXT("Stress sweep timed out"));
+			StopBenchmark();
+			return true;
+		}
+
+		CheckSteps(*Test);
+		return true;
+	}
+
+private:
+	FAutomationTestBase* Test;
+	bool bStarted = false;
+};
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCombatStressSweepTest, "EROEOREOREOR.Combat.Stress.Sweep",
+	EAutomationTestFlags::ClientContext | EAutomationTestFlags::StressFilter)
+
+bool FCombatStressSweepTest::RunTest(const FString& Parameters)
+{
+	AutomationOpenMap(CombatStressBenchmark::TEST_MAP);
+	ADD_LATENT_AUTOMATION_COMMAND(FCombatRunStressSweep(this));
+	return true;
+}
+#endif
@@ -151,6 +151,11 @@ struct EROEOREOREOR_API FCombatActionData : public FTableRowBase
     {
         return static_cast<int32>(PriorityLevel);
     }
+
+#if WITH_EDITOR
+    // Query-cost warnings from the combat data linter (CombatDataLinter.cpp)
+    virtual EDataValidationResult IsDataValid(FDataValidationContext& Context) const override;
+#endif
 };
 
 USTRUCT(BlueprintType)
@@ -340,6 +345,11 @@ struct EROEOREOREOR_API FAttackPrototypeData : public FTableRowBase
         FAttackShapeData DefaultShape;
         AttackShapes.Add(DefaultShape);
     }
+
+#if WITH_EDITOR
+    // Query-cost warnings from the combat data linter (CombatDataLinter.cpp)
+    virtual EDataValidationResult IsDataValid(FDataValidationContext& Context) const override;
+#endif
 };
 
 // Combat system constants
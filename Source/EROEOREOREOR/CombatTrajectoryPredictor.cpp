@@ -0,0 +1,261 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CombatTrajectoryPredictor.h"
+#include "Curves/CurveFloat.h"
+
+namespace
+{
+	/**
+	 * Vertical motion under GravityA for [0, Duration], then GravityB
+	 * Matches the Bounce window (scaled gravity, then falling) and an airborne dash (optional no-gravity, then falling)
+	 */
+	struct FTwoPhaseVertical
+	{
+		float Z0;
+		float Vz0;
+		float GravityA;
+		float Duration;
+		float GravityB;
+		float ZAtPhaseEnd;
+		float VzAtPhaseEnd;
+
+		FTwoPhaseVertical(float InZ0, float InVz0, float InGravityA, float InDuration, float InGravityB)
+			: Z0(InZ0)
+			, Vz0(InVz0)
+			, GravityA(InGravityA)
+			, Duration(FMath::Max(InDuration, 0.0f))
+			, GravityB(InGravityB)
+		{
+			ZAtPhaseEnd = Z0 + Vz0 * Duration + 0.5f * GravityA * Duration * Duration;
+			VzAtPhaseEnd = Vz0 + GravityA * Duration;
+		}
+
+		float ZAt(float InTime) const
+		{
+			if (InTime <= Duration)
+			{
+				return Z0 + Vz0 * InTime + 0.5f * GravityA * InTime * InTime;
+			}
+
+			const float T = InTime - Duration;
+			return ZAtPhaseEnd + VzAtPhaseEnd * T + 0.5f * GravityB * T * T;
+		}
+
+		float VzAt(float InTime) const
+		{
+			return InTime <= Duration ? Vz0 + GravityA * InTime : VzAtPhaseEnd + GravityB * (InTime - Duration);
+		}
+
+		float SolveApexTime() const
+		{
+			if (Vz0 <= 0.0f)
+			{
+				return 0.0f;
+			}
+
+			if (GravityA < 0.0f && -Vz0 / GravityA <= Duration)
+			{
+				return -Vz0 / GravityA;
+			}
+
+			if (VzAtPhaseEnd > 0.0f && GravityB < 0.0f)
+			{
+				return Duration + VzAtPhaseEnd / -GravityB;
+			}
+
+			// Still rising with no gravity to stop it - report the end of the first phase
+			return Duration;
+		}
+
+		bool SolveLanding(float LandingZ, float& OutTime) const
+		{
+			float PhaseTime = 0.0f;
+			if (Duration > 0.0f && FCombatTrajectoryPredictor::SolveLandingTime(Z0, Vz0, GravityA, LandingZ, PhaseTime) && PhaseTime <= Duration)
+			{
+				OutTime = PhaseTime;
+				return true;
+			}
+
+			if (FCombatTrajectoryPredictor::SolveLandingTime(ZAtPhaseEnd, VzAtPhaseEnd, GravityB, LandingZ, PhaseTime))
+			{
+				OutTime = Duration + PhaseTime;
+				return true;
+			}
+
+			return false;
+		}
+	};
+
+	// Dash horizontal motion - eased profile for Duration, then the retained velocity
+	struct FDashHorizontal
+	{
+		FVector Scale;
+		float Speed;
+		float Duration;
+		FVector EndDisplacement;
+		FVector RetainedVelocity;
+		const FCombatDashParams& Params;
+
+		explicit FDashHorizontal(const FDashTrajectoryQuery& Query)
+			: Params(Query.DashParams)
+		{
+			// Same axis handling as UCombatMovementComponent::CalculateDashVelocity
+			const FVector Direction = Query.RightVector.GetSafeNormal2D() * FMath::Sign(Params.DirectionSign);
+			Scale = FVector(Direction.X * Params.XAxisMultiplier, Direction.Y * Params.YAxisMultiplier, 0.0f) * Params.VelocityMultiplier;
+			Speed = Params.Speed;
+			Duration = FMath::Max(Params.Duration, UE_KINDA_SMALL_NUMBER);
+			EndDisplacement = Scale * (Speed * Duration * FCombatTrajectoryPredictor::IntegrateDashSpeed(Params, 1.0f));
+			RetainedVelocity = Scale * Params.EvaluateSpeed(1.0f) * Params.MomentumRetention;
+		}
+
+		FVector DisplacementAt(float InTime) const
+		{
+			if (InTime <= Duration)
+			{
+				return Scale * (Speed * Duration * FCombatTrajectoryPredictor::IntegrateDashSpeed(Params, InTime / Duration));
+			}
+
+			return EndDisplacement + RetainedVelocity * (InTime - Duration);
+		}
+
+		FVector VelocityAt(float InTime) const
+		{
+			return InTime < Duration ? Scale * Params.EvaluateSpeed(InTime / Duration) : RetainedVelocity;
+		}
+	};
+}
+
+float FCombatTrajectoryPredictor::IntegrateDashSpeed(const FCombatDashParams& Params, float InAlpha)
+{
+	const float Alpha = FMath::Clamp(InAlpha, 0.0f, 1.0f);
+
+	if (IsValid(Params.SpeedCurve))
+	{
+		// Simpson's rule over [0, Alpha] - designer curves have no closed form
+		const float Step = Alpha / CURVE_INTEGRATION_STEPS;
+		float Sum = Params.SpeedCurve->GetFloatValue(0.0f) + Params.SpeedCurve->GetFloatValue(Alpha);
+		for (int32 Index = 1; Index < CURVE_INTEGRATION_STEPS; ++Index)
+		{
+			Sum += (Index % 2 == 1 ? 4.0f : 2.0f) * Params.SpeedCurve->GetFloatValue(Step * Index);
+		}
+		return Sum * Step / 3.0f;
+	}
+
+	// Default ease-out speed is 0.2 + 0.8 * (1 - a)^2 - integrated exactly
+	const float OneMinusAlpha = 1.0f - Alpha;
+	return 0.2f * Alpha + (0.8f / 3.0f) * (1.0f - OneMinusAlpha * OneMinusAlpha * OneMinusAlpha);
+}
+
+bool FCombatTrajectoryPredictor::SolveLandingTime(float Z0, float Vz, float Gz, float LandingZ, float& OutTime)
+{
+	const float Height = Z0 - LandingZ;
+
+	if (FMath::IsNearlyZero(Gz))
+	{
+		if (Vz < 0.0f && Height >= 0.0f)
+		{
+			OutTime = Height / -Vz;
+			return true;
+		}
+		return false;
+	}
+
+	const float Discriminant = Vz * Vz - 2.0f * Gz * Height;
+	if (Discriminant < 0.0f)
+	{
+		return false;
+	}
+
+	// The descending crossing is (-Vz - sqrt(D)) / Gz for either sign of gravity
+	const float Time = (-Vz - FMath::Sqrt(Discriminant)) / Gz;
+	if (Time < 0.0f)
+	{
+		return false;
+	}
+
+	OutTime = Time;
+	return true;
+}
+
+FCombatTrajectoryPrediction FCombatTrajectoryPredictor::PredictBounce(const FBounceTrajectoryQuery& Query)
+{
+	FCombatTrajectoryPrediction Result;
+
+	const FTwoPhaseVertical Vertical(Query.StartLocation.Z, Query.LaunchVelocity.Z,
+		Query.GravityZ * Query.GravityScale, Query.Duration, Query.GravityZ);
+	const FVector HorizontalVelocity(Query.LaunchVelocity.X, Query.LaunchVelocity.Y, 0.0f);
+
+	Result.ApexTime = Vertical.SolveApexTime();
+	Result.Apex = Query.StartLocation + HorizontalVelocity * Result.ApexTime;
+	Result.Apex.Z = Vertical.ZAt(Result.ApexTime);
+
+	float LandingTime = 0.0f;
+	if (Vertical.SolveLanding(Query.LandingZ, LandingTime))
+	{
+		Result.bLands = true;
+		Result.LandingTime = LandingTime;
+		Result.LandingPoint = Query.StartLocation + HorizontalVelocity * LandingTime;
+		Result.LandingPoint.Z = Query.LandingZ;
+		Result.LandingVelocity = HorizontalVelocity;
+		Result.LandingVelocity.Z = Vertical.VzAt(LandingTime);
+	}
+
+	return Result;
+}
+
+FCombatTrajectoryPrediction FCombatTrajectoryPredictor::PredictDash(const FDashTrajectoryQuery& Query)
+{
+	FCombatTrajectoryPrediction Result;
+	const FDashHorizontal Horizontal(Query);
+
+	// Grounded dash stays on its floor - "landing" is where the dash hands back to walking
+	if (Query.bStartOnGround)
+	{
+		Result.Apex = Query.StartLocation;
+		Result.bLands = true;
+		Result.LandingTime = Horizontal.Duration;
+		Result.LandingPoint = Query.StartLocation + Horizontal.EndDisplacement;
+		Result.LandingVelocity = Horizontal.RetainedVelocity;
+		return Result;
+	}
+
+	const float DashGravityZ = Query.DashParams.bIgnoreGravity ? 0.0f : Query.GravityZ;
+	const FTwoPhaseVertical Vertical(Query.StartLocation.Z, Query.StartVelocityZ, DashGravityZ, Horizontal.Duration, Query.GravityZ);
+
+	Result.ApexTime = Vertical.SolveApexTime();
+	Result.Apex = Query.StartLocation + Horizontal.DisplacementAt(Result.ApexTime);
+	Result.Apex.Z = Vertical.ZAt(Result.ApexTime);
+
+	float LandingTime = 0.0f;
+	if (Vertical.SolveLanding(Query.LandingZ, LandingTime))
+	{
+		Result.bLands = true;
+		Result.LandingTime = LandingTime;
+		Result.LandingPoint = Query.StartLocation + Horizontal.DisplacementAt(LandingTime);
+		Result.LandingPoint.Z = Query.LandingZ;
+		Result.LandingVelocity = Horizontal.VelocityAt(LandingTime);
+		Result.LandingVelocity.Z = Vertical.VzAt(LandingTime);
+	}
+
+	return Result;
+}
+
+void FCombatTrajectoryPredictor::PredictBounceBatch(TConstArrayView<FBounceTrajectoryQuery> Queries, TArrayView<FCombatTrajectoryPrediction> OutPredictions)
+{
+	check(OutPredictions.Num() >= Queries.Num());
+
+	for (int32 Index = 0; Index < Queries.Num(); ++Index)
+	{
+		OutPredictions[Index] = PredictBounce(Queries[Index]);
+	}
+}
+
+void FCombatTrajectoryPredictor::PredictDashBatch(TConstArrayView<FDashTrajectoryQuery> Queries, TArrayView<FCombatTrajectoryPrediction> OutPredictions)
+{
+	check(OutPredictions.Num() >= Queries.Num());
+
+	for (int32 Index = 0; Index < Queries.Num(); ++Index)
+	{
+		OutPredictions[Index] = PredictDash(Queries[Index]);
+	}
+}
@@ -0,0 +1,109 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CombatMovementComponent.h"
+#include "CombatTrajectoryPredictor.generated.h"
+
+/**
+ * Closed-form result of a predicted Dash or Bounce
+ * Landing is measured against a flat landing plane - the caller supplies its height (actor-location Z)
+ */
+USTRUCT(BlueprintType)
+struct FCombatTrajectoryPrediction
+{
+	GENERATED_BODY()
+
+	// Highest actor location along the path (start location when the move never rises)
+	UPROPERTY(BlueprintReadOnly, Category = "Trajectory")
+	FVector Apex = FVector::ZeroVector;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Trajectory")
+	float ApexTime = 0.0f;
+
+	// First touchdown on the landing plane - for a grounded dash, where the dash ends
+	UPROPERTY(BlueprintReadOnly, Category = "Trajectory")
+	FVector LandingPoint = FVector::ZeroVector;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Trajectory")
+	float LandingTime = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Trajectory")
+	FVector LandingVelocity = FVector::ZeroVector;
+
+	// False when the path never comes back down to the landing plane
+	UPROPERTY(BlueprintReadOnly, Category = "Trajectory")
+	bool bLands = false;
+};
+
+/**
+ * Bounce launch as handed to UCombatMovementComponent
+ * Build with UGameplayAbility_Bounce::MakeBounceTrajectoryQuery so trajectory type and momentum transfer match the ability
+ */
+struct FBounceTrajectoryQuery
+{
+	FVector StartLocation = FVector::ZeroVector;
+	FVector LaunchVelocity = FVector::ZeroVector;
+
+	// Gravity Z of the movement component (negative)
+	float GravityZ = -980.0f;
+
+	// Bounce window - gravity is scaled by GravityScale for Duration seconds, then normal falling
+	float GravityScale = 1.0f;
+	float Duration = 0.0f;
+
+	float LandingZ = 0.0f;
+};
+
+/**
+ * Dash as handed to UCombatMovementComponent
+ * Build with UGameplayAbility_Dash::MakeDashTrajectoryQuery so params and camera basis match the ability
+ */
+struct FDashTrajectoryQuery
+{
+	FVector StartLocation = FVector::ZeroVector;
+
+	// Camera-right unit vector - DashParams.DirectionSign picks left or right
+	FVector RightVector = FVector::RightVector;
+
+	// Vertical velocity when the dash starts - ignored for grounded dashes
+	float StartVelocityZ = 0.0f;
+	bool bStartOnGround = true;
+
+	float GravityZ = -980.0f;
+	float LandingZ = 0.0f;
+
+	FCombatDashParams DashParams;
+};
+
+/**
+ * Analytic predictor for Dash and Bounce paths - no world, no traces, no allocations
+ * Mirrors PhysDash/PhysBounce for the no-input case: horizontal velocity is constant while falling
+ * (FallingLateralFriction and BrakingDecelerationFalling are 0 on the combat movement component),
+ * dash distance is the closed-form integral of the default ease-out, and gravity is piecewise constant.
+ * Terrain is a flat landing plane; walking off ledges mid-dash and terminal velocity are not modelled.
+ *
+ * PERFORMANCE: each prediction is a handful of multiplies and at most two square roots.
+ * The batch entry points are intended for AI evaluating many candidate moves per tick.
+ */
+class EROEOREOREOR_API FCombatTrajectoryPredictor
+{
+public:
+	static FCombatTrajectoryPrediction PredictBounce(const FBounceTrajectoryQuery& Query);
+	static FCombatTrajectoryPrediction PredictDash(const FDashTrajectoryQuery& Query);
+
+	// OutPredictions must be at least as large as Queries
+	static void PredictBounceBatch(TConstArrayView<FBounceTrajectoryQuery> Queries, TArrayView<FCombatTrajectoryPrediction> OutPredictions);
+	static void PredictDashBatch(TConstArrayView<FDashTrajectoryQuery> Queries, TArrayView<FCombatTrajectoryPrediction> OutPredictions);
+
+	// Dash distance covered by normalized time InAlpha, in units of Speed * Duration (before axis/velocity multipliers)
+	static float IntegrateDashSpeed(const FCombatDashParams& Params, float InAlpha);
+
+	// Earliest descending time at which Z0 + Vz*t + 0.5*Gz*t^2 reaches LandingZ. False when it never does.
+	static bool SolveLandingTime(float Z0, float Vz, float Gz, float LandingZ, float& OutTime);
+
+private:
+	// Samples used to integrate a custom SpeedCurve - the default ease-out is integrated exactly
+	static constexpr int32 CURVE_INTEGRATION_STEPS = 16;
+};
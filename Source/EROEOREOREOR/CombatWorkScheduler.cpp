@@ -0,0 +1,166 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "CombatWorkScheduler.h"
+#include "CombatStats.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<float> CVarCombatBudgetFrameUs(
+	TEXT("Combat.Budget.FrameUs"),
+	0.0f,
+	TEXT("Game thread time combat hit detection may spend per frame, in microseconds. 0 disables the budget."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarCombatBudgetLowFraction(
+	TEXT("Combat.Budget.LowPriorityFraction"),
+	0.5f,
+	TEXT("Share of the frame budget low-priority work may start in - the rest is kept for work near players or in view."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarCombatBudgetMaxDeferFrames(
+	TEXT("Combat.Budget.MaxDeferFrames"),
+	4,
+	TEXT("Consecutive frames a piece of combat work may be deferred before it is forced through."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarCombatBudgetCriticalRadius(
+	TEXT("Combat.Budget.CriticalRadius"),
+	600.0f,
+	TEXT("Work within this distance of a player pawn is never deferred, in cm."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarCombatBudgetNearRadius(
+	TEXT("Combat.Budget.NearRadius"),
+	2500.0f,
+	TEXT("Work within this distance of a player pawn, or inside a player's view, is high priority, in cm."),
+	ECVF_Default);
+
+UCombatWorkScheduler* UCombatWorkScheduler::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UCombatWorkScheduler>() : nullptr;
+}
+
+bool UCombatWorkScheduler::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+ECombatWorkPriority UCombatWorkScheduler::GetPriority(const AActor* Instigator, const FVector& Location, bool bPersistentField)
+{
+	const APawn* InstigatorPawn = Cast<APawn>(Instigator);
+	if (InstigatorPawn && InstigatorPawn->IsPlayerControlled())
+	{
+		return ECombatWorkPriority::Critical;
+	}
+
+	BeginFrameIfNeeded();
+
+	const float CriticalRadiusSq = FMath::Square(CVarCombatBudgetCriticalRadius.GetValueOnGameThread());
+	const float NearRadiusSq = FMath::Square(CVarCombatBudgetNearRadius.GetValueOnGameThread());
+
+	ECombatWorkPriority Priority = ECombatWorkPriority::Low;
+	for (const FPlayerView& View : PlayerViews)
+	{
+		const float DistSq = FVector::DistSquared(View.PawnLocation, Location);
+		if (DistSq <= CriticalRadiusSq)
+		{
+			// A player may be the one getting hit
+			return ECombatWorkPriority::Critical;
+		}
+
+		if (DistSq <= NearRadiusSq
+			|| FVector::DotProduct((Location - View.ViewLocation).GetSafeNormal(), View.ViewDirection) >= View.CosHalfFOV)
+		{
+			Priority = ECombatWorkPriority::High;
+		}
+	}
+
+	return bPersistentField ? ECombatWorkPriority::Low : Priority;
+}
+
+bool UCombatWorkScheduler::IsBudgetEnabled()
+{
+	return CVarCombatBudgetFrameUs.GetValueOnGameThread() > 0.0f;
+}
+
+bool UCombatWorkScheduler::TryAdmit(ECombatWorkPriority Priority, int32& InOutDeferredFrames)
+{
+	BeginFrameIfNeeded();
+
+	const float BudgetUs = CVarCombatBudgetFrameUs.GetValueOnGameThread();
+
+	bool bAdmit = BudgetUs <= 0.0f
+		|| Priority == ECombatWorkPriority::Critical
+		|| InOutDeferredFrames >= CVarCombatBudgetMaxDeferFrames.GetValueOnGameThread();
+
+	if (!bAdmit)
+	{
+		// Low-priority work only starts in the front of the budget so high-priority work still finds room
+		const float PriorityBudgetUs = Priority == ECombatWorkPriority::Low
+			? BudgetUs * FMath::Clamp(CVarCombatBudgetLowFraction.GetValueOnGameThread(), 0.0f, 1.0f)
+			: BudgetUs;
+		bAdmit = GetSpentMicroseconds() < PriorityBudgetUs;
+	}
+
+	if (!bAdmit)
+	{
+		++InOutDeferredFrames;
+		COMBAT_COUNTER_ADD(Deferred, 1);
+		return false;
+	}
+
+	if (InOutDeferredFrames > 0)
+	{
+		COMBAT_COUNTER_ADD(CaughtUp, 1);
+		InOutDeferredFrames = 0;
+	}
+	return true;
+}
+
+double UCombatWorkScheduler::GetSpentMicroseconds() const
+{
+	return FPlatformTime::ToMilliseconds64(SpentCycles) * 1000.0;
+}
+
+void UCombatWorkScheduler::BeginFrameIfNeeded()
+{
+	if (FrameNumber == GFrameCounter)
+	{
+		return;
+	}
+
+	FrameNumber = GFrameCounter;
+	SpentCycles = 0;
+	GatherPlayerViews();
+}
+
+void UCombatWorkScheduler::GatherPlayerViews()
+{
+	PlayerViews.Reset();
+
+	// Server-side controllers of remote players report their replicated view point, so this also holds on a dedicated server
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PlayerController = It->Get();
+		const APawn* Pawn = PlayerController ? PlayerController->GetPawn() : nullptr;
+		if (!Pawn)
+		{
+			continue;
+		}
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+		const float FOV = PlayerController->PlayerCameraManager ? PlayerController->PlayerCameraManager->GetFOVAngle() : 90.0f;
+
+		FPlayerView& View = PlayerViews.AddDefaulted_GetRef();
+		View.PawnLocation = Pawn->GetActorLocation();
+		View.ViewLocation = ViewLocation;
+		View.ViewDirection = ViewRotation.Vector();
+		View.CosHalfFOV = FMath::Cos(FMath::DegreesToRadians(FOV * 0.5f));
+	}
+}
@@ -0,0 +1,96 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CombatWorkScheduler.generated.h"
+
+enum class ECombatWorkPriority : uint8
+{
+	Critical,	// Player attacks and attacks on players - never deferred
+	High,		// Near a player or inside a player's view
+	Low			// Distant, off-screen NPC-vs-NPC work and persistent field ticks
+};
+
+/**
+ * Per-frame budget for combat hit detection
+ * Attack shapes and AoE fields ask for admission before running their queries. Work runs in priority order
+ * while the frame has budget left (Combat.Budget.FrameUs); the rest is deferred to a later frame.
+ * The caller keeps what it owes (frames of attack shapes, persistent field ticks) and work deferred
+ * Combat.Budget.MaxDeferFrames times in a row is forced through. Owed work is not replayed frame by frame: a shape
+ * active in any owed frame is tested once, and owed field ticks once, at the current poses. Deferred hits are an
+ * approximation - a victim that passed through a shape during the owed frames and left is missed, one that walked
+ * in is hit. The error is bounded by MaxDeferFrames frames of movement.
+ *
+ * Critical work always runs but is still charged, so a heavy player-side frame leaves less room for the rest.
+ * Deferred and caught-up work is counted through COMBAT_COUNTER_ADD (stat Combat, Insights Combat channel).
+ */
+UCLASS()
+class EROEOREOREOR_API UCombatWorkScheduler : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UCombatWorkScheduler* Get(const UWorld* World);
+
+	/**
+	 * Priority of hit work by Instigator centered on Location
+	 * bPersistentField drops non-critical work one step - a lingering field tolerates latency better than a swing.
+	 */
+	ECombatWorkPriority GetPriority(const AActor* Instigator, const FVector& Location, bool bPersistentField = false);
+
+	/**
+	 * True when the caller should run its work now. InOutDeferredFrames counts consecutive deferrals of that
+	 * work: it is incremented on deferral and reset on admission. Always true while the budget is disabled.
+	 */
+	bool TryAdmit(ECombatWorkPriority Priority, int32& InOutDeferredFrames);
+
+	// False while Combat.Budget.FrameUs is 0 - callers skip GetPriority and TryAdmit, and nothing is deferred
+	static bool IsBudgetEnabled();
+
+	// Charges the enclosed work to the current frame's budget
+	struct FScopedWork
+	{
+		explicit FScopedWork(UCombatWorkScheduler* InScheduler)
+			: Scheduler(InScheduler)
+			, StartCycles(InScheduler ? FPlatformTime::Cycles64() : 0)
+		{
+		}
+
+		~FScopedWork()
+		{
+			if (Scheduler)
+			{
+				Scheduler->SpentCycles += FPlatformTime::Cycles64() - StartCycles;
+			}
+		}
+
+		UCombatWorkScheduler* Scheduler;
+		uint64 StartCycles;
+	};
+
+	// Budget spent so far this frame, in microseconds
+	double GetSpentMicroseconds() const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FPlayerView
+	{
+		FVector PawnLocation = FVector::ZeroVector;
+		FVector ViewLocation = FVector::ZeroVector;
+		FVector ViewDirection = FVector::ForwardVector;
+		float CosHalfFOV = 0.0f;
+	};
+
+	// Player views are gathered once per frame, on the first admission request
+	TArray<FPlayerView, TInlineAllocator<4>> PlayerViews;
+
+	uint64 FrameNumber = MAX_uint64;
+	uint64 SpentCycles = 0;
+
+	void BeginFrameIfNeeded();
+	void GatherPlayerViews();
+};
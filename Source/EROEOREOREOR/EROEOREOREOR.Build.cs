@@ -14,7 +14,13 @@ public class EROEOREOREOR : ModuleRules
 			"GameplayTags", "GameplayTasks", "UMG", "Slate", "SlateCore",
 			"NetCore", "ReplicationGraph" });
 
-		PrivateDependencyModuleNames.AddRange(new string[] {  });
+		PrivateDependencyModuleNames.AddRange(new string[] { "AssetRegistry", "SignificanceManager" });
+
+		// Networked automation tests start PIE sessions
+		if (Target.bBuildEditor)
+		{
+			PrivateDependencyModuleNames.Add("UnrealEd");
+		}
 
 		// Uncomment if you are using Slate UI
 		// PrivateDependencyModuleNames.AddRange(new string[] { "Slate", "SlateCore" });
@@ -3,6 +3,28 @@
 #include "EROEOREOREOR.h"
 #include "Modules/ModuleManager.h"
 #include "GameplayTagsManager.h"
+#include "CombatStats.h"
+#include "CombatLog.h"
+#include "CombatHitchCapture.h"
+#include "CombatPerfHud.h"
+#include "CombatReplicationGraph.h"
+#include "Misc/CoreDelegates.h"
+
+DEFINE_LOG_CATEGORY(LogCombat);
+DEFINE_LOG_CATEGORY(LogDash);
+DEFINE_LOG_CATEGORY(LogBounce);
+DEFINE_LOG_CATEGORY(LogAoE);
+
+// Counters and gauges are flushed first so the hitch capture and perf HUD sample this frame's totals
+static void OnCombatEndFrame()
+{
+	FCombatFrameCounters::Flush();
+#if !UE_BUILD_SHIPPING
+	FCombatFrameGauges::Flush();
+	FCombatHitchCapture::EndFrame();
+	FCombatPerfHud::EndFrame();
+#endif
+}
 
 // Custom game module for native tag registration - Epic Games standard
 class FEROEOREOREORGameModule : public FDefaultGameModuleImpl
@@ -19,8 +41,25 @@ public:
 		GameplayTagsManager.AddNativeGameplayTag(FName("Input.Dash.Left"), TEXT("Left dash input direction"));
 		GameplayTagsManager.AddNativeGameplayTag(FName("Input.Dash.Right"), TEXT("Right dash input direction"));
 		
-		UE_LOG(LogTemp, Log, TEXT("EROEOREOREOR: Native gameplay tags registered"));
+		UE_LOG(LogCombat, Log, TEXT("EROEOREOREOR: Native gameplay tags registered"));
+		
+		// Per-frame combat counters go out to the trace once the frame's work is done
+		EndFrameHandle = FCoreDelegates::OnEndFrame.AddStatic(&OnCombatEndFrame);
+		
+		// Game net drivers pick up the combat replication graph (Combat.RepGraph.Enable)
+		UReplicationDriver::CreateReplicationDriverDelegate().BindStatic(&UCombatReplicationGraph::CreateReplicationDriver);
+	}
+	
+	virtual void ShutdownModule() override
+	{
+		FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+		UReplicationDriver::CreateReplicationDriverDelegate().Unbind();
+		
+		FDefaultGameModuleImpl::ShutdownModule();
 	}
+	
+private:
+	FDelegateHandle EndFrameHandle;
 };
 
 IMPLEMENT_PRIMARY_GAME_MODULE( FEROEOREOREORGameModule, EROEOREOREOR, "EROEOREOREOR" );
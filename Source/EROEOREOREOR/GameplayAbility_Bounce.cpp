@@ -3,6 +3,10 @@
 #include "GameplayAbility_Bounce.h"
 #include "MyCharacter.h"
 #include "MyAttributeSet.h"
+#include "CombatMovementComponent.h"
+#include "CombatMathKernels.h"
+#include "CombatStats.h"
+#include "CombatLog.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "GameFramework/Character.h"
@@ -14,6 +18,14 @@
 #include "GameplayTagsModule.h"
 #include "GameplayEffect.h"
 
+// Activation-path logging - runs on every bounce press, so everything below BOUNCE_LOG_COMPILE_VERBOSITY
+// is stripped from the binary (see CombatLog.h)
+#if !UE_BUILD_SHIPPING
+    #define BOUNCE_LOG(Verbosity, Format, ...) UE_LOG(LogBounce, Verbosity, TEXT("[BounceAbility] ") Format, ##__VA_ARGS__)
+#else
+    #define BOUNCE_LOG(Verbosity, Format, ...)
+#endif
+
 UGameplayAbility_Bounce::UGameplayAbility_Bounce()
 {
 	// GAS Configuration - Following Epic Games patterns (UE 5.6 API)
@@ -46,30 +58,29 @@ UGameplayAbility_Bounce::UGameplayAbility_Bounce()
 
 bool UGameplayAbility_Bounce::CanActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayTagContainer* SourceTags, const FGameplayTagContainer* TargetTags, OUT FGameplayTagContainer* OptionalRelevantTags) const
 {
-	UE_LOG(LogTemp, Log, TEXT("UGameplayAbility_Bounce::CanActivateAbility - Starting validation"));
-
+	COMBAT_SCOPE(BounceValidation);
+	
 	if (!Super::CanActivateAbility(Handle, ActorInfo, SourceTags, TargetTags, OptionalRelevantTags))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UGameplayAbility_Bounce::CanActivateAbility - Super::CanActivateAbility returned false"));
+		BOUNCE_LOG(Verbose, TEXT("CanActivateAbility: Super::CanActivateAbility returned false"));
 		return false;
 	}
 
 	const AMyCharacter* Character = Cast<AMyCharacter>(ActorInfo->AvatarActor.Get());
 	if (!Character)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("UGameplayAbility_Bounce::CanActivateAbility - Character cast failed"));
+		BOUNCE_LOG(Warning, TEXT("CanActivateAbility: Character cast failed"));
 		return false;
 	}
 
-	const bool bValidationResult = ValidateActivationRequirements(Character);
-	UE_LOG(LogTemp, Log, TEXT("UGameplayAbility_Bounce::CanActivateAbility - Validation result: %s"), 
-		bValidationResult ? TEXT("PASS") : TEXT("FAIL"));
-
-	return bValidationResult;
+	// Builds the activation context for this frame - ActivateAbility/ExecuteBounce reuse it
+	return ValidateActivationRequirements(Character);
 }
 
 void UGameplayAbility_Bounce::ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData)
 {
+	COMBAT_SCOPE(BounceActivate);
+	
 	if (!CommitAbility(Handle, ActorInfo, ActivationInfo))
 	{
 		EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
@@ -80,7 +91,7 @@ void UGameplayAbility_Bounce::ActivateAbility(const FGameplayAbilitySpecHandle H
 	CachedCharacter = Cast<AMyCharacter>(ActorInfo->AvatarActor.Get());
 	if (!CachedCharacter.IsValid())
 	{
-		UE_LOG(LogTemp, Error, TEXT("GameplayAbility_Bounce: Invalid character reference"));
+		BOUNCE_LOG(Error, TEXT("ActivateAbility: Invalid character reference"));
 		EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
 		return;
 	}
@@ -91,26 +102,15 @@ void UGameplayAbility_Bounce::ActivateAbility(const FGameplayAbilitySpecHandle H
 	{
 		Character->LandedDelegate.AddDynamic(this, &UGameplayAbility_Bounce::OnLandedDelegate);
 		bLandedDelegateRegistered = true;
-		UE_LOG(LogTemp, Log, TEXT("Bounce: Ground contact delegate registered for this instance"));
+		BOUNCE_LOG(Verbose, TEXT("Ground contact delegate registered for this instance"));
 	}
 
 	// EPIC GAMES STANDARD: Load curve assets asynchronously
 	LoadCurveAssets();
 
-	// PERFORMANCE: Cache air bounce count during ability execution
-	CachedAirBounceCount = GetCurrentAirBounceCount();
-
-	// Execute the bounce
+	// Execute the bounce - consumes the activation context built by CanActivateAbility this frame
 	ExecuteBounce();
 
-	// Debug logging
-	const bool bIsAirBounce = CurrentAirBounces > 0;
-	UE_LOG(LogTemp, Log, TEXT("Bounce Executed: AirBounce=%s, Count=%d/%d, Grounded=%s"), 
-		bIsAirBounce ? TEXT("True") : TEXT("False"), 
-		CurrentAirBounces, 
-		MaxAirBounces,
-		IsCharacterGrounded(CachedCharacter.Get()) ? TEXT("true") : TEXT("false"));
-
 	// End ability immediately (instantaneous like jump)
 	EndAbility(Handle, ActorInfo, ActivationInfo, false, false);
 }
@@ -118,11 +118,7 @@ void UGameplayAbility_Bounce::ActivateAbility(const FGameplayAbilitySpecHandle H
 void UGameplayAbility_Bounce::EndAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, bool bReplicateEndAbility, bool bWasCancelled)
 {
 	// EPIC GAMES STANDARD: Proper RAII cleanup - clean up timers first
-	if (BounceEffectTimer.IsValid())
-	{
-		GetWorld()->GetTimerManager().ClearTimer(BounceEffectTimer);
-	}
-
+	// The bounce physics window itself is owned by UCombatMovementComponent and outlives the ability
 	if (GroundCheckTimer.IsValid())
 	{
 		GetWorld()->GetTimerManager().ClearTimer(GroundCheckTimer);
@@ -140,11 +136,11 @@ void UGameplayAbility_Bounce::EndAbility(const FGameplayAbilitySpecHandle Handle
 	if (bWasCancelled)
 	{
 		CleanupDelegates();
-		UE_LOG(LogTemp, Log, TEXT("Bounce EndAbility: All delegates cleaned up due to cancellation"));
+		BOUNCE_LOG(Verbose, TEXT("EndAbility: All delegates cleaned up due to cancellation"));
 	}
 	else
 	{
-		UE_LOG(LogTemp, Log, TEXT("Bounce EndAbility: Keeping delegate active for persistent ground tracking"));
+		BOUNCE_LOG(Verbose, TEXT("EndAbility: Keeping delegate active for persistent ground tracking"));
 	}
 
 	Super::EndAbility(Handle, ActorInfo, ActivationInfo, bReplicateEndAbility, bWasCancelled);
@@ -158,7 +154,7 @@ void UGameplayAbility_Bounce::CleanupDelegates()
 	{
 		Character->LandedDelegate.RemoveDynamic(this, &UGameplayAbility_Bounce::OnLandedDelegate);
 		bLandedDelegateRegistered = false;
-		UE_LOG(LogTemp, VeryVerbose, TEXT("Bounce: Landed delegate cleaned up"));
+		BOUNCE_LOG(VeryVerbose, TEXT("Landed delegate cleaned up"));
 	}
 	
 	// Clear cached character reference safely
@@ -173,159 +169,212 @@ void UGameplayAbility_Bounce::CancelAbility(const FGameplayAbilitySpecHandle Han
 
 void UGameplayAbility_Bounce::ExecuteBounce()
 {
+	const FBounceTuningBlock& Tuning = GetBounceTuningData()->GetBlock();
 	AMyCharacter* Character = CachedCharacter.Get();
 	if (!IsValid(Character))
 	{
-		UE_LOG(LogTemp, Error, TEXT("ExecuteBounce: Invalid cached character"));
+		BOUNCE_LOG(Error, TEXT("ExecuteBounce: Invalid cached character"));
 		return;
 	}
 
-	UCharacterMovementComponent* MovementComponent = Character->GetCharacterMovement();
-	if (!IsValid(MovementComponent))
+	if (!IsValid(Character->GetCombatMovementComponent()))
 	{
-		UE_LOG(LogTemp, Error, TEXT("ExecuteBounce: Invalid movement component"));
+		BOUNCE_LOG(Error, TEXT("ExecuteBounce: Character movement is not a UCombatMovementComponent"));
 		return;
 	}
 
 	// CRITICAL FIX: Re-validate activation requirements at execution time
-	// This ensures consistency between CanActivateAbility and ExecuteBounce
-	if (!ValidateActivationRequirements(Character))
+	// Same-frame activations reuse the context from CanActivateAbility, so this is a cache hit, not a second query
+	const FBounceActivationContext& Context = GetActivationContext(Character);
+	if (!Context.bPassed)
 	{
-		UE_LOG(LogTemp, Error, TEXT("ExecuteBounce: Validation failed at execution time - aborting bounce"));
+		BOUNCE_LOG(Warning, TEXT("ExecuteBounce: Validation failed at execution time - aborting bounce"));
 		return;
 	}
 
-	// Determine if this is an air bounce
-	const bool bWasGrounded = IsCharacterGrounded(Character);
-	const bool bIsAirBounce = !bWasGrounded;
+	// Copy what we need - the context is invalidated below once the air bounce count changes
+	const bool bIsAirBounce = !Context.bIsGrounded;
+	const int32 AirBouncesAfter = Context.AirBounceCount + (bIsAirBounce ? 1 : 0);
 
 	// INDUSTRY BEST PRACTICE: Use Gameplay Attributes for state management
 	if (bIsAirBounce)
 	{
 		IncrementAirBounceCount();
-		const int32 NewCount = GetCurrentAirBounceCount();
-		UE_LOG(LogTemp, Log, TEXT("ExecuteBounce: Air bounce executed, count now %d/%d"), NewCount, MaxAirBounces);
-	}
-	else
-	{
-		const int32 CurrentCount = GetCurrentAirBounceCount();
-		UE_LOG(LogTemp, Log, TEXT("ExecuteBounce: Ground bounce executed, air bounce count remains %d/%d"), CurrentCount, MaxAirBounces);
 	}
 
-	// Apply bounce physics
-	ApplyBouncePhysics();
+	// Air bounce count changed - a second press in this frame must rebuild
+	CachedActivationContext.Invalidate();
 
-	// Apply bounce effects
-	if (BounceDuration > 0.0f)
-	{
-		GetWorld()->GetTimerManager().SetTimer(BounceEffectTimer, 
-			FTimerDelegate::CreateUObject(this, &UGameplayAbility_Bounce::FinalizeBounce), 
-			BounceDuration, 
-			false);
-	}
+	BOUNCE_LOG(Verbose, TEXT("ExecuteBounce: %s bounce, air bounces %d/%d"),
+		bIsAirBounce ? TEXT("Air") : TEXT("Ground"), AirBouncesAfter, Tuning.MaxAirBounces);
+
+	// Hand the bounce to the movement component - launch and physics window run inside PhysCustom
+	ApplyBouncePhysics();
 
-	// Debug visualization
+	// Debug visualization - draws the launch handed to the movement component, no recompute
 	if (bEnableBounceDebugDraw)
 	{
 		const FVector StartLocation = Character->GetActorLocation();
-		const FVector BounceVelocity = CalculateBounceVelocity(Character);
-		const FVector EndLocation = StartLocation + (BounceVelocity * 0.5f);
+		const FVector EndLocation = StartLocation + (LastLaunchVelocity * 0.5f);
 
 		DrawDebugSphere(GetWorld(), StartLocation, 50.0f, 12, FColor::Green, false, DebugDrawDuration, 0, 2.0f);
 		DrawDebugDirectionalArrow(GetWorld(), StartLocation, EndLocation, 100.0f, FColor::Yellow, false, DebugDrawDuration, 0, 3.0f);
 		
-		// Display air bounce count
-		const int32 CurrentCount = GetCurrentAirBounceCount();
-		const FString DebugText = FString::Printf(TEXT("Air Bounces: %d/%d"), CurrentCount, MaxAirBounces);
+		const FString DebugText = FString::Printf(TEXT("Air Bounces: %d/%d"), AirBouncesAfter, Tuning.MaxAirBounces);
 		DrawDebugString(GetWorld(), StartLocation + FVector(0, 0, 100), DebugText, nullptr, FColor::White, DebugDrawDuration);
 	}
 }
 
 void UGameplayAbility_Bounce::ApplyBouncePhysics()
 {
+	const FBounceTuningBlock& Tuning = GetBounceTuningData()->GetBlock();
 	AMyCharacter* Character = CachedCharacter.Get();
 	if (!IsValid(Character))
 	{
 		return;
 	}
 
-	UCharacterMovementComponent* MovementComponent = Character->GetCharacterMovement();
-	if (!IsValid(MovementComponent))
+	UCombatMovementComponent* CombatMovement = Character->GetCombatMovementComponent();
+	if (!IsValid(CombatMovement))
 	{
 		return;
 	}
 
-	const FVector CurrentVelocity = MovementComponent->Velocity;
-	FVector NewVelocity;
+	// Physics modifications are scoped to the Bounce movement mode - no GravityScale/AirControl mutation to undo.
+	// Launch inputs are read once here and travel with the params (and the saved move) from now on.
+	// LaunchVelocity is the fallback; with the resolver bound the movement component re-evaluates it inside the move.
+	FCombatBounceParams Params;
+	Params.AirBounceCount = ReadAirBounceCount(Character);
+	Params.bHasMomentum = TryGetMomentumContext(Character, Params.Momentum);
+	Params.LaunchVelocity = ResolveLaunchVelocity(CombatMovement->Velocity, Params);
+	LastLaunchVelocity = Params.LaunchVelocity;
+	Params.Duration = Tuning.GetDuration();
+	Params.GravityScale = Tuning.GetEffectiveGravityScale();
+	Params.AirControlMultiplier = Tuning.GetAirControlMultiplier();
 
-	// CLEAN ARCHITECTURE: Single decision point for trajectory enhancement
-	if (bEnableTrajectoryEnhancement)
-	{
-		NewVelocity = CalculateTrajectoryEnhancedVelocity(CurrentVelocity);
-		
-		if (bLogBounceEvents)
-		{
-			UE_LOG(LogTemp, Log, TEXT("ApplyBouncePhysics: Trajectory Enhancement - %.1f -> %.1f"), 
-				CurrentVelocity.Size(), NewVelocity.Size());
-		}
-	}
-	else
-	{
-		// Fallback to existing momentum transfer system
-		NewVelocity = CalculateStandardBounceVelocity(CurrentVelocity);
-		
-		if (bLogBounceEvents)
-		{
-			UE_LOG(LogTemp, Log, TEXT("ApplyBouncePhysics: Standard Bounce - %.1f -> %.1f"), 
-				CurrentVelocity.Size(), NewVelocity.Size());
-		}
-	}
+	CombatMovement->StartBounce(Params);
+}
+
+FVector UGameplayAbility_Bounce::ResolveLaunchVelocity(const FVector& CurrentVelocity, const FCombatBounceParams& Params) const
+{
+	const FBounceTuningBlock& Tuning = GetBounceTuningData()->GetBlock();
 
-	// Apply calculated velocity
-	MovementComponent->Velocity = NewVelocity;
+	// Only the move's velocity is live - air bounce count and momentum are what the activation captured
+	const FVector NewVelocity = CalculateLaunchVelocity(CurrentVelocity, Params.AirBounceCount, Params.bHasMomentum ? &Params.Momentum : nullptr);
 
-	// Apply physics modifications
-	if (bIgnoreGravityDuringBounce && BounceDuration > 0.0f)
+	if (bLogBounceEvents)
 	{
-		MovementComponent->GravityScale *= GravityScaleDuringBounce;
+		BOUNCE_LOG(Verbose, TEXT("ApplyBouncePhysics: %s - %.1f -> %.1f"), 
+			Tuning.bEnableTrajectoryEnhancement ? TEXT("Trajectory Enhancement") : TEXT("Standard Bounce"),
+			CurrentVelocity.Size(), NewVelocity.Size());
 	}
 
-	if (CurrentAirBounces > 0)
+	return NewVelocity;
+}
+
+FVector UGameplayAbility_Bounce::CalculateLaunchVelocity(const FVector& CurrentVelocity, int32 InAirBounceCount, const FVelocitySnapshot* InMomentum) const
+{
+	const FBounceTuningBlock& Tuning = GetBounceTuningData()->GetBlock();
+	// CLEAN ARCHITECTURE: Single decision point for trajectory enhancement
+	return Tuning.bEnableTrajectoryEnhancement
+		? CalculateTrajectoryEnhancedVelocity(CurrentVelocity, InAirBounceCount, InMomentum)
+		: CalculateStandardBounceVelocity(CurrentVelocity, InAirBounceCount, InMomentum);
+}
+
+FBounceTrajectoryQuery UGameplayAbility_Bounce::MakeBounceTrajectoryQuery(const FVector& StartLocation, const FVector& CurrentVelocity, int32 InAirBounceCount, float LandingZ, const FVelocitySnapshot* InMomentum) const
+{
+	const FBounceTuningBlock& Tuning = GetBounceTuningData()->GetBlock();
+	FBounceTrajectoryQuery Query;
+	Query.StartLocation = StartLocation;
+	Query.LaunchVelocity = CalculateLaunchVelocity(CurrentVelocity, InAirBounceCount, InMomentum);
+	Query.LandingZ = LandingZ;
+
+	// Same bounce window ApplyBouncePhysics hands to the movement component
+	Query.Duration = Tuning.GetDuration();
+	Query.GravityScale = Tuning.GetEffectiveGravityScale();
+
+	const AMyCharacter* Character = Cast<AMyCharacter>(GetAvatarActorFromActorInfo());
+	if (const UCharacterMovementComponent* MovementComponent = Character ? Character->GetCharacterMovement() : nullptr)
 	{
-		MovementComponent->AirControl *= AirControlMultiplier;
+		Query.GravityZ = MovementComponent->GetGravityZ();
 	}
+
+	return Query;
 }
 
-void UGameplayAbility_Bounce::FinalizeBounce()
+FCombatTrajectoryPrediction UGameplayAbility_Bounce::PredictBounceFromCurrentState(float LandingZ) const
 {
-	AMyCharacter* Character = CachedCharacter.Get();
-	if (!IsValid(Character))
+	const AMyCharacter* Character = Cast<AMyCharacter>(GetAvatarActorFromActorInfo());
+	const UCharacterMovementComponent* MovementComponent = Character ? Character->GetCharacterMovement() : nullptr;
+	if (!IsValid(MovementComponent))
 	{
-		return;
+		return FCombatTrajectoryPrediction();
 	}
 
-	UCharacterMovementComponent* MovementComponent = Character->GetCharacterMovement();
-	if (!IsValid(MovementComponent))
+	FVelocitySnapshot MomentumSnapshot;
+	const bool bHasMomentum = TryGetMomentumContext(Character, MomentumSnapshot);
+
+	const FBounceTrajectoryQuery Query = MakeBounceTrajectoryQuery(Character->GetActorLocation(), MovementComponent->Velocity,
+		ReadAirBounceCount(Character), LandingZ, bHasMomentum ? &MomentumSnapshot : nullptr);
+	return FCombatTrajectoryPredictor::PredictBounce(Query);
+}
+
+void UGameplayAbility_Bounce::OnAvatarSet(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec)
+{
+	Super::OnAvatarSet(ActorInfo, Spec);
+
+	// The fallback runs on every bounce - warn about the missing effects once per avatar instead
+	if (!IsValid(AirBounceIncrementEffect) || !IsValid(AirBounceResetEffect))
 	{
-		return;
+		BOUNCE_LOG(Warning, TEXT("OnAvatarSet: %s is missing%s%s - air bounce count uses the direct attribute fallback"),
+			*GetName(),
+			!IsValid(AirBounceIncrementEffect) ? TEXT(" AirBounceIncrementEffect") : TEXT(""),
+			!IsValid(AirBounceResetEffect) ? TEXT(" AirBounceResetEffect") : TEXT(""));
 	}
 
-	// Restore gravity if it was modified
-	if (bIgnoreGravityDuringBounce)
+	// Instanced per actor - bind once so server replay of a bounce move can evaluate the launch
+	if (const AMyCharacter* Character = ActorInfo ? Cast<AMyCharacter>(ActorInfo->AvatarActor.Get()) : nullptr)
 	{
-		MovementComponent->GravityScale /= GravityScaleDuringBounce;
+		if (UCombatMovementComponent* CombatMovement = Character->GetCombatMovementComponent())
+		{
+			CombatMovement->BounceLaunchResolver.BindUObject(this, &UGameplayAbility_Bounce::ResolveLaunchVelocity);
+		}
+
+		// Character blueprints still carrying the old bounce values, unless this ability names its own tuning
+		if (!BounceTuning && Character->GetMigratedBounceTuning())
+		{
+			BounceTuning = Character->GetMigratedBounceTuning();
+		}
+
+		const bool bCharacterSetWindow = Character->BounceInputWindow_DEPRECATED != GetDefault<AMyCharacter>()->BounceInputWindow_DEPRECATED;
+		const bool bAbilitySetWindow = BounceInputWindow != GetDefault<UGameplayAbility_Bounce>()->BounceInputWindow;
+		if (bCharacterSetWindow && !bAbilitySetWindow)
+		{
+			BounceInputWindow = Character->BounceInputWindow_DEPRECATED;
+		}
 	}
+}
 
-	// Restore air control if it was modified
-	if (CurrentAirBounces > 0 && AirControlMultiplier != 1.0f)
+void UGameplayAbility_Bounce::OnRemoveAbility(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec)
+{
+	if (const AMyCharacter* Character = ActorInfo ? Cast<AMyCharacter>(ActorInfo->AvatarActor.Get()) : nullptr)
 	{
-		MovementComponent->AirControl /= AirControlMultiplier;
+		if (UCombatMovementComponent* CombatMovement = Character->GetCombatMovementComponent())
+		{
+			if (CombatMovement->BounceLaunchResolver.IsBoundToObject(this))
+			{
+				CombatMovement->BounceLaunchResolver.Unbind();
+			}
+		}
 	}
+
+	Super::OnRemoveAbility(ActorInfo, Spec);
 }
 
 void UGameplayAbility_Bounce::OnLandedDelegate(const FHitResult& Hit)
 {
-	if (bResetAirBouncesOnGroundContact)
+	const FBounceTuningBlock& Tuning = GetBounceTuningData()->GetBlock();
+	if (Tuning.bResetAirBouncesOnGroundContact)
 	{
 		// INDUSTRY BEST PRACTICE: Use Gameplay Attributes for state management
 		ResetAirBounceCount();
@@ -334,13 +383,14 @@ void UGameplayAbility_Bounce::OnLandedDelegate(const FHitResult& Hit)
 
 		if (bLogBounceEvents)
 		{
-			UE_LOG(LogTemp, Log, TEXT("Bounce: Ground contact - air bounces reset via Gameplay Attributes"));
+			BOUNCE_LOG(Verbose, TEXT("Ground contact - air bounces reset via Gameplay Attributes"));
 		}
 	}
 }
 
 void UGameplayAbility_Bounce::CheckGroundState()
 {
+	const FBounceTuningBlock& Tuning = GetBounceTuningData()->GetBlock();
 	AMyCharacter* Character = CachedCharacter.Get();
 	if (IsValid(Character))
 	{
@@ -348,7 +398,7 @@ void UGameplayAbility_Bounce::CheckGroundState()
 		if (bCurrentlyGrounded != bIsGrounded)
 		{
 			bIsGrounded = bCurrentlyGrounded;
-			if (bIsGrounded && bResetAirBouncesOnGroundContact)
+			if (bIsGrounded && Tuning.bResetAirBouncesOnGroundContact)
 			{
 				// Create a dummy hit result for the ground contact
 				FHitResult DummyHit;
@@ -362,131 +412,135 @@ bool UGameplayAbility_Bounce::ValidateActivationRequirements(const AMyCharacter*
 {
 	if (!IsValid(InCharacter))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Bounce Validation FAIL: Invalid character"));
+		BOUNCE_LOG(Warning, TEXT("Validation FAIL: Invalid character"));
 		return false;
 	}
 
-	// Check if character has movement component
-	const UCharacterMovementComponent* MovementComponent = InCharacter->GetCharacterMovement();
+	return GetActivationContext(InCharacter).bPassed;
+}
+
+const FBounceActivationContext& UGameplayAbility_Bounce::GetActivationContext(const AMyCharacter* InCharacter) const
+{
+	if (!CachedActivationContext.IsCurrent(InCharacter))
+	{
+		BuildActivationContext(InCharacter, CachedActivationContext);
+	}
+
+	return CachedActivationContext;
+}
+
+void UGameplayAbility_Bounce::BuildActivationContext(const AMyCharacter* InCharacter, FBounceActivationContext& OutContext) const
+{
+	OutContext = FBounceActivationContext();
+	OutContext.FrameCounter = GFrameCounter;
+	OutContext.Character = InCharacter;
+
+	const UCharacterMovementComponent* MovementComponent = IsValid(InCharacter) ? InCharacter->GetCharacterMovement() : nullptr;
 	if (!IsValid(MovementComponent))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Bounce Validation FAIL: Invalid movement component"));
-		return false;
+		BOUNCE_LOG(Warning, TEXT("Validation FAIL: Invalid movement component"));
+		return;
 	}
 
-	// DASH-BOUNCE INTEGRATION: Check for active dash state
+	// Single read of every input the activation rules depend on
 	const UAbilitySystemComponent* ASC = InCharacter->GetAbilitySystemComponent();
-	const bool bIsDashing = ASC && ASC->HasMatchingGameplayTag(FGameplayTag::RequestGameplayTag(FName("State.Dashing")));
-	const bool bIsJumping = MovementComponent->IsFalling() && MovementComponent->Velocity.Z > 0.0f;
-	
-	// EDGE CASE FIX: Check for recent dash momentum to handle dash-ending transitions
-	const FVector CurrentVelocity = MovementComponent->Velocity;
-	const float HorizontalSpeed = FVector2D(CurrentVelocity.X, CurrentVelocity.Y).Size();
-	FVelocitySnapshot TestSnapshot;
-	const bool bHasRecentDashMomentum = TryGetMomentumContext(InCharacter, TestSnapshot) && 
-		HorizontalSpeed > MIN_VELOCITY_THRESHOLD;
-	
-	// INDUSTRY BEST PRACTICE: Get air bounce count from Gameplay Attributes for reliable state
-	const int32 ActualCurrentAirBounces = GetCurrentAirBounceCount();
-
-	// Check air bounce limitations
-	const bool bIsCurrentlyGrounded = IsCharacterGrounded(InCharacter);
-	UE_LOG(LogTemp, Log, TEXT("Bounce Validation: Grounded=%s, Dashing=%s, Jumping=%s, RecentDash=%s, HorizSpeed=%.1f, AirBounces=%d/%d"), 
-		bIsCurrentlyGrounded ? TEXT("true") : TEXT("false"),
-		bIsDashing ? TEXT("true") : TEXT("false"),
-		bIsJumping ? TEXT("true") : TEXT("false"),
-		bHasRecentDashMomentum ? TEXT("true") : TEXT("false"),
-		HorizontalSpeed,
-		ActualCurrentAirBounces, MaxAirBounces);
-
-	// USE ABILITY'S CORE SETTINGS DIRECTLY - Single source of truth
-	UE_LOG(LogTemp, Log, TEXT("Bounce Validation: Using ABILITY core setting MaxAirBounces: %d"), MaxAirBounces);
+	static const FGameplayTag DashingTag = FGameplayTag::RequestGameplayTag(FName("State.Dashing"));
+
+	OutContext.Velocity = MovementComponent->Velocity;
+	OutContext.HorizontalSpeed = FVector2D(OutContext.Velocity.X, OutContext.Velocity.Y).Size();
+	OutContext.bIsGrounded = MovementComponent->IsMovingOnGround();
+	OutContext.bIsDashing = ASC && ASC->HasMatchingGameplayTag(DashingTag);
+	OutContext.bIsJumping = MovementComponent->IsFalling() && OutContext.Velocity.Z > 0.0f;
+	OutContext.bIsRising = OutContext.Velocity.Z > MIN_VELOCITY_THRESHOLD;
+	OutContext.AirBounceCount = ReadAirBounceCount(InCharacter);
+
+	// EDGE CASE FIX: Recent dash momentum handles dash-ending transitions
+	if (OutContext.HorizontalSpeed > MIN_VELOCITY_THRESHOLD)
+	{
+		FVelocitySnapshot MomentumSnapshot;
+		OutContext.bHasRecentDashMomentum = TryGetMomentumContext(InCharacter, MomentumSnapshot);
+	}
+
+	if (const UWorld* World = GetWorld())
+	{
+		OutContext.TimeSinceGroundContact = World->GetTimeSeconds() - LastGroundContactTime;
+	}
+
+	OutContext.bPassed = EvaluateActivationContext(OutContext);
+}
+
+bool UGameplayAbility_Bounce::EvaluateActivationContext(const FBounceActivationContext& InContext) const
+{
+	const FBounceTuningBlock& Tuning = GetBounceTuningData()->GetBlock();
+	BOUNCE_LOG(VeryVerbose, TEXT("Validation: Grounded=%s, Dashing=%s, Jumping=%s, RecentDash=%s, HorizSpeed=%.1f, AirBounces=%d/%d"), 
+		InContext.bIsGrounded ? TEXT("true") : TEXT("false"),
+		InContext.bIsDashing ? TEXT("true") : TEXT("false"),
+		InContext.bIsJumping ? TEXT("true") : TEXT("false"),
+		InContext.bHasRecentDashMomentum ? TEXT("true") : TEXT("false"),
+		InContext.HorizontalSpeed,
+		InContext.AirBounceCount, Tuning.MaxAirBounces);
+
+	const int32 BouncesAfterThisOne = InContext.AirBounceCount + 1;
 
 	// DASH-BOUNCE INTEGRATION: Allow bounce during dash regardless of ground state
-	if (bIsDashing)
+	if (InContext.bIsDashing)
 	{
 		// During dash, allow bounce even if air bounce limit would be exceeded by 1
 		// This enables dash-bounce combos while maintaining reasonable limits
-		const int32 BouncesAfterThisOne = ActualCurrentAirBounces + 1;
-		if (BouncesAfterThisOne > (MaxAirBounces + 1))
+		if (BouncesAfterThisOne > (Tuning.MaxAirBounces + 1))
 		{
-			UE_LOG(LogTemp, Warning, TEXT("Bounce Validation FAIL: Dash-bounce would exceed extended limit (%d would become %d/%d+1)"), 
-				ActualCurrentAirBounces, BouncesAfterThisOne, MaxAirBounces);
+			BOUNCE_LOG(Verbose, TEXT("Validation FAIL: Dash-bounce would exceed extended limit (%d would become %d/%d+1)"), 
+				InContext.AirBounceCount, BouncesAfterThisOne, Tuning.MaxAirBounces);
 			return false;
 		}
-		UE_LOG(LogTemp, Log, TEXT("Bounce Validation PASS: Dash-bounce combo allowed (ABILITY core setting limit: %d)"), MaxAirBounces);
+		BOUNCE_LOG(Verbose, TEXT("Validation PASS: Dash-bounce combo allowed (limit: %d)"), Tuning.MaxAirBounces);
 		return true;
 	}
 
 	// JUMP-BOUNCE INTEGRATION: Allow bounce during jump with normal air bounce rules
-	if (bIsJumping)
+	if (InContext.bIsJumping)
 	{
-		const int32 BouncesAfterThisOne = ActualCurrentAirBounces + 1;
-		if (BouncesAfterThisOne > MaxAirBounces)
+		if (BouncesAfterThisOne > Tuning.MaxAirBounces)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("Bounce Validation FAIL: Jump-bounce would exceed air bounce limit (%d would become %d/%d)"), 
-				ActualCurrentAirBounces, BouncesAfterThisOne, MaxAirBounces);
+			BOUNCE_LOG(Verbose, TEXT("Validation FAIL: Jump-bounce would exceed air bounce limit (%d would become %d/%d)"), 
+				InContext.AirBounceCount, BouncesAfterThisOne, Tuning.MaxAirBounces);
 			return false;
 		}
-		UE_LOG(LogTemp, Log, TEXT("Bounce Validation PASS: Jump-bounce combo allowed (ABILITY core setting limit: %d)"), MaxAirBounces);
+		BOUNCE_LOG(Verbose, TEXT("Validation PASS: Jump-bounce combo allowed (limit: %d)"), Tuning.MaxAirBounces);
 		return true;
 	}
 
 	// EDGE CASE FIX: Recent dash momentum - extend dash rules briefly after dash ends
-	if (bHasRecentDashMomentum && !bIsCurrentlyGrounded)
+	if (InContext.bHasRecentDashMomentum && !InContext.bIsGrounded)
 	{
 		// Treat recent dash momentum similar to active dash (slightly more restrictive)
-		const int32 BouncesAfterThisOne = ActualCurrentAirBounces + 1;
-		if (BouncesAfterThisOne > MaxAirBounces)
+		if (BouncesAfterThisOne > Tuning.MaxAirBounces)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("Bounce Validation FAIL: Recent dash momentum wouldn't allow air bounce (%d would become %d/%d)"), 
-				ActualCurrentAirBounces, BouncesAfterThisOne, MaxAirBounces);
+			BOUNCE_LOG(Verbose, TEXT("Validation FAIL: Recent dash momentum wouldn't allow air bounce (%d would become %d/%d)"), 
+				InContext.AirBounceCount, BouncesAfterThisOne, Tuning.MaxAirBounces);
 			return false;
 		}
-		UE_LOG(LogTemp, Log, TEXT("Bounce Validation PASS: Recent dash momentum allows bounce (ABILITY core setting limit: %d)"), MaxAirBounces);
+		BOUNCE_LOG(Verbose, TEXT("Validation PASS: Recent dash momentum allows bounce (limit: %d)"), Tuning.MaxAirBounces);
 		return true;
 	}
 
 	// CRITICAL FIX: If not grounded, check if we would exceed air bounce limit AFTER this bounce
-	if (!bIsCurrentlyGrounded)
-	{
-		const int32 BouncesAfterThisOne = ActualCurrentAirBounces + 1;
-		if (BouncesAfterThisOne > MaxAirBounces)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("Bounce Validation FAIL: Would exceed air bounce limit (%d would become %d/%d)"), 
-				ActualCurrentAirBounces, BouncesAfterThisOne, MaxAirBounces);
-			return false;
-		}
-	}
-
-	// Check coyote time for ground-to-air transition
-	if (!bIsCurrentlyGrounded && CoyoteTime > 0.0f)
+	// (covers the outside-coyote-time case too - both use the same limit)
+	if (!InContext.bIsGrounded && BouncesAfterThisOne > Tuning.MaxAirBounces)
 	{
-		const float TimeSinceGroundContact = GetWorld()->GetTimeSeconds() - LastGroundContactTime;
-		UE_LOG(LogTemp, Log, TEXT("Bounce Validation: TimeSinceGroundContact=%.3f, CoyoteTime=%.3f"), 
-			TimeSinceGroundContact, CoyoteTime);
-
-		if (TimeSinceGroundContact > CoyoteTime)
-		{
-			// Outside coyote time, check air bounce availability for the NEXT bounce
-			const int32 BouncesAfterThisOne = ActualCurrentAirBounces + 1;
-			if (BouncesAfterThisOne > MaxAirBounces)
-			{
-				UE_LOG(LogTemp, Warning, TEXT("Bounce Validation FAIL: Outside coyote time and would exceed air bounce limit"));
-				return false;
-			}
-		}
+		BOUNCE_LOG(Verbose, TEXT("Validation FAIL: Would exceed air bounce limit (%d would become %d/%d), TimeSinceGroundContact=%.3f"), 
+			InContext.AirBounceCount, BouncesAfterThisOne, Tuning.MaxAirBounces, InContext.TimeSinceGroundContact);
+		return false;
 	}
 
 	// Check if rising and bounce while rising is disabled (but allow during jump)
-	const bool bIsRising = IsCharacterRising(InCharacter);
-	if (!bAllowBounceWhileRising && bIsRising && !bIsJumping)
+	if (!Tuning.bAllowBounceWhileRising && InContext.bIsRising && !InContext.bIsJumping)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Bounce Validation FAIL: Character is rising and bounce while rising is disabled"));
+		BOUNCE_LOG(Verbose, TEXT("Validation FAIL: Character is rising and bounce while rising is disabled"));
 		return false;
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("Bounce Validation PASS: All checks passed"));
+	BOUNCE_LOG(Verbose, TEXT("Validation PASS: All checks passed"));
 	return true;
 }
 
@@ -517,71 +571,51 @@ bool UGameplayAbility_Bounce::IsCharacterRising(const AMyCharacter* InCharacter)
 	return MovementComponent->Velocity.Z > MIN_VELOCITY_THRESHOLD;
 }
 
-FVector UGameplayAbility_Bounce::CalculateBounceVelocity(const AMyCharacter* InCharacter) const
+FVector UGameplayAbility_Bounce::CalculateBounceVelocity(int32 InAirBounceCount) const
 {
-	if (!IsValid(InCharacter))
-	{
-		return FVector::ZeroVector;
-	}
-
-	FVector BounceVelocity = FVector::ZeroVector;
-	
-	// Calculate effective bounce velocity (reduced for air bounces)
-	const float EffectiveVelocity = GetEffectiveBounceVelocity();
-	
-	// Apply curve modification if available - EPIC GAMES STANDARD: Use loaded curve assets
-	float CurveMultiplier = 1.0f;
-	if (IsValid(LoadedBounceVelocityCurve))
-	{
-		const float CurveInput = static_cast<float>(CurrentAirBounces) / FMath::Max(1.0f, static_cast<float>(MaxAirBounces));
-		CurveMultiplier = LoadedBounceVelocityCurve->GetFloatValue(CurveInput);
-	}
-
-	BounceVelocity.Z = EffectiveVelocity * CurveMultiplier;
-	return BounceVelocity;
+	// Curve modification only when the async load has finished
+	const UCurveFloat* VelocityCurve = IsValid(LoadedBounceVelocityCurve) ? LoadedBounceVelocityCurve.Get() : nullptr;
+	return FCombatMathKernels::BounceVelocity(GetBounceTuningData()->GetBlock(), VelocityCurve, InAirBounceCount);
 }
 
-float UGameplayAbility_Bounce::GetEffectiveBounceVelocity() const
+float UGameplayAbility_Bounce::GetEffectiveBounceVelocity(int32 InAirBounceCount) const
 {
-	// USE ABILITY'S CORE SETTINGS DIRECTLY - This ensures editor changes take effect
-	const int32 CurrentCount = GetCurrentAirBounceCount();
-	
-	if (CurrentCount == 0)
+	const FBounceTuningBlock& Tuning = GetBounceTuningData()->GetBlock();
+	const float EffectiveVelocity = FCombatMathKernels::EffectiveBounceVelocity(Tuning, InAirBounceCount);
+	if (InAirBounceCount > 0)
 	{
-		UE_LOG(LogTemp, Log, TEXT("Bounce: Using ABILITY core setting velocity: %.1f"), BounceUpwardVelocity);
-		return BounceUpwardVelocity;
+		BOUNCE_LOG(VeryVerbose, TEXT("Air bounce %d - velocity %.1f -> %.1f"), 
+			InAirBounceCount, Tuning.GetUpwardVelocity(), EffectiveVelocity);
 	}
 
-	// Reduce velocity for air bounces using ability's settings
-	const float EffectiveVelocity = BounceUpwardVelocity * FMath::Pow(AirBounceVelocityReduction, static_cast<float>(CurrentCount));
-	UE_LOG(LogTemp, Log, TEXT("Bounce: Air bounce %d - ABILITY velocity %.1f -> %.1f"), 
-		CurrentCount, BounceUpwardVelocity, EffectiveVelocity);
-	
 	return EffectiveVelocity;
 }
 
 // CRITICAL FIX: Safe GAS access with proper validation
 int32 UGameplayAbility_Bounce::GetCurrentAirBounceCount() const
 {
-	// SAFER APPROACH: Use cached character reference instead of ActorInfo
-	const AMyCharacter* Character = CachedCharacter.Get();
-	if (!IsValid(Character))
+	// Activation reads the count through the activation context; this serves Blueprint and velocity helpers
+	return ReadAirBounceCount(CachedCharacter.Get());
+}
+
+int32 UGameplayAbility_Bounce::ReadAirBounceCount(const AMyCharacter* InCharacter)
+{
+	if (!IsValid(InCharacter))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("GetCurrentAirBounceCount: Invalid cached character"));
 		return 0;
 	}
 
-	const UAbilitySystemComponent* ASC = Character->GetAbilitySystemComponent();
+	const UAbilitySystemComponent* ASC = InCharacter->GetAbilitySystemComponent();
 	if (!IsValid(ASC))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("GetCurrentAirBounceCount: Invalid ASC from character"));
+		BOUNCE_LOG(Warning, TEXT("ReadAirBounceCount: Invalid ASC from character"));
 		return 0;
 	}
 
 	// Validate ASC is properly initialized
 	if (!ASC->AbilityActorInfo.IsValid())
 	{
-		UE_LOG(LogTemp, Error, TEXT("GetCurrentAirBounceCount: ASC AbilityActorInfo not valid - GAS not initialized"));
+		BOUNCE_LOG(Warning, TEXT("ReadAirBounceCount: ASC AbilityActorInfo not valid - GAS not initialized"));
 		return 0;
 	}
 
@@ -589,13 +623,11 @@ int32 UGameplayAbility_Bounce::GetCurrentAirBounceCount() const
 	const UMyAttributeSet* AttributeSet = ASC->GetSet<UMyAttributeSet>();
 	if (!IsValid(AttributeSet))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("GetCurrentAirBounceCount: Invalid AttributeSet"));
+		BOUNCE_LOG(Warning, TEXT("ReadAirBounceCount: Invalid AttributeSet"));
 		return 0;
 	}
 
-	const float AttributeValue = AttributeSet->GetAirBounceCount();
-	UE_LOG(LogTemp, Log, TEXT("GetCurrentAirBounceCount: Retrieved value %.1f from GAS"), AttributeValue);
-	return FMath::RoundToInt32(AttributeValue);
+	return FMath::RoundToInt32(AttributeSet->GetAirBounceCount());
 }
 
 void UGameplayAbility_Bounce::ResetAirBounceCount()
@@ -603,7 +635,7 @@ void UGameplayAbility_Bounce::ResetAirBounceCount()
 	UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo();
 	if (!IsValid(ASC))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ResetAirBounceCount: Invalid ASC"));
+		BOUNCE_LOG(Warning, TEXT("ResetAirBounceCount: Invalid ASC"));
 		return;
 	}
 
@@ -617,18 +649,18 @@ void UGameplayAbility_Bounce::ResetAirBounceCount()
 			ASC->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
 			if (bLogBounceEvents)
 			{
-				UE_LOG(LogTemp, Log, TEXT("Bounce: Air bounce count reset to 0 via Gameplay Effect"));
+				BOUNCE_LOG(Verbose, TEXT("Air bounce count reset to 0 via Gameplay Effect"));
 			}
 		}
 		else
 		{
-			UE_LOG(LogTemp, Warning, TEXT("ResetAirBounceCount: Failed to create valid effect spec"));
+			BOUNCE_LOG(Warning, TEXT("ResetAirBounceCount: Failed to create valid effect spec"));
 		}
 	}
 	else
 	{
 		// FALLBACK: Direct attribute manipulation if no effect configured (not recommended)
-		UE_LOG(LogTemp, Warning, TEXT("ResetAirBounceCount: No AirBounceResetEffect configured, using fallback"));
+		BOUNCE_LOG(Verbose, TEXT("ResetAirBounceCount: No AirBounceResetEffect configured, using fallback"));
 		const FGameplayAttribute AirBounceAttribute = UMyAttributeSet::GetAirBounceCountAttribute();
 		ASC->ApplyModToAttribute(AirBounceAttribute, EGameplayModOp::Override, 0.0f);
 	}
@@ -639,7 +671,7 @@ void UGameplayAbility_Bounce::IncrementAirBounceCount()
 	UAbilitySystemComponent* ASC = GetAbilitySystemComponentFromActorInfo();
 	if (!IsValid(ASC))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("IncrementAirBounceCount: Invalid ASC"));
+		BOUNCE_LOG(Warning, TEXT("IncrementAirBounceCount: Invalid ASC"));
 		return;
 	}
 
@@ -651,28 +683,26 @@ void UGameplayAbility_Bounce::IncrementAirBounceCount()
 		if (SpecHandle.IsValid())
 		{
 			ASC->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
-			const int32 NewCount = GetCurrentAirBounceCount();
 			if (bLogBounceEvents)
 			{
-				UE_LOG(LogTemp, Log, TEXT("Bounce: Air bounce count incremented to %d via Gameplay Effect"), NewCount);
+				BOUNCE_LOG(Verbose, TEXT("Air bounce count incremented to %d via Gameplay Effect"), GetCurrentAirBounceCount());
 			}
 		}
 		else
 		{
-			UE_LOG(LogTemp, Warning, TEXT("IncrementAirBounceCount: Failed to create valid effect spec"));
+			BOUNCE_LOG(Warning, TEXT("IncrementAirBounceCount: Failed to create valid effect spec"));
 		}
 	}
 	else
 	{
 		// FALLBACK: Direct attribute manipulation if no effect configured (not recommended)
-		UE_LOG(LogTemp, Warning, TEXT("IncrementAirBounceCount: No AirBounceIncrementEffect configured, using fallback"));
+		BOUNCE_LOG(Verbose, TEXT("IncrementAirBounceCount: No AirBounceIncrementEffect configured, using fallback"));
 		const FGameplayAttribute AirBounceAttribute = UMyAttributeSet::GetAirBounceCountAttribute();
 		ASC->ApplyModToAttribute(AirBounceAttribute, EGameplayModOp::Additive, 1.0f);
 		
-		const int32 NewCount = GetCurrentAirBounceCount();
 		if (bLogBounceEvents)
 		{
-			UE_LOG(LogTemp, Log, TEXT("Bounce: Air bounce count incremented to %d"), NewCount);
+			BOUNCE_LOG(Verbose, TEXT("Air bounce count incremented to %d"), GetCurrentAirBounceCount());
 		}
 	}
 }
@@ -680,110 +710,120 @@ void UGameplayAbility_Bounce::IncrementAirBounceCount()
 // Testing and Debugging Functions
 void UGameplayAbility_Bounce::TestBounceParameters()
 {
-	UE_LOG(LogTemp, Warning, TEXT("=== BOUNCE ABILITY PARAMETERS ==="));
-	UE_LOG(LogTemp, Warning, TEXT("BounceUpwardVelocity: %f"), BounceUpwardVelocity);
-	UE_LOG(LogTemp, Warning, TEXT("MaxAirBounces: %d"), MaxAirBounces);
-	UE_LOG(LogTemp, Warning, TEXT("HorizontalVelocityRetention: %f"), HorizontalVelocityRetention);
-	UE_LOG(LogTemp, Warning, TEXT("CurrentAirBounces: %d"), CurrentAirBounces);
-	UE_LOG(LogTemp, Warning, TEXT("AirBounceVelocityReduction: %f"), AirBounceVelocityReduction);
-	UE_LOG(LogTemp, Warning, TEXT("CoyoteTime: %f"), CoyoteTime);
-	UE_LOG(LogTemp, Warning, TEXT("DashMomentumMultiplier: %f"), DashMomentumMultiplier);
-	UE_LOG(LogTemp, Warning, TEXT("JumpMomentumMultiplier: %f"), JumpMomentumMultiplier);
-	UE_LOG(LogTemp, Warning, TEXT("bAllowComboBounce: %s"), bAllowComboBounce ? TEXT("true") : TEXT("false"));
-	UE_LOG(LogTemp, Warning, TEXT("bAllowMomentumTransfer: %s"), bAllowMomentumTransfer ? TEXT("true") : TEXT("false"));
-	UE_LOG(LogTemp, Warning, TEXT("==============================="));
+	const FBounceTuningBlock& Tuning = GetBounceTuningData()->GetBlock();
+	UE_LOG(LogBounce, Warning, TEXT("=== BOUNCE ABILITY PARAMETERS ==="));
+	UE_LOG(LogBounce, Warning, TEXT("BounceUpwardVelocity: %f"), Tuning.GetUpwardVelocity());
+	UE_LOG(LogBounce, Warning, TEXT("MaxAirBounces: %d"), Tuning.MaxAirBounces);
+	UE_LOG(LogBounce, Warning, TEXT("HorizontalVelocityRetention: %f"), Tuning.GetHorizontalVelocityRetention());
+	UE_LOG(LogBounce, Warning, TEXT("CurrentAirBounces: %d"), CurrentAirBounces);
+	UE_LOG(LogBounce, Warning, TEXT("AirBounceVelocityReduction: %f"), Tuning.GetAirBounceVelocityReduction());
+	UE_LOG(LogBounce, Warning, TEXT("CoyoteTime: %f"), CoyoteTime);
+	UE_LOG(LogBounce, Warning, TEXT("DashMomentumMultiplier: %f"), Tuning.GetDashMomentumMultiplier());
+	UE_LOG(LogBounce, Warning, TEXT("JumpMomentumMultiplier: %f"), Tuning.GetJumpMomentumMultiplier());
+	UE_LOG(LogBounce, Warning, TEXT("bAllowComboBounce: %s"), Tuning.bAllowComboBounce ? TEXT("true") : TEXT("false"));
+	UE_LOG(LogBounce, Warning, TEXT("bAllowMomentumTransfer: %s"), Tuning.bAllowMomentumTransfer ? TEXT("true") : TEXT("false"));
+	UE_LOG(LogBounce, Warning, TEXT("==============================="));
 }
 
 // DASH-BOUNCE COMBO TESTING UTILITIES - Epic Games debugging standards
 void UGameplayAbility_Bounce::TestDashBounceCombo()
 {
-	UE_LOG(LogTemp, Warning, TEXT("=== DASH-BOUNCE COMBO TEST ==="));
+	const FBounceTuningBlock& Tuning = GetBounceTuningData()->GetBlock();
+	UE_LOG(LogBounce, Warning, TEXT("=== DASH-BOUNCE COMBO TEST ==="));
 	
 	const AMyCharacter* Character = CachedCharacter.Get();
 	if (!IsValid(Character))
 	{
-		UE_LOG(LogTemp, Error, TEXT("TestDashBounceCombo: Invalid character reference"));
+		UE_LOG(LogBounce, Error, TEXT("TestDashBounceCombo: Invalid character reference"));
 		return;
 	}
 
 	const UAbilitySystemComponent* ASC = Character->GetAbilitySystemComponent();
 	const bool bIsDashing = ASC && ASC->HasMatchingGameplayTag(FGameplayTag::RequestGameplayTag(FName("State.Dashing")));
 	
-	UE_LOG(LogTemp, Warning, TEXT("Character Dashing: %s"), bIsDashing ? TEXT("YES") : TEXT("NO"));
-	UE_LOG(LogTemp, Warning, TEXT("Current Air Bounces: %d/%d"), GetCurrentAirBounceCount(), MaxAirBounces);
+	UE_LOG(LogBounce, Warning, TEXT("Character Dashing: %s"), bIsDashing ? TEXT("YES") : TEXT("NO"));
+	UE_LOG(LogBounce, Warning, TEXT("Current Air Bounces: %d/%d"), GetCurrentAirBounceCount(), Tuning.MaxAirBounces);
 	
 	if (bIsDashing)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("DASH-BOUNCE COMBO AVAILABLE"));
+		UE_LOG(LogBounce, Warning, TEXT("DASH-BOUNCE COMBO AVAILABLE"));
 		
 		// Test momentum transfer
 		FVelocitySnapshot MomentumSnapshot;
 		if (TryGetMomentumContext(Character, MomentumSnapshot))
 		{
-			UE_LOG(LogTemp, Warning, TEXT("Momentum Source: %d"), static_cast<int32>(MomentumSnapshot.Source));
-			UE_LOG(LogTemp, Warning, TEXT("Momentum Speed: %.1f"), MomentumSnapshot.Speed);
-			UE_LOG(LogTemp, Warning, TEXT("Momentum Multiplier: %.2f"), GetMomentumMultiplier(MomentumSnapshot.Source));
+			UE_LOG(LogBounce, Warning, TEXT("Momentum Source: %d"), static_cast<int32>(MomentumSnapshot.Source));
+			UE_LOG(LogBounce, Warning, TEXT("Momentum Speed: %.1f"), MomentumSnapshot.Speed);
+			UE_LOG(LogBounce, Warning, TEXT("Momentum Multiplier: %.2f"), GetMomentumMultiplier(MomentumSnapshot.Source));
 		}
 		else
 		{
-			UE_LOG(LogTemp, Warning, TEXT("No momentum context available"));
+			UE_LOG(LogBounce, Warning, TEXT("No momentum context available"));
 		}
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("No active dash state - combo not available"));
+		UE_LOG(LogBounce, Warning, TEXT("No active dash state - combo not available"));
 	}
+
+	// Closed-form landing for a bounce pressed now, against the current height
+	const FCombatTrajectoryPrediction Prediction = PredictBounceFromCurrentState(Character->GetActorLocation().Z);
+	UE_LOG(LogBounce, Warning, TEXT("Predicted Apex: +%.1f at %.2fs"), Prediction.Apex.Z - Character->GetActorLocation().Z, Prediction.ApexTime);
+	UE_LOG(LogBounce, Warning, TEXT("Predicted Landing: %s after %.2fs, %.1f away"), Prediction.bLands ? TEXT("YES") : TEXT("NO"),
+		Prediction.LandingTime, FVector::Dist2D(Prediction.LandingPoint, Character->GetActorLocation()));
 	
-	UE_LOG(LogTemp, Warning, TEXT("================================"));
+	UE_LOG(LogBounce, Warning, TEXT("================================"));
 }
 
 void UGameplayAbility_Bounce::TestJumpBounceCombo()
 {
-	UE_LOG(LogTemp, Warning, TEXT("=== JUMP-BOUNCE COMBO TEST ==="));
+	const FBounceTuningBlock& Tuning = GetBounceTuningData()->GetBlock();
+	UE_LOG(LogBounce, Warning, TEXT("=== JUMP-BOUNCE COMBO TEST ==="));
 	
 	const AMyCharacter* Character = CachedCharacter.Get();
 	if (!IsValid(Character))
 	{
-		UE_LOG(LogTemp, Error, TEXT("TestJumpBounceCombo: Invalid character reference"));
+		UE_LOG(LogBounce, Error, TEXT("TestJumpBounceCombo: Invalid character reference"));
 		return;
 	}
 
 	const UCharacterMovementComponent* MovementComponent = Character->GetCharacterMovement();
 	const bool bIsJumping = MovementComponent && MovementComponent->IsFalling() && MovementComponent->Velocity.Z > 0.0f;
 	
-	UE_LOG(LogTemp, Warning, TEXT("Character Jumping: %s"), bIsJumping ? TEXT("YES") : TEXT("NO"));
-	UE_LOG(LogTemp, Warning, TEXT("Character Falling: %s"), MovementComponent && MovementComponent->IsFalling() ? TEXT("YES") : TEXT("NO"));
-	UE_LOG(LogTemp, Warning, TEXT("Vertical Velocity: %.1f"), MovementComponent ? MovementComponent->Velocity.Z : 0.0f);
-	UE_LOG(LogTemp, Warning, TEXT("Current Air Bounces: %d/%d"), GetCurrentAirBounceCount(), MaxAirBounces);
+	UE_LOG(LogBounce, Warning, TEXT("Character Jumping: %s"), bIsJumping ? TEXT("YES") : TEXT("NO"));
+	UE_LOG(LogBounce, Warning, TEXT("Character Falling: %s"), MovementComponent && MovementComponent->IsFalling() ? TEXT("YES") : TEXT("NO"));
+	UE_LOG(LogBounce, Warning, TEXT("Vertical Velocity: %.1f"), MovementComponent ? MovementComponent->Velocity.Z : 0.0f);
+	UE_LOG(LogBounce, Warning, TEXT("Current Air Bounces: %d/%d"), GetCurrentAirBounceCount(), Tuning.MaxAirBounces);
 	
 	if (bIsJumping)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("JUMP-BOUNCE COMBO AVAILABLE"));
+		UE_LOG(LogBounce, Warning, TEXT("JUMP-BOUNCE COMBO AVAILABLE"));
 		
 		// Test momentum transfer for jump
 		FVelocitySnapshot MomentumSnapshot;
 		if (TryGetMomentumContext(Character, MomentumSnapshot))
 		{
-			UE_LOG(LogTemp, Warning, TEXT("Momentum Source: %d"), static_cast<int32>(MomentumSnapshot.Source));
-			UE_LOG(LogTemp, Warning, TEXT("Jump Momentum Multiplier: %.2f"), JumpMomentumMultiplier);
+			UE_LOG(LogBounce, Warning, TEXT("Momentum Source: %d"), static_cast<int32>(MomentumSnapshot.Source));
+			UE_LOG(LogBounce, Warning, TEXT("Jump Momentum Multiplier: %.2f"), Tuning.GetJumpMomentumMultiplier());
 		}
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("No active jump state - combo not available"));
+		UE_LOG(LogBounce, Warning, TEXT("No active jump state - combo not available"));
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("==============================="));
+	UE_LOG(LogBounce, Warning, TEXT("==============================="));
 }
 
 void UGameplayAbility_Bounce::ValidateMomentumTransfer()
 {
-	UE_LOG(LogTemp, Warning, TEXT("=== MOMENTUM TRANSFER VALIDATION ==="));
+	const FBounceTuningBlock& Tuning = GetBounceTuningData()->GetBlock();
+	UE_LOG(LogBounce, Warning, TEXT("=== MOMENTUM TRANSFER VALIDATION ==="));
 	
 	const AMyCharacter* Character = CachedCharacter.Get();
 	if (!IsValid(Character))
 	{
-		UE_LOG(LogTemp, Error, TEXT("ValidateMomentumTransfer: Invalid character reference"));
+		UE_LOG(LogBounce, Error, TEXT("ValidateMomentumTransfer: Invalid character reference"));
 		return;
 	}
 
@@ -791,40 +831,51 @@ void UGameplayAbility_Bounce::ValidateMomentumTransfer()
 	UVelocitySnapshotComponent* SnapshotComponent = Character->GetVelocitySnapshotComponent();
 	if (!IsValid(SnapshotComponent))
 	{
-		UE_LOG(LogTemp, Error, TEXT("VelocitySnapshotComponent: NOT FOUND"));
-		UE_LOG(LogTemp, Warning, TEXT("Momentum transfer will not work without VelocitySnapshotComponent"));
+		UE_LOG(LogBounce, Error, TEXT("VelocitySnapshotComponent: NOT FOUND"));
+		UE_LOG(LogBounce, Warning, TEXT("Momentum transfer will not work without VelocitySnapshotComponent"));
 		return;
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("VelocitySnapshotComponent: FOUND"));
-	UE_LOG(LogTemp, Warning, TEXT("Has Valid Snapshots: %s"), SnapshotComponent->HasValidSnapshots() ? TEXT("YES") : TEXT("NO"));
-	UE_LOG(LogTemp, Warning, TEXT("Valid Snapshot Count: %d"), SnapshotComponent->GetValidSnapshotCount());
+	UE_LOG(LogBounce, Warning, TEXT("VelocitySnapshotComponent: FOUND"));
+	UE_LOG(LogBounce, Warning, TEXT("Movement History: %s"), SnapshotComponent->bRecordMovementHistory ? TEXT("RECORDING") : TEXT("DISABLED - no momentum"));
 	
-	// Test latest snapshot
-	FVelocitySnapshot LatestSnapshot;
-	if (SnapshotComponent->GetLatestSnapshot(LatestSnapshot))
+	// Test history momentum - the same lookup the launch uses
+	FVelocitySnapshot HistoryMomentum;
+	if (SnapshotComponent->GetHistoryMomentum(HistoryMomentum))
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Latest Snapshot Source: %d"), static_cast<int32>(LatestSnapshot.Source));
-		UE_LOG(LogTemp, Warning, TEXT("Latest Snapshot Speed: %.1f"), LatestSnapshot.Speed);
-		UE_LOG(LogTemp, Warning, TEXT("Latest Snapshot Valid: %s"), LatestSnapshot.IsValid(GetWorld()->GetTimeSeconds()) ? TEXT("YES") : TEXT("NO"));
+		UE_LOG(LogBounce, Warning, TEXT("History Momentum Source: %d"), static_cast<int32>(HistoryMomentum.Source));
+		UE_LOG(LogBounce, Warning, TEXT("History Momentum Speed: %.1f"), HistoryMomentum.Speed);
+		UE_LOG(LogBounce, Warning, TEXT("History Momentum Age: %.3f s"), GetWorld()->GetTimeSeconds() - HistoryMomentum.Timestamp);
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("No valid snapshots available"));
+		UE_LOG(LogBounce, Warning, TEXT("No source-tagged history frame within the validity window"));
 	}
 	
 	// Test momentum transfer settings
-	UE_LOG(LogTemp, Warning, TEXT("Allow Combo Bounce: %s"), bAllowComboBounce ? TEXT("YES") : TEXT("NO"));
-	UE_LOG(LogTemp, Warning, TEXT("Allow Momentum Transfer: %s"), bAllowMomentumTransfer ? TEXT("YES") : TEXT("NO"));
-	UE_LOG(LogTemp, Warning, TEXT("Momentum Transfer Efficiency: %.2f"), MomentumTransferEfficiency);
-	UE_LOG(LogTemp, Warning, TEXT("Preserve Momentum Direction: %s"), bPreserveMomentumDirection ? TEXT("YES") : TEXT("NO"));
+	UE_LOG(LogBounce, Warning, TEXT("Allow Combo Bounce: %s"), Tuning.bAllowComboBounce ? TEXT("YES") : TEXT("NO"));
+	UE_LOG(LogBounce, Warning, TEXT("Allow Momentum Transfer: %s"), Tuning.bAllowMomentumTransfer ? TEXT("YES") : TEXT("NO"));
+	UE_LOG(LogBounce, Warning, TEXT("Momentum Transfer Efficiency: %.2f"), Tuning.GetMomentumTransferEfficiency());
+	UE_LOG(LogBounce, Warning, TEXT("Preserve Momentum Direction: %s"), Tuning.bPreserveMomentumDirection ? TEXT("YES") : TEXT("NO"));
+
+	// Landing distance with and without the captured momentum - shows what the transfer is worth
+	const FVector StartLocation = Character->GetActorLocation();
+	const FVector CurrentVelocity = Character->GetVelocity();
+	const int32 AirBounceCount = GetCurrentAirBounceCount();
+	const FCombatTrajectoryPrediction WithoutMomentum = FCombatTrajectoryPredictor::PredictBounce(
+		MakeBounceTrajectoryQuery(StartLocation, CurrentVelocity, AirBounceCount, StartLocation.Z));
+	const FCombatTrajectoryPrediction WithMomentum = FCombatTrajectoryPredictor::PredictBounce(
+		MakeBounceTrajectoryQuery(StartLocation, CurrentVelocity, AirBounceCount, StartLocation.Z, bHasLatestSnapshot ? &LatestSnapshot : nullptr));
+	UE_LOG(LogBounce, Warning, TEXT("Predicted Landing Distance: %.1f without momentum, %.1f with latest snapshot"),
+		FVector::Dist2D(WithoutMomentum.LandingPoint, StartLocation), FVector::Dist2D(WithMomentum.LandingPoint, StartLocation));
 	
-	UE_LOG(LogTemp, Warning, TEXT("===================================="));
+	UE_LOG(LogBounce, Warning, TEXT("===================================="));
 }
 
 bool UGameplayAbility_Bounce::CanPerformAirBounce() const
 {
-	return CurrentAirBounces < MaxAirBounces;
+	const FBounceTuningBlock& Tuning = GetBounceTuningData()->GetBlock();
+	return CurrentAirBounces < Tuning.MaxAirBounces;
 }
 
 FVector UGameplayAbility_Bounce::GetCurrentHorizontalVelocity() const
@@ -854,87 +905,117 @@ float UGameplayAbility_Bounce::GetBounceInputTimeRemaining() const
 	return FMath::Max(0.0f, BounceInputWindow - TimeElapsed);
 }
 
-// Configuration Presets
+// PRESET IMPLEMENTATIONS - Pointer swaps onto shared built-in tuning
+
 void UGameplayAbility_Bounce::ApplyLowBouncePreset()
 {
-	BounceUpwardVelocity = 500.0f;
-	MaxAirBounces = 1;
-	HorizontalVelocityRetention = 0.9f;
-	AirBounceVelocityReduction = 0.8f;
+	BounceTuning = UBounceTuningData::GetBuiltInPreset(EBounceTuningPreset::Low);
 }
 
 void UGameplayAbility_Bounce::ApplyHighBouncePreset()
 {
-	BounceUpwardVelocity = 1200.0f;
-	MaxAirBounces = 3;
-	HorizontalVelocityRetention = 1.0f;
-	AirBounceVelocityReduction = 0.75f;
+	BounceTuning = UBounceTuningData::GetBuiltInPreset(EBounceTuningPreset::High);
 }
 
 void UGameplayAbility_Bounce::ApplyFloatyBouncePreset()
 {
-	BounceUpwardVelocity = 800.0f;
-	MaxAirBounces = 2;
-	GravityScaleDuringBounce = 0.5f;
-	BounceDuration = 0.5f;
-	bIgnoreGravityDuringBounce = true;
+	BounceTuning = UBounceTuningData::GetBuiltInPreset(EBounceTuningPreset::Floaty);
 }
 
 void UGameplayAbility_Bounce::ApplySnappyBouncePreset()
 {
-	BounceUpwardVelocity = 900.0f;
-	MaxAirBounces = 2;
-	HorizontalVelocityRetention = 1.0f;
-	BounceDuration = 0.1f;
-	AirControlMultiplier = 0.3f;
+	BounceTuning = UBounceTuningData::GetBuiltInPreset(EBounceTuningPreset::Snappy);
 }
 
 void UGameplayAbility_Bounce::ResetToDefaultPreset()
 {
-	BounceUpwardVelocity = 800.0f;
-	HorizontalVelocityRetention = 1.0f;
-	HorizontalVelocityMultiplier = 1.0f;
-	AirControlMultiplier = 0.2f;
-	MaxAirBounces = 2;
-	AirBounceVelocityReduction = 0.85f;
+	BounceTuning = UBounceTuningData::GetBuiltInPreset(EBounceTuningPreset::Default);
 	BounceInputWindow = 0.1f;
 	CoyoteTime = 0.15f;
-	GravityScaleDuringBounce = 1.0f;
-	BounceDuration = 0.2f;
 }
 
-// ENHANCED BOUNCE MOMENTUM TRANSFER METHODS - Dash-Bounce Combo Support
+// TUNING ACCESS
 
-FVector UGameplayAbility_Bounce::CalculateEnhancedBounceVelocity(const AMyCharacter* InCharacter) const
+const UBounceTuningData* UGameplayAbility_Bounce::GetBounceTuningData() const
 {
-	if (!IsValid(InCharacter))
-	{
-		return FVector::ZeroVector;
-	}
+	return BounceTuning ? BounceTuning.Get() : UBounceTuningData::GetBuiltInPreset(EBounceTuningPreset::Default);
+}
 
-	// PERFORMANCE OPTIMIZATION: Early exit if no snapshot component
-	UVelocitySnapshotComponent* SnapshotComponent = InCharacter->GetVelocitySnapshotComponent();
-	if (!IsValid(SnapshotComponent))
+void UGameplayAbility_Bounce::SetBounceVelocityRuntime(float InVelocity)
+{
+	FBounceTuning Tuning = GetBounceTuningData()->GetTuning();
+	Tuning.UpwardVelocity = FMath::Clamp(InVelocity, MIN_BOUNCE_VELOCITY, MAX_BOUNCE_VELOCITY);
+	BounceTuning = UBounceTuningData::MakeVariant(Tuning, this);
+}
+
+void UGameplayAbility_Bounce::SetMaxAirBouncesRuntime(int32 InMaxBounces)
+{
+	FBounceTuning Tuning = GetBounceTuningData()->GetTuning();
+	Tuning.MaxAirBounces = FMath::Clamp(InMaxBounces, 0, MAX_AIR_BOUNCES_LIMIT);
+	BounceTuning = UBounceTuningData::MakeVariant(Tuning, this);
+}
+
+void UGameplayAbility_Bounce::PostLoad()
+{
+	Super::PostLoad();
+
+	if (BounceTuning)
 	{
-		return FVector::ZeroVector;
+		return;
 	}
 
-	// Try to get momentum context using optimized O(1) lookup
-	FVelocitySnapshot MomentumSnapshot;
-	if (!SnapshotComponent->GetLatestSnapshot(MomentumSnapshot))
-	{
-		return FVector::ZeroVector; // No momentum to transfer
+	// Blueprints saved with per-ability values keep them as a tuning subobject saved with the blueprint
+	FBounceTuning Migrated;
+	Migrated.UpwardVelocity = BounceUpwardVelocity_DEPRECATED;
+	Migrated.HorizontalVelocityRetention = HorizontalVelocityRetention_DEPRECATED;
+	Migrated.HorizontalVelocityMultiplier = HorizontalVelocityMultiplier_DEPRECATED;
+	Migrated.AirControlMultiplier = AirControlMultiplier_DEPRECATED;
+	Migrated.MaxAirBounces = MaxAirBounces_DEPRECATED;
+	Migrated.AirBounceVelocityReduction = AirBounceVelocityReduction_DEPRECATED;
+	Migrated.bResetAirBouncesOnGroundContact = bResetAirBouncesOnGroundContact_DEPRECATED;
+	Migrated.bAllowBounceWhileRising = bAllowBounceWhileRising_DEPRECATED;
+	Migrated.GravityScaleDuringBounce = GravityScaleDuringBounce_DEPRECATED;
+	Migrated.Duration = BounceDuration_DEPRECATED;
+	Migrated.bIgnoreGravityDuringBounce = bIgnoreGravityDuringBounce_DEPRECATED;
+	Migrated.bPreserveDownwardMomentum = bPreserveDownwardMomentum_DEPRECATED;
+	Migrated.DashMomentumMultiplier = DashMomentumMultiplier_DEPRECATED;
+	Migrated.JumpMomentumMultiplier = JumpMomentumMultiplier_DEPRECATED;
+	Migrated.FallMomentumMultiplier = FallMomentumMultiplier_DEPRECATED;
+	Migrated.MomentumTransferEfficiency = MomentumTransferEfficiency_DEPRECATED;
+	Migrated.XAxisMultiplier = BounceXAxisMultiplier_DEPRECATED;
+	Migrated.YAxisMultiplier = BounceYAxisMultiplier_DEPRECATED;
+	Migrated.bAllowMomentumTransfer = bAllowMomentumTransfer_DEPRECATED;
+	Migrated.bPreserveMomentumDirection = bPreserveMomentumDirection_DEPRECATED;
+	Migrated.bAllowComboBounce = bAllowComboBounce_DEPRECATED;
+	Migrated.bEnableTrajectoryEnhancement = bEnableTrajectoryEnhancement_DEPRECATED;
+	Migrated.UpwardAmplificationMultiplier = UpwardAmplificationMultiplier_DEPRECATED;
+	Migrated.UpwardVelocityThreshold = UpwardVelocityThreshold_DEPRECATED;
+	Migrated.HorizontalEnhancementMultiplier = HorizontalEnhancementMultiplier_DEPRECATED;
+	Migrated.EnhancedHorizontalBoost = EnhancedHorizontalBoost_DEPRECATED;
+	Migrated.RecoveryJumpVelocity = RecoveryJumpVelocity_DEPRECATED;
+	Migrated.FallingVelocityThreshold = FallingVelocityThreshold_DEPRECATED;
+	Migrated.DiagonalEnhancementMultiplier = DiagonalEnhancementMultiplier_DEPRECATED;
+
+	const FBounceTuning Defaults;
+	if (!FBounceTuning::StaticStruct()->CompareScriptStruct(&Migrated, &Defaults, PPF_None))
+	{
+		BounceTuning = UBounceTuningData::MakeVariant(Migrated, this, TEXT("MigratedBounceTuning"), RF_NoFlags);
 	}
+}
 
+// ENHANCED BOUNCE MOMENTUM TRANSFER METHODS - Dash-Bounce Combo Support
+
+FVector UGameplayAbility_Bounce::CalculateEnhancedBounceVelocity(const FVelocitySnapshot& MomentumSnapshot, int32 InAirBounceCount) const
+{
 	// Calculate base bounce velocity
-	const FVector BaseBounceVelocity = CalculateBounceVelocity(InCharacter);
+	const FVector BaseBounceVelocity = CalculateBounceVelocity(InAirBounceCount);
 
 	// Apply momentum transfer
 	const FVector EnhancedVelocity = ApplyMomentumTransfer(BaseBounceVelocity, MomentumSnapshot);
 
 	if (bLogBounceEvents)
 	{
-		UE_LOG(LogTemp, Log, TEXT("Enhanced Bounce: Source=%d, Multiplier=%.2f, Speed=%.1f -> %.1f"),
+		BOUNCE_LOG(Verbose, TEXT("Enhanced Bounce: Source=%d, Multiplier=%.2f, Speed=%.1f -> %.1f"),
 			static_cast<int32>(MomentumSnapshot.Source),
 			GetMomentumMultiplier(MomentumSnapshot.Source),
 			BaseBounceVelocity.Size(),
@@ -957,92 +1038,52 @@ bool UGameplayAbility_Bounce::TryGetMomentumContext(const AMyCharacter* InCharac
 		return false;
 	}
 
-	// PERFORMANCE OPTIMIZATION: Use O(1) latest snapshot lookup
-	return SnapshotComponent->GetLatestSnapshot(OutSnapshot);
+	// Dash tags its history frames while it is strong - the newest tagged frame is the momentum to transfer
+	return SnapshotComponent->GetHistoryMomentum(OutSnapshot);
 }
 
 float UGameplayAbility_Bounce::GetMomentumMultiplier(EVelocitySource Source) const
 {
-	// PERFORMANCE OPTIMIZATION: Direct enum switch (compiler optimizes to jump table)
-	switch (Source)
-	{
-		case EVelocitySource::Dash:
-			return DashMomentumMultiplier;
-		case EVelocitySource::Jump:
-			return JumpMomentumMultiplier;
-		case EVelocitySource::Fall:
-			return FallMomentumMultiplier;
-		default:
-			return 1.0f;
-	}
+	return FCombatMathKernels::MomentumMultiplier(GetBounceTuningData()->GetBlock(), Source);
 }
 
 FVector UGameplayAbility_Bounce::ApplyMomentumTransfer(const FVector& BaseBounceVelocity, const FVelocitySnapshot& MomentumSnapshot) const
 {
-	const float Multiplier = GetMomentumMultiplier(MomentumSnapshot.Source);
-	
-	FVector EnhancedVelocity = BaseBounceVelocity;
-
-	if (bPreserveMomentumDirection)
-	{
-		// PERFORMANCE OPTIMIZATION: Minimize vector operations
-		const FVector HorizontalMomentum = FVector(MomentumSnapshot.Velocity.X, MomentumSnapshot.Velocity.Y, 0.0f);
-		const float TransferFactor = Multiplier * MomentumTransferEfficiency;
-		
-		EnhancedVelocity.X = HorizontalMomentum.X * TransferFactor;
-		EnhancedVelocity.Y = HorizontalMomentum.Y * TransferFactor;
-	}
-	else
-	{
-		// Apply momentum magnitude to existing direction
-		const float HorizontalSpeed = FVector2D(BaseBounceVelocity.X, BaseBounceVelocity.Y).Size();
-		const float EnhancedSpeed = HorizontalSpeed + (MomentumSnapshot.Speed * Multiplier * MomentumTransferEfficiency);
-		
-		const FVector2D Direction = FVector2D(BaseBounceVelocity.X, BaseBounceVelocity.Y).GetSafeNormal();
-		EnhancedVelocity.X = Direction.X * EnhancedSpeed;
-		EnhancedVelocity.Y = Direction.Y * EnhancedSpeed;
-	}
-
-	// Enhance vertical velocity for dash momentum
-	if (MomentumSnapshot.Source == EVelocitySource::Dash)
-	{
-		EnhancedVelocity.Z *= (1.0f + (Multiplier - 1.0f) * 0.5f);
-	}
-
-	return EnhancedVelocity;
+	return FCombatMathKernels::ApplyMomentumTransfer(GetBounceTuningData()->GetBlock(), BaseBounceVelocity, MomentumSnapshot);
 }
 
 // TRAJECTORY ENHANCEMENT SYSTEM IMPLEMENTATION - Clean modular architecture
 
-FVector UGameplayAbility_Bounce::CalculateTrajectoryEnhancedVelocity(const FVector& CurrentVelocity) const
+FVector UGameplayAbility_Bounce::CalculateTrajectoryEnhancedVelocity(const FVector& CurrentVelocity, int32 InAirBounceCount, const FVelocitySnapshot* InMomentum) const
 {
 	const EBounceTrajectoryType TrajectoryType = DetermineTrajectoryType(CurrentVelocity);
 	
 	switch (TrajectoryType)
 	{
 		case EBounceTrajectoryType::UpwardBoost:
-			return CalculateUpwardAmplification(CurrentVelocity);
+			return CalculateUpwardAmplification(CurrentVelocity, InAirBounceCount);
 			
 		case EBounceTrajectoryType::HorizontalBoost:
-			return CalculateHorizontalEnhancement(CurrentVelocity);
+			return CalculateHorizontalEnhancement(CurrentVelocity, InAirBounceCount);
 			
 		case EBounceTrajectoryType::DiagonalBoost:
-			return CalculateDiagonalEnhancement(CurrentVelocity);
+			return CalculateDiagonalEnhancement(CurrentVelocity, InAirBounceCount);
 			
 		case EBounceTrajectoryType::RecoveryJump:
-			return CalculateRecoveryJump(CurrentVelocity);
+			return CalculateRecoveryJump(CurrentVelocity, InAirBounceCount);
 			
 		default:
-			return CalculateStandardBounceVelocity(CurrentVelocity);
+			return CalculateStandardBounceVelocity(CurrentVelocity, InAirBounceCount, InMomentum);
 	}
 }
 
-FVector UGameplayAbility_Bounce::CalculateStandardBounceVelocity(const FVector& CurrentVelocity) const
+FVector UGameplayAbility_Bounce::CalculateStandardBounceVelocity(const FVector& CurrentVelocity, int32 InAirBounceCount, const FVelocitySnapshot* InMomentum) const
 {
+	const FBounceTuningBlock& Tuning = GetBounceTuningData()->GetBlock();
 	// Use existing momentum transfer system when trajectory enhancement is disabled
-	if (bAllowComboBounce && bAllowMomentumTransfer)
+	if (Tuning.bAllowComboBounce && Tuning.bAllowMomentumTransfer && InMomentum)
 	{
-		const FVector EnhancedVelocity = CalculateEnhancedBounceVelocity(CachedCharacter.Get());
+		const FVector EnhancedVelocity = CalculateEnhancedBounceVelocity(*InMomentum, InAirBounceCount);
 		if (!EnhancedVelocity.IsZero())
 		{
 			return EnhancedVelocity;
@@ -1051,13 +1092,13 @@ FVector UGameplayAbility_Bounce::CalculateStandardBounceVelocity(const FVector&
 	
 	// Basic bounce calculation with NEW axis multipliers
 	FVector BounceVelocity = CurrentVelocity;
-	BounceVelocity.X *= HorizontalVelocityRetention * HorizontalVelocityMultiplier * BounceXAxisMultiplier;
-	BounceVelocity.Y *= HorizontalVelocityRetention * HorizontalVelocityMultiplier * BounceYAxisMultiplier;
+	BounceVelocity.X *= Tuning.GetHorizontalVelocityRetention() * Tuning.GetHorizontalVelocityMultiplier() * Tuning.GetXAxisMultiplier();
+	BounceVelocity.Y *= Tuning.GetHorizontalVelocityRetention() * Tuning.GetHorizontalVelocityMultiplier() * Tuning.GetYAxisMultiplier();
 	
 	// Calculate effective upward velocity
-	const float EffectiveUpwardVelocity = GetEffectiveBounceVelocity();
+	const float EffectiveUpwardVelocity = GetEffectiveBounceVelocity(InAirBounceCount);
 	
-	if (bPreserveDownwardMomentum && CurrentVelocity.Z < 0.0f)
+	if (Tuning.bPreserveDownwardMomentum && CurrentVelocity.Z < 0.0f)
 	{
 		BounceVelocity.Z = FMath::Max(EffectiveUpwardVelocity, CurrentVelocity.Z + EffectiveUpwardVelocity);
 	}
@@ -1071,76 +1112,51 @@ FVector UGameplayAbility_Bounce::CalculateStandardBounceVelocity(const FVector&
 
 EBounceTrajectoryType UGameplayAbility_Bounce::DetermineTrajectoryType(const FVector& Velocity) const
 {
-	const float HorizontalSpeed = FVector2D(Velocity.X, Velocity.Y).Size();
-	const float VerticalSpeed = FMath::Abs(Velocity.Z);
-	
-	// FALLING: Significant downward movement
-	if (Velocity.Z < -FallingVelocityThreshold)
-	{
-		return EBounceTrajectoryType::RecoveryJump;
-	}
-	
-	// UPWARD: Significant upward movement
-	if (Velocity.Z > UpwardVelocityThreshold)
-	{
-		return EBounceTrajectoryType::UpwardBoost;
-	}
-	
-	// DIAGONAL: Both horizontal and vertical movement
-	if (HorizontalSpeed > MIN_VELOCITY_THRESHOLD && VerticalSpeed > MIN_VELOCITY_THRESHOLD)
-	{
-		return EBounceTrajectoryType::DiagonalBoost;
-	}
-	
-	// HORIZONTAL: Primarily horizontal movement
-	if (HorizontalSpeed > MIN_VELOCITY_THRESHOLD)
-	{
-		return EBounceTrajectoryType::HorizontalBoost;
-	}
-	
-	return EBounceTrajectoryType::None;
+	return FCombatMathKernels::DetermineTrajectoryType(GetBounceTuningData()->GetBlock(), Velocity, MIN_VELOCITY_THRESHOLD);
 }
 
-FVector UGameplayAbility_Bounce::CalculateUpwardAmplification(const FVector& CurrentVelocity) const
+FVector UGameplayAbility_Bounce::CalculateUpwardAmplification(const FVector& CurrentVelocity, int32 InAirBounceCount) const
 {
+	const FBounceTuningBlock& Tuning = GetBounceTuningData()->GetBlock();
 	FVector EnhancedVelocity = CurrentVelocity;
 	
 	// Amplify all directions when moving upward
-	EnhancedVelocity *= UpwardAmplificationMultiplier;
+	EnhancedVelocity *= Tuning.GetUpwardAmplificationMultiplier();
 	
 	// Cap vertical velocity to prevent excessive height
-	const float MaxUpwardSpeed = BounceUpwardVelocity * 2.0f;
+	const float MaxUpwardSpeed = Tuning.GetUpwardVelocity() * 2.0f;
 	EnhancedVelocity.Z = FMath::Min(EnhancedVelocity.Z, MaxUpwardSpeed);
 	
 	// Apply air bounce reduction if applicable
-	if (GetCurrentAirBounceCount() > 0)
+	if (InAirBounceCount > 0)
 	{
-		const float AirBounceScalar = FMath::Pow(AirBounceVelocityReduction, GetCurrentAirBounceCount());
+		const float AirBounceScalar = FMath::Pow(Tuning.GetAirBounceVelocityReduction(), static_cast<float>(InAirBounceCount));
 		EnhancedVelocity *= AirBounceScalar;
 	}
 	
 	if (bLogBounceEvents)
 	{
-		UE_LOG(LogTemp, Log, TEXT("Trajectory: Upward Amplification - %.1f -> %.1f"), 
+		BOUNCE_LOG(Verbose, TEXT("Trajectory: Upward Amplification - %.1f -> %.1f"), 
 			   CurrentVelocity.Size(), EnhancedVelocity.Size());
 	}
 	
 	return EnhancedVelocity;
 }
 
-FVector UGameplayAbility_Bounce::CalculateHorizontalEnhancement(const FVector& CurrentVelocity) const
+FVector UGameplayAbility_Bounce::CalculateHorizontalEnhancement(const FVector& CurrentVelocity, int32 InAirBounceCount) const
 {
+	const FBounceTuningBlock& Tuning = GetBounceTuningData()->GetBlock();
 	FVector EnhancedVelocity = CurrentVelocity;
 	
 	// Enhance horizontal movement, add moderate vertical boost
-	EnhancedVelocity.X *= HorizontalEnhancementMultiplier;
-	EnhancedVelocity.Y *= HorizontalEnhancementMultiplier;
-	EnhancedVelocity.Z = EnhancedHorizontalBoost;
+	EnhancedVelocity.X *= Tuning.GetHorizontalEnhancementMultiplier();
+	EnhancedVelocity.Y *= Tuning.GetHorizontalEnhancementMultiplier();
+	EnhancedVelocity.Z = Tuning.GetEnhancedHorizontalBoost();
 	
 	// Apply air bounce reduction if applicable
-	if (GetCurrentAirBounceCount() > 0)
+	if (InAirBounceCount > 0)
 	{
-		const float AirBounceScalar = FMath::Pow(AirBounceVelocityReduction, GetCurrentAirBounceCount());
+		const float AirBounceScalar = FMath::Pow(Tuning.GetAirBounceVelocityReduction(), static_cast<float>(InAirBounceCount));
 		EnhancedVelocity.X *= AirBounceScalar;
 		EnhancedVelocity.Y *= AirBounceScalar;
 		EnhancedVelocity.Z *= AirBounceScalar;
@@ -1148,7 +1164,7 @@ FVector UGameplayAbility_Bounce::CalculateHorizontalEnhancement(const FVector& C
 	
 	if (bLogBounceEvents)
 	{
-		UE_LOG(LogTemp, Log, TEXT("Trajectory: Horizontal Enhancement - Speed %.1f -> %.1f"), 
+		BOUNCE_LOG(Verbose, TEXT("Trajectory: Horizontal Enhancement - Speed %.1f -> %.1f"), 
 			   FVector2D(CurrentVelocity.X, CurrentVelocity.Y).Size(),
 			   FVector2D(EnhancedVelocity.X, EnhancedVelocity.Y).Size());
 	}
@@ -1156,50 +1172,52 @@ FVector UGameplayAbility_Bounce::CalculateHorizontalEnhancement(const FVector& C
 	return EnhancedVelocity;
 }
 
-FVector UGameplayAbility_Bounce::CalculateDiagonalEnhancement(const FVector& CurrentVelocity) const
+FVector UGameplayAbility_Bounce::CalculateDiagonalEnhancement(const FVector& CurrentVelocity, int32 InAirBounceCount) const
 {
+	const FBounceTuningBlock& Tuning = GetBounceTuningData()->GetBlock();
 	FVector EnhancedVelocity = CurrentVelocity;
 	
 	// Enhance all movement directions proportionally
-	EnhancedVelocity *= DiagonalEnhancementMultiplier;
+	EnhancedVelocity *= Tuning.GetDiagonalEnhancementMultiplier();
 	
 	// Apply air bounce reduction if applicable
-	if (GetCurrentAirBounceCount() > 0)
+	if (InAirBounceCount > 0)
 	{
-		const float AirBounceScalar = FMath::Pow(AirBounceVelocityReduction, GetCurrentAirBounceCount());
+		const float AirBounceScalar = FMath::Pow(Tuning.GetAirBounceVelocityReduction(), static_cast<float>(InAirBounceCount));
 		EnhancedVelocity *= AirBounceScalar;
 	}
 	
 	if (bLogBounceEvents)
 	{
-		UE_LOG(LogTemp, Log, TEXT("Trajectory: Diagonal Enhancement - %.1f -> %.1f"), 
+		BOUNCE_LOG(Verbose, TEXT("Trajectory: Diagonal Enhancement - %.1f -> %.1f"), 
 			   CurrentVelocity.Size(), EnhancedVelocity.Size());
 	}
 	
 	return EnhancedVelocity;
 }
 
-FVector UGameplayAbility_Bounce::CalculateRecoveryJump(const FVector& CurrentVelocity) const
+FVector UGameplayAbility_Bounce::CalculateRecoveryJump(const FVector& CurrentVelocity, int32 InAirBounceCount) const
 {
+	const FBounceTuningBlock& Tuning = GetBounceTuningData()->GetBlock();
 	FVector RecoveryVelocity = CurrentVelocity;
 	
 	// Preserve horizontal movement, replace vertical with recovery jump
-	RecoveryVelocity.Z = RecoveryJumpVelocity;
+	RecoveryVelocity.Z = Tuning.GetRecoveryJumpVelocity();
 	
 	// Slightly enhance horizontal movement for better feel
 	RecoveryVelocity.X *= 1.1f;
 	RecoveryVelocity.Y *= 1.1f;
 	
 	// Apply air bounce reduction if applicable
-	if (GetCurrentAirBounceCount() > 0)
+	if (InAirBounceCount > 0)
 	{
-		const float AirBounceScalar = FMath::Pow(AirBounceVelocityReduction, GetCurrentAirBounceCount());
+		const float AirBounceScalar = FMath::Pow(Tuning.GetAirBounceVelocityReduction(), static_cast<float>(InAirBounceCount));
 		RecoveryVelocity.Z *= AirBounceScalar;
 	}
 	
 	if (bLogBounceEvents)
 	{
-		UE_LOG(LogTemp, Log, TEXT("Trajectory: Recovery Jump - Falling %.1f -> Recovery %.1f"), 
+		BOUNCE_LOG(Verbose, TEXT("Trajectory: Recovery Jump - Falling %.1f -> Recovery %.1f"), 
 			   CurrentVelocity.Z, RecoveryVelocity.Z);
 	}
 	
@@ -1227,9 +1245,10 @@ EBounceTrajectoryType UGameplayAbility_Bounce::GetCurrentTrajectoryType() const
 
 void UGameplayAbility_Bounce::TestTrajectoryEnhancement()
 {
-	UE_LOG(LogTemp, Warning, TEXT("=== TRAJECTORY ENHANCEMENT TEST ==="));
-	UE_LOG(LogTemp, Warning, TEXT("Enhancement Enabled: %s"), bEnableTrajectoryEnhancement ? TEXT("YES") : TEXT("NO"));
-	UE_LOG(LogTemp, Warning, TEXT("Current Trajectory Type: %s"), *UEnum::GetValueAsString(GetCurrentTrajectoryType()));
+	const FBounceTuningBlock& Tuning = GetBounceTuningData()->GetBlock();
+	UE_LOG(LogBounce, Warning, TEXT("=== TRAJECTORY ENHANCEMENT TEST ==="));
+	UE_LOG(LogBounce, Warning, TEXT("Enhancement Enabled: %s"), Tuning.bEnableTrajectoryEnhancement ? TEXT("YES") : TEXT("NO"));
+	UE_LOG(LogBounce, Warning, TEXT("Current Trajectory Type: %s"), *UEnum::GetValueAsString(GetCurrentTrajectoryType()));
 	
 	const AMyCharacter* Character = CachedCharacter.Get();
 	if (IsValid(Character))
@@ -1238,61 +1257,64 @@ void UGameplayAbility_Bounce::TestTrajectoryEnhancement()
 		if (IsValid(MovementComponent))
 		{
 			const FVector Velocity = MovementComponent->Velocity;
-			UE_LOG(LogTemp, Warning, TEXT("Current Velocity: %.1f, %.1f, %.1f"), Velocity.X, Velocity.Y, Velocity.Z);
-			UE_LOG(LogTemp, Warning, TEXT("Horizontal Speed: %.1f"), FVector2D(Velocity.X, Velocity.Y).Size());
-			UE_LOG(LogTemp, Warning, TEXT("Vertical Speed: %.1f"), Velocity.Z);
+			UE_LOG(LogBounce, Warning, TEXT("Current Velocity: %.1f, %.1f, %.1f"), Velocity.X, Velocity.Y, Velocity.Z);
+			UE_LOG(LogBounce, Warning, TEXT("Horizontal Speed: %.1f"), FVector2D(Velocity.X, Velocity.Y).Size());
+			UE_LOG(LogBounce, Warning, TEXT("Vertical Speed: %.1f"), Velocity.Z);
 			
-			if (bEnableTrajectoryEnhancement)
+			if (Tuning.bEnableTrajectoryEnhancement)
 			{
-				const FVector EnhancedVelocity = CalculateTrajectoryEnhancedVelocity(Velocity);
-				UE_LOG(LogTemp, Warning, TEXT("Enhanced Velocity: %.1f, %.1f, %.1f"), 
+				FVelocitySnapshot MomentumSnapshot;
+				const bool bHasMomentum = TryGetMomentumContext(Character, MomentumSnapshot);
+				const FVector EnhancedVelocity = CalculateTrajectoryEnhancedVelocity(Velocity, GetCurrentAirBounceCount(), bHasMomentum ? &MomentumSnapshot : nullptr);
+				UE_LOG(LogBounce, Warning, TEXT("Enhanced Velocity: %.1f, %.1f, %.1f"), 
 					   EnhancedVelocity.X, EnhancedVelocity.Y, EnhancedVelocity.Z);
-				UE_LOG(LogTemp, Warning, TEXT("Speed Change: %.1f -> %.1f"), 
+				UE_LOG(LogBounce, Warning, TEXT("Speed Change: %.1f -> %.1f"), 
 					   Velocity.Size(), EnhancedVelocity.Size());
 			}
 		}
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("No valid character - cannot test current velocity"));
+		UE_LOG(LogBounce, Warning, TEXT("No valid character - cannot test current velocity"));
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("==================================="));
+	UE_LOG(LogBounce, Warning, TEXT("==================================="));
 }
 
 void UGameplayAbility_Bounce::ValidateTrajectoryParameters()
 {
-	UE_LOG(LogTemp, Warning, TEXT("=== TRAJECTORY PARAMETERS ==="));
-	UE_LOG(LogTemp, Warning, TEXT("Enhancement Enabled: %s"), bEnableTrajectoryEnhancement ? TEXT("YES") : TEXT("NO"));
-	UE_LOG(LogTemp, Warning, TEXT("Upward Amplification: %.2fx"), UpwardAmplificationMultiplier);
-	UE_LOG(LogTemp, Warning, TEXT("Horizontal Enhancement: %.2fx"), HorizontalEnhancementMultiplier);
-	UE_LOG(LogTemp, Warning, TEXT("Diagonal Enhancement: %.2fx"), DiagonalEnhancementMultiplier);
-	UE_LOG(LogTemp, Warning, TEXT("Recovery Jump Velocity: %.1f"), RecoveryJumpVelocity);
-	UE_LOG(LogTemp, Warning, TEXT("Upward Threshold: %.1f"), UpwardVelocityThreshold);
-	UE_LOG(LogTemp, Warning, TEXT("Falling Threshold: %.1f"), FallingVelocityThreshold);
-	UE_LOG(LogTemp, Warning, TEXT("Enhanced Horizontal Boost: %.1f"), EnhancedHorizontalBoost);
-	UE_LOG(LogTemp, Warning, TEXT("Min Velocity Threshold: %.1f"), MIN_VELOCITY_THRESHOLD);
+	const FBounceTuningBlock& Tuning = GetBounceTuningData()->GetBlock();
+	UE_LOG(LogBounce, Warning, TEXT("=== TRAJECTORY PARAMETERS ==="));
+	UE_LOG(LogBounce, Warning, TEXT("Enhancement Enabled: %s"), Tuning.bEnableTrajectoryEnhancement ? TEXT("YES") : TEXT("NO"));
+	UE_LOG(LogBounce, Warning, TEXT("Upward Amplification: %.2fx"), Tuning.GetUpwardAmplificationMultiplier());
+	UE_LOG(LogBounce, Warning, TEXT("Horizontal Enhancement: %.2fx"), Tuning.GetHorizontalEnhancementMultiplier());
+	UE_LOG(LogBounce, Warning, TEXT("Diagonal Enhancement: %.2fx"), Tuning.GetDiagonalEnhancementMultiplier());
+	UE_LOG(LogBounce, Warning, TEXT("Recovery Jump Velocity: %.1f"), Tuning.GetRecoveryJumpVelocity());
+	UE_LOG(LogBounce, Warning, TEXT("Upward Threshold: %.1f"), Tuning.GetUpwardVelocityThreshold());
+	UE_LOG(LogBounce, Warning, TEXT("Falling Threshold: %.1f"), Tuning.GetFallingVelocityThreshold());
+	UE_LOG(LogBounce, Warning, TEXT("Enhanced Horizontal Boost: %.1f"), Tuning.GetEnhancedHorizontalBoost());
+	UE_LOG(LogBounce, Warning, TEXT("Min Velocity Threshold: %.1f"), MIN_VELOCITY_THRESHOLD);
 	
 	// Validate parameter ranges
 	bool bParametersValid = true;
-	if (UpwardAmplificationMultiplier < 1.0f || UpwardAmplificationMultiplier > 3.0f)
+	if (Tuning.GetUpwardAmplificationMultiplier() < 1.0f || Tuning.GetUpwardAmplificationMultiplier() > 3.0f)
 	{
-		UE_LOG(LogTemp, Error, TEXT("INVALID: UpwardAmplificationMultiplier out of range (1.0-3.0)"));
+		UE_LOG(LogBounce, Error, TEXT("INVALID: UpwardAmplificationMultiplier out of range (1.0-3.0)"));
 		bParametersValid = false;
 	}
-	if (HorizontalEnhancementMultiplier < 1.0f || HorizontalEnhancementMultiplier > 2.5f)
+	if (Tuning.GetHorizontalEnhancementMultiplier() < 1.0f || Tuning.GetHorizontalEnhancementMultiplier() > 2.5f)
 	{
-		UE_LOG(LogTemp, Error, TEXT("INVALID: HorizontalEnhancementMultiplier out of range (1.0-2.5)"));
+		UE_LOG(LogBounce, Error, TEXT("INVALID: HorizontalEnhancementMultiplier out of range (1.0-2.5)"));
 		bParametersValid = false;
 	}
-	if (RecoveryJumpVelocity < 500.0f || RecoveryJumpVelocity > 1200.0f)
+	if (Tuning.GetRecoveryJumpVelocity() < 500.0f || Tuning.GetRecoveryJumpVelocity() > 1200.0f)
 	{
-		UE_LOG(LogTemp, Error, TEXT("INVALID: RecoveryJumpVelocity out of range (500.0-1200.0)"));
+		UE_LOG(LogBounce, Error, TEXT("INVALID: RecoveryJumpVelocity out of range (500.0-1200.0)"));
 		bParametersValid = false;
 	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("Parameters Valid: %s"), bParametersValid ? TEXT("YES") : TEXT("NO"));
-	UE_LOG(LogTemp, Warning, TEXT("============================="));
+	UE_LOG(LogBounce, Warning, TEXT("Parameters Valid: %s"), bParametersValid ? TEXT("YES") : TEXT("NO"));
+	UE_LOG(LogBounce, Warning, TEXT("============================="));
 }
 
 // EPIC GAMES STANDARD: Async curve loading following proper asset management patterns
@@ -1324,11 +1346,11 @@ void UGameplayAbility_Bounce::LoadCurveAssets()
 
 	if (CurveLoadHandle.IsValid())
 	{
-		UE_LOG(LogTemp, Log, TEXT("Bounce: Started loading %d curve assets"), AssetsToLoad.Num());
+		BOUNCE_LOG(Verbose, TEXT("Started loading %d curve assets"), AssetsToLoad.Num());
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Bounce: Failed to start curve asset loading"));
+		BOUNCE_LOG(Warning, TEXT("Failed to start curve asset loading"));
 	}
 }
 
@@ -1340,11 +1362,11 @@ void UGameplayAbility_Bounce::OnCurveAssetsLoaded()
 		LoadedBounceVelocityCurve = BounceVelocityCurve.LoadSynchronous();
 		if (IsValid(LoadedBounceVelocityCurve))
 		{
-			UE_LOG(LogTemp, Log, TEXT("Bounce: BounceVelocityCurve loaded successfully"));
+			BOUNCE_LOG(Verbose, TEXT("BounceVelocityCurve loaded successfully"));
 		}
 		else
 		{
-			UE_LOG(LogTemp, Warning, TEXT("Bounce: Failed to load BounceVelocityCurve"));
+			BOUNCE_LOG(Warning, TEXT("Failed to load BounceVelocityCurve"));
 		}
 	}
 
@@ -1353,11 +1375,11 @@ void UGameplayAbility_Bounce::OnCurveAssetsLoaded()
 		LoadedAirControlCurve = AirControlCurve.LoadSynchronous();
 		if (IsValid(LoadedAirControlCurve))
 		{
-			UE_LOG(LogTemp, Log, TEXT("Bounce: AirControlCurve loaded successfully"));
+			BOUNCE_LOG(Verbose, TEXT("AirControlCurve loaded successfully"));
 		}
 		else
 		{
-			UE_LOG(LogTemp, Warning, TEXT("Bounce: Failed to load AirControlCurve"));
+			BOUNCE_LOG(Warning, TEXT("Failed to load AirControlCurve"));
 		}
 	}
 
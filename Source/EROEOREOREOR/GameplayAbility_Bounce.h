@@ -10,12 +10,15 @@
 #include "Engine/StreamableManager.h"
 #include "Misc/Optional.h"
 #include "VelocitySnapshotComponent.h"
+#include "CombatTrajectoryPredictor.h"
+#include "MovementAbilityTuning.h"
 #include "GameplayAbility_Bounce.generated.h"
 
 // Forward declarations
 class AMyCharacter;
 class UCurveFloat;
 class UGameplayEffect;
+struct FCombatBounceParams;
 
 // EPIC GAMES STANDARD: Enum for trajectory enhancement type safety
 UENUM(BlueprintType)
@@ -28,6 +31,39 @@ enum class EBounceTrajectoryType : uint8
 	DiagonalBoost   UMETA(DisplayName = "Diagonal Enhancement")
 };
 
+/**
+ * Character state read once per bounce input event
+ * CanActivateAbility, ActivateAbility and ExecuteBounce run in the same frame for one press,
+ * so they share this snapshot instead of re-querying the ASC, movement and snapshot components
+ */
+struct FBounceActivationContext
+{
+	// GFrameCounter when built - 0 means invalid
+	uint64 FrameCounter = 0;
+	TWeakObjectPtr<const AMyCharacter> Character;
+
+	FVector Velocity = FVector::ZeroVector;
+	float HorizontalSpeed = 0.0f;
+	float TimeSinceGroundContact = 0.0f;
+	int32 AirBounceCount = 0;
+
+	bool bIsGrounded = false;
+	bool bIsDashing = false;
+	bool bIsJumping = false;
+	bool bIsRising = false;
+	bool bHasRecentDashMomentum = false;
+
+	// Result of the activation rules for this snapshot
+	bool bPassed = false;
+
+	bool IsCurrent(const AMyCharacter* InCharacter) const
+	{
+		return FrameCounter == GFrameCounter && Character.Get() == InCharacter;
+	}
+
+	void Invalidate() { FrameCounter = 0; }
+};
+
 /**
  * Production-ready Gameplay Ability for bounce movement mechanics
  * Preserves horizontal momentum while adding upward velocity
@@ -46,14 +82,17 @@ public:
 	virtual void ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData) override;
 	virtual void EndAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, bool bReplicateEndAbility, bool bWasCancelled) override;
 	virtual void CancelAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, bool bReplicateEndAbility) override;
+	virtual void OnAvatarSet(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec) override;
+	virtual void OnRemoveAbility(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec) override;
 	virtual bool CanActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayTagContainer* SourceTags, const FGameplayTagContainer* TargetTags, OUT FGameplayTagContainer* OptionalRelevantTags) const override;
+	virtual void PostLoad() override;
 
 	// Public API - Blueprint accessible for design iteration
 	UFUNCTION(BlueprintPure, Category = "Bounce")
 	int32 GetCurrentAirBounces() const { return GetCurrentAirBounceCount(); }
 
 	UFUNCTION(BlueprintPure, Category = "Bounce")
-	int32 GetMaxAirBounces() const { return MaxAirBounces; }
+	int32 GetMaxAirBounces() const { return GetBounceTuningData()->GetBlock().MaxAirBounces; }
 
 	UFUNCTION(BlueprintCallable, Category = "Bounce")
 	void ResetAirBounces() { ResetAirBounceCount(); }
@@ -85,11 +124,15 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Bounce|Testing")
 	float GetBounceInputTimeRemaining() const;
 
+	// Runtime tweaks build a transient variant of the current tuning - shared assets are never written
 	UFUNCTION(BlueprintCallable, Category = "Bounce|Testing")
-	void SetBounceVelocityRuntime(float InVelocity) { BounceUpwardVelocity = FMath::Clamp(InVelocity, MIN_BOUNCE_VELOCITY, MAX_BOUNCE_VELOCITY); }
+	void SetBounceVelocityRuntime(float InVelocity);
 
 	UFUNCTION(BlueprintCallable, Category = "Bounce|Testing")
-	void SetMaxAirBouncesRuntime(int32 InMaxBounces) { MaxAirBounces = FMath::Clamp(InMaxBounces, 0, MAX_AIR_BOUNCES_LIMIT); }
+	void SetMaxAirBouncesRuntime(int32 InMaxBounces);
+
+	// Active tuning - BounceTuning or the built-in default preset
+	const UBounceTuningData* GetBounceTuningData() const;
 
 	// CONFIGURATION PRESETS - Easy testing of different feels
 	UFUNCTION(BlueprintCallable, Category = "Bounce|Presets", CallInEditor)
@@ -107,6 +150,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Bounce|Presets", CallInEditor)
 	void ResetToDefaultPreset();
 
+	UFUNCTION(BlueprintCallable, Category = "Bounce|Presets")
+	void SetBounceTuning(const UBounceTuningData* InTuning) { BounceTuning = InTuning; }
+
 	// DASH-BOUNCE COMBO TESTING UTILITIES - Epic Games debugging standards
 	UFUNCTION(BlueprintCallable, Category = "Bounce|Testing", CallInEditor)
 	void TestDashBounceCombo();
@@ -117,6 +163,13 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Bounce|Testing", CallInEditor)
 	void ValidateMomentumTransfer();
 
+	// TRAJECTORY PREDICTION - closed form, no simulation (AI, UI arcs)
+	UFUNCTION(BlueprintPure, Category = "Bounce|Prediction")
+	FCombatTrajectoryPrediction PredictBounceFromCurrentState(float LandingZ) const;
+
+	// Query for a hypothetical bounce - same launch rules as the ability. Feed to FCombatTrajectoryPredictor::PredictBounceBatch
+	FBounceTrajectoryQuery MakeBounceTrajectoryQuery(const FVector& StartLocation, const FVector& CurrentVelocity, int32 InAirBounceCount, float LandingZ, const FVelocitySnapshot* InMomentum = nullptr) const;
+
 	// TRAJECTORY ENHANCEMENT TESTING - Epic Games debugging standards
 	UFUNCTION(BlueprintPure, Category = "Bounce|Testing")
 	EBounceTrajectoryType GetCurrentTrajectoryType() const;
@@ -128,41 +181,11 @@ public:
 	void ValidateTrajectoryParameters();
 
 protected:
-	// BOUNCE VELOCITY CONTROL - Core bounce power settings
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "🏀 Bounce Core Settings", 
-		meta = (ClampMin = "100.0", ClampMax = "5000.0", UIMin = "200.0", UIMax = "3000.0", Units = "cm/s",
-		DisplayName = "Upward Bounce Power", ToolTip = "Primary upward velocity when bouncing. Higher = bigger jumps!"))
-	float BounceUpwardVelocity = 800.0f;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "🏀 Bounce Core Settings", 
-		meta = (ClampMin = "0.0", ClampMax = "3.0", UIMin = "0.0", UIMax = "2.0", Units = "Multiplier",
-		DisplayName = "Horizontal Keep Rate", ToolTip = "How much side-to-side speed to keep when bouncing. 1.0 = keep all momentum, >1.0 = amplify momentum."))
-	float HorizontalVelocityRetention = 1.0f;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "🏀 Bounce Core Settings", 
-		meta = (ClampMin = "0.0", ClampMax = "5.0", UIMin = "0.0", UIMax = "3.0", Units = "Multiplier",
-		DisplayName = "Horizontal Boost", ToolTip = "Extra horizontal speed boost during bounce. 1.0 = normal, 2.0 = double boost, 3.0 = triple boost."))
-	float HorizontalVelocityMultiplier = 1.0f;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "🏀 Bounce Core Settings", 
-		meta = (ClampMin = "0.0", ClampMax = "2.0", UIMin = "0.0", UIMax = "1.5", Units = "Multiplier",
-		DisplayName = "Air Control Power", ToolTip = "How much directional control you have while airborne. 0 = no control, 1 = full control, >1 = enhanced control."))
-	float AirControlMultiplier = 0.2f;
-
-	// BOUNCE AIR CONTROL - Movement limitations
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bounce|AirControl", 
-		meta = (ClampMin = "0", ClampMax = "5", UIMin = "0", UIMax = "15"))
-	int32 MaxAirBounces = 2;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bounce|AirControl", 
-		meta = (ClampMin = "0.5", ClampMax = "1.0", UIMin = "0.7", UIMax = "1.0"))
-	float AirBounceVelocityReduction = 0.85f;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bounce|AirControl")
-	bool bResetAirBouncesOnGroundContact = true;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bounce|AirControl")
-	bool bAllowBounceWhileRising = false;
+	// BOUNCE TUNING - Launch, air-bounce, momentum and trajectory settings live in a shared immutable asset.
+	// Presets and runtime tweaks swap this pointer; empty = built-in default preset
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "🏀 Bounce Core Settings",
+		meta = (DisplayName = "Bounce Tuning", ToolTip = "Tuning asset read by every bounce. Leave empty for the built-in default preset."))
+	TObjectPtr<const UBounceTuningData> BounceTuning;
 
 	// BOUNCE INPUT CONTROL - Responsiveness parameters
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bounce|Input", 
@@ -179,118 +202,11 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bounce|Input")
 	bool bAllowBufferedBounce = true;
 
-	// BOUNCE PHYSICS CONTROL - Advanced movement behavior
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bounce|Physics", 
-		meta = (ClampMin = "0.0", ClampMax = "1.0", UIMin = "0.0", UIMax = "1.0"))
-	float GravityScaleDuringBounce = 1.0f;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bounce|Physics", 
-		meta = (ClampMin = "0.01", ClampMax = "1.0", UIMin = "0.1", UIMax = "0.5"))
-	float BounceDuration = 0.2f;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bounce|Physics")
-	bool bIgnoreGravityDuringBounce = false;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bounce|Physics")
-	bool bPreserveDownwardMomentum = false;
-
-	// COMBO MULTIPLIERS - Dash-Bounce momentum transfer power  
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "🔥 Combo Multipliers", 
-		meta = (ClampMin = "0.0", ClampMax = "10.0", UIMin = "1.0", UIMax = "5.0", Units = "Multiplier",
-		DisplayName = "Dash → Bounce Power", ToolTip = "How much stronger bounce becomes after dash. 1.8 = 80% stronger! Great for air combos."))
-	float DashMomentumMultiplier = 1.8f;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "🔥 Combo Multipliers", 
-		meta = (ClampMin = "0.0", ClampMax = "10.0", UIMin = "1.0", UIMax = "5.0", Units = "Multiplier",
-		DisplayName = "Jump → Bounce Power", ToolTip = "Bounce power boost when used during jump. 1.3 = 30% stronger for jump combos."))
-	float JumpMomentumMultiplier = 1.3f;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "🔥 Combo Multipliers", 
-		meta = (ClampMin = "0.0", ClampMax = "10.0", UIMin = "0.8", UIMax = "5.0", Units = "Multiplier",
-		DisplayName = "Fall → Bounce Power", ToolTip = "Recovery bounce power when falling. Higher = better fall recovery potential."))
-	float FallMomentumMultiplier = 1.0f;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "🔥 Combo Multipliers", 
-		meta = (ClampMin = "0.0", ClampMax = "3.0", UIMin = "0.0", UIMax = "1.0", Units = "Multiplier",
-		DisplayName = "Momentum Transfer Rate", ToolTip = "How efficiently momentum transfers between abilities. 0.85 = 85% transfer rate."))
-	float MomentumTransferEfficiency = 0.85f;
-
-	// AXIS CONTROL - Fine-tune bounce direction
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "⚖️ Axis Control", 
-		meta = (ClampMin = "0.1", ClampMax = "10.0", UIMin = "0.5", UIMax = "5.0", Units = "Multiplier",
-		DisplayName = "X-Axis Multiplier", ToolTip = "Control horizontal bounce strength. 1.0 = normal, 2.0 = double power."))
-	float BounceXAxisMultiplier = 1.0f;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "⚖️ Axis Control", 
-		meta = (ClampMin = "0.1", ClampMax = "10.0", UIMin = "0.5", UIMax = "5.0", Units = "Multiplier",
-		DisplayName = "Y-Axis Multiplier", ToolTip = "Control side-to-side bounce strength. 1.0 = normal, 2.0 = double power."))
-	float BounceYAxisMultiplier = 1.0f;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bounce|Momentum")
-	bool bAllowMomentumTransfer = true;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bounce|Momentum")
-	bool bPreserveMomentumDirection = true;
-
 	// COMBO SYSTEM - Event-based ability coordination
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bounce|Combo")
-	bool bAllowComboBounce = true;
-
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bounce|Combo", 
 		meta = (ClampMin = "0.05", ClampMax = "0.5", UIMin = "0.1", UIMax = "0.3"))
 	float ComboWindow = 0.2f;
 
-	// TRAJECTORY ENHANCEMENT SYSTEM - Epic Games standard implementation
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bounce|Trajectory Enhancement",
-		meta = (DisplayName = "Enable Trajectory Enhancement"))
-	bool bEnableTrajectoryEnhancement = true;
-
-	// Upward Movement Enhancement
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bounce|Trajectory Enhancement|Upward",
-		meta = (ClampMin = "1.0", ClampMax = "3.0", UIMin = "1.2", UIMax = "2.5",
-				DisplayName = "Upward Amplification Multiplier",
-				EditCondition = "bEnableTrajectoryEnhancement"))
-	float UpwardAmplificationMultiplier = 1.75f;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bounce|Trajectory Enhancement|Upward",
-		meta = (ClampMin = "50.0", ClampMax = "500.0", UIMin = "100.0", UIMax = "300.0",
-				DisplayName = "Minimum Upward Velocity Threshold",
-				EditCondition = "bEnableTrajectoryEnhancement"))
-	float UpwardVelocityThreshold = 150.0f;
-
-	// Horizontal Movement Enhancement  
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bounce|Trajectory Enhancement|Horizontal",
-		meta = (ClampMin = "1.0", ClampMax = "2.5", UIMin = "1.1", UIMax = "2.0",
-				DisplayName = "Horizontal Enhancement Multiplier",
-				EditCondition = "bEnableTrajectoryEnhancement"))
-	float HorizontalEnhancementMultiplier = 1.4f;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bounce|Trajectory Enhancement|Horizontal",
-		meta = (ClampMin = "300.0", ClampMax = "800.0", UIMin = "400.0", UIMax = "700.0",
-				DisplayName = "Enhanced Horizontal Boost",
-				EditCondition = "bEnableTrajectoryEnhancement"))
-	float EnhancedHorizontalBoost = 500.0f;
-
-	// Fall Recovery System
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bounce|Trajectory Enhancement|Recovery",
-		meta = (ClampMin = "500.0", ClampMax = "1200.0", UIMin = "600.0", UIMax = "1000.0",
-				DisplayName = "Recovery Jump Velocity",
-				EditCondition = "bEnableTrajectoryEnhancement"))
-	float RecoveryJumpVelocity = 800.0f;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bounce|Trajectory Enhancement|Recovery",
-		meta = (ClampMin = "50.0", ClampMax = "500.0", UIMin = "100.0", UIMax = "300.0",
-				DisplayName = "Falling Velocity Threshold",
-				EditCondition = "bEnableTrajectoryEnhancement"))
-	float FallingVelocityThreshold = 200.0f;
-
-	// Diagonal Movement
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bounce|Trajectory Enhancement|Diagonal",
-		meta = (ClampMin = "1.0", ClampMax = "2.5", UIMin = "1.2", UIMax = "2.0",
-				DisplayName = "Diagonal Enhancement Multiplier",
-				EditCondition = "bEnableTrajectoryEnhancement"))
-	float DiagonalEnhancementMultiplier = 1.6f;
-
 	// BOUNCE CURVE CONTROL - Epic Games soft reference pattern for proper asset loading
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bounce|Curves", 
 		meta = (DisplayName = "Velocity Curve (Optional)", AllowedClasses = "/Script/Engine.CurveFloat"))
@@ -354,7 +270,10 @@ private:
 	// Core Implementation - Single responsibility
 	void ExecuteBounce();
 	void ApplyBouncePhysics();
-	void FinalizeBounce();
+
+	// NETWORK PREDICTION: Evaluated by UCombatMovementComponent inside the flagged move on client and server,
+	// from the launch inputs ApplyBouncePhysics captured into the params
+	FVector ResolveLaunchVelocity(const FVector& CurrentVelocity, const FCombatBounceParams& Params) const;
 	
 	// Ground state tracking
 	UFUNCTION()
@@ -363,13 +282,21 @@ private:
 
 	// Helper functions for testability
 	bool ValidateActivationRequirements(const AMyCharacter* InCharacter) const;
+
+	// PERFORMANCE OPTIMIZATION: Built at most once per frame per character, reused by Activate/Execute
+	const FBounceActivationContext& GetActivationContext(const AMyCharacter* InCharacter) const;
+	void BuildActivationContext(const AMyCharacter* InCharacter, FBounceActivationContext& OutContext) const;
+	bool EvaluateActivationContext(const FBounceActivationContext& InContext) const;
+
+	// Reads the AirBounceCount attribute from the given character rather than CachedCharacter
+	static int32 ReadAirBounceCount(const AMyCharacter* InCharacter);
 	bool IsCharacterGrounded(const AMyCharacter* InCharacter) const;
 	bool IsCharacterRising(const AMyCharacter* InCharacter) const;
-	FVector CalculateBounceVelocity(const AMyCharacter* InCharacter) const;
-	float GetEffectiveBounceVelocity() const;
+	FVector CalculateBounceVelocity(int32 InAirBounceCount) const;
+	float GetEffectiveBounceVelocity(int32 InAirBounceCount) const;
 	
 	// Enhanced bounce calculation with momentum transfer
-	FVector CalculateEnhancedBounceVelocity(const AMyCharacter* InCharacter) const;
+	FVector CalculateEnhancedBounceVelocity(const FVelocitySnapshot& MomentumSnapshot, int32 InAirBounceCount) const;
 	
 	// Momentum transfer utilities - performance optimized
 	bool TryGetMomentumContext(const AMyCharacter* InCharacter, FVelocitySnapshot& OutSnapshot) const;
@@ -377,15 +304,17 @@ private:
 	FVector ApplyMomentumTransfer(const FVector& BaseBounceVelocity, const FVelocitySnapshot& MomentumSnapshot) const;
 	
 	// TRAJECTORY ENHANCEMENT SYSTEM - Clean modular implementation
-	FVector CalculateTrajectoryEnhancedVelocity(const FVector& CurrentVelocity) const;
-	FVector CalculateStandardBounceVelocity(const FVector& CurrentVelocity) const;
+	// Launch inputs are explicit so the live bounce and trajectory prediction share one code path
+	FVector CalculateLaunchVelocity(const FVector& CurrentVelocity, int32 InAirBounceCount, const FVelocitySnapshot* InMomentum) const;
+	FVector CalculateTrajectoryEnhancedVelocity(const FVector& CurrentVelocity, int32 InAirBounceCount, const FVelocitySnapshot* InMomentum) const;
+	FVector CalculateStandardBounceVelocity(const FVector& CurrentVelocity, int32 InAirBounceCount, const FVelocitySnapshot* InMomentum) const;
 	EBounceTrajectoryType DetermineTrajectoryType(const FVector& Velocity) const;
 	
 	// Individual trajectory calculations - Single responsibility, highly testable
-	FVector CalculateUpwardAmplification(const FVector& CurrentVelocity) const;
-	FVector CalculateHorizontalEnhancement(const FVector& CurrentVelocity) const;
-	FVector CalculateDiagonalEnhancement(const FVector& CurrentVelocity) const;
-	FVector CalculateRecoveryJump(const FVector& CurrentVelocity) const;
+	FVector CalculateUpwardAmplification(const FVector& CurrentVelocity, int32 InAirBounceCount) const;
+	FVector CalculateHorizontalEnhancement(const FVector& CurrentVelocity, int32 InAirBounceCount) const;
+	FVector CalculateDiagonalEnhancement(const FVector& CurrentVelocity, int32 InAirBounceCount) const;
+	FVector CalculateRecoveryJump(const FVector& CurrentVelocity, int32 InAirBounceCount) const;
 	
 	// EPIC GAMES STANDARD: Proper delegate lifecycle management
 	void CleanupDelegates();
@@ -416,9 +345,11 @@ private:
 	UPROPERTY(Transient)
 	bool bLandedDelegateRegistered = false;
 
-	// Performance optimization: Cache air bounce count during ability execution
-	UPROPERTY(Transient)
-	int32 CachedAirBounceCount = 0;
+	// Activation snapshot shared by CanActivateAbility, ActivateAbility and ExecuteBounce
+	mutable FBounceActivationContext CachedActivationContext;
+
+	// Launch handed to the movement component - reused by debug draw instead of recomputing
+	FVector LastLaunchVelocity = FVector::ZeroVector;
 
 	// EPIC GAMES STANDARD: Curve asset loading state management
 	UPROPERTY(Transient)
@@ -428,13 +359,100 @@ private:
 	TObjectPtr<UCurveFloat> LoadedAirControlCurve;
 
 	// Timers and handles
-	FTimerHandle BounceEffectTimer;
 	FTimerHandle GroundCheckTimer;
 	FTimerHandle CurveLoadTimer;
 
 	// EPIC GAMES STANDARD: Asset loading streamable handle management
 	TSharedPtr<FStreamableHandle> CurveLoadHandle;
 
+	// Values saved before BounceTuning existed - PostLoad moves non-default ones into a tuning subobject
+	UPROPERTY()
+	float BounceUpwardVelocity_DEPRECATED = 800.0f;
+
+	UPROPERTY()
+	float HorizontalVelocityRetention_DEPRECATED = 1.0f;
+
+	UPROPERTY()
+	float HorizontalVelocityMultiplier_DEPRECATED = 1.0f;
+
+	UPROPERTY()
+	float AirControlMultiplier_DEPRECATED = 0.2f;
+
+	UPROPERTY()
+	int32 MaxAirBounces_DEPRECATED = 2;
+
+	UPROPERTY()
+	float AirBounceVelocityReduction_DEPRECATED = 0.85f;
+
+	UPROPERTY()
+	bool bResetAirBouncesOnGroundContact_DEPRECATED = true;
+
+	UPROPERTY()
+	bool bAllowBounceWhileRising_DEPRECATED = false;
+
+	UPROPERTY()
+	float GravityScaleDuringBounce_DEPRECATED = 1.0f;
+
+	UPROPERTY()
+	float BounceDuration_DEPRECATED = 0.2f;
+
+	UPROPERTY()
+	bool bIgnoreGravityDuringBounce_DEPRECATED = false;
+
+	UPROPERTY()
+	bool bPreserveDownwardMomentum_DEPRECATED = false;
+
+	UPROPERTY()
+	float DashMomentumMultiplier_DEPRECATED = 1.8f;
+
+	UPROPERTY()
+	float JumpMomentumMultiplier_DEPRECATED = 1.3f;
+
+	UPROPERTY()
+	float FallMomentumMultiplier_DEPRECATED = 1.0f;
+
+	UPROPERTY()
+	float MomentumTransferEfficiency_DEPRECATED = 0.85f;
+
+	UPROPERTY()
+	float BounceXAxisMultiplier_DEPRECATED = 1.0f;
+
+	UPROPERTY()
+	float BounceYAxisMultiplier_DEPRECATED = 1.0f;
+
+	UPROPERTY()
+	bool bAllowMomentumTransfer_DEPRECATED = true;
+
+	UPROPERTY()
+	bool bPreserveMomentumDirection_DEPRECATED = true;
+
+	UPROPERTY()
+	bool bAllowComboBounce_DEPRECATED = true;
+
+	UPROPERTY()
+	bool bEnableTrajectoryEnhancement_DEPRECATED = true;
+
+	UPROPERTY()
+	float UpwardAmplificationMultiplier_DEPRECATED = 1.75f;
+
+	UPROPERTY()
+	float UpwardVelocityThreshold_DEPRECATED = 150.0f;
+
+	UPROPERTY()
+	float HorizontalEnhancementMultiplier_DEPRECATED = 1.4f;
+
+	UPROPERTY()
+	float EnhancedHorizontalBoost_DEPRECATED = 500.0f;
+
+	UPROPERTY()
+	float RecoveryJumpVelocity_DEPRECATED = 800.0f;
+
+	UPROPERTY()
+	float FallingVelocityThreshold_DEPRECATED = 200.0f;
+
+	UPROPERTY()
+	float DiagonalEnhancementMultiplier_DEPRECATED = 1.6f;
+
 	// Constants - Epic Games style
 	static constexpr float DEFAULT_GROUND_CHECK_RATE = 1.0f / 20.0f;
 	static constexpr float MIN_BOUNCE_VELOCITY = 200.0f;
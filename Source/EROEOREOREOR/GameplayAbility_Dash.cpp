@@ -2,15 +2,17 @@
 
 #include "GameplayAbility_Dash.h"
 #include "MyCharacter.h"
+#include "CombatMovementComponent.h"
+#include "CombatStats.h"
+#include "CombatLog.h"
 #include "Camera/CameraComponent.h"
-#include "GameFramework/CharacterMovementComponent.h"
 #include "AbilitySystemComponent.h"
 #include "Engine/World.h"
 #include "Curves/CurveFloat.h"
 
-// Conditional logging - Epic Games standard approach using LogTemp
+// Conditional logging - LogDash, hot-path calls are Verbose and stripped by DASH_LOG_COMPILE_VERBOSITY
 #if !UE_BUILD_SHIPPING
-    #define DASH_LOG(Verbosity, Format, ...) UE_LOG(LogTemp, Verbosity, TEXT("[DashAbility] ") Format, ##__VA_ARGS__)
+    #define DASH_LOG(Verbosity, Format, ...) UE_LOG(LogDash, Verbosity, TEXT("[DashAbility] ") Format, ##__VA_ARGS__)
 #else  
     #define DASH_LOG(Verbosity, Format, ...)
 #endif
@@ -29,6 +31,8 @@ UGameplayAbility_Dash::UGameplayAbility_Dash()
 	DashingStateTag = FGameplayTag::RequestGameplayTag(FName("State.Dashing"));
 	DashCooldownTag = FGameplayTag::RequestGameplayTag(FName("Cooldown.Dash"));
 	DashImmuneTag = FGameplayTag::RequestGameplayTag(FName("Immune.Dash"));
+	DashLeftInputTag = FGameplayTag::RequestGameplayTag(FName("Input.Dash.Left"));
+	DashRightInputTag = FGameplayTag::RequestGameplayTag(FName("Input.Dash.Right"));
 	
 	// NOTE: Default values are now set in header file only
 	// This allows Blueprint editor changes to persist
@@ -37,7 +41,7 @@ UGameplayAbility_Dash::UGameplayAbility_Dash()
 	DashDirection = EDashDirection::None;
 	CachedCharacter = nullptr;
 	bIsActiveDash = false;
-	DashStartTime = 0.0f;
+	bMovementDelegateBound = false;
 	StoredInputDirection = FVector2D::ZeroVector;
 	LoadedDashSpeedCurve = nullptr;
 	LoadedDashDirectionCurve = nullptr;
@@ -67,32 +71,31 @@ bool UGameplayAbility_Dash::CanActivateAbility(const FGameplayAbilitySpecHandle
 
 void UGameplayAbility_Dash::ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData)
 {
-	// Epic Games standard: Extract direction from natively registered tags
+	COMBAT_SCOPE(DashActivate);
+
+	// Direction arrives in the trigger event payload sent by AMyCharacter::ActivateAbilityInput
 	EDashDirection ActivationDirection = EDashDirection::None;
 	
-	if (ActorInfo && ActorInfo->AbilitySystemComponent.IsValid())
+	if (TriggerEventData)
 	{
-		const UAbilitySystemComponent* ASC = ActorInfo->AbilitySystemComponent.Get();
-		
-		// Use natively registered tags - guaranteed to be available
-		if (ASC->HasMatchingGameplayTag(FGameplayTag::RequestGameplayTag(FName("Input.Dash.Left"))))
+		if (TriggerEventData->EventTag == DashLeftInputTag)
 		{
 			ActivationDirection = EDashDirection::Left;
 		}
-		else if (ASC->HasMatchingGameplayTag(FGameplayTag::RequestGameplayTag(FName("Input.Dash.Right"))))
+		else if (TriggerEventData->EventTag == DashRightInputTag)
 		{
 			ActivationDirection = EDashDirection::Right;
 		}
 	}
 
-	DASH_LOG(Log, TEXT("ActivateAbility: Starting dash with direction %s"), 
+	DASH_LOG(Verbose, TEXT("ActivateAbility: Starting dash with direction %s"), 
 		ActivationDirection == EDashDirection::Left ? TEXT("LEFT") : 
 		ActivationDirection == EDashDirection::Right ? TEXT("RIGHT") : TEXT("NONE"));
 
-	// Validate direction was communicated through gameplay tags
+	// Validate direction was communicated through the event payload
 	if (ActivationDirection == EDashDirection::None)
 	{
-		DASH_LOG(Warning, TEXT("ActivateAbility: No dash direction tag found - aborting"));
+		DASH_LOG(Warning, TEXT("ActivateAbility: No dash direction in trigger event - aborting"));
 		EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
 		return;
 	}
@@ -103,7 +106,7 @@ void UGameplayAbility_Dash::ActivateAbility(const FGameplayAbilitySpecHandle Han
 	// Commit ability resources
 	if (!CommitAbility(Handle, ActorInfo, ActivationInfo))
 	{
-		DASH_LOG(Warning, TEXT("ActivateAbility: CommitAbility failed"));
+		DASH_LOG(Verbose, TEXT("ActivateAbility: CommitAbility failed"));
 		EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
 		return;
 	}
@@ -131,18 +134,12 @@ void UGameplayAbility_Dash::ActivateAbility(const FGameplayAbilitySpecHandle Han
 	// Execute dash - single method, single responsibility
 	ExecuteDash();
 
-	DASH_LOG(Log, TEXT("ActivateAbility: Successfully started dash"));
+	DASH_LOG(Verbose, TEXT("ActivateAbility: Successfully started dash"));
 }
 
 void UGameplayAbility_Dash::EndAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, bool bReplicateEndAbility, bool bWasCancelled)
 {
-	DASH_LOG(Log, TEXT("EndAbility: Ending dash - Cancelled: %s"), bWasCancelled ? TEXT("true") : TEXT("false"));
-
-	// Clean up timer resources
-	if (const UWorld* World = GetWorld())
-	{
-		World->GetTimerManager().ClearTimer(VelocityUpdateTimer);
-	}
+	DASH_LOG(Verbose, TEXT("EndAbility: Ending dash - Cancelled: %s"), bWasCancelled ? TEXT("true") : TEXT("false"));
 
 	// EPIC GAMES STANDARD: Clean up streamable handles properly
 	if (CurveLoadHandle.IsValid())
@@ -151,18 +148,15 @@ void UGameplayAbility_Dash::EndAbility(const FGameplayAbilitySpecHandle Handle,
 		CurveLoadHandle.Reset();
 	}
 
-	// Apply momentum retention if dash completed naturally
-	AMyCharacter* Character = CachedCharacter.Get();
-	if (!bWasCancelled && Character)
+	// Momentum retention is applied by the movement component when the dash mode completes naturally.
+	// Any other end (cancel, external EndAbility) must leave the dash mode so movement and tags agree.
+	UnbindMovementDelegate();
+	if (const AMyCharacter* Character = CachedCharacter.Get())
 	{
-		if (UCharacterMovementComponent* MovementComponent = Character->GetCharacterMovement())
+		UCombatMovementComponent* CombatMovement = Character->GetCombatMovementComponent();
+		if (CombatMovement && CombatMovement->IsInCombatMovementMode(ECombatMovementMode::Dash))
 		{
-			FVector CurrentVelocity = MovementComponent->Velocity;
-			CurrentVelocity.X *= MomentumRetention;
-			CurrentVelocity.Y *= MomentumRetention;
-			MovementComponent->Velocity = CurrentVelocity;
-			
-			DASH_LOG(VeryVerbose, TEXT("EndAbility: Applied momentum retention %.2f"), MomentumRetention);
+			CombatMovement->StopCombatMovement();
 		}
 	}
 
@@ -171,20 +165,13 @@ void UGameplayAbility_Dash::EndAbility(const FGameplayAbilitySpecHandle Handle,
 	CachedCharacter = nullptr;
 	DashDirection = EDashDirection::None;
 	StoredInputDirection = FVector2D::ZeroVector;
-	DashStartTime = 0.0f;
 
 	Super::EndAbility(Handle, ActorInfo, ActivationInfo, bReplicateEndAbility, bWasCancelled);
 }
 
 void UGameplayAbility_Dash::CancelAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, bool bReplicateEndAbility)
 {
-	DASH_LOG(Log, TEXT("CancelAbility: Dash ability cancelled"));
-	
-	// Immediate cleanup
-	if (const UWorld* World = GetWorld())
-	{
-		World->GetTimerManager().ClearTimer(VelocityUpdateTimer);
-	}
+	DASH_LOG(Verbose, TEXT("CancelAbility: Dash ability cancelled"));
 
 	Super::CancelAbility(Handle, ActorInfo, ActivationInfo, bReplicateEndAbility);
 }
@@ -199,9 +186,9 @@ bool UGameplayAbility_Dash::ValidateActivationRequirements(const AMyCharacter* I
 		return false;
 	}
 
-	if (!InCharacter->GetCharacterMovement())
+	if (!InCharacter->GetCombatMovementComponent())
 	{
-		DASH_LOG(Warning, TEXT("ValidateActivationRequirements: No character movement component"));
+		DASH_LOG(Warning, TEXT("ValidateActivationRequirements: Character movement is not a UCombatMovementComponent"));
 		return false;
 	}
 
@@ -219,11 +206,13 @@ void UGameplayAbility_Dash::ExecuteDash()
 	AMyCharacter* Character = CachedCharacter.Get();
 	check(Character); // Epic Games style assertion for internal methods
 
-	// EDITOR VALUES NOW RESPECTED - No more character blueprint override!
-	// The ability's own editor parameters are now the authoritative source
-	
-	DASH_LOG(Warning, TEXT("Using Ability editor values - Speed: %.1f, Duration: %.2f, Momentum: %.2f"), 
-		DashSpeed, DashDuration, MomentumRetention);
+	UCombatMovementComponent* CombatMovement = Character->GetCombatMovementComponent();
+	check(CombatMovement); // Guaranteed by ValidateActivationRequirements
+
+	// The ability's tuning asset is the authoritative source - no character blueprint override
+	const FDashTuningBlock& Tuning = GetDashTuningData()->GetBlock();
+	DASH_LOG(VeryVerbose, TEXT("Using tuning %s - Speed: %.1f, Duration: %.2f, Momentum: %.2f"), 
+		*GetNameSafe(GetDashTuningData()), Tuning.GetSpeed(), Tuning.GetDuration(), Tuning.GetMomentumRetention());
 
 	// Store input direction relative to camera at activation time
 	const FVector2D CurrentInput = Character->GetCurrentMovementInput();
@@ -238,179 +227,118 @@ void UGameplayAbility_Dash::ExecuteDash()
 		StoredInputDirection = CurrentInput.GetSafeNormal();
 	}
 
-	// Initialize dash state
-	bIsActiveDash = true;
-	DashStartTime = GetWorld()->GetTimeSeconds();
-
-	// IMMEDIATE VELOCITY APPLICATION - No delay for first frame!
-	UCharacterMovementComponent* MovementComponent = Character->GetCharacterMovement();
-	if (MovementComponent)
-	{
-		// Calculate initial direction and speed for immediate response
-		const FVector DashDirectionVector = CalculateCameraRelativeDashDirection(Character);
-		const float InitialSpeed = CalculateCurrentDashSpeed(0.0f); // Start at full speed
-		
-		// Apply velocity immediately - critical for responsive feel
-		FVector DashVelocity = DashDirectionVector * InitialSpeed;
-		DashVelocity.Z = MovementComponent->Velocity.Z; // Preserve gravity
-		MovementComponent->Velocity = DashVelocity;
-		
-		// CAPTURE INITIAL HIGH-VELOCITY SNAPSHOT for momentum transfer
-		if (UVelocitySnapshotComponent* SnapshotComponent = Character->GetVelocitySnapshotComponent())
-		{
-			const FGameplayTag DashTag = FGameplayTag::RequestGameplayTag(FName("State.Dashing"));
-			SnapshotComponent->CaptureSnapshot(DashVelocity, EVelocitySource::Dash, DashTag);
-		}
-		
-		DASH_LOG(Log, TEXT("ExecuteDash: IMMEDIATE velocity applied - Direction: (%.2f, %.2f, %.2f), Speed: %.2f"), 
-			DashDirectionVector.X, DashDirectionVector.Y, DashDirectionVector.Z, InitialSpeed);
-	}
-
-	// Calculate update rate with bounds checking
-	const float ClampedUpdateFrequency = FMath::Clamp(UpdateFrequency, 10.0f, 120.0f);
-	const float UpdateRate = 1.0f / ClampedUpdateFrequency;
+	// MOVEMENT MODE HANDOFF - Velocity is evaluated by the movement component once per substep.
+	// No timer: the first substep of the next movement update runs at full speed (alpha 0).
+	const FCombatDashParams Params = BuildDashParams(DashDirection);
 
-	// Start velocity updates using Epic Games timer delegate pattern
-	if (UWorld* World = GetWorld())
+	if (!bMovementDelegateBound)
 	{
-		FTimerDelegate UpdateDelegate = FTimerDelegate::CreateUObject(this, &UGameplayAbility_Dash::UpdateDashVelocity);
-		World->GetTimerManager().SetTimer(VelocityUpdateTimer, UpdateDelegate, UpdateRate, true);
+		CombatMovement->OnCombatMovementModeEnded.AddDynamic(this, &UGameplayAbility_Dash::OnDashMovementEnded);
+		bMovementDelegateBound = true;
 	}
 
-	DASH_LOG(Log, TEXT("ExecuteDash: Started with input (%.2f, %.2f), update rate %.3f"), 
-		StoredInputDirection.X, StoredInputDirection.Y, UpdateRate);
+	bIsActiveDash = true;
+	CombatMovement->StartDash(Params);
+
+	DASH_LOG(VeryVerbose, TEXT("ExecuteDash: Started with input (%.2f, %.2f), sign %.0f"), 
+		StoredInputDirection.X, StoredInputDirection.Y, Params.DirectionSign);
 }
 
-FVector UGameplayAbility_Dash::CalculateCameraRelativeDashDirection(const AMyCharacter* InCharacter) const
+FCombatDashParams UGameplayAbility_Dash::BuildDashParams(EDashDirection InDirection) const
 {
-	check(InCharacter); // Epic Games assertion pattern
-
-	const UCameraComponent* FollowCamera = InCharacter->GetFollowCamera();
-	check(FollowCamera);
-
-	// Get camera's right vector - this is our pure left/right axis for screen-relative movement
-	FVector CameraRightVector = FollowCamera->GetRightVector();
-	
-	// Project to horizontal plane (remove vertical component)
-	CameraRightVector.Z = 0.0f;
-	CameraRightVector.Normalize();
-	
-	// Apply direction based on dash type - CAMERA RELATIVE IMPLEMENTATION
-	FVector DashDirectionVector = FVector::ZeroVector;
-	
-	switch (DashDirection)
-	{
-		case EDashDirection::Left:
-			// Left dash always moves toward left edge of screen (negative camera right)
-			DashDirectionVector = -CameraRightVector;
-			break;
-			
-		case EDashDirection::Right:
-			// Right dash always moves toward right edge of screen (positive camera right)
-			DashDirectionVector = CameraRightVector;
-			break;
-			
-		default:
-			DASH_LOG(Warning, TEXT("Invalid dash direction - defaulting to right"));
-			DashDirectionVector = CameraRightVector;
-			break;
-	}
-	
-	return DashDirectionVector.GetSafeNormal();
+	// PERFORMANCE: Every value below comes from one cache line of the shared tuning block
+	const FDashTuningBlock& Tuning = GetDashTuningData()->GetBlock();
+
+	FCombatDashParams Params;
+	Params.DirectionSign = (InDirection == EDashDirection::Left) ? -1.0f : 1.0f;
+	Params.Speed = FMath::Clamp(Tuning.GetSpeed(), MIN_DASH_SPEED, MAX_DASH_SPEED);
+	Params.Duration = Tuning.GetDuration();
+	Params.XAxisMultiplier = Tuning.GetXAxisMultiplier();
+	Params.YAxisMultiplier = Tuning.GetYAxisMultiplier();
+	Params.VelocityMultiplier = Tuning.GetVelocityMultiplier();
+	Params.MomentumRetention = Tuning.GetMomentumRetention();
+	Params.bIgnoreGravity = Tuning.bIgnoreGravity;
+	Params.SpeedCurve = LoadedDashSpeedCurve;
+	return Params;
 }
 
-float UGameplayAbility_Dash::CalculateCurrentDashSpeed(const float InAlpha) const
+bool UGameplayAbility_Dash::MakeDashTrajectoryQuery(EDashDirection InDirection, float LandingZ, FDashTrajectoryQuery& OutQuery) const
 {
-	// Bounds checking
-	const float ClampedAlpha = FMath::Clamp(InAlpha, 0.0f, 1.0f);
-	
-	float CurrentSpeed = FMath::Clamp(DashSpeed, MIN_DASH_SPEED, MAX_DASH_SPEED);
-	
-	// Check if curve is loaded and valid - EPIC GAMES STANDARD: Use loaded curve assets
-	if (IsValid(LoadedDashSpeedCurve))
+	const AMyCharacter* Character = Cast<AMyCharacter>(GetAvatarActorFromActorInfo());
+	const UCombatMovementComponent* CombatMovement = Character ? Character->GetCombatMovementComponent() : nullptr;
+	if (!IsValid(CombatMovement))
 	{
-		CurrentSpeed *= LoadedDashSpeedCurve->GetFloatValue(ClampedAlpha);
-	}
-	else
-	{
-		// Default quadratic ease-out - industry standard
-		const float EaseMultiplier = 1.0f - FMath::Pow(1.0f - ClampedAlpha, 2.0f);
-		const float SpeedMultiplier = FMath::Lerp(1.0f, 0.2f, EaseMultiplier);
-		CurrentSpeed *= SpeedMultiplier;
+		return false;
 	}
 
-	return CurrentSpeed;
+	OutQuery.StartLocation = Character->GetActorLocation();
+	OutQuery.RightVector = CombatMovement->GetDashRightVector();
+	OutQuery.StartVelocityZ = CombatMovement->Velocity.Z;
+	OutQuery.bStartOnGround = CombatMovement->IsMovingOnGround();
+	OutQuery.GravityZ = CombatMovement->GetGravityZ();
+	OutQuery.LandingZ = LandingZ;
+	OutQuery.DashParams = BuildDashParams(InDirection);
+	return true;
 }
 
-void UGameplayAbility_Dash::UpdateDashVelocity()
+FCombatTrajectoryPrediction UGameplayAbility_Dash::PredictDashFromCurrentState(EDashDirection InDirection, float LandingZ) const
 {
-	// Early exit guards - Epic Games pattern
-	AMyCharacter* Character = CachedCharacter.Get();
-	if (!bIsActiveDash || !Character)
+	FDashTrajectoryQuery Query;
+	if (!MakeDashTrajectoryQuery(InDirection, LandingZ, Query))
 	{
-		return;
+		return FCombatTrajectoryPrediction();
 	}
 
-	// Calculate dash progress
-	const float CurrentTime = GetWorld()->GetTimeSeconds();
-	const float ElapsedTime = CurrentTime - DashStartTime;
-	const float Alpha = FMath::Clamp(ElapsedTime / DashDuration, 0.0f, 1.0f);
+	return FCombatTrajectoryPredictor::PredictDash(Query);
+}
 
-	// Check completion
-	if (Alpha >= 1.0f)
+void UGameplayAbility_Dash::OnDashMovementEnded(ECombatMovementMode EndedMode, bool bWasInterrupted)
+{
+	if (EndedMode != ECombatMovementMode::Dash || !bIsActiveDash)
 	{
-		FinalizeDash();
 		return;
 	}
 
-	// Component validation - defensive programming
-	UCharacterMovementComponent* MovementComponent = Character->GetCharacterMovement();
-	if (!MovementComponent)
+	if (bWasInterrupted)
 	{
-		DASH_LOG(Warning, TEXT("UpdateDashVelocity: Lost movement component - ending dash"));
-		FinalizeDash();
+		// Another movement mode took over (bounce, launch, external SetMovementMode)
+		DASH_LOG(Verbose, TEXT("OnDashMovementEnded: Dash mode interrupted"));
+		bIsActiveDash = false;
+		UnbindMovementDelegate();
+
+		if (IsActive())
+		{
+			K2_CancelAbility();
+		}
 		return;
 	}
 
-	// Calculate direction and speed
-	const FVector DashDirectionVector = CalculateCameraRelativeDashDirection(Character);
-	const float CurrentSpeed = CalculateCurrentDashSpeed(Alpha);
+	FinalizeDash();
+}
 
-	// Apply velocity with Z-preservation and new multipliers - critical for gravity
-	FVector DashVelocity = DashDirectionVector * CurrentSpeed;
-	
-	// Apply new axis-specific multipliers
-	DashVelocity.X *= DashXAxisMultiplier;
-	DashVelocity.Y *= DashYAxisMultiplier;
-	
-	// Apply dash-specific multipliers
-	DashVelocity *= DashVelocityMultiplier;
-	
-	DashVelocity.Z = MovementComponent->Velocity.Z;
-	MovementComponent->Velocity = DashVelocity;
+void UGameplayAbility_Dash::UnbindMovementDelegate()
+{
+	if (!bMovementDelegateBound)
+	{
+		return;
+	}
 
-	// CAPTURE VELOCITY SNAPSHOT for momentum transfer (only during strong dash phase)
-	if (Alpha < 0.8f && CurrentSpeed > 500.0f) // Only capture meaningful velocity
+	if (const AMyCharacter* Character = CachedCharacter.Get())
 	{
-		if (UVelocitySnapshotComponent* SnapshotComponent = Character->GetVelocitySnapshotComponent())
+		if (UCombatMovementComponent* CombatMovement = Character->GetCombatMovementComponent())
 		{
-			const FGameplayTag DashTag = FGameplayTag::RequestGameplayTag(FName("State.Dashing"));
-			SnapshotComponent->CaptureSnapshot(DashVelocity, EVelocitySource::Dash, DashTag);
+			CombatMovement->OnCombatMovementModeEnded.RemoveDynamic(this, &UGameplayAbility_Dash::OnDashMovementEnded);
 		}
 	}
+
+	bMovementDelegateBound = false;
 }
 
 void UGameplayAbility_Dash::FinalizeDash()
 {
-	// Clean up timer
-	if (const UWorld* World = GetWorld())
-	{
-		World->GetTimerManager().ClearTimer(VelocityUpdateTimer);
-	}
-
 	bIsActiveDash = false;
 
-	DASH_LOG(Log, TEXT("FinalizeDash: Dash completed naturally"));
+	DASH_LOG(Verbose, TEXT("FinalizeDash: Dash completed naturally"));
 
 	// End ability through GAS - proper flow
 	if (IsActive())
@@ -448,11 +376,11 @@ void UGameplayAbility_Dash::LoadCurveAssets()
 
 	if (CurveLoadHandle.IsValid())
 	{
-		UE_LOG(LogTemp, Log, TEXT("Dash: Started loading %d curve assets"), AssetsToLoad.Num());
+		UE_LOG(LogDash, Verbose, TEXT("Dash: Started loading %d curve assets"), AssetsToLoad.Num());
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Dash: Failed to start curve asset loading"));
+		UE_LOG(LogDash, Warning, TEXT("Dash: Failed to start curve asset loading"));
 	}
 }
 
@@ -464,11 +392,11 @@ void UGameplayAbility_Dash::OnCurveAssetsLoaded()
 		LoadedDashSpeedCurve = DashSpeedCurve.LoadSynchronous();
 		if (IsValid(LoadedDashSpeedCurve))
 		{
-			UE_LOG(LogTemp, Log, TEXT("Dash: DashSpeedCurve loaded successfully"));
+			UE_LOG(LogDash, Verbose, TEXT("Dash: DashSpeedCurve loaded successfully"));
 		}
 		else
 		{
-			UE_LOG(LogTemp, Warning, TEXT("Dash: Failed to load DashSpeedCurve"));
+			UE_LOG(LogDash, Warning, TEXT("Dash: Failed to load DashSpeedCurve"));
 		}
 	}
 
@@ -477,11 +405,11 @@ void UGameplayAbility_Dash::OnCurveAssetsLoaded()
 		LoadedDashDirectionCurve = DashDirectionCurve.LoadSynchronous();
 		if (IsValid(LoadedDashDirectionCurve))
 		{
-			UE_LOG(LogTemp, Log, TEXT("Dash: DashDirectionCurve loaded successfully"));
+			UE_LOG(LogDash, Verbose, TEXT("Dash: DashDirectionCurve loaded successfully"));
 		}
 		else
 		{
-			UE_LOG(LogTemp, Warning, TEXT("Dash: Failed to load DashDirectionCurve"));
+			UE_LOG(LogDash, Warning, TEXT("Dash: Failed to load DashDirectionCurve"));
 		}
 	}
 
@@ -497,24 +425,25 @@ void UGameplayAbility_Dash::OnCurveAssetsLoaded()
 void UGameplayAbility_Dash::TestDashParameters()
 {
 	DASH_LOG(Warning, TEXT("=== DASH PARAMETER TEST ==="));
-	DASH_LOG(Warning, TEXT("DashSpeed: %.2f"), DashSpeed);
-	DASH_LOG(Warning, TEXT("DashDuration: %.2f"), DashDuration);
-	DASH_LOG(Warning, TEXT("DashInitialBurstSpeed: %.2f"), DashInitialBurstSpeed);
-	DASH_LOG(Warning, TEXT("MomentumRetention: %.2f"), MomentumRetention);
-	DASH_LOG(Warning, TEXT("UpdateFrequency: %.2f"), UpdateFrequency);
+	const FDashTuning& Tuning = GetDashTuningData()->GetTuning();
+	DASH_LOG(Warning, TEXT("Tuning: %s"), *GetNameSafe(GetDashTuningData()));
+	DASH_LOG(Warning, TEXT("DashSpeed: %.2f"), Tuning.Speed);
+	DASH_LOG(Warning, TEXT("DashDuration: %.2f"), Tuning.Duration);
+	DASH_LOG(Warning, TEXT("DashInitialBurstSpeed: %.2f"), Tuning.InitialBurstSpeed);
+	DASH_LOG(Warning, TEXT("MomentumRetention: %.2f"), Tuning.MomentumRetention);
 	DASH_LOG(Warning, TEXT("=== END TEST ==="));
 }
 
 float UGameplayAbility_Dash::GetCurrentDashProgress() const
 {
-	if (!bIsActiveDash || DashStartTime <= 0.0f)
+	const AMyCharacter* Character = CachedCharacter.Get();
+	if (!bIsActiveDash || !Character)
 	{
 		return 0.0f;
 	}
 
-	const float CurrentTime = GetWorld()->GetTimeSeconds();
-	const float ElapsedTime = CurrentTime - DashStartTime;
-	return FMath::Clamp(ElapsedTime / DashDuration, 0.0f, 1.0f);
+	const UCombatMovementComponent* CombatMovement = Character->GetCombatMovementComponent();
+	return CombatMovement ? CombatMovement->GetDashProgress() : 0.0f;
 }
 
 FVector UGameplayAbility_Dash::GetCurrentDashDirection() const
@@ -525,88 +454,113 @@ FVector UGameplayAbility_Dash::GetCurrentDashDirection() const
 		return FVector::ZeroVector;
 	}
 
-	return CalculateCameraRelativeDashDirection(Character);
+	const UCombatMovementComponent* CombatMovement = Character->GetCombatMovementComponent();
+	return CombatMovement ? CombatMovement->GetDashDirection() : FVector::ZeroVector;
 }
 
 float UGameplayAbility_Dash::GetCurrentDashSpeed() const
 {
-	if (!bIsActiveDash)
+	const AMyCharacter* Character = CachedCharacter.Get();
+	if (!bIsActiveDash || !Character)
 	{
 		return 0.0f;
 	}
 
-	const float Progress = GetCurrentDashProgress();
-	return CalculateCurrentDashSpeed(Progress);
+	const UCombatMovementComponent* CombatMovement = Character->GetCombatMovementComponent();
+	return CombatMovement ? CombatMovement->GetDashSpeed() : 0.0f;
 }
 
-// PRESET IMPLEMENTATIONS - Epic Games standards
+// PRESET IMPLEMENTATIONS - Pointer swaps onto shared built-in tuning
 
 void UGameplayAbility_Dash::ApplyQuickDashPreset()
 {
-	// Fast, snappy dash feel
-	DashSpeed = 2200.0f;
-	DashInitialBurstSpeed = 2800.0f;
-	DashDuration = 0.4f;
-	DashInitialBurstDuration = 0.05f;
-	DashSpeedDecayRate = 0.25f;
-	MomentumRetention = 0.1f;
-	UpdateFrequency = 90.0f;
-	
+	DashTuning = UDashTuningData::GetBuiltInPreset(EDashTuningPreset::Quick);
 	DASH_LOG(Warning, TEXT("Applied Quick Dash Preset"));
 }
 
 void UGameplayAbility_Dash::ApplyFloatyDashPreset()
 {
-	// Smooth, extended dash feel
-	DashSpeed = 1400.0f;
-	DashInitialBurstSpeed = 1600.0f;
-	DashDuration = 1.2f;
-	DashInitialBurstDuration = 0.15f;
-	DashSpeedDecayRate = 0.05f;
-	MomentumRetention = 0.6f;
-	UpdateFrequency = 45.0f;
-	
+	DashTuning = UDashTuningData::GetBuiltInPreset(EDashTuningPreset::Floaty);
 	DASH_LOG(Warning, TEXT("Applied Floaty Dash Preset"));
 }
 
 void UGameplayAbility_Dash::ApplySnappyDashPreset()
 {
-	// Immediate, precise dash feel
-	DashSpeed = 2500.0f;
-	DashInitialBurstSpeed = 3000.0f;
-	DashDuration = 0.25f;
-	DashInitialBurstDuration = 0.02f;
-	DashSpeedDecayRate = 0.4f;
-	MomentumRetention = 0.05f;
-	UpdateFrequency = 120.0f;
-	
+	DashTuning = UDashTuningData::GetBuiltInPreset(EDashTuningPreset::Snappy);
 	DASH_LOG(Warning, TEXT("Applied Snappy Dash Preset"));
 }
 
 void UGameplayAbility_Dash::ApplyPowerfulDashPreset()
 {
-	// High-speed, impactful dash feel
-	DashSpeed = 2800.0f;
-	DashInitialBurstSpeed = 3500.0f;
-	DashDuration = 0.6f;
-	DashInitialBurstDuration = 0.08f;
-	DashSpeedDecayRate = 0.18f;
-	MomentumRetention = 0.4f;
-	UpdateFrequency = 75.0f;
-	
+	DashTuning = UDashTuningData::GetBuiltInPreset(EDashTuningPreset::Powerful);
 	DASH_LOG(Warning, TEXT("Applied Powerful Dash Preset"));
 }
 
 void UGameplayAbility_Dash::ResetToDefaultPreset()
 {
-	// Reset to original balanced values
-	DashSpeed = 1875.0f;
-	DashInitialBurstSpeed = 2500.0f;
-	DashDuration = 0.8f;
-	DashInitialBurstDuration = 0.1f;
-	DashSpeedDecayRate = 0.15f;
-	MomentumRetention = 0.3f;
-	UpdateFrequency = 60.0f;
-	
+	DashTuning = UDashTuningData::GetBuiltInPreset(EDashTuningPreset::Default);
 	DASH_LOG(Warning, TEXT("Reset to Default Dash Preset"));
 }
+
+// TUNING ACCESS
+
+const UDashTuningData* UGameplayAbility_Dash::GetDashTuningData() const
+{
+	return DashTuning ? DashTuning.Get() : UDashTuningData::GetBuiltInPreset(EDashTuningPreset::Default);
+}
+
+void UGameplayAbility_Dash::SetDashSpeedRuntime(float InSpeed)
+{
+	FDashTuning Tuning = GetDashTuningData()->GetTuning();
+	Tuning.Speed = FMath::Clamp(InSpeed, MIN_DASH_SPEED, MAX_DASH_SPEED);
+	DashTuning = UDashTuningData::MakeVariant(Tuning, this);
+}
+
+void UGameplayAbility_Dash::SetDashDurationRuntime(float InDuration)
+{
+	FDashTuning Tuning = GetDashTuningData()->GetTuning();
+	Tuning.Duration = FMath::Clamp(InDuration, 0.05f, 3.0f);
+	DashTuning = UDashTuningData::MakeVariant(Tuning, this);
+}
+
+void UGameplayAbility_Dash::OnAvatarSet(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec)
+{
+	Super::OnAvatarSet(ActorInfo, Spec);
+
+	// Instanced per actor - a character blueprint still carrying the old dash values tunes its own dash,
+	// unless this ability already names a tuning asset
+	const AMyCharacter* Character = ActorInfo ? Cast<AMyCharacter>(ActorInfo->AvatarActor.Get()) : nullptr;
+	if (!DashTuning && Character && Character->GetMigratedDashTuning())
+	{
+		DashTuning = Character->GetMigratedDashTuning();
+	}
+}
+
+void UGameplayAbility_Dash::PostLoad()
+{
+	Super::PostLoad();
+
+	if (DashTuning)
+	{
+		return;
+	}
+
+	// Blueprints saved with per-ability values keep them as a tuning subobject saved with the blueprint
+	FDashTuning Migrated;
+	Migrated.Speed = DashSpeed_DEPRECATED;
+	Migrated.InitialBurstSpeed = DashInitialBurstSpeed_DEPRECATED;
+	Migrated.SpeedDecayRate = DashSpeedDecayRate_DEPRECATED;
+	Migrated.XAxisMultiplier = DashXAxisMultiplier_DEPRECATED;
+	Migrated.YAxisMultiplier = DashYAxisMultiplier_DEPRECATED;
+	Migrated.VelocityMultiplier = DashVelocityMultiplier_DEPRECATED;
+	Migrated.Duration = DashDuration_DEPRECATED;
+	Migrated.InitialBurstDuration = DashInitialBurstDuration_DEPRECATED;
+	Migrated.MomentumRetention = MomentumRetention_DEPRECATED;
+	Migrated.bIgnoreGravity = bIgnoreGravityDuringDash_DEPRECATED;
+
+	const FDashTuning Defaults;
+	if (!FDashTuning::StaticStruct()->CompareScriptStruct(&Migrated, &Defaults, PPF_None))
+	{
+		DashTuning = UDashTuningData::MakeVariant(Migrated, this, TEXT("MigratedDashTuning"), RF_NoFlags);
+	}
+}
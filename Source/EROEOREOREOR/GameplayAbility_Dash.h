@@ -5,7 +5,9 @@
 #include "CoreMinimal.h"
 #include "Abilities/GameplayAbility.h"
 #include "GameplayTagContainer.h"
-#include "Engine/TimerHandle.h"
+#include "CombatMovementComponent.h"
+#include "CombatTrajectoryPredictor.h"
+#include "MovementAbilityTuning.h"
 #include "Engine/AssetManager.h"
 #include "Engine/StreamableManager.h"
 #include "Misc/Optional.h"
@@ -41,6 +43,8 @@ public:
 	virtual void EndAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, bool bReplicateEndAbility, bool bWasCancelled) override;
 	virtual void CancelAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, bool bReplicateEndAbility) override;
 	virtual bool CanActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayTagContainer* SourceTags, const FGameplayTagContainer* TargetTags, OUT FGameplayTagContainer* OptionalRelevantTags) const override;
+	virtual void OnAvatarSet(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec) override;
+	virtual void PostLoad() override;
 
 	// Public API - Blueprint accessible for design iteration
 	UFUNCTION(BlueprintCallable, Category = "Dash")
@@ -63,11 +67,22 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Dash|Testing")
 	float GetCurrentDashSpeed() const;
 
+	// TRAJECTORY PREDICTION - closed form, no simulation (AI, UI arcs)
+	UFUNCTION(BlueprintPure, Category = "Dash|Prediction")
+	FCombatTrajectoryPrediction PredictDashFromCurrentState(EDashDirection InDirection, float LandingZ) const;
+
+	// Query for a dash started now by the avatar - feed to FCombatTrajectoryPredictor::PredictDashBatch
+	bool MakeDashTrajectoryQuery(EDashDirection InDirection, float LandingZ, FDashTrajectoryQuery& OutQuery) const;
+
+	// Runtime tweaks build a transient variant of the current tuning - shared assets are never written
 	UFUNCTION(BlueprintCallable, Category = "Dash|Testing")
-	void SetDashSpeedRuntime(float InSpeed) { DashSpeed = FMath::Clamp(InSpeed, MIN_DASH_SPEED, MAX_DASH_SPEED); }
+	void SetDashSpeedRuntime(float InSpeed);
 
 	UFUNCTION(BlueprintCallable, Category = "Dash|Testing")
-	void SetDashDurationRuntime(float InDuration) { DashDuration = FMath::Clamp(InDuration, 0.05f, 3.0f); }
+	void SetDashDurationRuntime(float InDuration);
+
+	// Active tuning - DashTuning or the built-in default preset
+	const UDashTuningData* GetDashTuningData() const;
 
 	// CONFIGURATION PRESETS - Easy testing of different feels
 	UFUNCTION(BlueprintCallable, Category = "Dash|Presets", CallInEditor)
@@ -85,45 +100,22 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Dash|Presets", CallInEditor)
 	void ResetToDefaultPreset();
 
-protected:
-	// DASH VELOCITY CONTROL - Core speed and power settings
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "🚀 Dash Core Settings", 
-		meta = (ClampMin = "100.0", ClampMax = "10000.0", UIMin = "500.0", UIMax = "5000.0", Units = "cm/s",
-		DisplayName = "Base Dash Speed", ToolTip = "Primary speed of the dash movement. Higher = faster dash."))
-	float DashSpeed = 1875.0f;
+	UFUNCTION(BlueprintCallable, Category = "Dash|Presets")
+	void SetDashTuning(const UDashTuningData* InTuning) { DashTuning = InTuning; }
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "🚀 Dash Core Settings", 
-		meta = (ClampMin = "0.0", ClampMax = "5000.0", UIMin = "0.0", UIMax = "2500.0", Units = "cm/s",
-		DisplayName = "Initial Burst Speed", ToolTip = "Extra speed applied at dash start for snappy feel. 0 = no burst."))
-	float DashInitialBurstSpeed = 2500.0f;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "🚀 Dash Core Settings", 
-		meta = (ClampMin = "0.0", ClampMax = "1.0", UIMin = "0.0", UIMax = "1.0", Units = "Multiplier",
-		DisplayName = "Speed Decay Rate", ToolTip = "How quickly dash slows down over time. 0 = constant speed, 1 = immediate stop."))
-	float DashSpeedDecayRate = 0.15f;
+protected:
+	// DASH TUNING - Speed, duration, axis and momentum settings live in a shared immutable asset.
+	// Presets and runtime tweaks swap this pointer; empty = built-in default preset
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "🚀 Dash Core Settings",
+		meta = (DisplayName = "Dash Tuning", ToolTip = "Tuning asset read by every dash. Leave empty for the built-in default preset."))
+	TObjectPtr<const UDashTuningData> DashTuning;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "🚀 Dash Core Settings", 
 		meta = (ClampMin = "0.0", ClampMax = "1.0", UIMin = "0.0", UIMax = "1.0", Units = "Multiplier",
 		DisplayName = "Vertical Momentum Keep", ToolTip = "How much vertical velocity to preserve during dash. 1 = keep all, 0 = remove all."))
 	float DashVerticalVelocityPreservation = 1.0f;
 
-	// AXIS MULTIPLIERS - Fine-tune directional control
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "⚖️ Axis Control", 
-		meta = (ClampMin = "0.1", ClampMax = "5.0", UIMin = "0.5", UIMax = "3.0", Units = "Multiplier",
-		DisplayName = "X-Axis Multiplier", ToolTip = "Boost/reduce horizontal dash strength. 1.0 = normal, 2.0 = double strength."))
-	float DashXAxisMultiplier = 1.0f;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "⚖️ Axis Control", 
-		meta = (ClampMin = "0.1", ClampMax = "5.0", UIMin = "0.5", UIMax = "3.0", Units = "Multiplier",
-		DisplayName = "Y-Axis Multiplier", ToolTip = "Boost/reduce side-to-side dash strength. 1.0 = normal, 2.0 = double strength."))
-	float DashYAxisMultiplier = 1.0f;
-
 	// POWER MULTIPLIERS - Enhanced dash effects
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "💪 Power Multipliers", 
-		meta = (ClampMin = "0.1", ClampMax = "10.0", UIMin = "0.5", UIMax = "5.0", Units = "Multiplier",
-		DisplayName = "Overall Velocity Boost", ToolTip = "Multiply final dash velocity. Great for power-ups! 1.0 = normal, 3.0 = triple power."))
-	float DashVelocityMultiplier = 1.0f;
-
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "💪 Power Multipliers", 
 		meta = (ClampMin = "0.1", ClampMax = "10.0", UIMin = "0.5", UIMax = "5.0", Units = "Multiplier",
 		DisplayName = "Momentum Transfer Power", ToolTip = "How much dash momentum transfers to other abilities. Higher = stronger combo potential."))
@@ -135,27 +127,11 @@ protected:
 	float DashDirectionalMultiplier = 1.0f;
 
 	// DASH TIMING CONTROL - Precise duration management
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dash|Timing", 
-		meta = (ClampMin = "0.05", ClampMax = "3.0", UIMin = "0.1", UIMax = "2.0"))
-	float DashDuration = 0.8f;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dash|Timing", 
-		meta = (ClampMin = "0.0", ClampMax = "0.5", UIMin = "0.0", UIMax = "0.3"))
-	float DashInitialBurstDuration = 0.1f;
-
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dash|Timing", 
 		meta = (ClampMin = "0.0", ClampMax = "2.0", UIMin = "0.0", UIMax = "1.0"))
 	float DashCancelWindow = 0.2f;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dash|Timing", 
-		meta = (ClampMin = "10.0", ClampMax = "120.0", UIMin = "30.0", UIMax = "90.0"))
-	float UpdateFrequency = 60.0f;
-
 	// DASH PHYSICS CONTROL - Movement feel parameters
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dash|Physics", 
-		meta = (ClampMin = "0.0", ClampMax = "1.0", UIMin = "0.0", UIMax = "1.0"))
-	float MomentumRetention = 0.3f;
-
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dash|Physics", 
 		meta = (ClampMin = "0.0", ClampMax = "1.0", UIMin = "0.0", UIMax = "1.0"))
 	float DashAirControl = 0.1f;
@@ -167,9 +143,6 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dash|Physics")
 	bool bPreserveVerticalMomentum = true;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dash|Physics")
-	bool bIgnoreGravityDuringDash = false;
-
 	// DASH DISTANCE CONTROL - Alternative to time-based dashing
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dash|Distance")
 	bool bUseDistanceBasedDash = false;
@@ -236,16 +209,28 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dash|GameplayTags")
 	FGameplayTag DashImmuneTag;
 
+	// Trigger event tags carrying the dash direction
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dash|GameplayTags")
+	FGameplayTag DashLeftInputTag;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dash|GameplayTags")
+	FGameplayTag DashRightInputTag;
+
 private:
 	// Core Implementation - Single responsibility
 	void ExecuteDash();
-	void UpdateDashVelocity();
 	void FinalizeDash();
 
+	// Dash velocity runs as a custom movement mode - the ability only reacts to its end
+	UFUNCTION()
+	void OnDashMovementEnded(ECombatMovementMode EndedMode, bool bWasInterrupted);
+	void UnbindMovementDelegate();
+
 	// Helper functions for testability
 	bool ValidateActivationRequirements(const AMyCharacter* InCharacter) const;
-	FVector CalculateCameraRelativeDashDirection(const AMyCharacter* InCharacter) const;
-	float CalculateCurrentDashSpeed(const float InAlpha) const;
+
+	// Movement parameters for a dash in the given direction - same values ExecuteDash hands to the movement component
+	FCombatDashParams BuildDashParams(EDashDirection InDirection) const;
 
 	// Core Implementation - Single responsibility
 	void LoadCurveAssets();
@@ -270,16 +255,44 @@ private:
 	TObjectPtr<UCurveFloat> LoadedDashDirectionCurve;
 
 	// Runtime State
-	FTimerHandle VelocityUpdateTimer;
-	FTimerHandle CurveLoadTimer;
-	float DashStartTime;
 	bool bIsActiveDash;
+	bool bMovementDelegateBound;
 
 	// EPIC GAMES STANDARD: Asset loading streamable handle management
 	TSharedPtr<FStreamableHandle> CurveLoadHandle;
 
+	// Values saved before DashTuning existed - PostLoad moves non-default ones into a tuning subobject
+	UPROPERTY()
+	float DashSpeed_DEPRECATED = 1875.0f;
+
+	UPROPERTY()
+	float DashInitialBurstSpeed_DEPRECATED = 2500.0f;
+
+	UPROPERTY()
+	float DashSpeedDecayRate_DEPRECATED = 0.15f;
+
+	UPROPERTY()
+	float DashXAxisMultiplier_DEPRECATED = 1.0f;
+
+	UPROPERTY()
+	float DashYAxisMultiplier_DEPRECATED = 1.0f;
+
+	UPROPERTY()
+	float DashVelocityMultiplier_DEPRECATED = 1.0f;
+
+	UPROPERTY()
+	float DashDuration_DEPRECATED = 0.8f;
+
+	UPROPERTY()
+	float DashInitialBurstDuration_DEPRECATED = 0.1f;
+
+	UPROPERTY()
+	float MomentumRetention_DEPRECATED = 0.3f;
+
+	UPROPERTY()
+	bool bIgnoreGravityDuringDash_DEPRECATED = false;
+
 	// Constants - Epic Games style
-	static constexpr float DEFAULT_UPDATE_RATE = 1.0f / 30.0f;
 	static constexpr float MIN_DASH_SPEED = 100.0f;
 	static constexpr float MAX_DASH_SPEED = 5000.0f;
 };
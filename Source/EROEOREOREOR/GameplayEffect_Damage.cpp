@@ -1,5 +1,7 @@
 #include "GameplayEffect_Damage.h"
 #include "MyAttributeSet.h"
+#include "CombatStats.h"
+#include "CombatLog.h"
 #include "AbilitySystemComponent.h"
 #include "GameplayEffectTypes.h"
 #include "GameplayTagContainer.h"
@@ -74,6 +76,8 @@ UDamageExecutionCalculation::UDamageExecutionCalculation()
 
 void UDamageExecutionCalculation::Execute_Implementation(const FGameplayEffectCustomExecutionParameters& ExecutionParams, OUT FGameplayEffectCustomExecutionOutput& OutExecutionOutput) const
 {
+	COMBAT_SCOPE(DamageExecution);
+	
 	UAbilitySystemComponent* TargetABC = ExecutionParams.GetTargetAbilitySystemComponent();
 	UAbilitySystemComponent* SourceABC = ExecutionParams.GetSourceAbilitySystemComponent();
 
@@ -111,7 +115,7 @@ void UDamageExecutionCalculation::Execute_Implementation(const FGameplayEffectCu
 		// Log damage for debugging
 		if (SourceActor && TargetActor)
 		{
-			UE_LOG(LogTemp, Log, TEXT("DamageExecution: %s dealt %.1f damage to %s"), 
+			UE_LOG(LogCombat, VeryVerbose, TEXT("DamageExecution: %s dealt %.1f damage to %s"), 
 				*SourceActor->GetName(), FinalDamage, *TargetActor->GetName());
 		}
 	}
@@ -164,7 +168,7 @@ float UDamageExecutionCalculation::ApplyCriticalHit(float BaseDamage, const FGam
 		// Apply critical multiplier
 		float CriticalDamage = BaseDamage * FMath::Max(CritMultiplier, 1.0f);
 		
-		UE_LOG(LogTemp, Log, TEXT("CRITICAL HIT! %.1f -> %.1f (%.1fx multiplier)"), 
+		UE_LOG(LogCombat, VeryVerbose, TEXT("CRITICAL HIT! %.1f -> %.1f (%.1fx multiplier)"), 
 			BaseDamage, CriticalDamage, CritMultiplier);
 			
 		return CriticalDamage;
@@ -193,7 +197,7 @@ float UDamageExecutionCalculation::ApplyResistances(float Damage, const FGamepla
 	
 	if (Resistance > 0.0f)
 	{
-		UE_LOG(LogTemp, Log, TEXT("Resistance Applied: %.1f -> %.1f (%.1f%% resistance)"), 
+		UE_LOG(LogCombat, VeryVerbose, TEXT("Resistance Applied: %.1f -> %.1f (%.1f%% resistance)"), 
 			Damage, FinalDamage, Resistance * 100.0f);
 	}
 	
@@ -209,7 +213,7 @@ void UDamageExecutionCalculation::ApplyStatusEffects(const FGameplayEffectCustom
 	
 	if (SourceTags && SourceTags->HasAny(FGameplayTagContainer(FGameplayTag::RequestGameplayTag(FName("Status")))))
 	{
-		UE_LOG(LogTemp, Log, TEXT("Status effects would be applied here"));
+		UE_LOG(LogCombat, VeryVerbose, TEXT("Status effects would be applied here"));
 	}
 }
 
@@ -231,9 +235,11 @@ UDamageApplicationComponent::UDamageApplicationComponent()
 
 bool UDamageApplicationComponent::ApplyDamage(AActor* Target, const FAttackPrototypeData& AttackData, AActor* Instigator)
 {
+	COMBAT_SCOPE(ApplyDamage);
+	
 	if (!Target || !DamageEffectClass)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ApplyDamage: Invalid Target or DamageEffectClass"));
+		UE_LOG(LogCombat, Warning, TEXT("ApplyDamage: Invalid Target or DamageEffectClass"));
 		return false;
 	}
 	
@@ -242,7 +248,7 @@ bool UDamageApplicationComponent::ApplyDamage(AActor* Target, const FAttackProto
 	
 	if (!TargetASC)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ApplyDamage: Target %s has no AbilitySystemComponent"), *Target->GetName());
+		UE_LOG(LogCombat, Warning, TEXT("ApplyDamage: Target %s has no AbilitySystemComponent"), *Target->GetName());
 		return false;
 	}
 	
@@ -257,10 +263,12 @@ bool UDamageApplicationComponent::ApplyDamage(AActor* Target, const FAttackProto
 		
 	if (!SpecHandle.IsValid())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ApplyDamage: Failed to create GameplayEffectSpec"));
+		UE_LOG(LogCombat, Warning, TEXT("ApplyDamage: Failed to create GameplayEffectSpec"));
 		return false;
 	}
 	
+	COMBAT_COUNTER_ADD(Allocations, 1);
+	
 	// Set damage amount from attack data
 	SpecHandle.Data->SetSetByCallerMagnitude(DamageTags::BaseDamage, AttackData.BaseDamage);
 	
@@ -274,6 +282,8 @@ bool UDamageApplicationComponent::ApplyDamage(AActor* Target, const FAttackProto
 	
 	if (bDamageApplied)
 	{
+		COMBAT_COUNTER_ADD(DamageSpecs, 1);
+		
 		// Show damage numbers if enabled
 		if (bShowDamageNumbers)
 		{
@@ -289,7 +299,7 @@ bool UDamageApplicationComponent::ApplyDamage(AActor* Target, const FAttackProto
 			OnTargetKilled.Broadcast(Target, Instigator);
 		}
 		
-		UE_LOG(LogTemp, Log, TEXT("ApplyDamage: Successfully applied %.1f damage to %s"), 
+		UE_LOG(LogCombat, Verbose, TEXT("ApplyDamage: Successfully applied %.1f damage to %s"), 
 			AttackData.BaseDamage, *Target->GetName());
 	}
 	
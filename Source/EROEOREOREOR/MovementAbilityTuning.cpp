@@ -0,0 +1,216 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "MovementAbilityTuning.h"
+#include "UObject/Package.h"
+
+using namespace MovementTuningQuantization;
+
+void FDashTuningBlock::Build(const FDashTuning& InTuning)
+{
+	SpeedQ = QuantizeSpeed(InTuning.Speed);
+	DurationQ = QuantizeDuration(InTuning.Duration);
+	XAxisMultiplierQ = QuantizeScalar(InTuning.XAxisMultiplier);
+	YAxisMultiplierQ = QuantizeScalar(InTuning.YAxisMultiplier);
+	VelocityMultiplierQ = QuantizeScalar(InTuning.VelocityMultiplier);
+	MomentumRetentionQ = QuantizeScalar(InTuning.MomentumRetention);
+	bIgnoreGravity = InTuning.bIgnoreGravity;
+}
+
+void FBounceTuningBlock::Build(const FBounceTuning& InTuning)
+{
+	UpwardVelocityQ = QuantizeSpeed(InTuning.UpwardVelocity);
+	HorizontalVelocityRetentionQ = QuantizeScalar(InTuning.HorizontalVelocityRetention);
+	HorizontalVelocityMultiplierQ = QuantizeScalar(InTuning.HorizontalVelocityMultiplier);
+	AirControlMultiplierQ = QuantizeScalar(InTuning.AirControlMultiplier);
+	AirBounceVelocityReductionQ = QuantizeScalar(InTuning.AirBounceVelocityReduction);
+	GravityScaleDuringBounceQ = QuantizeScalar(InTuning.GravityScaleDuringBounce);
+	DurationQ = QuantizeDuration(InTuning.Duration);
+	DashMomentumMultiplierQ = QuantizeScalar(InTuning.DashMomentumMultiplier);
+	JumpMomentumMultiplierQ = QuantizeScalar(InTuning.JumpMomentumMultiplier);
+	FallMomentumMultiplierQ = QuantizeScalar(InTuning.FallMomentumMultiplier);
+	MomentumTransferEfficiencyQ = QuantizeScalar(InTuning.MomentumTransferEfficiency);
+	XAxisMultiplierQ = QuantizeScalar(InTuning.XAxisMultiplier);
+	YAxisMultiplierQ = QuantizeScalar(InTuning.YAxisMultiplier);
+	UpwardAmplificationMultiplierQ = QuantizeScalar(InTuning.UpwardAmplificationMultiplier);
+	UpwardVelocityThresholdQ = QuantizeSpeed(InTuning.UpwardVelocityThreshold);
+	HorizontalEnhancementMultiplierQ = QuantizeScalar(InTuning.HorizontalEnhancementMultiplier);
+	EnhancedHorizontalBoostQ = QuantizeSpeed(InTuning.EnhancedHorizontalBoost);
+	RecoveryJumpVelocityQ = QuantizeSpeed(InTuning.RecoveryJumpVelocity);
+	FallingVelocityThresholdQ = QuantizeSpeed(InTuning.FallingVelocityThreshold);
+	DiagonalEnhancementMultiplierQ = QuantizeScalar(InTuning.DiagonalEnhancementMultiplier);
+	MaxAirBounces = static_cast<uint8>(FMath::Clamp(InTuning.MaxAirBounces, 0, static_cast<int32>(MAX_uint8)));
+	bResetAirBouncesOnGroundContact = InTuning.bResetAirBouncesOnGroundContact;
+	bAllowBounceWhileRising = InTuning.bAllowBounceWhileRising;
+	bIgnoreGravityDuringBounce = InTuning.bIgnoreGravityDuringBounce;
+	bPreserveDownwardMomentum = InTuning.bPreserveDownwardMomentum;
+	bAllowMomentumTransfer = InTuning.bAllowMomentumTransfer;
+	bPreserveMomentumDirection = InTuning.bPreserveMomentumDirection;
+	bAllowComboBounce = InTuning.bAllowComboBounce;
+	bEnableTrajectoryEnhancement = InTuning.bEnableTrajectoryEnhancement;
+}
+
+// DASH TUNING
+
+void UDashTuningData::PostInitProperties()
+{
+	Super::PostInitProperties();
+	Block.Build(Tuning);
+}
+
+void UDashTuningData::PostLoad()
+{
+	Super::PostLoad();
+	Block.Build(Tuning);
+}
+
+#if WITH_EDITOR
+void UDashTuningData::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	Block.Build(Tuning);
+}
+#endif
+
+const UDashTuningData* UDashTuningData::MakeVariant(const FDashTuning& InTuning, UObject* Outer, FName Name, EObjectFlags Flags)
+{
+	UDashTuningData* Variant = NewObject<UDashTuningData>(Outer ? Outer : GetTransientPackage(), Name, Flags);
+	Variant->Tuning = InTuning;
+	Variant->Block.Build(InTuning);
+	return Variant;
+}
+
+const UDashTuningData* UDashTuningData::GetBuiltInPreset(EDashTuningPreset InPreset)
+{
+	static const UDashTuningData* Presets[static_cast<int32>(EDashTuningPreset::Count)] = {};
+
+	const int32 Index = FMath::Clamp(static_cast<int32>(InPreset), 0, static_cast<int32>(EDashTuningPreset::Count) - 1);
+	if (!Presets[Index])
+	{
+		FDashTuning Preset;
+		switch (static_cast<EDashTuningPreset>(Index))
+		{
+			case EDashTuningPreset::Quick:
+				// Fast, snappy dash feel
+				Preset.Speed = 2200.0f;
+				Preset.InitialBurstSpeed = 2800.0f;
+				Preset.Duration = 0.4f;
+				Preset.InitialBurstDuration = 0.05f;
+				Preset.SpeedDecayRate = 0.25f;
+				Preset.MomentumRetention = 0.1f;
+				break;
+			case EDashTuningPreset::Floaty:
+				// Smooth, extended dash feel
+				Preset.Speed = 1400.0f;
+				Preset.InitialBurstSpeed = 1600.0f;
+				Preset.Duration = 1.2f;
+				Preset.InitialBurstDuration = 0.15f;
+				Preset.SpeedDecayRate = 0.05f;
+				Preset.MomentumRetention = 0.6f;
+				break;
+			case EDashTuningPreset::Snappy:
+				// Immediate, precise dash feel
+				Preset.Speed = 2500.0f;
+				Preset.InitialBurstSpeed = 3000.0f;
+				Preset.Duration = 0.25f;
+				Preset.InitialBurstDuration = 0.02f;
+				Preset.SpeedDecayRate = 0.4f;
+				Preset.MomentumRetention = 0.05f;
+				break;
+			case EDashTuningPreset::Powerful:
+				// High-speed, impactful dash feel
+				Preset.Speed = 2800.0f;
+				Preset.InitialBurstSpeed = 3500.0f;
+				Preset.Duration = 0.6f;
+				Preset.InitialBurstDuration = 0.08f;
+				Preset.SpeedDecayRate = 0.18f;
+				Preset.MomentumRetention = 0.4f;
+				break;
+			default:
+				break;
+		}
+
+		const UDashTuningData* Created = MakeVariant(Preset, GetTransientPackage());
+		const_cast<UDashTuningData*>(Created)->AddToRoot();
+		Presets[Index] = Created;
+	}
+
+	return Presets[Index];
+}
+
+// BOUNCE TUNING
+
+void UBounceTuningData::PostInitProperties()
+{
+	Super::PostInitProperties();
+	Block.Build(Tuning);
+}
+
+void UBounceTuningData::PostLoad()
+{
+	Super::PostLoad();
+	Block.Build(Tuning);
+}
+
+#if WITH_EDITOR
+void UBounceTuningData::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	Block.Build(Tuning);
+}
+#endif
+
+const UBounceTuningData* UBounceTuningData::MakeVariant(const FBounceTuning& InTuning, UObject* Outer, FName Name, EObjectFlags Flags)
+{
+	UBounceTuningData* Variant = NewObject<UBounceTuningData>(Outer ? Outer : GetTransientPackage(), Name, Flags);
+	Variant->Tuning = InTuning;
+	Variant->Block.Build(InTuning);
+	return Variant;
+}
+
+const UBounceTuningData* UBounceTuningData::GetBuiltInPreset(EBounceTuningPreset InPreset)
+{
+	static const UBounceTuningData* Presets[static_cast<int32>(EBounceTuningPreset::Count)] = {};
+
+	const int32 Index = FMath::Clamp(static_cast<int32>(InPreset), 0, static_cast<int32>(EBounceTuningPreset::Count) - 1);
+	if (!Presets[Index])
+	{
+		FBounceTuning Preset;
+		switch (static_cast<EBounceTuningPreset>(Index))
+		{
+			case EBounceTuningPreset::Low:
+				Preset.UpwardVelocity = 500.0f;
+				Preset.MaxAirBounces = 1;
+				Preset.HorizontalVelocityRetention = 0.9f;
+				Preset.AirBounceVelocityReduction = 0.8f;
+				break;
+			case EBounceTuningPreset::High:
+				Preset.UpwardVelocity = 1200.0f;
+				Preset.MaxAirBounces = 3;
+				Preset.HorizontalVelocityRetention = 1.0f;
+				Preset.AirBounceVelocityReduction = 0.75f;
+				break;
+			case EBounceTuningPreset::Floaty:
+				Preset.UpwardVelocity = 800.0f;
+				Preset.MaxAirBounces = 2;
+				Preset.GravityScaleDuringBounce = 0.5f;
+				Preset.Duration = 0.5f;
+				Preset.bIgnoreGravityDuringBounce = true;
+				break;
+			case EBounceTuningPreset::Snappy:
+				Preset.UpwardVelocity = 900.0f;
+				Preset.MaxAirBounces = 2;
+				Preset.HorizontalVelocityRetention = 1.0f;
+				Preset.Duration = 0.1f;
+				Preset.AirControlMultiplier = 0.3f;
+				break;
+			default:
+				break;
+		}
+
+		const UBounceTuningData* Created = MakeVariant(Preset, GetTransientPackage());
+		const_cast<UBounceTuningData*>(Created)->AddToRoot();
+		Presets[Index] = Created;
+	}
+
+	return Presets[Index];
+}
@@ -0,0 +1,418 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "MovementAbilityTuning.generated.h"
+
+/**
+ * Fixed-point steps used by the packed tuning blocks
+ * Values are snapped once when the block is built, so every reader (client, server, prediction) sees identical numbers
+ */
+namespace MovementTuningQuantization
+{
+	// Speeds and velocity thresholds - 1 cm/s steps, 0..65535 cm/s
+	FORCEINLINE uint16 QuantizeSpeed(float InSpeed) { return static_cast<uint16>(FMath::Clamp(FMath::RoundToInt(InSpeed), 0, static_cast<int32>(MAX_uint16))); }
+	FORCEINLINE float DequantizeSpeed(uint16 InValue) { return static_cast<float>(InValue); }
+
+	// Durations - 1 ms steps, 0..65.5 s
+	FORCEINLINE uint16 QuantizeDuration(float InSeconds) { return static_cast<uint16>(FMath::Clamp(FMath::RoundToInt(InSeconds * 1000.0f), 0, static_cast<int32>(MAX_uint16))); }
+	FORCEINLINE float DequantizeDuration(uint16 InValue) { return static_cast<float>(InValue) * 0.001f; }
+
+	// Multipliers and ratios - 1/1024 steps, 0..64
+	FORCEINLINE uint16 QuantizeScalar(float InScalar) { return static_cast<uint16>(FMath::Clamp(FMath::RoundToInt(InScalar * 1024.0f), 0, static_cast<int32>(MAX_uint16))); }
+	FORCEINLINE float DequantizeScalar(uint16 InValue) { return static_cast<float>(InValue) * (1.0f / 1024.0f); }
+}
+
+/**
+ * Dash tunables as authored on UDashTuningData
+ */
+USTRUCT(BlueprintType)
+struct FDashTuning
+{
+	GENERATED_BODY()
+
+	// DASH VELOCITY CONTROL - Core speed and power settings
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "🚀 Dash Core Settings",
+		meta = (ClampMin = "100.0", ClampMax = "10000.0", UIMin = "500.0", UIMax = "5000.0", Units = "cm/s",
+		DisplayName = "Base Dash Speed", ToolTip = "Primary speed of the dash movement. Higher = faster dash."))
+	float Speed = 1875.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "🚀 Dash Core Settings",
+		meta = (ClampMin = "0.0", ClampMax = "5000.0", UIMin = "0.0", UIMax = "2500.0", Units = "cm/s",
+		DisplayName = "Initial Burst Speed", ToolTip = "Extra speed applied at dash start for snappy feel. 0 = no burst."))
+	float InitialBurstSpeed = 2500.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "🚀 Dash Core Settings",
+		meta = (ClampMin = "0.0", ClampMax = "1.0", UIMin = "0.0", UIMax = "1.0", Units = "Multiplier",
+		DisplayName = "Speed Decay Rate", ToolTip = "How quickly dash slows down over time. 0 = constant speed, 1 = immediate stop."))
+	float SpeedDecayRate = 0.15f;
+
+	// AXIS MULTIPLIERS - Fine-tune directional control
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "⚖️ Axis Control",
+		meta = (ClampMin = "0.1", ClampMax = "5.0", UIMin = "0.5", UIMax = "3.0", Units = "Multiplier",
+		DisplayName = "X-Axis Multiplier", ToolTip = "Boost/reduce horizontal dash strength. 1.0 = normal, 2.0 = double strength."))
+	float XAxisMultiplier = 1.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "⚖️ Axis Control",
+		meta = (ClampMin = "0.1", ClampMax = "5.0", UIMin = "0.5", UIMax = "3.0", Units = "Multiplier",
+		DisplayName = "Y-Axis Multiplier", ToolTip = "Boost/reduce side-to-side dash strength. 1.0 = normal, 2.0 = double strength."))
+	float YAxisMultiplier = 1.0f;
+
+	// POWER MULTIPLIERS - Enhanced dash effects
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "💪 Power Multipliers",
+		meta = (ClampMin = "0.1", ClampMax = "10.0", UIMin = "0.5", UIMax = "5.0", Units = "Multiplier",
+		DisplayName = "Overall Velocity Boost", ToolTip = "Multiply final dash velocity. Great for power-ups! 1.0 = normal, 3.0 = triple power."))
+	float VelocityMultiplier = 1.0f;
+
+	// DASH TIMING CONTROL - Precise duration management
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Dash|Timing",
+		meta = (ClampMin = "0.05", ClampMax = "3.0", UIMin = "0.1", UIMax = "2.0"))
+	float Duration = 0.8f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Dash|Timing",
+		meta = (ClampMin = "0.0", ClampMax = "0.5", UIMin = "0.0", UIMax = "0.3"))
+	float InitialBurstDuration = 0.1f;
+
+	// DASH PHYSICS CONTROL - Movement feel parameters
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Dash|Physics",
+		meta = (ClampMin = "0.0", ClampMax = "1.0", UIMin = "0.0", UIMax = "1.0"))
+	float MomentumRetention = 0.3f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Dash|Physics")
+	bool bIgnoreGravity = false;
+};
+
+/**
+ * Bounce tunables as authored on UBounceTuningData
+ */
+USTRUCT(BlueprintType)
+struct FBounceTuning
+{
+	GENERATED_BODY()
+
+	// BOUNCE VELOCITY CONTROL - Core bounce power settings
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "🏀 Bounce Core Settings",
+		meta = (ClampMin = "100.0", ClampMax = "5000.0", UIMin = "200.0", UIMax = "3000.0", Units = "cm/s",
+		DisplayName = "Upward Bounce Power", ToolTip = "Primary upward velocity when bouncing. Higher = bigger jumps!"))
+	float UpwardVelocity = 800.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "🏀 Bounce Core Settings",
+		meta = (ClampMin = "0.0", ClampMax = "3.0", UIMin = "0.0", UIMax = "2.0", Units = "Multiplier",
+		DisplayName = "Horizontal Keep Rate", ToolTip = "How much side-to-side speed to keep when bouncing. 1.0 = keep all momentum, >1.0 = amplify momentum."))
+	float HorizontalVelocityRetention = 1.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "🏀 Bounce Core Settings",
+		meta = (ClampMin = "0.0", ClampMax = "5.0", UIMin = "0.0", UIMax = "3.0", Units = "Multiplier",
+		DisplayName = "Horizontal Boost", ToolTip = "Extra horizontal speed boost during bounce. 1.0 = normal, 2.0 = double boost, 3.0 = triple boost."))
+	float HorizontalVelocityMultiplier = 1.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "🏀 Bounce Core Settings",
+		meta = (ClampMin = "0.0", ClampMax = "2.0", UIMin = "0.0", UIMax = "1.5", Units = "Multiplier",
+		DisplayName = "Air Control Power", ToolTip = "How much directional control you have while airborne. 0 = no control, 1 = full control, >1 = enhanced control."))
+	float AirControlMultiplier = 0.2f;
+
+	// BOUNCE AIR CONTROL - Movement limitations
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Bounce|AirControl",
+		meta = (ClampMin = "0", ClampMax = "10", UIMin = "0", UIMax = "10"))
+	int32 MaxAirBounces = 2;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Bounce|AirControl",
+		meta = (ClampMin = "0.5", ClampMax = "1.0", UIMin = "0.7", UIMax = "1.0"))
+	float AirBounceVelocityReduction = 0.85f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Bounce|AirControl")
+	bool bResetAirBouncesOnGroundContact = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Bounce|AirControl")
+	bool bAllowBounceWhileRising = false;
+
+	// BOUNCE PHYSICS CONTROL - Advanced movement behavior
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Bounce|Physics",
+		meta = (ClampMin = "0.0", ClampMax = "1.0", UIMin = "0.0", UIMax = "1.0"))
+	float GravityScaleDuringBounce = 1.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Bounce|Physics",
+		meta = (ClampMin = "0.01", ClampMax = "1.0", UIMin = "0.1", UIMax = "0.5"))
+	float Duration = 0.2f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Bounce|Physics")
+	bool bIgnoreGravityDuringBounce = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Bounce|Physics")
+	bool bPreserveDownwardMomentum = false;
+
+	// COMBO MULTIPLIERS - Dash-Bounce momentum transfer power
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "🔥 Combo Multipliers",
+		meta = (ClampMin = "0.0", ClampMax = "10.0", UIMin = "1.0", UIMax = "5.0", Units = "Multiplier",
+		DisplayName = "Dash → Bounce Power", ToolTip = "How much stronger bounce becomes after dash. 1.8 = 80% stronger! Great for air combos."))
+	float DashMomentumMultiplier = 1.8f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "🔥 Combo Multipliers",
+		meta = (ClampMin = "0.0", ClampMax = "10.0", UIMin = "1.0", UIMax = "5.0", Units = "Multiplier",
+		DisplayName = "Jump → Bounce Power", ToolTip = "Bounce power boost when used during jump. 1.3 = 30% stronger for jump combos."))
+	float JumpMomentumMultiplier = 1.3f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "🔥 Combo Multipliers",
+		meta = (ClampMin = "0.0", ClampMax = "10.0", UIMin = "0.8", UIMax = "5.0", Units = "Multiplier",
+		DisplayName = "Fall → Bounce Power", ToolTip = "Recovery bounce power when falling. Higher = better fall recovery potential."))
+	float FallMomentumMultiplier = 1.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "🔥 Combo Multipliers",
+		meta = (ClampMin = "0.0", ClampMax = "3.0", UIMin = "0.0", UIMax = "1.0", Units = "Multiplier",
+		DisplayName = "Momentum Transfer Rate", ToolTip = "How efficiently momentum transfers between abilities. 0.85 = 85% transfer rate."))
+	float MomentumTransferEfficiency = 0.85f;
+
+	// AXIS CONTROL - Fine-tune bounce direction
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "⚖️ Axis Control",
+		meta = (ClampMin = "0.1", ClampMax = "10.0", UIMin = "0.5", UIMax = "5.0", Units = "Multiplier",
+		DisplayName = "X-Axis Multiplier", ToolTip = "Control horizontal bounce strength. 1.0 = normal, 2.0 = double power."))
+	float XAxisMultiplier = 1.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "⚖️ Axis Control",
+		meta = (ClampMin = "0.1", ClampMax = "10.0", UIMin = "0.5", UIMax = "5.0", Units = "Multiplier",
+		DisplayName = "Y-Axis Multiplier", ToolTip = "Control side-to-side bounce strength. 1.0 = normal, 2.0 = double power."))
+	float YAxisMultiplier = 1.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Bounce|Momentum")
+	bool bAllowMomentumTransfer = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Bounce|Momentum")
+	bool bPreserveMomentumDirection = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Bounce|Combo")
+	bool bAllowComboBounce = true;
+
+	// TRAJECTORY ENHANCEMENT SYSTEM
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Bounce|Trajectory Enhancement",
+		meta = (DisplayName = "Enable Trajectory Enhancement"))
+	bool bEnableTrajectoryEnhancement = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Bounce|Trajectory Enhancement|Upward",
+		meta = (ClampMin = "1.0", ClampMax = "3.0", UIMin = "1.2", UIMax = "2.5",
+				DisplayName = "Upward Amplification Multiplier",
+				EditCondition = "bEnableTrajectoryEnhancement"))
+	float UpwardAmplificationMultiplier = 1.75f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Bounce|Trajectory Enhancement|Upward",
+		meta = (ClampMin = "50.0", ClampMax = "500.0", UIMin = "100.0", UIMax = "300.0",
+				DisplayName = "Minimum Upward Velocity Threshold",
+				EditCondition = "bEnableTrajectoryEnhancement"))
+	float UpwardVelocityThreshold = 150.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Bounce|Trajectory Enhancement|Horizontal",
+		meta = (ClampMin = "1.0", ClampMax = "2.5", UIMin = "1.1", UIMax = "2.0",
+				DisplayName = "Horizontal Enhancement Multiplier",
+				EditCondition = "bEnableTrajectoryEnhancement"))
+	float HorizontalEnhancementMultiplier = 1.4f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Bounce|Trajectory Enhancement|Horizontal",
+		meta = (ClampMin = "300.0", ClampMax = "800.0", UIMin = "400.0", UIMax = "700.0",
+				DisplayName = "Enhanced Horizontal Boost",
+				EditCondition = "bEnableTrajectoryEnhancement"))
+	float EnhancedHorizontalBoost = 500.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Bounce|Trajectory Enhancement|Recovery",
+		meta = (ClampMin = "500.0", ClampMax = "1200.0", UIMin = "600.0", UIMax = "1000.0",
+				DisplayName = "Recovery Jump Velocity",
+				EditCondition = "bEnableTrajectoryEnhancement"))
+	float RecoveryJumpVelocity = 800.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Bounce|Trajectory Enhancement|Recovery",
+		meta = (ClampMin = "50.0", ClampMax = "500.0", UIMin = "100.0", UIMax = "300.0",
+				DisplayName = "Falling Velocity Threshold",
+				EditCondition = "bEnableTrajectoryEnhancement"))
+	float FallingVelocityThreshold = 200.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Bounce|Trajectory Enhancement|Diagonal",
+		meta = (ClampMin = "1.0", ClampMax = "2.5", UIMin = "1.2", UIMax = "2.0",
+				DisplayName = "Diagonal Enhancement Multiplier",
+				EditCondition = "bEnableTrajectoryEnhancement"))
+	float DiagonalEnhancementMultiplier = 1.6f;
+};
+
+/**
+ * Packed dash values read by BuildDashParams - one cache line, built from FDashTuning
+ */
+struct alignas(PLATFORM_CACHE_LINE_SIZE) FDashTuningBlock
+{
+	uint16 SpeedQ = 0;
+	uint16 DurationQ = 0;
+	uint16 XAxisMultiplierQ = 0;
+	uint16 YAxisMultiplierQ = 0;
+	uint16 VelocityMultiplierQ = 0;
+	uint16 MomentumRetentionQ = 0;
+	uint8 bIgnoreGravity : 1;
+
+	FDashTuningBlock() : bIgnoreGravity(false) {}
+
+	void Build(const FDashTuning& InTuning);
+
+	FORCEINLINE float GetSpeed() const { return MovementTuningQuantization::DequantizeSpeed(SpeedQ); }
+	FORCEINLINE float GetDuration() const { return MovementTuningQuantization::DequantizeDuration(DurationQ); }
+	FORCEINLINE float GetXAxisMultiplier() const { return MovementTuningQuantization::DequantizeScalar(XAxisMultiplierQ); }
+	FORCEINLINE float GetYAxisMultiplier() const { return MovementTuningQuantization::DequantizeScalar(YAxisMultiplierQ); }
+	FORCEINLINE float GetVelocityMultiplier() const { return MovementTuningQuantization::DequantizeScalar(VelocityMultiplierQ); }
+	FORCEINLINE float GetMomentumRetention() const { return MovementTuningQuantization::DequantizeScalar(MomentumRetentionQ); }
+};
+
+/**
+ * Packed bounce values read by activation validation and launch calculation - one cache line, built from FBounceTuning
+ */
+struct alignas(PLATFORM_CACHE_LINE_SIZE) FBounceTuningBlock
+{
+	uint16 UpwardVelocityQ = 0;
+	uint16 HorizontalVelocityRetentionQ = 0;
+	uint16 HorizontalVelocityMultiplierQ = 0;
+	uint16 AirControlMultiplierQ = 0;
+	uint16 AirBounceVelocityReductionQ = 0;
+	uint16 GravityScaleDuringBounceQ = 0;
+	uint16 DurationQ = 0;
+	uint16 DashMomentumMultiplierQ = 0;
+	uint16 JumpMomentumMultiplierQ = 0;
+	uint16 FallMomentumMultiplierQ = 0;
+	uint16 MomentumTransferEfficiencyQ = 0;
+	uint16 XAxisMultiplierQ = 0;
+	uint16 YAxisMultiplierQ = 0;
+	uint16 UpwardAmplificationMultiplierQ = 0;
+	uint16 UpwardVelocityThresholdQ = 0;
+	uint16 HorizontalEnhancementMultiplierQ = 0;
+	uint16 EnhancedHorizontalBoostQ = 0;
+	uint16 RecoveryJumpVelocityQ = 0;
+	uint16 FallingVelocityThresholdQ = 0;
+	uint16 DiagonalEnhancementMultiplierQ = 0;
+	uint8 MaxAirBounces = 0;
+	uint8 bResetAirBouncesOnGroundContact : 1;
+	uint8 bAllowBounceWhileRising : 1;
+	uint8 bIgnoreGravityDuringBounce : 1;
+	uint8 bPreserveDownwardMomentum : 1;
+	uint8 bAllowMomentumTransfer : 1;
+	uint8 bPreserveMomentumDirection : 1;
+	uint8 bAllowComboBounce : 1;
+	uint8 bEnableTrajectoryEnhancement : 1;
+
+	FBounceTuningBlock()
+		: bResetAirBouncesOnGroundContact(false), bAllowBounceWhileRising(false), bIgnoreGravityDuringBounce(false)
+		, bPreserveDownwardMomentum(false), bAllowMomentumTransfer(false), bPreserveMomentumDirection(false)
+		, bAllowComboBounce(false), bEnableTrajectoryEnhancement(false)
+	{
+	}
+
+	void Build(const FBounceTuning& InTuning);
+
+	FORCEINLINE float GetUpwardVelocity() const { return MovementTuningQuantization::DequantizeSpeed(UpwardVelocityQ); }
+	FORCEINLINE float GetHorizontalVelocityRetention() const { return MovementTuningQuantization::DequantizeScalar(HorizontalVelocityRetentionQ); }
+	FORCEINLINE float GetHorizontalVelocityMultiplier() const { return MovementTuningQuantization::DequantizeScalar(HorizontalVelocityMultiplierQ); }
+	FORCEINLINE float GetAirControlMultiplier() const { return MovementTuningQuantization::DequantizeScalar(AirControlMultiplierQ); }
+	FORCEINLINE float GetAirBounceVelocityReduction() const { return MovementTuningQuantization::DequantizeScalar(AirBounceVelocityReductionQ); }
+	FORCEINLINE float GetGravityScaleDuringBounce() const { return MovementTuningQuantization::DequantizeScalar(GravityScaleDuringBounceQ); }
+	FORCEINLINE float GetDuration() const { return MovementTuningQuantization::DequantizeDuration(DurationQ); }
+	FORCEINLINE float GetDashMomentumMultiplier() const { return MovementTuningQuantization::DequantizeScalar(DashMomentumMultiplierQ); }
+	FORCEINLINE float GetJumpMomentumMultiplier() const { return MovementTuningQuantization::DequantizeScalar(JumpMomentumMultiplierQ); }
+	FORCEINLINE float GetFallMomentumMultiplier() const { return MovementTuningQuantization::DequantizeScalar(FallMomentumMultiplierQ); }
+	FORCEINLINE float GetMomentumTransferEfficiency() const { return MovementTuningQuantization::DequantizeScalar(MomentumTransferEfficiencyQ); }
+	FORCEINLINE float GetXAxisMultiplier() const { return MovementTuningQuantization::DequantizeScalar(XAxisMultiplierQ); }
+	FORCEINLINE float GetYAxisMultiplier() const { return MovementTuningQuantization::DequantizeScalar(YAxisMultiplierQ); }
+	FORCEINLINE float GetUpwardAmplificationMultiplier() const { return MovementTuningQuantization::DequantizeScalar(UpwardAmplificationMultiplierQ); }
+	FORCEINLINE float GetUpwardVelocityThreshold() const { return MovementTuningQuantization::DequantizeSpeed(UpwardVelocityThresholdQ); }
+	FORCEINLINE float GetHorizontalEnhancementMultiplier() const { return MovementTuningQuantization::DequantizeScalar(HorizontalEnhancementMultiplierQ); }
+	FORCEINLINE float GetEnhancedHorizontalBoost() const { return MovementTuningQuantization::DequantizeSpeed(EnhancedHorizontalBoostQ); }
+	FORCEINLINE float GetRecoveryJumpVelocity() const { return MovementTuningQuantization::DequantizeSpeed(RecoveryJumpVelocityQ); }
+	FORCEINLINE float GetFallingVelocityThreshold() const { return MovementTuningQuantization::DequantizeSpeed(FallingVelocityThresholdQ); }
+	FORCEINLINE float GetDiagonalEnhancementMultiplier() const { return MovementTuningQuantization::DequantizeScalar(DiagonalEnhancementMultiplierQ); }
+
+	// Gravity scale handed to the Bounce movement mode
+	FORCEINLINE float GetEffectiveGravityScale() const { return bIgnoreGravityDuringBounce ? GetGravityScaleDuringBounce() : 1.0f; }
+};
+
+static_assert(sizeof(FDashTuningBlock) == PLATFORM_CACHE_LINE_SIZE, "FDashTuningBlock must stay within one cache line");
+static_assert(sizeof(FBounceTuningBlock) == PLATFORM_CACHE_LINE_SIZE, "FBounceTuningBlock must stay within one cache line");
+
+UENUM(BlueprintType)
+enum class EDashTuningPreset : uint8
+{
+	Default		UMETA(DisplayName = "Default"),
+	Quick		UMETA(DisplayName = "Quick"),
+	Floaty		UMETA(DisplayName = "Floaty"),
+	Snappy		UMETA(DisplayName = "Snappy"),
+	Powerful	UMETA(DisplayName = "Powerful"),
+	Count		UMETA(Hidden)
+};
+
+UENUM(BlueprintType)
+enum class EBounceTuningPreset : uint8
+{
+	Default		UMETA(DisplayName = "Default"),
+	Low			UMETA(DisplayName = "Low"),
+	High		UMETA(DisplayName = "High"),
+	Floaty		UMETA(DisplayName = "Floaty"),
+	Snappy		UMETA(DisplayName = "Snappy"),
+	Count		UMETA(Hidden)
+};
+
+/**
+ * Immutable dash tuning shared by every ability instance that references it
+ * Switching feel is a pointer swap on the ability - the asset itself is never written at runtime
+ */
+UCLASS(BlueprintType, Const)
+class EROEOREOREOR_API UDashTuningData : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	const FDashTuning& GetTuning() const { return Tuning; }
+	const FDashTuningBlock& GetBlock() const { return Block; }
+
+	// Shared code-defined presets, created on first use and kept for the lifetime of the module
+	static const UDashTuningData* GetBuiltInPreset(EDashTuningPreset InPreset);
+
+	// Transient copy with edited values - used for runtime tweaks, never mutates a shared asset
+	static const UDashTuningData* MakeVariant(const FDashTuning& InTuning, UObject* Outer, FName Name = NAME_None, EObjectFlags Flags = RF_Transient);
+
+	virtual void PostInitProperties() override;
+	virtual void PostLoad() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+protected:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Dash", meta = (ShowOnlyInnerProperties))
+	FDashTuning Tuning;
+
+private:
+	FDashTuningBlock Block;
+};
+
+/**
+ * Immutable bounce tuning shared by every ability instance that references it
+ * Switching feel is a pointer swap on the ability - the asset itself is never written at runtime
+ */
+UCLASS(BlueprintType, Const)
+class EROEOREOREOR_API UBounceTuningData : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	const FBounceTuning& GetTuning() const { return Tuning; }
+	const FBounceTuningBlock& GetBlock() const { return Block; }
+
+	// Shared code-defined presets, created on first use and kept for the lifetime of the module
+	static const UBounceTuningData* GetBuiltInPreset(EBounceTuningPreset InPreset);
+
+	// Transient copy with edited values - used for runtime tweaks, never mutates a shared asset
+	static const UBounceTuningData* MakeVariant(const FBounceTuning& InTuning, UObject* Outer, FName Name = NAME_None, EObjectFlags Flags = RF_Transient);
+
+	virtual void PostInitProperties() override;
+	virtual void PostLoad() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+protected:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Bounce", meta = (ShowOnlyInnerProperties))
+	FBounceTuning Tuning;
+
+private:
+	FBounceTuningBlock Block;
+};
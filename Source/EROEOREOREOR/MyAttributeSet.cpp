@@ -1,5 +1,6 @@
 #include "MyAttributeSet.h"
 #include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
 #include "GameplayEffect.h"
 #include "GameplayEffectExtension.h"
 
@@ -27,22 +28,27 @@ void UMyAttributeSet::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutL
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
+	// Push model - nothing is compared until PostAttributeChange/PostAttributeBaseChange marks an attribute dirty
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+	Params.RepNotifyCondition = REPNOTIFY_Always;
+
 	// Replicate attributes to all clients - Following Epic Games GAS patterns
-	DOREPLIFETIME_CONDITION_NOTIFY(UMyAttributeSet, Health, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UMyAttributeSet, MaxHealth, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UMyAttributeSet, Stamina, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UMyAttributeSet, MaxStamina, COND_None, REPNOTIFY_Always);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UMyAttributeSet, Health, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UMyAttributeSet, MaxHealth, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UMyAttributeSet, Stamina, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UMyAttributeSet, MaxStamina, Params);
 	
 	// Combat attributes
-	DOREPLIFETIME_CONDITION_NOTIFY(UMyAttributeSet, AttackPower, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UMyAttributeSet, CriticalHitChance, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UMyAttributeSet, CriticalHitMultiplier, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UMyAttributeSet, AttackSpeed, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UMyAttributeSet, PhysicalResistance, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UMyAttributeSet, ElementalResistance, COND_None, REPNOTIFY_Always);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UMyAttributeSet, AttackPower, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UMyAttributeSet, CriticalHitChance, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UMyAttributeSet, CriticalHitMultiplier, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UMyAttributeSet, AttackSpeed, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UMyAttributeSet, PhysicalResistance, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UMyAttributeSet, ElementalResistance, Params);
 	
 	// Movement state attributes
-	DOREPLIFETIME_CONDITION_NOTIFY(UMyAttributeSet, AirBounceCount, COND_None, REPNOTIFY_Always);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UMyAttributeSet, AirBounceCount, Params);
 }
 
 void UMyAttributeSet::OnRep_Health(const FGameplayAttributeData& OldValue)
@@ -134,6 +140,22 @@ void UMyAttributeSet::PreAttributeChange(const FGameplayAttribute& Attribute, fl
 	}
 }
 
+void UMyAttributeSet::PostAttributeChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue)
+{
+	Super::PostAttributeChange(Attribute, OldValue, NewValue);
+
+	// Every current-value write (effects, aggregators, ApplyModToAttributeUnsafe) lands here
+	MARK_PROPERTY_DIRTY(this, Attribute.GetUProperty());
+}
+
+void UMyAttributeSet::PostAttributeBaseChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue) const
+{
+	Super::PostAttributeBaseChange(Attribute, OldValue, NewValue);
+
+	// Set<Attribute> and instant effects write the base value through the ability system component
+	MARK_PROPERTY_DIRTY(const_cast<UMyAttributeSet*>(this), Attribute.GetUProperty());
+}
+
 void UMyAttributeSet::PostGameplayEffectExecute(const FGameplayEffectModCallbackData& Data)
 {
 	Super::PostGameplayEffectExecute(Data);
@@ -9,7 +9,12 @@
 #include "CombatStateMachineComponent.h"
 #include "CombatPrototypeComponent.h"
 #include "AttackShapeComponent.h"
+#include "CombatMovementComponent.h"
 #include "GameplayEffect_Damage.h"
+#include "CombatInputQueue.h"
+#include "CombatReplay.h"
+#include "CombatSignificance.h"
+#include "CombatLog.h"
 #include "Camera/CameraComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/InputComponent.h"
@@ -20,9 +25,11 @@
 #include "EnhancedInputSubsystems.h"
 #include "InputActionValue.h"
 #include "Engine/World.h"
+#include "HAL/PlatformTime.h"
 
 // Sets default values
-AMyCharacter::AMyCharacter()
+AMyCharacter::AMyCharacter(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer.SetDefaultSubobjectClass<UCombatMovementComponent>(ACharacter::CharacterMovementComponentName))
 {
  	// Set this character to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
 	PrimaryActorTick.bCanEverTick = true;
@@ -77,6 +84,46 @@ AMyCharacter::AMyCharacter()
 
 	// Initialize movement input tracking
 	CurrentMovementInput = FVector2D::ZeroVector;
+
+	// Event tags sent with each ability input - resolved once, handles filled by RebuildAbilityInputTable
+	AbilityInputTable[static_cast<int32>(ECombatAbilityInput::DashLeft)].EventTag = FGameplayTag::RequestGameplayTag(FName("Input.Dash.Left"));
+	AbilityInputTable[static_cast<int32>(ECombatAbilityInput::DashRight)].EventTag = FGameplayTag::RequestGameplayTag(FName("Input.Dash.Right"));
+	AbilityInputTable[static_cast<int32>(ECombatAbilityInput::Bounce)].EventTag = FGameplayTag::RequestGameplayTag(FName("Input.Bounce"));
+}
+
+void AMyCharacter::PostLoad()
+{
+	Super::PostLoad();
+
+	// Blueprints saved with the pre-tuning-asset values keep them as tuning subobjects the abilities pick up
+	if (!MigratedDashTuning)
+	{
+		FDashTuning Migrated;
+		Migrated.Speed = DashSpeed_DEPRECATED;
+		Migrated.Duration = DashDuration_DEPRECATED;
+		Migrated.MomentumRetention = MomentumRetention_DEPRECATED;
+		Migrated.InitialBurstSpeed = DashInitialBurstSpeed_DEPRECATED;
+
+		const FDashTuning Defaults;
+		if (!FDashTuning::StaticStruct()->CompareScriptStruct(&Migrated, &Defaults, PPF_None))
+		{
+			MigratedDashTuning = UDashTuningData::MakeVariant(Migrated, this, TEXT("MigratedDashTuning"), RF_NoFlags);
+		}
+	}
+
+	if (!MigratedBounceTuning)
+	{
+		FBounceTuning Migrated;
+		Migrated.UpwardVelocity = BounceUpwardVelocity_DEPRECATED;
+		Migrated.HorizontalVelocityRetention = HorizontalVelocityRetention_DEPRECATED;
+		Migrated.MaxAirBounces = MaxAirBounces_DEPRECATED;
+
+		const FBounceTuning Defaults;
+		if (!FBounceTuning::StaticStruct()->CompareScriptStruct(&Migrated, &Defaults, PPF_None))
+		{
+			MigratedBounceTuning = UBounceTuningData::MakeVariant(Migrated, this, TEXT("MigratedBounceTuning"), RF_NoFlags);
+		}
+	}
 }
 
 // Called when the game starts or when spawned
@@ -100,6 +147,101 @@ void AMyCharacter::BeginPlay()
 		FInputModeGameOnly InputModeData;
 		PlayerController->SetInputMode(InputModeData);
 		PlayerController->bShowMouseCursor = false;
+
+		// Stamp combat inputs when the OS messages are pumped, not when Enhanced Input dispatches them
+		if (PlayerController->IsLocalController())
+		{
+			FCombatInputTimestamps::AddRef();
+			bInputTimestampsRegistered = true;
+
+			// Mappings rebuild a frame after a context is added or removed - refresh the press keys with them
+			if (UEnhancedInputLocalPlayerSubsystem* Subsystem = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(PlayerController->GetLocalPlayer()))
+			{
+				Subsystem->ControlMappingsRebuiltDelegate.AddUniqueDynamic(this, &AMyCharacter::RefreshCombatInputKeys);
+			}
+			RefreshCombatInputKeys();
+		}
+	}
+
+	// Combat LOD tier from distance and visibility to the players - components run at full rate until the first evaluation
+	if (UCombatSignificanceSubsystem* Significance = UCombatSignificanceSubsystem::Get(GetWorld()))
+	{
+		Significance->RegisterFighter(this);
+	}
+}
+
+void AMyCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (bInputTimestampsRegistered)
+	{
+		FCombatInputTimestamps::Release();
+		bInputTimestampsRegistered = false;
+
+		const APlayerController* PlayerController = Cast<APlayerController>(Controller);
+		if (UEnhancedInputLocalPlayerSubsystem* Subsystem = PlayerController
+			? ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(PlayerController->GetLocalPlayer())
+			: nullptr)
+		{
+			Subsystem->ControlMappingsRebuiltDelegate.RemoveDynamic(this, &AMyCharacter::RefreshCombatInputKeys);
+		}
+	}
+
+	if (UCombatSignificanceSubsystem* Significance = UCombatSignificanceSubsystem::Get(GetWorld()))
+	{
+		Significance->UnregisterFighter(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+double AMyCharacter::GetInputPollTime(ECombatInputAction Action) const
+{
+	// No keys cached (not a local player, or mappings not built yet) reads as pressed now
+	return FCombatInputTimestamps::ConsumePressTime(CombatInputKeys[static_cast<int32>(Action)]);
+}
+
+const UInputAction* AMyCharacter::GetCombatInputAction(ECombatInputAction Action) const
+{
+	switch (Action)
+	{
+		case ECombatInputAction::LightAttack:
+			return LightAttackAction;
+		case ECombatInputAction::HeavyAttack:
+			return HeavyAttackAction;
+		case ECombatInputAction::DashLeft:
+			return DashLeftAction;
+		case ECombatInputAction::DashRight:
+			return DashRightAction;
+		case ECombatInputAction::Bounce:
+			return BounceAction;
+		default:
+			return nullptr;
+	}
+}
+
+void AMyCharacter::RefreshCombatInputKeys()
+{
+	for (TArray<FKey, TInlineAllocator<2>>& Keys : CombatInputKeys)
+	{
+		Keys.Reset();
+	}
+
+	const APlayerController* PlayerController = Cast<APlayerController>(Controller);
+	const UEnhancedInputLocalPlayerSubsystem* Subsystem = PlayerController && PlayerController->IsLocalController()
+		? ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(PlayerController->GetLocalPlayer())
+		: nullptr;
+
+	if (!Subsystem)
+	{
+		return;
+	}
+
+	for (int32 Index = 0; Index < static_cast<int32>(ECombatInputAction::Count); ++Index)
+	{
+		if (const UInputAction* Action = GetCombatInputAction(static_cast<ECombatInputAction>(Index)))
+		{
+			CombatInputKeys[Index].Append(Subsystem->QueryKeysMappedToAction(Action));
+		}
 	}
 }
 
@@ -134,7 +276,7 @@ void AMyCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputCompone
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("JumpAction is not configured"));
+		UE_LOG(LogCombat, Warning, TEXT("JumpAction is not configured"));
 	}
 	
 	if (LookAction)
@@ -143,7 +285,7 @@ void AMyCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputCompone
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("LookAction is not configured"));
+		UE_LOG(LogCombat, Warning, TEXT("LookAction is not configured"));
 	}
 
 	// Movement input bindings with proper error handling
@@ -153,7 +295,7 @@ void AMyCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputCompone
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("MoveForwardAction is not configured"));
+		UE_LOG(LogCombat, Warning, TEXT("MoveForwardAction is not configured"));
 	}
 	
 	if (MoveBackwardAction)
@@ -162,7 +304,7 @@ void AMyCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputCompone
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("MoveBackwardAction is not configured"));
+		UE_LOG(LogCombat, Warning, TEXT("MoveBackwardAction is not configured"));
 	}
 	
 	if (MoveLeftAction)
@@ -171,7 +313,7 @@ void AMyCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputCompone
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("MoveLeftAction is not configured"));
+		UE_LOG(LogCombat, Warning, TEXT("MoveLeftAction is not configured"));
 	}
 	
 	if (MoveRightAction)
@@ -180,7 +322,7 @@ void AMyCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputCompone
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("MoveRightAction is not configured"));
+		UE_LOG(LogCombat, Warning, TEXT("MoveRightAction is not configured"));
 	}
 
 	// Shift key bindings
@@ -191,7 +333,7 @@ void AMyCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputCompone
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("ShiftAction is not configured"));
+		UE_LOG(LogCombat, Warning, TEXT("ShiftAction is not configured"));
 	}
 
 	// Dash bindings with immediate response
@@ -201,7 +343,7 @@ void AMyCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputCompone
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("DashLeftAction is not configured"));
+		UE_LOG(LogCombat, Warning, TEXT("DashLeftAction is not configured"));
 	}
 	
 	if (DashRightAction)
@@ -210,7 +352,7 @@ void AMyCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputCompone
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("DashRightAction is not configured"));
+		UE_LOG(LogCombat, Warning, TEXT("DashRightAction is not configured"));
 	}
 
 	// Bounce binding
@@ -220,7 +362,26 @@ void AMyCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputCompone
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("BounceAction is not configured"));
+		UE_LOG(LogCombat, Warning, TEXT("BounceAction is not configured"));
+	}
+
+	// Combat bindings - buffered through the combat state machine
+	if (LightAttackAction)
+	{
+		EnhancedInputComponent->BindAction(LightAttackAction, ETriggerEvent::Started, this, &AMyCharacter::LightAttack);
+	}
+	else
+	{
+		UE_LOG(LogCombat, Warning, TEXT("LightAttackAction is not configured"));
+	}
+
+	if (HeavyAttackAction)
+	{
+		EnhancedInputComponent->BindAction(HeavyAttackAction, ETriggerEvent::Started, this, &AMyCharacter::HeavyAttack);
+	}
+	else
+	{
+		UE_LOG(LogCombat, Warning, TEXT("HeavyAttackAction is not configured"));
 	}
 
 }
@@ -247,7 +408,7 @@ void AMyCharacter::PossessedBy(AController* NewController)
 		// Ensure the AttributeSet is properly registered with the ASC
 		AbilitySystemComponent->GetSet<UMyAttributeSet>();
 		
-		UE_LOG(LogTemp, Log, TEXT("PossessedBy: GAS initialized, abilities will be granted by Blueprint"));
+		UE_LOG(LogCombat, Verbose, TEXT("PossessedBy: GAS initialized, abilities will be granted by Blueprint"));
 	}
 }
 
@@ -373,48 +534,7 @@ void AMyCharacter::ShiftReleased(const FInputActionValue& Value)
 
 void AMyCharacter::DashLeft(const FInputActionValue& Value)
 {
-	if (!AbilitySystemComponent)
-	{
-		return;
-	}
-
-	// PERFORMANCE: Use cached handle to avoid lookup delays
-	if (!CachedDashAbilityHandle.IsValid())
-	{
-		// Cache the handle on first use
-		for (FGameplayAbilitySpec& Spec : AbilitySystemComponent->GetActivatableAbilities())
-		{
-			if (Spec.Ability && Spec.Ability->IsA<UGameplayAbility_Dash>())
-			{
-				CachedDashAbilityHandle = Spec.Handle;
-				break;
-			}
-		}
-	}
-
-	if (!CachedDashAbilityHandle.IsValid())
-	{
-		UE_LOG(LogTemp, Warning, TEXT("DashLeft: No dash ability found to cache"));
-		return;
-	}
-
-	// Epic Games standard: Use gameplay tags to communicate direction
-	FGameplayTagContainer DirectionTags;
-	DirectionTags.AddTag(FGameplayTag::RequestGameplayTag(FName("Input.Dash.Left")));
-	
-	// Apply direction tag temporarily
-	AbilitySystemComponent->AddLooseGameplayTags(DirectionTags);
-
-	// IMMEDIATE ACTIVATION: Use cached handle for instant response
-	bool bActivated = AbilitySystemComponent->TryActivateAbility(CachedDashAbilityHandle);
-	
-	// Remove direction tag after activation attempt
-	AbilitySystemComponent->RemoveLooseGameplayTags(DirectionTags);
-	
-	if (!bActivated)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("DashLeft: Failed to activate cached dash ability"));
-	}
+	DispatchCombatInput(ECombatInputAction::DashLeft, GetInputPollTime(ECombatInputAction::DashLeft));
 }
 
 void AMyCharacter::Landed(const FHitResult& Hit)
@@ -425,217 +545,195 @@ void AMyCharacter::Landed(const FHitResult& Hit)
 	if (LandedDelegate.IsBound())
 	{
 		LandedDelegate.Broadcast(Hit);
-		UE_LOG(LogTemp, Warning, TEXT("CHARACTER LANDED - Broadcasting to %d delegates"), 
+		UE_LOG(LogCombat, Verbose, TEXT("CHARACTER LANDED - Broadcasting to %d delegates"), 
 			LandedDelegate.GetAllObjects().Num());
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("CHARACTER LANDED - No delegates listening"));
+		UE_LOG(LogCombat, Verbose, TEXT("CHARACTER LANDED - No delegates listening"));
 	}
 }
 
 // Debug functions for testing - minimal implementations
 void AMyCharacter::Move(const FInputActionValue& Value)
 {
-	UE_LOG(LogTemp, Log, TEXT("Move debug function called"));
+	UE_LOG(LogCombat, Log, TEXT("Move debug function called"));
 }
 
 void AMyCharacter::Dash(const FInputActionValue& Value)
 {
-	UE_LOG(LogTemp, Log, TEXT("Dash debug function called"));
+	UE_LOG(LogCombat, Log, TEXT("Dash debug function called"));
 }
 
 void AMyCharacter::TestKey()
 {
-	UE_LOG(LogTemp, Log, TEXT("TestKey debug function called"));
+	UE_LOG(LogCombat, Log, TEXT("TestKey debug function called"));
 }
 
 void AMyCharacter::TestDash()
 {
-	UE_LOG(LogTemp, Log, TEXT("TestDash debug function called"));
+	UE_LOG(LogCombat, Log, TEXT("TestDash debug function called"));
 }
 
 void AMyCharacter::TestBounce()
 {
-	UE_LOG(LogTemp, Log, TEXT("TestBounce debug function called"));
+	UE_LOG(LogCombat, Log, TEXT("TestBounce debug function called"));
 }
 
 void AMyCharacter::LightAttack(const FInputActionValue& Value)
 {
-	if (!CombatStateMachine)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("LightAttack: CombatStateMachine is null"));
-		return;
-	}
-	
-	// Buffer light attack input
-	const FGameplayTag LightAttackTag = FGameplayTag::RequestGameplayTag(FName("Combat.Actions.Attack.Light.Jab"));
-	CombatStateMachine->BufferInput(LightAttackTag);
-	
-	UE_LOG(LogTemp, Log, TEXT("Light Attack input buffered"));
+	DispatchCombatInput(ECombatInputAction::LightAttack, GetInputPollTime(ECombatInputAction::LightAttack));
 }
 
 void AMyCharacter::HeavyAttack(const FInputActionValue& Value)
 {
-	if (!CombatStateMachine)
+	DispatchCombatInput(ECombatInputAction::HeavyAttack, GetInputPollTime(ECombatInputAction::HeavyAttack));
+}
+
+void AMyCharacter::DispatchCombatInput(ECombatInputAction Action, double InputPollTime)
+{
+#if !UE_BUILD_SHIPPING
+	FCombatReplay::NotifyCombatInput(this, Action, InputPollTime);
+#endif
+
+	switch (Action)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("HeavyAttack: CombatStateMachine is null"));
-		return;
+		case ECombatInputAction::LightAttack:
+		case ECombatInputAction::HeavyAttack:
+		{
+			const bool bLight = Action == ECombatInputAction::LightAttack;
+			if (!CombatStateMachine)
+			{
+				UE_LOG(LogCombat, Warning, TEXT("%s: CombatStateMachine is null"), bLight ? TEXT("LightAttack") : TEXT("HeavyAttack"));
+				return;
+			}
+			
+			// Buffer attack input
+			const FGameplayTag AttackTag = FGameplayTag::RequestGameplayTag(bLight
+				? FName("Combat.Actions.Attack.Light.Jab")
+				: FName("Combat.Actions.Attack.Heavy.Straight"));
+			CombatStateMachine->BufferTimestampedInput(AttackTag, InputPollTime);
+			
+			UE_LOG(LogCombat, Verbose, TEXT("%s Attack input buffered"), bLight ? TEXT("Light") : TEXT("Heavy"));
+			break;
+		}
+		case ECombatInputAction::DashLeft:
+			ActivateAbilityInput(ECombatAbilityInput::DashLeft, InputPollTime);
+			break;
+		case ECombatInputAction::DashRight:
+			ActivateAbilityInput(ECombatAbilityInput::DashRight, InputPollTime);
+			break;
+		case ECombatInputAction::Bounce:
+			ActivateAbilityInput(ECombatAbilityInput::Bounce, InputPollTime);
+			break;
+		default:
+			break;
 	}
-	
-	// Buffer heavy attack input
-	const FGameplayTag HeavyAttackTag = FGameplayTag::RequestGameplayTag(FName("Combat.Actions.Attack.Heavy.Straight"));
-	CombatStateMachine->BufferInput(HeavyAttackTag);
-	
-	UE_LOG(LogTemp, Log, TEXT("Heavy Attack input buffered"));
 }
 
 void AMyCharacter::TestCombatSystem()
 {
 	if (!CombatStateMachine)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("TestCombatSystem: CombatStateMachine is null"));
+		UE_LOG(LogCombat, Warning, TEXT("TestCombatSystem: CombatStateMachine is null"));
 		return;
 	}
 	
-	UE_LOG(LogTemp, Log, TEXT("=== COMBAT SYSTEM TEST START ==="));
-	UE_LOG(LogTemp, Log, TEXT("Current State: %d"), static_cast<int32>(CombatStateMachine->GetCurrentState()));
-	UE_LOG(LogTemp, Log, TEXT("Input Buffer Size: %d"), CombatStateMachine->GetInputBufferSize());
-	UE_LOG(LogTemp, Log, TEXT("Loaded Actions: %d"), CombatStateMachine->GetLoadedActionCount());
+	UE_LOG(LogCombat, Log, TEXT("=== COMBAT SYSTEM TEST START ==="));
+	UE_LOG(LogCombat, Log, TEXT("Current State: %d"), static_cast<int32>(CombatStateMachine->GetCurrentState()));
+	UE_LOG(LogCombat, Log, TEXT("Input Buffer Size: %d"), CombatStateMachine->GetInputBufferSize());
+	UE_LOG(LogCombat, Log, TEXT("Loaded Actions: %d"), CombatStateMachine->GetLoadedActionCount());
 	
 	// Test light attack
 	const FGameplayTag TestTag = FGameplayTag::RequestGameplayTag(FName("Combat.Actions.Attack.Light.Jab"));
 	const bool bCanStart = CombatStateMachine->CanStartAction(TestTag);
-	UE_LOG(LogTemp, Log, TEXT("Can start Light Jab: %s"), bCanStart ? TEXT("YES") : TEXT("NO"));
+	UE_LOG(LogCombat, Log, TEXT("Can start Light Jab: %s"), bCanStart ? TEXT("YES") : TEXT("NO"));
 	
-	UE_LOG(LogTemp, Log, TEXT("=== COMBAT SYSTEM TEST END ==="));
+	UE_LOG(LogCombat, Log, TEXT("=== COMBAT SYSTEM TEST END ==="));
 }
 
 // Production-ready dash methods - clean GAS implementation
 
 void AMyCharacter::DashRight(const FInputActionValue& Value)
 {
-	if (!AbilitySystemComponent)
+	DispatchCombatInput(ECombatInputAction::DashRight, GetInputPollTime(ECombatInputAction::DashRight));
+}
+
+void AMyCharacter::Bounce(const FInputActionValue& Value)
+{
+	DispatchCombatInput(ECombatInputAction::Bounce, GetInputPollTime(ECombatInputAction::Bounce));
+}
+
+void AMyCharacter::ActivateAbilityInput(ECombatAbilityInput Input, double InputPollTime)
+{
+	if (!AbilitySystemComponent || !AbilitySystemComponent->AbilityActorInfo.IsValid())
 	{
 		return;
 	}
 
-	// PERFORMANCE: Use cached handle to avoid lookup delays
-	if (!CachedDashAbilityHandle.IsValid())
+	const FAbilityInputBinding* Binding = &AbilityInputTable[static_cast<int32>(Input)];
+	if (!Binding->Handle.IsValid())
 	{
-		// Cache the handle on first use
-		for (FGameplayAbilitySpec& Spec : AbilitySystemComponent->GetActivatableAbilities())
+		// Remote clients receive their specs by replication after GrantStartingAbilities ran on the server
+		RebuildAbilityInputTable();
+		if (!Binding->Handle.IsValid())
 		{
-			if (Spec.Ability && Spec.Ability->IsA<UGameplayAbility_Dash>())
-			{
-				CachedDashAbilityHandle = Spec.Handle;
-				break;
-			}
+			UE_LOG(LogCombat, Warning, TEXT("ActivateAbilityInput: No ability granted for %s"), *Binding->EventTag.ToString());
+			return;
 		}
 	}
 
-	if (!CachedDashAbilityHandle.IsValid())
-	{
-		UE_LOG(LogTemp, Warning, TEXT("DashRight: No dash ability found to cache"));
-		return;
-	}
+	// PERFORMANCE: Direction/input travels in the event payload (replicated with the activation RPC),
+	// not as loose tags added and removed around activation - no tag-count updates, no allocations
+	FGameplayEventData EventData;
+	EventData.EventTag = Binding->EventTag;
+	EventData.Instigator = this;
 
-	// Epic Games standard: Use gameplay tags to communicate direction
-	FGameplayTagContainer DirectionTags;
-	DirectionTags.AddTag(FGameplayTag::RequestGameplayTag(FName("Input.Dash.Right")));
-	
-	// Apply direction tag temporarily
-	AbilitySystemComponent->AddLooseGameplayTags(DirectionTags);
+	const bool bActivated = AbilitySystemComponent->TriggerAbilityFromGameplayEvent(
+		Binding->Handle, AbilitySystemComponent->AbilityActorInfo.Get(), Binding->EventTag, &EventData, *AbilitySystemComponent);
 
-	// IMMEDIATE ACTIVATION: Use cached handle for instant response
-	bool bActivated = AbilitySystemComponent->TryActivateAbility(CachedDashAbilityHandle);
-	
-	// Remove direction tag after activation attempt
-	AbilitySystemComponent->RemoveLooseGameplayTags(DirectionTags);
-	
-	if (!bActivated)
+	if (bActivated)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("DashRight: Failed to activate cached dash ability"));
+		FCombatInputLatencyHistogram::GetMovementHistogram().Record((FPlatformTime::Seconds() - InputPollTime) * 1000.0);
+	}
+	else
+	{
+		UE_LOG(LogCombat, Verbose, TEXT("ActivateAbilityInput: %s did not activate"), *Binding->EventTag.ToString());
 	}
 }
 
-void AMyCharacter::Bounce(const FInputActionValue& Value)
+void AMyCharacter::RebuildAbilityInputTable()
 {
+	for (FAbilityInputBinding& Binding : AbilityInputTable)
+	{
+		Binding.Handle = FGameplayAbilitySpecHandle();
+	}
+
 	if (!AbilitySystemComponent)
 	{
-		UE_LOG(LogTemp, Error, TEXT("Bounce: AbilitySystemComponent is null"));
 		return;
 	}
 
-	// ENHANCED DEBUGGING: Check ability system state
-	UE_LOG(LogTemp, Log, TEXT("Bounce: Attempting bounce activation. ASC valid: %s"), 
-		AbilitySystemComponent ? TEXT("true") : TEXT("false"));
-
-	// PERFORMANCE: Use cached handle to avoid lookup delays
-	if (!CachedBounceAbilityHandle.IsValid())
+	for (const FGameplayAbilitySpec& Spec : AbilitySystemComponent->GetActivatableAbilities())
 	{
-		UE_LOG(LogTemp, Log, TEXT("Bounce: Caching bounce ability handle"));
-		
-		// Cache the handle on first use
-		int32 BounceAbilityCount = 0;
-		for (FGameplayAbilitySpec& Spec : AbilitySystemComponent->GetActivatableAbilities())
+		if (!Spec.Ability)
 		{
-			if (Spec.Ability && Spec.Ability->IsA<UGameplayAbility_Bounce>())
-			{
-				CachedBounceAbilityHandle = Spec.Handle;
-				BounceAbilityCount++;
-				UE_LOG(LogTemp, Log, TEXT("Bounce: Found and cached bounce ability handle"));
-				break;
-			}
+			continue;
 		}
-		
-		if (BounceAbilityCount == 0)
+
+		if (Spec.Ability->IsA<UGameplayAbility_Dash>())
 		{
-			UE_LOG(LogTemp, Error, TEXT("Bounce: No UGameplayAbility_Bounce found in activatable abilities"));
-			
-			// DEBUG: List all available abilities
-			for (const FGameplayAbilitySpec& Spec : AbilitySystemComponent->GetActivatableAbilities())
-			{
-				if (Spec.Ability)
-				{
-					UE_LOG(LogTemp, Log, TEXT("Available Ability: %s"), *Spec.Ability->GetName());
-				}
-			}
+			AbilityInputTable[static_cast<int32>(ECombatAbilityInput::DashLeft)].Handle = Spec.Handle;
+			AbilityInputTable[static_cast<int32>(ECombatAbilityInput::DashRight)].Handle = Spec.Handle;
+		}
+		else if (Spec.Ability->IsA<UGameplayAbility_Bounce>())
+		{
+			AbilityInputTable[static_cast<int32>(ECombatAbilityInput::Bounce)].Handle = Spec.Handle;
 		}
 	}
 
-	if (!CachedBounceAbilityHandle.IsValid())
-	{
-		UE_LOG(LogTemp, Error, TEXT("Bounce: CachedBounceAbilityHandle is invalid - ability not granted"));
-		return;
-	}
-
-	// Check if ability system is initialized
-	if (!AbilitySystemComponent->AbilityActorInfo.IsValid())
-	{
-		UE_LOG(LogTemp, Warning, TEXT("Bounce: AbilityActorInfo is not valid - ASC not properly initialized"));
-		return;
-	}
-
-	// Epic Games standard: Use gameplay tags to communicate input
-	FGameplayTagContainer InputTags;
-	InputTags.AddTag(FGameplayTag::RequestGameplayTag(FName("Input.Bounce")));
-	
-	// Apply input tag temporarily
-	AbilitySystemComponent->AddLooseGameplayTags(InputTags);
-
-	// IMMEDIATE ACTIVATION: Use cached handle for instant response
-	const bool bActivated = AbilitySystemComponent->TryActivateAbility(CachedBounceAbilityHandle);
-	
-	// Remove input tag after activation attempt
-	AbilitySystemComponent->RemoveLooseGameplayTags(InputTags);
-	
-	UE_LOG(LogTemp, Log, TEXT("Bounce: Activation result: %s"), bActivated ? TEXT("SUCCESS") : TEXT("FAILED"));
-	
-	if (!bActivated)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("Bounce: TryActivateAbility failed despite CanActivateAbility returning true"));
-	}
+	// Press keys are cached alongside the handles - mapping rebuilds refresh them through ControlMappingsRebuiltDelegate
+	RefreshCombatInputKeys();
 }
 
 // BLUEPRINT ACCESSIBLE ATTRIBUTE MANAGEMENT FUNCTIONS
@@ -677,17 +775,17 @@ void AMyCharacter::GrantStartingAbilities()
 {
 	if (!AbilitySystemComponent)
 	{
-		UE_LOG(LogTemp, Error, TEXT("GrantStartingAbilities: AbilitySystemComponent is null"));
+		UE_LOG(LogCombat, Error, TEXT("GrantStartingAbilities: AbilitySystemComponent is null"));
 		return;
 	}
 
 	if (!AbilitySystemComponent->AbilityActorInfo.IsValid())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("GrantStartingAbilities: AbilityActorInfo not valid - call after GAS initialization"));
+		UE_LOG(LogCombat, Warning, TEXT("GrantStartingAbilities: AbilityActorInfo not valid - call after GAS initialization"));
 		return;
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("GrantStartingAbilities: Granting %d abilities"), StartingAbilities.Num());
+	UE_LOG(LogCombat, Verbose, TEXT("GrantStartingAbilities: Granting %d abilities"), StartingAbilities.Num());
 
 	// Grant all abilities from Blueprint-configurable array
 	for (TSubclassOf<UGameplayAbility> AbilityClass : StartingAbilities)
@@ -699,17 +797,20 @@ void AMyCharacter::GrantStartingAbilities()
 			
 			if (Handle.IsValid())
 			{
-				UE_LOG(LogTemp, Log, TEXT("GrantStartingAbilities: Successfully granted %s"), 
+				UE_LOG(LogCombat, Verbose, TEXT("GrantStartingAbilities: Successfully granted %s"), 
 					*AbilityClass->GetName());
 			}
 			else
 			{
-				UE_LOG(LogTemp, Error, TEXT("GrantStartingAbilities: Failed to grant %s"), 
+				UE_LOG(LogCombat, Error, TEXT("GrantStartingAbilities: Failed to grant %s"), 
 					*AbilityClass->GetName());
 			}
 		}
 	}
 
+	// Input presses index this table directly - no spec walk on the activation path
+	RebuildAbilityInputTable();
+
 	// Apply starting effects
 	for (TSubclassOf<UGameplayEffect> EffectClass : StartingEffects)
 	{
@@ -724,7 +825,7 @@ void AMyCharacter::GrantStartingAbilities()
 			if (SpecHandle.IsValid())
 			{
 				AbilitySystemComponent->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
-				UE_LOG(LogTemp, Log, TEXT("GrantStartingAbilities: Successfully applied effect %s"), 
+				UE_LOG(LogCombat, Verbose, TEXT("GrantStartingAbilities: Successfully applied effect %s"), 
 					*EffectClass->GetName());
 			}
 		}
@@ -736,18 +837,18 @@ void AMyCharacter::InitializeStartingAttributes()
 {
 	if (!AbilitySystemComponent || !AttributeSet)
 	{
-		UE_LOG(LogTemp, Error, TEXT("InitializeStartingAttributes: GAS components not initialized"));
+		UE_LOG(LogCombat, Error, TEXT("InitializeStartingAttributes: GAS components not initialized"));
 		return;
 	}
 
 	UMyAttributeSet* MyAttributeSet = GetMyAttributeSet();
 	if (!MyAttributeSet)
 	{
-		UE_LOG(LogTemp, Error, TEXT("InitializeStartingAttributes: MyAttributeSet is null"));
+		UE_LOG(LogCombat, Error, TEXT("InitializeStartingAttributes: MyAttributeSet is null"));
 		return;
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("InitializeStartingAttributes: Setting attributes from Blueprint values"));
+	UE_LOG(LogCombat, Verbose, TEXT("InitializeStartingAttributes: Setting attributes from Blueprint values"));
 
 	// Set starting attribute values from Blueprint-editable properties
 	// Note: In production, you'd typically use GameplayEffects for this, but direct setting works for prototyping
@@ -756,20 +857,20 @@ void AMyCharacter::InitializeStartingAttributes()
 	if (StartingMaxHealth > 0.0f)
 	{
 		MyAttributeSet->SetMaxHealth(StartingMaxHealth);
-		UE_LOG(LogTemp, Log, TEXT("InitializeStartingAttributes: Set MaxHealth to %.1f"), StartingMaxHealth);
+		UE_LOG(LogCombat, Verbose, TEXT("InitializeStartingAttributes: Set MaxHealth to %.1f"), StartingMaxHealth);
 	}
 	
 	if (StartingHealth > 0.0f)
 	{
 		MyAttributeSet->SetHealth(FMath::Clamp(StartingHealth, 1.0f, StartingMaxHealth));
-		UE_LOG(LogTemp, Log, TEXT("InitializeStartingAttributes: Set Health to %.1f"), 
+		UE_LOG(LogCombat, Verbose, TEXT("InitializeStartingAttributes: Set Health to %.1f"), 
 			FMath::Clamp(StartingHealth, 1.0f, StartingMaxHealth));
 	}
 
 	// Set air bounce count (MaxAirBounces is handled by Blueprint property, not AttributeSet)
 	MyAttributeSet->SetAirBounceCount(static_cast<float>(StartingAirBounceCount));
 	
-	UE_LOG(LogTemp, Log, TEXT("InitializeStartingAttributes: Set AirBounceCount to %d (MaxAirBounces: %d managed by Blueprint)"), 
+	UE_LOG(LogCombat, Verbose, TEXT("InitializeStartingAttributes: Set AirBounceCount to %d (MaxAirBounces: %d managed by Blueprint)"), 
 		StartingAirBounceCount, StartingMaxAirBounces);
 
 	// Force attribute replication update
@@ -780,5 +881,5 @@ void AMyCharacter::InitializeStartingAttributes()
 		AbilitySystemComponent->SetNumericAttributeBase(MyAttributeSet->GetAirBounceCountAttribute(), MyAttributeSet->GetAirBounceCount());
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("InitializeStartingAttributes: Attribute initialization complete"));
+	UE_LOG(LogCombat, Verbose, TEXT("InitializeStartingAttributes: Attribute initialization complete"));
 }
@@ -13,6 +13,7 @@
 #include "CombatStateMachineComponent.h"
 #include "GameplayEffect_Damage.h"
 #include "AttackShapeComponent.h"
+#include "CombatMovementComponent.h"
 #include "MyCharacter.generated.h"
 
 class UInputMappingContext;
@@ -21,6 +22,26 @@ class USpringArmComponent;
 class UCameraComponent;
 class UDamageApplicationComponent;
 
+// Ability inputs resolved through AMyCharacter's prebuilt handle table
+enum class ECombatAbilityInput : uint8
+{
+	DashLeft,
+	DashRight,
+	Bounce,
+	Count
+};
+
+// Discrete combat inputs as they reach the character - recorded and re-driven by Combat.Replay
+enum class ECombatInputAction : uint8
+{
+	LightAttack,
+	HeavyAttack,
+	DashLeft,
+	DashRight,
+	Bounce,
+	Count
+};
+
 UCLASS()
 class EROEOREOREOR_API AMyCharacter : public ACharacter , public IAbilitySystemInterface
 {
@@ -28,7 +49,7 @@ class EROEOREOREOR_API AMyCharacter : public ACharacter , public IAbilitySystemI
 
 public:
 	// Sets default values for this character's properties
-	AMyCharacter();
+	AMyCharacter(const FObjectInitializer& ObjectInitializer);
 
     // IAbilitySystemInterface
     virtual UAbilitySystemComponent* GetAbilitySystemComponent() const override;
@@ -45,10 +66,20 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Movement")
     FVector2D GetCurrentMovementInput() const { return CurrentMovementInput; }
 
+    // Replay sets the movement input the recorded player had - the Move* handlers derive it from Enhanced Input
+    void SetCurrentMovementInput(const FVector2D& Input) { CurrentMovementInput = Input; }
+
+    // Single entry for combat inputs - Enhanced Input handlers and replay both come through here
+    void DispatchCombatInput(ECombatInputAction Action, double InputPollTime);
+
     // Getter for velocity snapshot component (for dash-bounce combo system)
     UFUNCTION(BlueprintPure, Category = "Movement")
     UVelocitySnapshotComponent* GetVelocitySnapshotComponent() const { return VelocitySnapshotComponent; }
 
+    // Getter for the combat movement component (Dash/Bounce custom movement modes)
+    UFUNCTION(BlueprintPure, Category = "Movement")
+    UCombatMovementComponent* GetCombatMovementComponent() const { return Cast<UCombatMovementComponent>(GetCharacterMovement()); }
+
 	// Override Landed to broadcast delegate (uses built-in ACharacter::LandedDelegate)
 	virtual void Landed(const FHitResult& Hit) override;
 
@@ -56,6 +87,8 @@ protected:
 	
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void PostLoad() override;
 
     // GAS Lifecycle Hooks - NEW
     virtual void PossessedBy(AController* NewController) override;
@@ -108,34 +141,38 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category=Camera)
 	float BaseLookUpRate;
 
-	// Advanced Dash System Properties - PUBLIC for GameplayAbility access
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dash|Core", meta = (ClampMin = "100.0", ClampMax = "5000.0"))
-	float DashSpeed = 1875.0f;
+	// Dash/Bounce values from before the tuning assets - PostLoad forwards non-default ones to the character's
+	// Dash and Bounce abilities through MigratedDashTuning/MigratedBounceTuning. Runtime writes have no effect.
+	UPROPERTY(BlueprintReadWrite, Category = "Dash|Deprecated", meta = (DeprecatedProperty, DeprecationMessage = "Set Speed on the Dash ability's DashTuning asset."))
+	float DashSpeed_DEPRECATED = 1875.0f;
+
+	UPROPERTY(BlueprintReadWrite, Category = "Dash|Deprecated", meta = (DeprecatedProperty, DeprecationMessage = "Set Duration on the Dash ability's DashTuning asset."))
+	float DashDuration_DEPRECATED = 0.8f;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dash|Core", meta = (ClampMin = "0.1", ClampMax = "3.0"))
-	float DashDuration = 0.8f;
+	UPROPERTY(BlueprintReadWrite, Category = "Dash|Deprecated", meta = (DeprecatedProperty, DeprecationMessage = "Set MomentumRetention on the Dash ability's DashTuning asset."))
+	float MomentumRetention_DEPRECATED = 0.3f;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dash|Core", meta = (ClampMin = "0.0", ClampMax = "1.0"))
-	float MomentumRetention = 0.3f;
+	UPROPERTY(BlueprintReadWrite, Category = "Dash|Deprecated", meta = (DeprecatedProperty, DeprecationMessage = "Set InitialBurstSpeed on the Dash ability's DashTuning asset."))
+	float DashInitialBurstSpeed_DEPRECATED = 2500.0f;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dash|Feel", meta = (ClampMin = "0.0", ClampMax = "5000.0"))
-	float DashInitialBurstSpeed = 2500.0f;
+	UPROPERTY(BlueprintReadWrite, Category = "Dash|Deprecated", meta = (DeprecatedProperty, DeprecationMessage = "Unused - the dash runs at the movement component's update rate."))
+	float UpdateFrequency_DEPRECATED = 60.0f;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dash|Feel", meta = (ClampMin = "10.0", ClampMax = "120.0"))
-	float UpdateFrequency = 60.0f;
+	UPROPERTY(BlueprintReadWrite, Category = "Bounce|Deprecated", meta = (DeprecatedProperty, DeprecationMessage = "Set UpwardVelocity on the Bounce ability's BounceTuning asset."))
+	float BounceUpwardVelocity_DEPRECATED = 800.0f;
 
-	// Advanced Bounce System Properties - PUBLIC for GameplayAbility access
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bounce|Core", meta = (ClampMin = "200.0", ClampMax = "2000.0"))
-	float BounceUpwardVelocity = 800.0f;
+	UPROPERTY(BlueprintReadWrite, Category = "Bounce|Deprecated", meta = (DeprecatedProperty, DeprecationMessage = "Set HorizontalVelocityRetention on the Bounce ability's BounceTuning asset."))
+	float HorizontalVelocityRetention_DEPRECATED = 1.0f;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bounce|Core", meta = (ClampMin = "0.0", ClampMax = "1.0"))
-	float HorizontalVelocityRetention = 1.0f;
+	UPROPERTY(BlueprintReadWrite, Category = "Bounce|Deprecated", meta = (DeprecatedProperty, DeprecationMessage = "Set MaxAirBounces on the Bounce ability's BounceTuning asset."))
+	int32 MaxAirBounces_DEPRECATED = 2;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bounce|Core", meta = (ClampMin = "0", ClampMax = "5"))
-	int32 MaxAirBounces = 2;
+	UPROPERTY(BlueprintReadWrite, Category = "Bounce|Deprecated", meta = (DeprecatedProperty, DeprecationMessage = "Set BounceInputWindow on the Bounce ability."))
+	float BounceInputWindow_DEPRECATED = 0.1f;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bounce|Feel", meta = (ClampMin = "0.0", ClampMax = "0.5"))
-	float BounceInputWindow = 0.1f;
+	// Tuning built from the deprecated values above - null when they were all defaults
+	const UDashTuningData* GetMigratedDashTuning() const { return MigratedDashTuning; }
+	const UBounceTuningData* GetMigratedBounceTuning() const { return MigratedBounceTuning; }
 
 	// BLUEPRINT ACCESSIBLE ATTRIBUTES - Designer-friendly attribute access
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Attributes|Health", meta = (ClampMin = "1.0", ClampMax = "1000.0"))
@@ -216,6 +253,13 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Enhanced Input", meta = (AllowPrivateAccess = "true"))
 	TObjectPtr<UInputAction> BounceAction;
 
+	// Combat Input Actions
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Enhanced Input", meta = (AllowPrivateAccess = "true"))
+	TObjectPtr<UInputAction> LightAttackAction;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Enhanced Input", meta = (AllowPrivateAccess = "true"))
+	TObjectPtr<UInputAction> HeavyAttackAction;
+
 	// Camera Components
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Camera, meta = (AllowPrivateAccess = "true"))
 	TObjectPtr<USpringArmComponent> CameraBoom;
@@ -251,6 +295,13 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dash|Legacy", meta = (AllowPrivateAccess = "true"))
 	float DashCooldown = 2.0f;
 
+	// Saved with the blueprint that carried the deprecated values - the abilities adopt these in OnAvatarSet
+	UPROPERTY()
+	TObjectPtr<const UDashTuningData> MigratedDashTuning;
+
+	UPROPERTY()
+	TObjectPtr<const UBounceTuningData> MigratedBounceTuning;
+
 private:
 	// Dash state tracking
 	bool bIsShiftPressed = false;
@@ -260,11 +311,27 @@ private:
 	// Movement input tracking for dash system
 	FVector2D CurrentMovementInput;
 
-	// PERFORMANCE: Cache ability handles to avoid lookup delays
-	UPROPERTY(Transient)
-	FGameplayAbilitySpecHandle CachedDashAbilityHandle;
+	// PERFORMANCE: Input -> ability handle table, built by GrantStartingAbilities
+	struct FAbilityInputBinding
+	{
+		FGameplayAbilitySpecHandle Handle;
+		FGameplayTag EventTag;
+	};
+	FAbilityInputBinding AbilityInputTable[static_cast<int32>(ECombatAbilityInput::Count)];
+
+	void RebuildAbilityInputTable();
+	void ActivateAbilityInput(ECombatAbilityInput Input, double InputPollTime);
+
+	// INPUT LATENCY: Platform time the keys bound to Action were pressed, as seen by the Slate pre-processor
+	double GetInputPollTime(ECombatInputAction Action) const;
+	bool bInputTimestampsRegistered = false;
+
+	// Keys mapped to each combat input - queried once per mapping rebuild, not on every press
+	TArray<FKey, TInlineAllocator<2>> CombatInputKeys[static_cast<int32>(ECombatInputAction::Count)];
+
+	const UInputAction* GetCombatInputAction(ECombatInputAction Action) const;
 
-	UPROPERTY(Transient)
-	FGameplayAbilitySpecHandle CachedBounceAbilityHandle;
+	UFUNCTION()
+	void RefreshCombatInputKeys();
 
 };
@@ -1,5 +1,7 @@
 #include "TargetDummy.h"
 #include "GameplayEffect_Damage.h"
+#include "CombatLagCompensation.h"
+#include "CombatLog.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/SphereComponent.h"
 #include "Components/WidgetComponent.h"
@@ -12,6 +14,10 @@ ATargetDummy::ATargetDummy()
 {
 	PrimaryActorTick.bCanEverTick = false;
 
+	// Replicated but dormant - the replication graph skips it until a health change wakes it
+	bReplicates = true;
+	NetDormancy = DORM_DormantAll;
+
 	// Create root collision component
 	CollisionComponent = CreateDefaultSubobject<USphereComponent>(TEXT("CollisionComponent"));
 	RootComponent = CollisionComponent;
@@ -89,10 +95,37 @@ void ATargetDummy::BeginPlay()
 			{
 				OnHealthChanged(Data.OldValue, Data.NewValue);
 			});
+			
+			// Duration effects and their tags replicate through the ASC without touching health - wake for those too
+			if (HasAuthority())
+			{
+				AbilitySystemComponent->OnActiveGameplayEffectAddedDelegateToSelf.AddUObject(this, &ATargetDummy::OnGameplayEffectAdded);
+				AbilitySystemComponent->OnAnyGameplayEffectRemovedDelegate().AddUObject(this, &ATargetDummy::OnGameplayEffectRemoved);
+			}
+		}
+	}
+
+	// Static target - no movement history, lag-compensated checks test it where it stands
+	if (HasAuthority() && CollisionComponent)
+	{
+		if (UCombatLagCompensationSubsystem* LagCompensation = UCombatLagCompensationSubsystem::Get(GetWorld()))
+		{
+			const float Radius = CollisionComponent->GetScaledSphereRadius();
+			LagCompensation->RegisterHurtVolume(this, nullptr, Radius, Radius);
 		}
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("TargetDummy: BeginPlay completed - Health initialized to %.1f"), MaxHealth);
+	UE_LOG(LogCombat, Verbose, TEXT("TargetDummy: BeginPlay completed - Health initialized to %.1f"), MaxHealth);
+}
+
+void ATargetDummy::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UCombatLagCompensationSubsystem* LagCompensation = UCombatLagCompensationSubsystem::Get(GetWorld()))
+	{
+		LagCompensation->UnregisterHurtVolume(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 UAbilitySystemComponent* ATargetDummy::GetAbilitySystemComponent() const
@@ -122,7 +155,7 @@ void ATargetDummy::ResetHealth()
 		
 		ResetDamageEffect();
 		
-		UE_LOG(LogTemp, Log, TEXT("TargetDummy: Health reset to %.1f"), MaxHealth);
+		UE_LOG(LogCombat, Verbose, TEXT("TargetDummy: Health reset to %.1f"), MaxHealth);
 	}
 }
 
@@ -159,7 +192,7 @@ void ATargetDummy::ShowDamageEffect(float DamageAmount, bool bWasCritical)
 		}
 	}
 	
-	UE_LOG(LogTemp, Log, TEXT("TargetDummy: Showing damage effect - %.1f damage%s"), 
+	UE_LOG(LogCombat, Verbose, TEXT("TargetDummy: Showing damage effect - %.1f damage%s"), 
 		DamageAmount, bWasCritical ? TEXT(" (CRITICAL!)") : TEXT(""));
 }
 
@@ -167,18 +200,18 @@ void ATargetDummy::LogCurrentStats() const
 {
 	if (const UMyAttributeSet* MyAttributeSet = GetMyAttributeSet())
 	{
-		UE_LOG(LogTemp, Log, TEXT("=== TARGET DUMMY STATS ==="));
-		UE_LOG(LogTemp, Log, TEXT("Health: %.1f / %.1f (%.1f%%)"), 
+		UE_LOG(LogCombat, Log, TEXT("=== TARGET DUMMY STATS ==="));
+		UE_LOG(LogCombat, Log, TEXT("Health: %.1f / %.1f (%.1f%%)"), 
 			MyAttributeSet->GetHealth(), MyAttributeSet->GetMaxHealth(), GetHealthPercent() * 100.0f);
-		UE_LOG(LogTemp, Log, TEXT("Total Damage Received: %.1f"), TotalDamageReceived);
-		UE_LOG(LogTemp, Log, TEXT("Hit Count: %d"), HitCount);
-		UE_LOG(LogTemp, Log, TEXT("Physical Resistance: %.3f"), MyAttributeSet->GetPhysicalResistance());
-		UE_LOG(LogTemp, Log, TEXT("Elemental Resistance: %.3f"), MyAttributeSet->GetElementalResistance());
-		UE_LOG(LogTemp, Log, TEXT("Attack Power: %.2f"), MyAttributeSet->GetAttackPower());
-		UE_LOG(LogTemp, Log, TEXT("Crit Chance: %.1f%%"), MyAttributeSet->GetCriticalHitChance() * 100.0f);
-		UE_LOG(LogTemp, Log, TEXT("Crit Multiplier: %.2fx"), MyAttributeSet->GetCriticalHitMultiplier());
-		UE_LOG(LogTemp, Log, TEXT("Auto Regen: %s"), bAutoRegenHealth ? TEXT("ON") : TEXT("OFF"));
-		UE_LOG(LogTemp, Log, TEXT("========================"));
+		UE_LOG(LogCombat, Log, TEXT("Total Damage Received: %.1f"), TotalDamageReceived);
+		UE_LOG(LogCombat, Log, TEXT("Hit Count: %d"), HitCount);
+		UE_LOG(LogCombat, Log, TEXT("Physical Resistance: %.3f"), MyAttributeSet->GetPhysicalResistance());
+		UE_LOG(LogCombat, Log, TEXT("Elemental Resistance: %.3f"), MyAttributeSet->GetElementalResistance());
+		UE_LOG(LogCombat, Log, TEXT("Attack Power: %.2f"), MyAttributeSet->GetAttackPower());
+		UE_LOG(LogCombat, Log, TEXT("Crit Chance: %.1f%%"), MyAttributeSet->GetCriticalHitChance() * 100.0f);
+		UE_LOG(LogCombat, Log, TEXT("Crit Multiplier: %.2fx"), MyAttributeSet->GetCriticalHitMultiplier());
+		UE_LOG(LogCombat, Log, TEXT("Auto Regen: %s"), bAutoRegenHealth ? TEXT("ON") : TEXT("OFF"));
+		UE_LOG(LogCombat, Log, TEXT("========================"));
 	}
 }
 
@@ -199,7 +232,7 @@ void ATargetDummy::StartHealthRegeneration()
 		true // Repeating
 	);
 	
-	UE_LOG(LogTemp, Log, TEXT("TargetDummy: Started health regeneration at %.1f HP/sec"), HealthRegenRate);
+	UE_LOG(LogCombat, Verbose, TEXT("TargetDummy: Started health regeneration at %.1f HP/sec"), HealthRegenRate);
 }
 
 void ATargetDummy::RegenerateHealth()
@@ -227,7 +260,7 @@ void ATargetDummy::RegenerateHealth()
 	
 	if (FMath::IsNearlyEqual(NewHealth, MaxHP, 0.1f))
 	{
-		UE_LOG(LogTemp, Log, TEXT("TargetDummy: Health fully regenerated to %.1f"), NewHealth);
+		UE_LOG(LogCombat, Verbose, TEXT("TargetDummy: Health fully regenerated to %.1f"), NewHealth);
 	}
 }
 
@@ -240,12 +273,28 @@ void ATargetDummy::ResetDamageEffect()
 	}
 }
 
+void ATargetDummy::OnGameplayEffectAdded(UAbilitySystemComponent* Target, const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle Handle)
+{
+	FlushNetDormancy();
+}
+
+void ATargetDummy::OnGameplayEffectRemoved(const FActiveGameplayEffect& Effect)
+{
+	FlushNetDormancy();
+}
+
 void ATargetDummy::OnHealthChanged(float OldValue, float NewValue)
 {
 	const float HealthDifference = NewValue - OldValue;
 	
-	UE_LOG(LogTemp, Log, TEXT("TargetDummy: Health changed from %.1f to %.1f (diff: %.1f)"), 
+	UE_LOG(LogCombat, VeryVerbose, TEXT("TargetDummy: Health changed from %.1f to %.1f (diff: %.1f)"), 
 		OldValue, NewValue, HealthDifference);
+
+	// Send the new health once, then go back to sleep
+	if (HasAuthority())
+	{
+		FlushNetDormancy();
+	}
 	
 	// Track damage taken
 	if (HealthDifference < 0.0f)
@@ -272,14 +321,14 @@ void ATargetDummy::OnHealthChanged(float OldValue, float NewValue)
 			);
 		}
 		
-		UE_LOG(LogTemp, Warning, TEXT("TargetDummy: Took %.1f damage! Health: %.1f/%.1f (Total: %.1f, Hits: %d)"), 
+		UE_LOG(LogCombat, Verbose, TEXT("TargetDummy: Took %.1f damage! Health: %.1f/%.1f (Total: %.1f, Hits: %d)"), 
 			DamageTaken, NewValue, NewValue, TotalDamageReceived, HitCount);
 	}
 	
 	// Handle death
 	if (NewValue <= 0.0f)
 	{
-		UE_LOG(LogTemp, Error, TEXT("TargetDummy: DESTROYED! Total damage taken: %.1f over %d hits"), 
+		UE_LOG(LogCombat, Error, TEXT("TargetDummy: DESTROYED! Total damage taken: %.1f over %d hits"), 
 			TotalDamageReceived, HitCount);
 		
 		// Reset after a short delay for testing
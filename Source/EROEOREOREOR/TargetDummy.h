@@ -55,6 +55,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	// Components
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
@@ -117,4 +118,8 @@ private:
 
 	// Attribute change callbacks - UE5.6 compatible
 	void OnHealthChanged(float OldValue, float NewValue);
+	
+	// Server only - a dormant dummy must still send effects that do not change health
+	void OnGameplayEffectAdded(UAbilitySystemComponent* Target, const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle Handle);
+	void OnGameplayEffectRemoved(const FActiveGameplayEffect& Effect);
 };
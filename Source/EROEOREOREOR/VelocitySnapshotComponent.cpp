@@ -1,53 +1,325 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "VelocitySnapshotComponent.h"
+#include "CombatStats.h"
+#include "CombatLog.h"
+#include "CombatMemory.h"
+#include "CombatSystemTypes.h"
+#include "CombatLagCompensation.h"
+#include "Components/CapsuleComponent.h"
 #include "Engine/World.h"
+#include "GameFramework/Actor.h"
 #include "GameplayTagsModule.h"
 
+// MOVEMENT HISTORY BUFFER
+
+namespace
+{
+    FORCEINLINE bool QuantizeToInt16(double Value, float Quantum, int16& OutValue)
+    {
+        const int64 Quantized = FMath::RoundToInt64(Value / Quantum);
+        if (Quantized < MIN_int16 || Quantized > MAX_int16)
+        {
+            return false;
+        }
+        OutValue = static_cast<int16>(Quantized);
+        return true;
+    }
+}
+
+void FMovementHistoryBuffer::Start(double InStartTime, float InSampleRate)
+{
+    SampleRate = FMath::Max(InSampleRate, 1.0f);
+    SampleInterval = 1.0 / SampleRate;
+    StartTime = InStartTime;
+    NextFrame = 0;
+    NumFrames = 0;
+}
+
+void FMovementHistoryBuffer::Reset()
+{
+    NextFrame = 0;
+    NumFrames = 0;
+}
+
+bool FMovementHistoryBuffer::Append(const FVector& Location, const FVector& Velocity, float Yaw, EVelocitySource Source)
+{
+    const int64 Frame = NextFrame;
+    const int32 KeyframeSlot = static_cast<int32>((Frame / KEYFRAME_INTERVAL) & (KEYFRAME_SLOTS - 1));
+
+    // Each block of KEYFRAME_INTERVAL frames is delta-encoded against its first frame
+    if (Frame % KEYFRAME_INTERVAL == 0)
+    {
+        Keyframes[KeyframeSlot] = Location;
+    }
+
+    FPackedSample Packed;
+    const FVector Delta = Location - Keyframes[KeyframeSlot];
+    if (!QuantizeToInt16(Delta.X, POSITION_QUANTUM, Packed.PositionDelta[0])
+        || !QuantizeToInt16(Delta.Y, POSITION_QUANTUM, Packed.PositionDelta[1])
+        || !QuantizeToInt16(Delta.Z, POSITION_QUANTUM, Packed.PositionDelta[2]))
+    {
+        // Moved further than a block can encode - only a teleport does this
+        return false;
+    }
+
+    // Velocity saturates instead of failing - anything past the range is far beyond gameplay speeds
+    for (int32 Axis = 0; Axis < 3; ++Axis)
+    {
+        const int64 Quantized = FMath::RoundToInt64(Velocity[Axis] / VELOCITY_QUANTUM);
+        Packed.Velocity[Axis] = static_cast<int16>(FMath::Clamp<int64>(Quantized, MIN_int16, MAX_int16));
+    }
+
+    Packed.Yaw = FRotator::CompressAxisToShort(Yaw);
+    Packed.Source = static_cast<uint8>(Source);
+    Packed.Padding = 0;
+
+    Samples[Frame & (HISTORY_SIZE - 1)] = Packed;
+    ++NextFrame;
+    NumFrames = FMath::Min(NumFrames + 1, HISTORY_SIZE);
+    return true;
+}
+
+bool FMovementHistoryBuffer::GetSampleAtFrame(int64 Frame, FMovementHistorySample& OutSample) const
+{
+    if (NumFrames == 0 || Frame < GetOldestFrame() || Frame > GetNewestFrame())
+    {
+        return false;
+    }
+
+    const FPackedSample& Packed = Samples[Frame & (HISTORY_SIZE - 1)];
+    const FVector& Keyframe = Keyframes[(Frame / KEYFRAME_INTERVAL) & (KEYFRAME_SLOTS - 1)];
+
+    OutSample.Location = Keyframe + FVector(Packed.PositionDelta[0], Packed.PositionDelta[1], Packed.PositionDelta[2]) * POSITION_QUANTUM;
+    OutSample.Velocity = FVector(Packed.Velocity[0], Packed.Velocity[1], Packed.Velocity[2]) * VELOCITY_QUANTUM;
+    OutSample.Yaw = FRotator::DecompressAxisFromShort(Packed.Yaw);
+    OutSample.Source = static_cast<EVelocitySource>(Packed.Source);
+    OutSample.Time = GetFrameTime(Frame);
+    return true;
+}
+
+EVelocitySource FMovementHistoryBuffer::GetSourceAtFrame(int64 Frame) const
+{
+    if (NumFrames == 0 || Frame < GetOldestFrame() || Frame > GetNewestFrame())
+    {
+        return EVelocitySource::None;
+    }
+    return static_cast<EVelocitySource>(Samples[Frame & (HISTORY_SIZE - 1)].Source);
+}
+
+bool FMovementHistoryBuffer::GetSampleAtTime(double Time, FMovementHistorySample& OutSample) const
+{
+    if (NumFrames == 0)
+    {
+        return false;
+    }
+
+    const double FrameFloat = (Time - StartTime) * SampleRate;
+    const int64 FrameA = static_cast<int64>(FMath::FloorToDouble(FrameFloat));
+    if (FrameA < GetOldestFrame() || FrameA > GetNewestFrame())
+    {
+        return false;
+    }
+
+    FMovementHistorySample SampleA;
+    GetSampleAtFrame(FrameA, SampleA);
+
+    FMovementHistorySample SampleB;
+    if (!GetSampleAtFrame(FrameA + 1, SampleB))
+    {
+        // Exactly on (or just past) the newest frame
+        OutSample = SampleA;
+        OutSample.Time = Time;
+        return true;
+    }
+
+    const float Alpha = static_cast<float>(FrameFloat - static_cast<double>(FrameA));
+    OutSample.Location = FMath::Lerp(SampleA.Location, SampleB.Location, Alpha);
+    OutSample.Velocity = FMath::Lerp(SampleA.Velocity, SampleB.Velocity, Alpha);
+    OutSample.Yaw = FRotator::NormalizeAxis(SampleA.Yaw + FMath::FindDeltaAngleDegrees(SampleA.Yaw, SampleB.Yaw) * Alpha);
+    OutSample.Source = Alpha < 0.5f ? SampleA.Source : SampleB.Source;
+    OutSample.Time = Time;
+    return true;
+}
+
+// COMPONENT
+
 UVelocitySnapshotComponent::UVelocitySnapshotComponent()
 {
-    // CRITICAL PERFORMANCE FIX: Start with ticking DISABLED
+    // History is sampled after movement has run for the frame
     PrimaryComponentTick.bCanEverTick = true;
-    PrimaryComponentTick.bStartWithTickEnabled = false;
+    PrimaryComponentTick.bStartWithTickEnabled = true;
+    PrimaryComponentTick.TickGroup = TG_PostPhysics;
     
     DefaultValidityDuration = 0.2f;
     bLogSnapshots = false;
-    
-    // Initialize ring buffer state
-    CurrentIndex = 0;
-    ValidCount = 0;
 }
 
 void UVelocitySnapshotComponent::BeginPlay()
 {
     Super::BeginPlay();
     
-    // PERFORMANCE OPTIMIZATION: Start disabled, enable only when needed
-    SetComponentTickEnabled(false);
+    // PERFORMANCE OPTIMIZATION: Snapshot expiry is checked on read, so only history recording needs a tick
+    SetComponentTickEnabled(bRecordMovementHistory);
+    ResetMovementHistory();
+    
+    // Server rewinds the owner's capsule through this history for lag-compensated hit checks
+    AActor* Owner = GetOwner();
+    const UCapsuleComponent* Capsule = Owner ? Cast<UCapsuleComponent>(Owner->GetRootComponent()) : nullptr;
+    if (Capsule && bRecordMovementHistory && Owner->HasAuthority())
+    {
+        if (UCombatLagCompensationSubsystem* LagCompensation = UCombatLagCompensationSubsystem::Get(GetWorld()))
+        {
+            LagCompensation->RegisterHurtVolume(Owner, this, Capsule->GetScaledCapsuleRadius(), Capsule->GetScaledCapsuleHalfHeight());
+        }
+    }
     
-    // Pre-allocate cache maps to avoid rehashing
-    SourceIndexCache.Reserve(static_cast<int32>(EVelocitySource::External) + 1);
-    TagIndexCache.Reserve(MAX_SNAPSHOTS);
+    UE_LOG(LogCombat, Verbose, TEXT("VelocitySnapshotComponent: Initialized, movement history %s (%d frames at %.0f Hz)"),
+        bRecordMovementHistory ? TEXT("enabled") : TEXT("disabled"),
+        FMovementHistoryBuffer::HISTORY_SIZE, CombatConstants::TARGET_FRAMERATE);
+}
+
+void UVelocitySnapshotComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UCombatLagCompensationSubsystem* LagCompensation = UCombatLagCompensationSubsystem::Get(GetWorld()))
+    {
+        LagCompensation->UnregisterHurtVolume(GetOwner());
+    }
     
-    UE_LOG(LogTemp, Log, TEXT("VelocitySnapshotComponent: Initialized with conditional ticking"));
+    Super::EndPlay(EndPlayReason);
 }
 
 void UVelocitySnapshotComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
     
-    // PERFORMANCE OPTIMIZATION: Efficient cleanup without array operations
-    OptimizedCleanup();
-    
-    // CRITICAL PERFORMANCE FIX: Disable ticking when no valid snapshots remain
-    if (ValidCount == 0)
+    RecordMovementHistory();
+}
+
+void UVelocitySnapshotComponent::RecordMovementHistory()
+{
+    COMBAT_SCOPE(MovementHistory);
+
+    const AActor* Owner = GetOwner();
+    const UWorld* World = GetWorld();
+    if (!Owner || !World)
+    {
+        return;
+    }
+
+    const double Now = World->GetTimeSeconds();
+    const FVector Location = Owner->GetActorLocation();
+    const FVector Velocity = Owner->GetVelocity();
+    const float Yaw = Owner->GetActorRotation().Yaw;
+
+    if (MovementHistory.IsEmpty())
+    {
+        RestartMovementHistory(Now, Location, Velocity, Yaw);
+        return;
+    }
+
+    // A hitch longer than the whole buffer leaves nothing worth interpolating
+    const int64 FramesDue = static_cast<int64>((Now - MovementHistory.GetFrameTime(MovementHistory.GetNextFrame())) * MovementHistory.GetSampleRate()) + 1;
+    if (FramesDue > FMovementHistoryBuffer::HISTORY_SIZE)
+    {
+        RestartMovementHistory(Now, Location, Velocity, Yaw);
+        return;
+    }
+
+    const double TickSpan = Now - PreviousTime;
+    double FrameTime = MovementHistory.GetFrameTime(MovementHistory.GetNextFrame());
+    while (FrameTime <= Now)
+    {
+        const float Alpha = TickSpan > UE_DOUBLE_SMALL_NUMBER ? static_cast<float>((FrameTime - PreviousTime) / TickSpan) : 1.0f;
+        const FVector FrameLocation = FMath::Lerp(PreviousLocation, Location, Alpha);
+        const FVector FrameVelocity = FMath::Lerp(PreviousVelocity, Velocity, Alpha);
+        const float FrameYaw = FRotator::NormalizeAxis(PreviousYaw + FMath::FindDeltaAngleDegrees(PreviousYaw, Yaw) * Alpha);
+
+        if (!MovementHistory.Append(FrameLocation, FrameVelocity, FrameYaw, PendingHistorySource))
+        {
+            // Teleport - the old history no longer describes a continuous path
+            RestartMovementHistory(Now, Location, Velocity, Yaw);
+            return;
+        }
+
+        PendingHistorySource = EVelocitySource::None;
+        FrameTime = MovementHistory.GetFrameTime(MovementHistory.GetNextFrame());
+    }
+
+    PreviousLocation = Location;
+    PreviousVelocity = Velocity;
+    PreviousYaw = Yaw;
+    PreviousTime = Now;
+}
+
+void UVelocitySnapshotComponent::RestartMovementHistory(double Now, const FVector& Location, const FVector& Velocity, float Yaw)
+{
+    MovementHistory.Start(Now, CombatConstants::TARGET_FRAMERATE);
+    MovementHistory.Append(Location, Velocity, Yaw, PendingHistorySource);
+    PendingHistorySource = EVelocitySource::None;
+
+    PreviousLocation = Location;
+    PreviousVelocity = Velocity;
+    PreviousYaw = Yaw;
+    PreviousTime = Now;
+}
+
+void UVelocitySnapshotComponent::ResetMovementHistory()
+{
+    MovementHistory.Reset();
+    PendingHistorySource = EVelocitySource::None;
+}
+
+bool UVelocitySnapshotComponent::GetHistorySampleAtTime(double Time, FMovementHistorySample& OutSample) const
+{
+    return MovementHistory.GetSampleAtTime(Time, OutSample);
+}
+
+bool UVelocitySnapshotComponent::GetHistorySampleAtFrame(int64 Frame, FMovementHistorySample& OutSample) const
+{
+    return MovementHistory.GetSampleAtFrame(Frame, OutSample);
+}
+
+bool UVelocitySnapshotComponent::GetHistoryMomentum(FVelocitySnapshot& OutSnapshot) const
+{
+    if (MovementHistory.IsEmpty())
+    {
+        return false;
+    }
+
+    // Only frames young enough to still be valid - a dozen source bytes at 60 Hz, newest first
+    const int64 NewestFrame = MovementHistory.GetNewestFrame();
+    const int64 OldestFrame = FMath::Max(MovementHistory.GetOldestFrame(),
+        NewestFrame - FMath::CeilToInt(DefaultValidityDuration * MovementHistory.GetSampleRate()));
+
+    for (int64 Frame = NewestFrame; Frame >= OldestFrame; --Frame)
     {
-        SetComponentTickEnabled(false);
-        if (bLogSnapshots)
+        if (MovementHistory.GetSourceAtFrame(Frame) == EVelocitySource::None)
         {
-            UE_LOG(LogTemp, VeryVerbose, TEXT("VelocitySnapshot: Disabled ticking - no valid snapshots"));
+            continue;
         }
+
+        FMovementHistorySample Sample;
+        MovementHistory.GetSampleAtFrame(Frame, Sample);
+
+        FVelocitySnapshot Snapshot(Sample.Velocity, Sample.Source, FGameplayTag());
+        Snapshot.Timestamp = static_cast<float>(Sample.Time);
+        Snapshot.ValidityDuration = DefaultValidityDuration;
+        if (!Snapshot.IsValid(GetCurrentTime()))
+        {
+            return false;
+        }
+
+        OutSnapshot = Snapshot;
+        return true;
     }
+    return false;
+}
+
+float UVelocitySnapshotComponent::GetCurrentTime() const
+{
+    const UWorld* World = GetWorld();
+    return World ? World->GetTimeSeconds() : 0.0f;
 }
 
 void UVelocitySnapshotComponent::CaptureSnapshot(const FVector& Velocity, EVelocitySource Source, const FGameplayTag& SourceTag)
@@ -58,43 +330,38 @@ void UVelocitySnapshotComponent::CaptureSnapshot(const FVector& Velocity, EVeloc
         return;
     }
 
-    // Create snapshot using ring buffer - NO ALLOCATIONS
-    FVelocitySnapshot& NewSnapshot = SnapshotRingBuffer[CurrentIndex];
+    // Overwrite this source's slot - NO ALLOCATIONS, no index caches to maintain
+    FVelocitySnapshot& NewSnapshot = SourceSnapshots[static_cast<int32>(Source)];
     NewSnapshot = FVelocitySnapshot(Velocity, Source, SourceTag);
-    NewSnapshot.Timestamp = GetWorld()->GetTimeSeconds();
+    NewSnapshot.Timestamp = GetCurrentTime();
     NewSnapshot.ValidityDuration = DefaultValidityDuration;
 
-    // Update caches for O(1) lookups
-    SourceIndexCache.Add(Source, CurrentIndex);
-    TagIndexCache.Add(SourceTag, CurrentIndex);
-
-    // Advance ring buffer
-    CurrentIndex = (CurrentIndex + 1) % MAX_SNAPSHOTS;
-    ValidCount = FMath::Min(ValidCount + 1, MAX_SNAPSHOTS);
-
-    // CRITICAL PERFORMANCE FIX: Enable ticking only when we have data
-    if (!IsComponentTickEnabled())
-    {
-        SetComponentTickEnabled(true);
-        if (bLogSnapshots)
-        {
-            UE_LOG(LogTemp, VeryVerbose, TEXT("VelocitySnapshot: Enabled ticking"));
-        }
-    }
+    // Tag the next history frame with the momentum source
+    PendingHistorySource = Source;
 
     if (bLogSnapshots)
     {
-        UE_LOG(LogTemp, Log, TEXT("VelocitySnapshot: Captured %s velocity: %.1f units/s"), 
+        UE_LOG(LogCombat, VeryVerbose, TEXT("VelocitySnapshot: Captured %s velocity: %.1f units/s"), 
             *SourceTag.ToString(), NewSnapshot.Speed);
     }
 }
 
 bool UVelocitySnapshotComponent::GetLatestSnapshot(FVelocitySnapshot& OutSnapshot) const
 {
-    const int32 RecentIndex = GetMostRecentValidIndex();
-    if (RecentIndex != INDEX_NONE)
+    const float CurrentTime = GetCurrentTime();
+    const FVelocitySnapshot* Latest = nullptr;
+
+    for (const FVelocitySnapshot& Snapshot : SourceSnapshots)
+    {
+        if (Snapshot.IsValid(CurrentTime) && (!Latest || Snapshot.Timestamp > Latest->Timestamp))
+        {
+            Latest = &Snapshot;
+        }
+    }
+
+    if (Latest)
     {
-        OutSnapshot = SnapshotRingBuffer[RecentIndex];
+        OutSnapshot = *Latest;
         return true;
     }
     return false;
@@ -102,26 +369,23 @@ bool UVelocitySnapshotComponent::GetLatestSnapshot(FVelocitySnapshot& OutSnapsho
 
 bool UVelocitySnapshotComponent::GetSnapshotBySource(EVelocitySource Source, FVelocitySnapshot& OutSnapshot) const
 {
-    // PERFORMANCE OPTIMIZATION: O(1) lookup via cache
-    if (const int32* IndexPtr = SourceIndexCache.Find(Source))
+    // PERFORMANCE OPTIMIZATION: Direct slot index
+    const FVelocitySnapshot& Snapshot = SourceSnapshots[static_cast<int32>(Source)];
+    if (Snapshot.IsValid(GetCurrentTime()))
     {
-        const FVelocitySnapshot& Snapshot = SnapshotRingBuffer[*IndexPtr];
-        if (Snapshot.IsValid(GetWorld()->GetTimeSeconds()))
-        {
-            OutSnapshot = Snapshot;
-            return true;
-        }
+        OutSnapshot = Snapshot;
+        return true;
     }
     return false;
 }
 
 bool UVelocitySnapshotComponent::GetSnapshotByTag(const FGameplayTag& SourceTag, FVelocitySnapshot& OutSnapshot) const
 {
-    // PERFORMANCE OPTIMIZATION: O(1) lookup via cache
-    if (const int32* IndexPtr = TagIndexCache.Find(SourceTag))
+    // PERFORMANCE OPTIMIZATION: NUM_VELOCITY_SOURCES slots - a linear scan beats hashing
+    const float CurrentTime = GetCurrentTime();
+    for (const FVelocitySnapshot& Snapshot : SourceSnapshots)
     {
-        const FVelocitySnapshot& Snapshot = SnapshotRingBuffer[*IndexPtr];
-        if (Snapshot.IsValid(GetWorld()->GetTimeSeconds()))
+        if (Snapshot.SourceTag == SourceTag && Snapshot.IsValid(CurrentTime))
         {
             OutSnapshot = Snapshot;
             return true;
@@ -132,60 +396,61 @@ bool UVelocitySnapshotComponent::GetSnapshotByTag(const FGameplayTag& SourceTag,
 
 void UVelocitySnapshotComponent::ClearAllSnapshots()
 {
-    // Reset ring buffer state - no memory operations needed
-    ValidCount = 0;
-    CurrentIndex = 0;
-    
-    // Clear caches
-    SourceIndexCache.Empty();
-    TagIndexCache.Empty();
-    
-    // Disable ticking since we have no data
-    if (IsComponentTickEnabled())
+    for (FVelocitySnapshot& Snapshot : SourceSnapshots)
     {
-        SetComponentTickEnabled(false);
+        Snapshot = FVelocitySnapshot();
     }
+    PendingHistorySource = EVelocitySource::None;
     
     if (bLogSnapshots)
     {
-        UE_LOG(LogTemp, Log, TEXT("VelocitySnapshot: Cleared all snapshots"));
+        UE_LOG(LogCombat, Verbose, TEXT("VelocitySnapshot: Cleared all snapshots"));
     }
 }
 
 void UVelocitySnapshotComponent::LogCurrentSnapshots() const
 {
-    UE_LOG(LogTemp, Warning, TEXT("=== VELOCITY SNAPSHOTS ==="));
-    UE_LOG(LogTemp, Warning, TEXT("Valid Count: %d/%d"), ValidCount, MAX_SNAPSHOTS);
-    UE_LOG(LogTemp, Warning, TEXT("Current Index: %d"), CurrentIndex);
-    UE_LOG(LogTemp, Warning, TEXT("Ticking Enabled: %s"), IsComponentTickEnabled() ? TEXT("true") : TEXT("false"));
+    UE_LOG(LogCombat, Warning, TEXT("=== VELOCITY SNAPSHOTS ==="));
+    UE_LOG(LogCombat, Warning, TEXT("Valid Count: %d/%d"), GetValidSnapshotCount(), NUM_VELOCITY_SOURCES);
+    UE_LOG(LogCombat, Warning, TEXT("Ticking Enabled: %s"), IsComponentTickEnabled() ? TEXT("true") : TEXT("false"));
     
-    const float CurrentTime = GetWorld()->GetTimeSeconds();
+    const float CurrentTime = GetCurrentTime();
     
-    for (int32 i = 0; i < ValidCount; ++i)
+    for (int32 Index = 0; Index < NUM_VELOCITY_SOURCES; ++Index)
     {
-        const int32 Index = (CurrentIndex - ValidCount + i + MAX_SNAPSHOTS) % MAX_SNAPSHOTS;
-        const FVelocitySnapshot& Snapshot = SnapshotRingBuffer[Index];
+        const FVelocitySnapshot& Snapshot = SourceSnapshots[Index];
+        if (Snapshot.Speed <= 0.0f)
+        {
+            continue;
+        }
         
-        UE_LOG(LogTemp, Warning, TEXT("  [%d] Source: %d, Speed: %.1f, Valid: %s, Age: %.3fs"),
+        UE_LOG(LogCombat, Warning, TEXT("  [%d] Source: %d, Speed: %.1f, Valid: %s, Age: %.3fs"),
             Index,
             static_cast<int32>(Snapshot.Source),
             Snapshot.Speed,
             Snapshot.IsValid(CurrentTime) ? TEXT("YES") : TEXT("NO"),
             CurrentTime - Snapshot.Timestamp);
     }
+
+    if (!MovementHistory.IsEmpty())
+    {
+        UE_LOG(LogCombat, Warning, TEXT("History: frames %lld..%lld (%.2fs at %.0f Hz, %d bytes)"),
+            MovementHistory.GetOldestFrame(), MovementHistory.GetNewestFrame(),
+            (MovementHistory.GetNewestFrame() - MovementHistory.GetOldestFrame()) / MovementHistory.GetSampleRate(),
+            MovementHistory.GetSampleRate(), static_cast<int32>(sizeof(FMovementHistoryBuffer)));
+    }
     
-    UE_LOG(LogTemp, Warning, TEXT("========================"));
+    UE_LOG(LogCombat, Warning, TEXT("========================"));
 }
 
 int32 UVelocitySnapshotComponent::GetValidSnapshotCount() const
 {
-    const float CurrentTime = GetWorld()->GetTimeSeconds();
+    const float CurrentTime = GetCurrentTime();
     int32 Count = 0;
     
-    for (int32 i = 0; i < ValidCount; ++i)
+    for (const FVelocitySnapshot& Snapshot : SourceSnapshots)
     {
-        const int32 Index = (CurrentIndex - ValidCount + i + MAX_SNAPSHOTS) % MAX_SNAPSHOTS;
-        if (SnapshotRingBuffer[Index].IsValid(CurrentTime))
+        if (Snapshot.IsValid(CurrentTime))
         {
             Count++;
         }
@@ -199,72 +464,10 @@ bool UVelocitySnapshotComponent::HasValidSnapshots() const
     return GetValidSnapshotCount() > 0;
 }
 
-void UVelocitySnapshotComponent::OptimizedCleanup()
-{
-    const float CurrentTime = GetWorld()->GetTimeSeconds();
-    int32 ExpiredCount = 0;
-    
-    // Check all valid entries in ring buffer
-    for (int32 i = 0; i < ValidCount; ++i)
-    {
-        const int32 Index = (CurrentIndex - ValidCount + i + MAX_SNAPSHOTS) % MAX_SNAPSHOTS;
-        const FVelocitySnapshot& Snapshot = SnapshotRingBuffer[Index];
-        
-        if (!Snapshot.IsValid(CurrentTime))
-        {
-            // Remove from caches
-            SourceIndexCache.Remove(Snapshot.Source);
-            TagIndexCache.Remove(Snapshot.SourceTag);
-            ExpiredCount++;
-        }
-    }
-    
-    if (ExpiredCount > 0)
-    {
-        ValidCount = FMath::Max(0, ValidCount - ExpiredCount);
-        UpdateCaches(); // Rebuild caches for remaining valid entries
-        
-        if (bLogSnapshots)
-        {
-            UE_LOG(LogTemp, VeryVerbose, TEXT("VelocitySnapshot: Cleaned %d expired snapshots"), ExpiredCount);
-        }
-    }
-}
-
-void UVelocitySnapshotComponent::UpdateCaches()
-{
-    // Rebuild caches for all valid entries
-    SourceIndexCache.Empty();
-    TagIndexCache.Empty();
-    
-    const float CurrentTime = GetWorld()->GetTimeSeconds();
-    
-    for (int32 i = 0; i < ValidCount; ++i)
-    {
-        const int32 Index = (CurrentIndex - ValidCount + i + MAX_SNAPSHOTS) % MAX_SNAPSHOTS;
-        const FVelocitySnapshot& Snapshot = SnapshotRingBuffer[Index];
-        
-        if (Snapshot.IsValid(CurrentTime))
-        {
-            SourceIndexCache.Add(Snapshot.Source, Index);
-            TagIndexCache.Add(Snapshot.SourceTag, Index);
-        }
-    }
-}
+// MEMORY ACCOUNTING
 
-int32 UVelocitySnapshotComponent::GetMostRecentValidIndex() const
+void UVelocitySnapshotComponent::GetCombatMemoryUsage(FCombatMemoryUsage& OutUsage) const
 {
-    const float CurrentTime = GetWorld()->GetTimeSeconds();
-    
-    // Search backwards from most recent
-    for (int32 i = ValidCount - 1; i >= 0; --i)
-    {
-        const int32 Index = (CurrentIndex - ValidCount + i + MAX_SNAPSHOTS) % MAX_SNAPSHOTS;
-        if (SnapshotRingBuffer[Index].IsValid(CurrentTime))
-        {
-            return Index;
-        }
-    }
-    
-    return INDEX_NONE;
+    // Snapshot slots and the movement history are inline - nothing on the heap
+    OutUsage.Add(ECombatMemoryCategory::Runtime, sizeof(*this));
 }
@@ -6,6 +6,7 @@
 #include "Components/ActorComponent.h"
 #include "GameplayTagContainer.h"
 #include "Engine/Engine.h"
+#include "CombatMemory.h"
 #include "VelocitySnapshotComponent.generated.h"
 
 UENUM(BlueprintType)
@@ -64,21 +65,114 @@ struct EROEOREOREOR_API FVelocitySnapshot
 };
 
 /**
- * PERFORMANCE-OPTIMIZED Component for capturing and managing velocity snapshots
+ * One decoded movement history sample
+ */
+USTRUCT(BlueprintType)
+struct EROEOREOREOR_API FMovementHistorySample
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Movement History")
+    FVector Location = FVector::ZeroVector;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Movement History")
+    FVector Velocity = FVector::ZeroVector;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Movement History")
+    float Yaw = 0.0f;
+
+    // Momentum source captured during this sample interval (Dash while PhysDash feeds the combo)
+    UPROPERTY(BlueprintReadOnly, Category = "Movement History")
+    EVelocitySource Source = EVelocitySource::None;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Movement History")
+    double Time = 0.0;
+};
+
+/**
+ * Fixed-rate compressed transform/velocity history
+ * HISTORY_SIZE samples at the combat frame rate (~1.07 s at 60 Hz), 16 bytes per sample.
+ * Positions are quantized to POSITION_QUANTUM and stored as int16 deltas from a keyframe written
+ * every KEYFRAME_INTERVAL frames, so any frame decodes in O(1) from its own keyframe.
+ * Frames are absolute (frame 0 = first sample after Start), time = StartTime + Frame / SampleRate.
+ */
+class EROEOREOREOR_API FMovementHistoryBuffer
+{
+public:
+    static constexpr int32 HISTORY_SIZE = 64;
+    static constexpr int32 KEYFRAME_INTERVAL = 16;
+    static constexpr int32 KEYFRAME_SLOTS = 8;
+    static constexpr float POSITION_QUANTUM = 0.1f;
+    static constexpr float VELOCITY_QUANTUM = 0.5f;
+
+    static_assert((HISTORY_SIZE & (HISTORY_SIZE - 1)) == 0, "HISTORY_SIZE must be a power of two");
+    static_assert((KEYFRAME_SLOTS & (KEYFRAME_SLOTS - 1)) == 0, "KEYFRAME_SLOTS must be a power of two");
+    static_assert(KEYFRAME_SLOTS > HISTORY_SIZE / KEYFRAME_INTERVAL, "Keyframes must outlive the samples that reference them");
+
+    // Discard everything and restart the frame clock
+    void Start(double InStartTime, float InSampleRate);
+    void Reset();
+
+    // Appends the next frame. False when the sample cannot be encoded (teleport) - caller restarts the history.
+    bool Append(const FVector& Location, const FVector& Velocity, float Yaw, EVelocitySource Source);
+
+    bool IsEmpty() const { return NumFrames == 0; }
+    int64 GetNewestFrame() const { return NextFrame - 1; }
+    int64 GetOldestFrame() const { return NextFrame - NumFrames; }
+    int64 GetNextFrame() const { return NextFrame; }
+    double GetFrameTime(int64 Frame) const { return StartTime + static_cast<double>(Frame) * SampleInterval; }
+    float GetSampleRate() const { return SampleRate; }
+
+    // O(1) - exact frame
+    bool GetSampleAtFrame(int64 Frame, FMovementHistorySample& OutSample) const;
+
+    // O(1) - source tag of a frame without decoding it, None outside the buffer
+    EVelocitySource GetSourceAtFrame(int64 Frame) const;
+
+    // O(1) - interpolated between the two frames bracketing Time
+    bool GetSampleAtTime(double Time, FMovementHistorySample& OutSample) const;
+
+private:
+    struct FPackedSample
+    {
+        int16 PositionDelta[3];
+        int16 Velocity[3];
+        uint16 Yaw;
+        uint8 Source;
+        uint8 Padding;
+    };
+    static_assert(sizeof(FPackedSample) == 16, "History samples are expected to pack to 16 bytes");
+
+    FPackedSample Samples[HISTORY_SIZE];
+    FVector Keyframes[KEYFRAME_SLOTS];
+
+    double StartTime = 0.0;
+    double SampleInterval = 1.0 / 60.0;
+    float SampleRate = 60.0f;
+    int64 NextFrame = 0;
+    int32 NumFrames = 0;
+};
+
+/**
+ * Per-character velocity history and dash-bounce momentum snapshots
  * Features:
- * - Conditional ticking (only when snapshots exist)
- * - Fixed-size ring buffer (zero allocations)
- * - O(1) lookups via cached indices
- * - Automatic cleanup without expensive array operations
+ * - Continuous fixed-rate movement history (FMovementHistoryBuffer) for momentum, lag compensation and replay
+ * - Bounce momentum comes from source-tagged history frames (GetHistoryMomentum) - dash tags them via MarkHistorySource
+ * - Registers the owner's capsule as a lag-compensated hurt volume on the server
+ * - One snapshot slot per EVelocitySource for Blueprint captures - O(1) lookups without hash maps, expiry checked on read
+ * - Zero allocations after construction
  */
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent), BlueprintType)
-class EROEOREOREOR_API UVelocitySnapshotComponent : public UActorComponent
+class EROEOREOREOR_API UVelocitySnapshotComponent : public UActorComponent, public ICombatMemoryReporter
 {
     GENERATED_BODY()
 
 public:
     UVelocitySnapshotComponent();
 
+    // Snapshot slots and the movement history ring are fixed-size members - reports sizeof only, so no GetResourceSizeEx
+    virtual void GetCombatMemoryUsage(FCombatMemoryUsage& OutUsage) const override;
+
     // Core API - Blueprint accessible for design iteration
     UFUNCTION(BlueprintCallable, Category = "Velocity Snapshot")
     void CaptureSnapshot(const FVector& Velocity, EVelocitySource Source, const FGameplayTag& SourceTag);
@@ -95,11 +189,35 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Velocity Snapshot")
     void ClearAllSnapshots();
 
+    // MOVEMENT HISTORY - interpolated transform/velocity over the last ~1 s
+    UFUNCTION(BlueprintCallable, Category = "Velocity Snapshot|History", BlueprintPure)
+    bool GetHistorySampleAtTime(double Time, FMovementHistorySample& OutSample) const;
+
+    UFUNCTION(BlueprintCallable, Category = "Velocity Snapshot|History", BlueprintPure)
+    bool GetHistorySampleAtFrame(int64 Frame, FMovementHistorySample& OutSample) const;
+
+    // Newest source-tagged history frame within DefaultValidityDuration, as a momentum snapshot
+    UFUNCTION(BlueprintCallable, Category = "Velocity Snapshot|History", BlueprintPure)
+    bool GetHistoryMomentum(FVelocitySnapshot& OutSnapshot) const;
+
+    // Tags the next history frame with a momentum source without writing a snapshot slot -
+    // cheap enough for movement modes to call every frame
+    void MarkHistorySource(EVelocitySource Source) { PendingHistorySource = Source; }
+
+    const FMovementHistoryBuffer& GetMovementHistory() const { return MovementHistory; }
+
+    UFUNCTION(BlueprintCallable, Category = "Velocity Snapshot|History")
+    void ResetMovementHistory();
+
     // Configuration - Exposed for tuning in engine
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Velocity Snapshot",
         meta = (ClampMin = "0.05", ClampMax = "1.0", UIMin = "0.1", UIMax = "0.5"))
     float DefaultValidityDuration = 0.2f;
 
+    // Disable on actors that never need momentum history - stops the component ticking entirely
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Velocity Snapshot|History")
+    bool bRecordMovementHistory = true;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Velocity Snapshot|Debug")
     bool bLogSnapshots = false;
 
@@ -115,22 +233,28 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 private:
-    // PERFORMANCE OPTIMIZATION: Fixed-size ring buffer eliminates allocations
-    static constexpr int32 MAX_SNAPSHOTS = 8;
-    FVelocitySnapshot SnapshotRingBuffer[MAX_SNAPSHOTS];
-    int32 CurrentIndex = 0;
-    int32 ValidCount = 0;
-    
-    // PERFORMANCE OPTIMIZATION: O(1) lookups via cached indices
-    TMap<EVelocitySource, int32> SourceIndexCache;
-    
-    // PERFORMANCE OPTIMIZATION: Cached GameplayTag handles for fast comparison
-    mutable TMap<FGameplayTag, int32> TagIndexCache;
-    
-    void OptimizedCleanup();
-    void UpdateCaches();
-    int32 GetMostRecentValidIndex() const;
+    // Fixed-rate samples between the previous and current tick, interpolated to their nominal frame times
+    void RecordMovementHistory();
+    void RestartMovementHistory(double Now, const FVector& Location, const FVector& Velocity, float Yaw);
+
+    // PERFORMANCE OPTIMIZATION: One slot per source replaces the snapshot ring and its TMap index caches
+    static constexpr int32 NUM_VELOCITY_SOURCES = static_cast<int32>(EVelocitySource::External) + 1;
+    FVelocitySnapshot SourceSnapshots[NUM_VELOCITY_SOURCES];
+
+    FMovementHistoryBuffer MovementHistory;
+
+    // State at the previous tick - history frames between ticks are interpolated from it
+    FVector PreviousLocation = FVector::ZeroVector;
+    FVector PreviousVelocity = FVector::ZeroVector;
+    float PreviousYaw = 0.0f;
+    double PreviousTime = 0.0;
+
+    // Source captured since the last history frame
+    EVelocitySource PendingHistorySource = EVelocitySource::None;
+
+    float GetCurrentTime() const;
 };
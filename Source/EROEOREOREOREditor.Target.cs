@@ -10,6 +10,10 @@ public class EROEOREOREOREditorTarget : TargetRules
 		Type = TargetType.Editor;
 		DefaultBuildSettings = BuildSettingsVersion.V5;
 
+		// Same replication as the game target, so PIE and the networked automation tests exercise push model too
+		bWithPushModel = true;
+		BuildEnvironment = TargetBuildEnvironment.Unique;
+
 		ExtraModuleNames.AddRange( new string[] { "EROEOREOREOR" } );
 	}
 }
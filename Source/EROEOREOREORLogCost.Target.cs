@@ -0,0 +1,23 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+using UnrealBuildTool;
+using System.Collections.Generic;
+
+// Game build with every combat log call compiled in - run Combat.Bench.LogCost here to see the cost the default ceiling strips
+public class EROEOREOREORLogCostTarget : TargetRules
+{
+	public EROEOREOREORLogCostTarget(TargetInfo Target) : base(Target)
+	{
+		Type = TargetType.Game;
+		DefaultBuildSettings = BuildSettingsVersion.V5;
+
+		// Same push model environment as the game target
+		bWithPushModel = true;
+		BuildEnvironment = TargetBuildEnvironment.Unique;
+
+		// Dash/Bounce/AoE ceilings default to the combat one (CombatLog.h)
+		GlobalDefinitions.Add("COMBAT_LOG_COMPILE_VERBOSITY=All");
+
+		ExtraModuleNames.AddRange( new string[] { "EROEOREOREOR" } );
+	}
+}